@@ -204,6 +204,14 @@ static inline tcg_target_ulong cpu_tb_exec(CPUState *cpu, TranslationBlock *itb)
     if (execute_llvm) {
         assert(itb->llvm_tc_ptr);
         ret = tcg_llvm_qemu_tb_exec(env, itb);
+        // a trace may have gone on to run other blocks after itb
+        itb = tcg_llvm_runtime.last_tb;
+        if (ret == TB_EXIT_REQUESTED) {
+            // a trace stopped before a block, see tcg_llvm_trace_next()
+            cpu->can_do_io = 1;
+            atomic_set(&cpu->tcg_exit_req, 0);
+            return TB_EXIT_REQUESTED;
+        }
     } else {
         assert(tb_ptr);
         ret = tcg_qemu_tb_exec(env, tb_ptr);
@@ -220,6 +228,10 @@ static inline tcg_target_ulong cpu_tb_exec(CPUState *cpu, TranslationBlock *itb)
 
     /* force into variable of known size */
     exitCode = (uint8_t)tb_exit;
+    panda_callbacks_mem_batch_flush(cpu);
+    // the block may have written memory the guest instruction count at its
+    // last instruction doesn't tell about
+    panda_mem_cache_invalidate();
     panda_callbacks_after_block_exec(cpu, itb, exitCode);
 
     trace_exec_tb_exit(last_tb, tb_exit);
@@ -389,6 +401,77 @@ static TranslationBlock *tb_htable_lookup(CPUState *cpu,
     return qht_lookup(&tcg_ctx.tb_ctx.htable, tb_cmp, &desc, h);
 }
 
+#if defined(CONFIG_LLVM)
+/*
+ * Called by LLVM traces (see TCGLLVMTier2) between two of their blocks:
+ * prev_ret was returned by the block that just ran, and next is the block
+ * the trace goes on with. Returns 0 after doing what cpu_tb_exec() and the
+ * main loop would do between the two blocks, if next is the block the main
+ * loop would run and nothing needs the main loop first. Otherwise nothing is
+ * done and the trace returns the value returned here to cpu_tb_exec().
+ */
+uintptr_t tcg_llvm_trace_next(CPUArchState *env, uintptr_t prev_ret,
+                              TranslationBlock *next)
+{
+    CPUState *cpu = ENV_GET_CPU(env);
+    target_ulong pc, cs_base;
+    uint32_t flags;
+
+    // before_block_exec_invalidate_opt callbacks are left to the main loop,
+    // which runs them once, after after_block_exec for the previous block
+    if ((prev_ret & TB_EXIT_MASK) > TB_EXIT_IDX1 || panda_exit_loop ||
+        atomic_read(&cpu->exit_request) || atomic_read(&cpu->tcg_exit_req) ||
+        cpu->interrupt_request || cpu->singlestep_enabled ||
+        cpu->temp_rr_bp_instr || panda_plugin_to_unload ||
+        panda_please_flush_tb || rr_in_record() ||
+        panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT] != NULL ||
+        qemu_loglevel_mask(CPU_LOG_EXEC | CPU_LOG_TB_CPU | CPU_LOG_RR)) {
+        return prev_ret;
+    }
+
+#ifdef CONFIG_SOFTMMU
+    if (rr_in_replay()) {
+        // nothing may be due in the log before next runs, and next must
+        // not need to be split for an interrupt
+        RR_log_entry *head = rr_get_queue_head();
+        uint64_t until_interrupt = rr_num_instr_before_next_interrupt();
+        if (head == NULL || rr_replay_finished() ||
+            head->header.prog_point.guest_instr_count <=
+                rr_get_guest_instr_count() ||
+            until_interrupt == 0 || next->icount > until_interrupt) {
+            return prev_ret;
+        }
+    }
+#endif
+
+    // what tb_find() would return
+    cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
+    if (atomic_rcu_read(&cpu->tb_jmp_cache[tb_jmp_cache_hash_func(pc)]) != next ||
+        next->invalid || next->pc != pc || next->cs_base != cs_base ||
+        next->flags != flags || next->llvm_tc_ptr == NULL) {
+        return prev_ret;
+    }
+
+    cpu->can_do_io = 1;
+    panda_callbacks_mem_batch_flush(cpu);
+    // the block may have written memory the guest instruction count at its
+    // last instruction doesn't tell about
+    panda_mem_cache_invalidate();
+    panda_callbacks_after_block_exec(cpu, tcg_llvm_runtime.last_tb,
+                                     prev_ret & TB_EXIT_MASK);
+    rr_maybe_progress();
+
+    tcg_llvm_runtime.last_tb = next;
+    cpu->can_do_io = !use_icount;
+    panda_callbacks_before_block_exec(cpu, next);
+    if (panda_exit_loop) {
+        return TB_EXIT_REQUESTED;
+    }
+    panda_bb_invalidate_done = false;
+    return 0;
+}
+#endif
+
 static inline TranslationBlock *tb_find(CPUState *cpu,
                                         TranslationBlock *last_tb,
                                         int tb_exit)
@@ -544,6 +627,8 @@ static inline bool cpu_handle_exception(CPUState *cpu, int *ret)
 #endif
                 CPUClass *cc = CPU_GET_CLASS(cpu);
                 cc->do_interrupt(cpu);
+                // delivery pushed to the stack
+                panda_mem_cache_invalidate();
                 cpu->exception_index = -1;
             } else if (!replay_has_interrupt()) {
                 /* give a chance to iothread in replay mode */
@@ -628,6 +713,8 @@ static inline bool cpu_handle_interrupt(CPUState *cpu,
            and via longjmp via cpu_loop_exit.  */
         else {
             if (cc->cpu_exec_interrupt(cpu, interrupt_request)) {
+                // delivery pushed to the stack
+                panda_mem_cache_invalidate();
                 replay_interrupt();
                 *last_tb = NULL;
             }
@@ -567,7 +567,8 @@ static void vhost_set_memory(MemoryListener *listener,
     hwaddr start_addr = section->offset_within_address_space;
     ram_addr_t size = int128_get64(section->size);
     bool log_dirty =
-        memory_region_get_dirty_log_mask(section->mr) & ~(1 << DIRTY_MEMORY_MIGRATION);
+        memory_region_get_dirty_log_mask(section->mr) &
+        ~(1 << DIRTY_MEMORY_MIGRATION | 1 << DIRTY_MEMORY_PANDA);
     int s = offsetof(struct vhost_memory, regions) +
         (dev->mem->nregions + 1) * sizeof dev->mem->regions[0];
     void *ram;
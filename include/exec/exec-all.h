@@ -345,6 +345,10 @@ struct TranslationBlock {
     // indicates if this block was split up abnormally
     uint8_t was_split;
 
+    // kind of the block's last instruction (call, return, ...), filled in
+    // at translation time by callstack_instr; 0 if unknown
+    uint8_t panda_end_type;
+
     void *tc_ptr;    /* pointer to the translated code */
     uint8_t *tc_search;  /* pointer to search data */
     /* original tb when cflags has CF_NOCACHE */
@@ -396,6 +400,13 @@ struct TranslationBlock {
      * CONFIG_USER_ONLY, can determine a maximum size
      */
     char llvm_fn_name[64];
+    /* executions counted towards optimizing the block (-llvm-tiered) */
+    uint32_t llvm_exec_count;
+    /* block that usually runs next, and the net count of times it did */
+    struct TranslationBlock *llvm_trace_next;
+    uint32_t llvm_trace_count;
+    /* number of blocks run by llvm_tc_ptr when it is a trace, else 0 */
+    uint32_t llvm_trace_len;
 #endif
 };
 
@@ -1257,6 +1257,28 @@ void memory_global_dirty_log_start(void);
  */
 void memory_global_dirty_log_stop(void);
 
+/**
+ * memory_global_panda_dirty_log_start: also log writes to RAM by devices
+ * in the DIRTY_MEMORY_PANDA bitmap.  Writes by the CPU are always logged
+ * there once a page's bit has been cleared.
+ */
+void memory_global_panda_dirty_log_start(void);
+
+typedef void (*MemorySectionFn)(MemoryRegionSection *section, void *opaque);
+
+/**
+ * address_space_foreach_direct_section: call @fn on each section of @as
+ * that can be read directly from host memory (RAM, or a ROM device in romd
+ * mode), in address order.  Each section is clamped to the part of its
+ * region that is mapped there.
+ *
+ * @as: the address space to walk
+ * @fn: the function to call
+ * @opaque: passed to @fn
+ */
+void address_space_foreach_direct_section(AddressSpace *as,
+                                          MemorySectionFn fn, void *opaque);
+
 void mtree_info(fprintf_function mon_printf, void *f, bool flatview);
 
 /**
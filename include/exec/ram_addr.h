@@ -166,7 +166,8 @@ static inline bool cpu_physical_memory_is_clean(ram_addr_t addr)
     bool code = cpu_physical_memory_get_dirty_flag(addr, DIRTY_MEMORY_CODE);
     bool migration =
         cpu_physical_memory_get_dirty_flag(addr, DIRTY_MEMORY_MIGRATION);
-    return !(vga && code && migration);
+    bool panda = cpu_physical_memory_get_dirty_flag(addr, DIRTY_MEMORY_PANDA);
+    return !(vga && code && migration && panda);
 }
 
 static inline uint8_t cpu_physical_memory_range_includes_clean(ram_addr_t start,
@@ -187,6 +188,10 @@ static inline uint8_t cpu_physical_memory_range_includes_clean(ram_addr_t start,
         !cpu_physical_memory_all_dirty(start, length, DIRTY_MEMORY_MIGRATION)) {
         ret |= (1 << DIRTY_MEMORY_MIGRATION);
     }
+    if (mask & (1 << DIRTY_MEMORY_PANDA) &&
+        !cpu_physical_memory_all_dirty(start, length, DIRTY_MEMORY_PANDA)) {
+        ret |= (1 << DIRTY_MEMORY_PANDA);
+    }
     return ret;
 }
 
@@ -251,6 +256,10 @@ static inline void cpu_physical_memory_set_dirty_range(ram_addr_t start,
             bitmap_set_atomic(blocks[DIRTY_MEMORY_CODE]->blocks[idx],
                               offset, next - page);
         }
+        if (unlikely(mask & (1 << DIRTY_MEMORY_PANDA))) {
+            bitmap_set_atomic(blocks[DIRTY_MEMORY_PANDA]->blocks[idx],
+                              offset, next - page);
+        }
 
         page = next;
         idx++;
@@ -301,6 +310,7 @@ static inline void cpu_physical_memory_set_dirty_lebitmap(unsigned long *bitmap,
 
                 atomic_or(&blocks[DIRTY_MEMORY_MIGRATION][idx][offset], temp);
                 atomic_or(&blocks[DIRTY_MEMORY_VGA][idx][offset], temp);
+                atomic_or(&blocks[DIRTY_MEMORY_PANDA][idx][offset], temp);
                 if (tcg_enabled()) {
                     atomic_or(&blocks[DIRTY_MEMORY_CODE][idx][offset], temp);
                 }
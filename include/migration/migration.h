@@ -18,6 +18,7 @@
 #include "qemu-common.h"
 #include "qemu/thread.h"
 #include "qemu/notify.h"
+#include "qemu/uuid.h"
 #include "migration/vmstate.h"
 #include "qapi-types.h"
 #include "exec/cpu-common.h"
@@ -289,6 +290,16 @@ uint64_t xbzrle_mig_pages_cache_miss(void);
 double xbzrle_mig_cache_miss_rate(void);
 
 void ram_handle_compressed(void *host, uint8_t ch, uint64_t size);
+/* PANDA: read RAM pages in ram_load but don't store them, when guest RAM
+ * comes from an image of the snapshot instead */
+extern bool ram_load_discard_pages;
+/* PANDA: save only the list of RAM blocks, not their contents, which are
+ * saved in an image of their own, and ram_no_pages_id in their place;
+ * ram_load sets ram_load_no_pages and ram_no_pages_id when it finds such a
+ * snapshot */
+extern bool ram_save_skip_pages;
+extern bool ram_load_no_pages;
+extern QemuUUID ram_no_pages_id;
 void ram_debug_dump_bitmap(unsigned long *todump, bool expected);
 /* For outgoing discard bitmap */
 int ram_postcopy_send_discard_bitmap(MigrationState *ms);
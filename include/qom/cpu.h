@@ -392,6 +392,8 @@ struct CPUState {
     int32_t exception_index; /* used by m68k TCG */
     uint64_t rr_guest_instr_count;
     vaddr panda_guest_pc;
+    void *panda_mem_batch; // pending PANDA_CB_MEM_ACCESS_BATCH records
+    void *panda_vtlb; // PANDA's cache of guest page translations, see panda/common.h
 
     // Used for rr reverse debugging
     uint8_t reverse_flags;
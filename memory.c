@@ -38,6 +38,7 @@ static unsigned memory_region_transaction_depth;
 static bool memory_region_update_pending;
 static bool ioeventfd_update_pending;
 static bool global_dirty_log = false;
+static bool panda_dirty_log = false;
 
 static QTAILQ_HEAD(memory_listeners, MemoryListener) memory_listeners
     = QTAILQ_HEAD_INITIALIZER(memory_listeners);
@@ -1622,6 +1623,9 @@ uint8_t memory_region_get_dirty_log_mask(MemoryRegion *mr)
     if (global_dirty_log && mr->ram_block) {
         mask |= (1 << DIRTY_MEMORY_MIGRATION);
     }
+    if (panda_dirty_log && mr->ram_block) {
+        mask |= (1 << DIRTY_MEMORY_PANDA);
+    }
     return mask;
 }
 
@@ -2345,6 +2349,35 @@ void memory_global_dirty_log_stop(void)
     MEMORY_LISTENER_CALL_GLOBAL(log_global_stop, Reverse);
 }
 
+void memory_global_panda_dirty_log_start(void)
+{
+    if (panda_dirty_log) {
+        return;
+    }
+    panda_dirty_log = true;
+
+    /* Refresh DIRTY_LOG_PANDA bit.  */
+    memory_region_transaction_begin();
+    memory_region_update_pending = true;
+    memory_region_transaction_commit();
+}
+
+void address_space_foreach_direct_section(AddressSpace *as,
+                                          MemorySectionFn fn, void *opaque)
+{
+    FlatView *view;
+    FlatRange *fr;
+
+    view = address_space_get_flatview(as);
+    FOR_EACH_FLAT_RANGE(fr, view) {
+        if (memory_access_is_direct(fr->mr, false)) {
+            MemoryRegionSection mrs = section_from_flat_range(fr, as);
+            fn(&mrs, opaque);
+        }
+    }
+    flatview_unref(view);
+}
+
 static void listener_add_address_space(MemoryListener *listener,
                                        AddressSpace *as)
 {
@@ -61,9 +61,14 @@ static uint64_t bitmap_sync_count;
 #define RAM_SAVE_FLAG_XBZRLE   0x40
 /* 0x80 is reserved in migration.h start with 0x100 next */
 #define RAM_SAVE_FLAG_COMPRESS_PAGE    0x100
+/* PANDA: the pages were left out, see ram_save_skip_pages */
+#define RAM_SAVE_FLAG_NO_PAGES         0x200
 
 static uint8_t *ZERO_TARGET_PAGE;
 
+bool ram_save_skip_pages;
+QemuUUID ram_no_pages_id;
+
 static inline bool is_zero_range(uint8_t *p, uint64_t size)
 {
     return buffer_is_zero(p, size);
@@ -1365,7 +1370,7 @@ static int ram_find_and_save_block(QEMUFile *f, bool last_stage,
                                  ram_addr_t space */
 
     /* No dirty page as there is zero RAM */
-    if (!ram_bytes_total()) {
+    if (!ram_bytes_total() || ram_save_skip_pages) {
         return pages;
     }
 
@@ -2018,6 +2023,11 @@ static int ram_save_setup(QEMUFile *f, void *opaque)
 
     rcu_read_unlock();
 
+    if (ram_save_skip_pages) {
+        qemu_put_be64(f, RAM_SAVE_FLAG_NO_PAGES);
+        qemu_put_buffer(f, ram_no_pages_id.data, sizeof(ram_no_pages_id));
+    }
+
     ram_control_before_iterate(f, RAM_CONTROL_SETUP);
     ram_control_after_iterate(f, RAM_CONTROL_SETUP);
 
@@ -2509,8 +2519,12 @@ static int ram_load_postcopy(QEMUFile *f)
     return ret;
 }
 
+bool ram_load_discard_pages;
+bool ram_load_no_pages;
+
 static int ram_load(QEMUFile *f, void *opaque, int version_id)
 {
+    static uint8_t discard_page[TARGET_PAGE_SIZE];
     int flags = 0, ret = 0;
     static uint64_t seq_iter;
     int len = 0;
@@ -2558,6 +2572,9 @@ static int ram_load(QEMUFile *f, void *opaque, int version_id)
                 ret = -EINVAL;
                 break;
             }
+            if (ram_load_discard_pages) {
+                host = discard_page;
+            }
         }
 
         switch (flags & ~RAM_SAVE_FLAG_CONTINUE) {
@@ -2639,6 +2656,10 @@ static int ram_load(QEMUFile *f, void *opaque, int version_id)
         case RAM_SAVE_FLAG_EOS:
             /* normal exit */
             break;
+        case RAM_SAVE_FLAG_NO_PAGES:
+            qemu_get_buffer(f, ram_no_pages_id.data, sizeof(ram_no_pages_id));
+            ram_load_no_pages = true;
+            break;
         default:
             if (flags & RAM_SAVE_FLAG_HOOK) {
                 ram_control_load_hook(f, RAM_CONTROL_HOOK, NULL);
@@ -99,9 +99,29 @@ typedef enum panda_cb_type {
     PANDA_CB_START_BLOCK_EXEC,
     PANDA_CB_END_BLOCK_EXEC,
 
+    PANDA_CB_MEM_ACCESS_BATCH,      // Batches of recorded memory accesses
+
     PANDA_CB_LAST
 } panda_cb_type;
 
+// Flags of a panda_mem_access record
+typedef enum panda_mem_access_flags {
+    PANDA_MEM_ACCESS_READ = 1,        // access was a load
+    PANDA_MEM_ACCESS_WRITE = 2,       // access was a store
+    PANDA_MEM_ACCESS_PADDR_VALID = 4, // paddr could be resolved from the TLB
+} panda_mem_access_flags;
+
+// Compact record of a single guest memory access, as delivered in
+// batches to PANDA_CB_MEM_ACCESS_BATCH callbacks.
+typedef struct panda_mem_access {
+    target_ptr_t pc;    // guest PC doing the access
+    target_ptr_t vaddr; // virtual address accessed
+    hwaddr paddr;       // physical address accessed, if PADDR_VALID is set
+    uint64_t value;     // value loaded or stored
+    uint32_t size;      // size of the access in bytes
+    uint32_t flags;     // panda_mem_access_flags
+} panda_mem_access;
+
 // Union of all possible callback function types
 typedef union panda_cb {
     /* Callback ID: PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT
@@ -1033,6 +1053,31 @@ typedef union panda_cb {
     */
     void (*end_block_exec)(CPUState *cpu, TranslationBlock* tb);
 
+    /* Callback ID: PANDA_CB_MEM_ACCESS_BATCH
+
+       mem_access_batch:
+        Called with a batch of guest memory accesses recorded by the
+        softmmu helpers. Records are appended to a per-vCPU buffer and
+        delivered in program order at the end of each basic block, or
+        earlier if the buffer fills up.
+
+       Arguments:
+        CPUState *env:                     the current CPU state
+        const panda_mem_access *accesses:  the recorded accesses
+        size_t count:                      the number of records
+
+       Helper call location: cpu-exec.c
+
+       Return value:
+        none
+
+       Notes:
+        Like the other memory callbacks, this requires the plugin to
+        call panda_enable_memcb(). The records are only valid for the
+        duration of the callback.
+    */
+    void (*mem_access_batch)(CPUState *env, const panda_mem_access *accesses, size_t count);
+
     void (*cbaddr)(void);
 } panda_cb;
 
@@ -14,6 +14,7 @@ PANDAENDCOMMENT */
 #pragma once
 #include "panda/callbacks/cb-support.h"
 #include "panda/plugin.h"
+#include "panda/common.h"
 
 void HELPER(panda_insn_exec)(target_ulong pc) {
     // PANDA instrumentation: before basic block
@@ -26,6 +27,9 @@ void HELPER(panda_insn_exec)(target_ulong pc) {
 void HELPER(panda_after_insn_exec)(target_ulong pc) {
     // PANDA instrumentation: after basic block
     panda_cb_list *plist;
+    // the instruction may have written memory, and the instruction count
+    // only moves at the start of the next one
+    panda_mem_cache_invalidate();
     for(plist = panda_cbs[PANDA_CB_AFTER_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.after_insn_exec(first_cpu, pc);
     }
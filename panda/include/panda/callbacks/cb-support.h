@@ -23,7 +23,7 @@ gcc -E -P -C "$defs" | python3 -c '
 import re
 import fileinput
 sig_re = re.compile("^ *(int|bool|void).*; *$")
-sigbl_re = re.compile("_mem_(before|after)_")
+sigbl_re = re.compile("_mem_(before|after)_|mem_access_batch")
 loc_re = re.compile("^ *Helper call location: *(.+) *$")
 namefix_re = re.compile("\(\*([^)]+)\)")
 
@@ -62,6 +62,8 @@ void panda_callbacks_mem_before_read(CPUState *env, target_ptr_t pc, target_ptr_
 void panda_callbacks_mem_after_read(CPUState *env, target_ptr_t pc, target_ptr_t addr, size_t data_size, uint64_t result, void *ram_ptr);
 void panda_callbacks_mem_before_write(CPUState *env, target_ptr_t pc, target_ptr_t addr, size_t data_size, uint64_t val, void *ram_ptr);
 void panda_callbacks_mem_after_write(CPUState *env, target_ptr_t pc, target_ptr_t addr, size_t data_size, uint64_t val, void *ram_ptr);
+/* delivers accesses buffered for PANDA_CB_MEM_ACCESS_BATCH, invoked from cpu-exec.c */
+void panda_callbacks_mem_batch_flush(CPUState *env);
 
 /* invoked from cpu-exec.c */
 void panda_callbacks_before_find_fast(void);
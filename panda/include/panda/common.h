@@ -70,6 +70,12 @@ target_ulong panda_current_pc(CPUState *cpu);
 
 // END_PYPANDA_NEEDS_THIS -- do not delete this comment!
 
+/**
+ * @brief Drops what panda_virtual_memory_read_cached() has cached, e.g.
+ * after guest memory was changed behind PANDA's back.
+ */
+void panda_mem_cache_invalidate(void);
+
 /**
  * @brief Reads/writes data into/from \p buf from/to guest physical address \p addr.
  */
@@ -89,24 +95,97 @@ static inline int panda_physical_memory_rw(hwaddr addr, uint8_t *buf, int len,
 
     if (is_write) {
         memcpy(ram_ptr, buf, len);
+        panda_mem_cache_invalidate();
     } else {
         memcpy(buf, ram_ptr, len);
     }
     return MEMTX_OK;
 }
 
+/*
+ * Per-CPU cache of the guest page translations done by the functions below,
+ * so that introspection doesn't walk the guest page tables for every read.
+ * Only successful translations are cached. Entries are tagged with the
+ * address space, and dropped whenever QEMU flushes the CPU's TLB (which it
+ * does on page table base register writes and TLB maintenance instructions,
+ * that guests must issue after changing a mapping) and when PANDA writes to
+ * guest virtual memory.
+ */
+#define PANDA_VTLB_BITS 8
+#define PANDA_VTLB_SIZE (1 << PANDA_VTLB_BITS)
+
+typedef struct PandaVtlbEntry {
+    target_ulong asid;
+    target_ulong page; // -1 when unused
+    hwaddr phys_page;
+} PandaVtlbEntry;
+
+typedef struct PandaVtlb {
+    bool empty;
+    PandaVtlbEntry entries[PANDA_VTLB_SIZE];
+} PandaVtlb;
+
+PandaVtlb *panda_vtlb_new(CPUState *cpu);
+
+/**
+ * @brief Drops all the cached translations of \p cpu.
+ */
+void panda_vtlb_flush(CPUState *cpu);
+
+/* Cheap tag for the current address space, unlike panda_current_asid() on
+ * ARM there's no page walk */
+static inline target_ulong panda_vtlb_asid(CPUState *cpu) {
+    CPUArchState *env = (CPUArchState *)cpu->env_ptr;
+#if defined(TARGET_I386)
+    return env->cr[3];
+#elif defined(TARGET_ARM)
+    return env->cp15.ttbr0_el[1];
+#elif defined(TARGET_PPC)
+    return env->sr[0];
+#elif defined(TARGET_MIPS)
+    return (env->CP0_EntryHi & env->CP0_EntryHi_ASID_mask);
+#else
+    return 0;
+#endif
+}
+
+static inline PandaVtlbEntry *panda_vtlb_entry(CPUState *cpu, target_ulong page) {
+    PandaVtlb *vtlb = (PandaVtlb *)cpu->panda_vtlb;
+    if (unlikely(vtlb == NULL)) {
+        vtlb = panda_vtlb_new(cpu);
+    }
+    return &vtlb->entries[(page >> TARGET_PAGE_BITS) & (PANDA_VTLB_SIZE - 1)];
+}
+
+static inline void panda_vtlb_fill(CPUState *cpu, PandaVtlbEntry *e,
+                                   target_ulong asid, target_ulong page,
+                                   hwaddr phys_page) {
+    ((PandaVtlb *)cpu->panda_vtlb)->empty = false;
+    e->asid = asid;
+    e->page = page;
+    e->phys_page = phys_page;
+}
+
 /**
  * @brief Translates guest virtual addres \p addr to a guest physical address.
  */
 static inline hwaddr panda_virt_to_phys(CPUState *env, target_ulong addr) {
     target_ulong page;
+    target_ulong asid;
     hwaddr phys_addr;
+    PandaVtlbEntry *e;
     page = addr & TARGET_PAGE_MASK;
+    asid = panda_vtlb_asid(env);
+    e = panda_vtlb_entry(env, page);
+    if (likely(e->page == page && e->asid == asid)) {
+        return e->phys_page + (addr & ~TARGET_PAGE_MASK);
+    }
     phys_addr = cpu_get_phys_page_debug(env, page);
     if (phys_addr == -1) {
         // no physical page mapped
         return -1;
     }
+    panda_vtlb_fill(env, e, asid, page, phys_addr);
     phys_addr += (addr & ~TARGET_PAGE_MASK);
     return phys_addr;
 }
@@ -124,33 +203,49 @@ bool enter_priv(CPUState* cpu);
  */
 void exit_priv(CPUState* cpu);
 
+/*
+ * Translates \p page in address space \p asid through the cache, switching
+ * into privileged mode if the translation fails otherwise. Leaves the guest
+ * in privileged mode if it had to switch, and sets \p changed_priv.
+ */
+static inline hwaddr panda_vtlb_translate(CPUState *env, target_ulong asid,
+                                          target_ulong page,
+                                          bool *changed_priv) {
+    hwaddr phys_addr;
+    PandaVtlbEntry *e = panda_vtlb_entry(env, page);
+    if (likely(e->page == page && e->asid == asid)) {
+        return e->phys_page;
+    }
+    phys_addr = cpu_get_phys_page_debug(env, page);
+    // If we failed and we aren't in priv mode and we CAN go into it, toggle modes and try again
+    if (phys_addr == -1  && !*changed_priv && (*changed_priv=enter_priv(env))) {
+        phys_addr = cpu_get_phys_page_debug(env, page);
+        //if (phys_addr != -1) printf("[panda dbg] virt->phys failed until privileged mode\n");
+    }
+    if (phys_addr != -1) {
+        panda_vtlb_fill(env, e, asid, page, phys_addr);
+    }
+    return phys_addr;
+}
 
-/**
- * @brief Reads/writes data into/from \p buf from/to guest virtual address \p addr.
- *
- * For ARM/MIPS we switch into privileged mode if the access fails. The mode is always reset
- * before we return.
+/*
+ * Body of panda_virtual_memory_rw(), for address space \p asid. Leaves the
+ * guest in privileged mode if it had to switch, and sets \p changed_priv.
  */
-static inline int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
-                                          uint8_t *buf, int len, bool is_write) {
+static inline int panda_virtual_memory_rw_priv(CPUState *env, target_ulong asid,
+                                               target_ulong addr, uint8_t *buf,
+                                               int len, bool is_write,
+                                               bool *changed_priv) {
     int l;
     int ret;
     hwaddr phys_addr;
     target_ulong page;
-    bool changed_priv = false;
 
     while (len > 0) {
         page = addr & TARGET_PAGE_MASK;
-        phys_addr = cpu_get_phys_page_debug(env, page);
-        // If we failed and we aren't in priv mode and we CAN go into it, toggle modes and try again
-        if (phys_addr == -1  && !changed_priv && (changed_priv=enter_priv(env))) {
-            phys_addr = cpu_get_phys_page_debug(env, page);
-            //if (phys_addr != -1) printf("[panda dbg] virt->phys failed until privileged mode\n");
-        }
-
+        phys_addr = panda_vtlb_translate(env, asid, page, changed_priv);
         // No physical page mapped, even after potential privileged switch, abort
         if (phys_addr == -1)  {
-            if (changed_priv) exit_priv(env); // Cleanup mode if necessary
             return -1;
         }
 
@@ -162,13 +257,12 @@ static inline int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
         ret = panda_physical_memory_rw(phys_addr, buf, l, is_write);
 
         // Failed and privileged mode wasn't already enabled - enable priv and retry if we can
-        if (ret != MEMTX_OK && !changed_priv && (changed_priv = enter_priv(env))) {
+        if (ret != MEMTX_OK && !*changed_priv && (*changed_priv = enter_priv(env))) {
             ret = panda_physical_memory_rw(phys_addr, buf, l, is_write);
             //if (ret == MEMTX_OK) printf("[panda dbg] accessing phys failed until privileged mode\n");
         }
         // Still failed, even after potential privileged switch, abort
         if (ret != MEMTX_OK) {
-            if (changed_priv) exit_priv(env); // Cleanup mode if necessary
             return ret;
         }
 
@@ -176,10 +270,28 @@ static inline int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
         buf += l;
         addr += l;
     }
-    if (changed_priv) exit_priv(env); // Clear privileged mode if necessary
     return 0;
 }
 
+/**
+ * @brief Reads/writes data into/from \p buf from/to guest virtual address \p addr.
+ *
+ * For ARM/MIPS we switch into privileged mode if the access fails. The mode is always reset
+ * before we return.
+ */
+static inline int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
+                                          uint8_t *buf, int len, bool is_write) {
+    bool changed_priv = false;
+    int ret = panda_virtual_memory_rw_priv(env, panda_vtlb_asid(env), addr,
+                                           buf, len, is_write, &changed_priv);
+    if (changed_priv) exit_priv(env); // Clear privileged mode if necessary
+    if (is_write) {
+        // the write may have changed page tables
+        panda_vtlb_flush(env);
+    }
+    return ret;
+}
+
 /**
  * @brief Reads data into \p buf from guest virtual address \p addr.
  */
@@ -196,6 +308,120 @@ static inline int panda_virtual_memory_write(CPUState *env, target_ulong addr,
     return panda_virtual_memory_rw(env, addr, buf, len, 1);
 }
 
+/**
+ * @brief One of the reads done by panda_virtual_memory_read_many().
+ */
+typedef struct PandaMemRead {
+    target_ulong addr;
+    uint8_t *buf;
+    int len;
+    int ret; // set to what panda_virtual_memory_read() would return
+} PandaMemRead;
+
+/**
+ * @brief Does the \p n reads in \p reads from guest virtual memory, switching
+ * into privileged mode at most once for all of them. Returns the number of
+ * reads that failed.
+ */
+int panda_virtual_memory_read_many(CPUState *env, PandaMemRead *reads, int n);
+
+/**
+ * @brief Reads the NUL-terminated string at guest virtual address \p addr into
+ * \p buf, which is always NUL-terminated, truncating it to \p size - 1 bytes.
+ * The string is read a page at a time rather than a byte at a time. Returns
+ * its length, or -1 if not even its first byte can be read. A string that
+ * runs into an unreadable page is cut there.
+ */
+int panda_virtual_memory_read_str(CPUState *env, target_ulong addr, char *buf,
+                                  int size);
+
+/**
+ * @brief Same as panda_virtual_memory_read(), but the data is kept in a small
+ * cache, per address space, until the guest executes another instruction or
+ * writes memory, so that reading the same kernel structures over and over
+ * from one callback doesn't go back to guest memory each time. The cache is
+ * only used in replay, where those are the only ways memory changes;
+ * otherwise this is a plain read. Without memory callbacks, guest stores
+ * are only noticed after the instruction (after_insn_exec), at the end of
+ * the block (after_block_exec) or once an interrupt or exception has been
+ * delivered, so a line read in insn_exec or before_block_exec isn't
+ * refreshed by the stores of that instruction or block until then.
+ */
+int panda_virtual_memory_read_cached(CPUState *env, target_ulong addr,
+                                     uint8_t *buf, int len);
+
+/**
+ * @brief Fills \p iov with host pointers to the \p len bytes of guest physical
+ * memory at \p addr, without copying them. Pieces that are contiguous in host
+ * memory are merged, so a range within one RAM block takes a single entry.
+ * Returns the number of entries used, or -1 if part of the range isn't RAM
+ * or it takes more than \p max_iov entries.
+ *
+ * The view is only valid until the guest executes another instruction (or a
+ * snapshot is loaded): read it from within a callback, and don't keep it.
+ * Writing through it bypasses dirty tracking and the invalidation of
+ * translated code, so use panda_physical_memory_rw() to write.
+ */
+int panda_physical_memory_view(hwaddr addr, size_t len, struct iovec *iov,
+                               int max_iov);
+
+/**
+ * @brief Same as panda_physical_memory_view(), for the \p len bytes at guest
+ * virtual address \p addr in the current address space. Returns -1 if part
+ * of the range isn't mapped.
+ */
+int panda_virtual_memory_view(CPUState *env, target_ulong addr, size_t len,
+                              struct iovec *iov, int max_iov);
+
+/**
+ * @brief Callback for panda_ram_scan(): the \p len bytes of guest RAM at guest
+ * physical address \p addr are at \p host.
+ */
+typedef void (*panda_ram_scan_cb)(hwaddr addr, uint8_t *host, size_t len,
+                                  void *opaque);
+
+/** Only visit pages written since the last panda_ram_dirty_reset(). */
+#define PANDA_RAM_SCAN_DIRTY 1
+
+/** Largest range passed to a panda_ram_scan_cb. */
+#define PANDA_RAM_SCAN_CHUNK (16 << 20)
+
+/**
+ * @brief Calls \p cb on all the RAM (and ROM) in the guest physical address
+ * space, straight from the host memory backing it, in ranges of up to
+ * PANDA_RAM_SCAN_CHUNK bytes. The ranges are handed out to \p threads worker
+ * threads (0 for one per host CPU; 1 to call \p cb from this thread), so
+ * \p cb may run concurrently with itself and must not call into PANDA or
+ * QEMU. The guest is stopped until all the calls have returned, and the
+ * host pointers must not be kept past them. Returns the number of bytes
+ * visited.
+ *
+ * With PANDA_RAM_SCAN_DIRTY in \p flags, only the pages written (by the guest
+ * or by devices) since the last panda_ram_dirty_reset() are visited; if it
+ * was never called, that's all of them.
+ */
+uint64_t panda_ram_scan(panda_ram_scan_cb cb, void *opaque, int threads,
+                        int flags);
+
+/**
+ * @brief Starts over the record of which pages of RAM have been written, for
+ * PANDA_RAM_SCAN_DIRTY. The first write to each page afterwards takes the
+ * slow path through the TLB.
+ */
+void panda_ram_dirty_reset(void);
+
+/**
+ * @brief Returns the guest instruction count at the last
+ * panda_ram_dirty_reset(), or 0 if it was never called.
+ */
+uint64_t panda_ram_dirty_since(void);
+
+/**
+ * @brief Marks all of RAM as written, for when it is replaced behind the dirty
+ * tracking's back (e.g. by loading a snapshot).
+ */
+void panda_ram_dirty_mark_all(void);
+
 /**
  * @brief Obtains a host pointer for the given virtual address.
  */
@@ -22,13 +22,27 @@ extern "C" {
 
 #include <stdio.h>
 #include <iostream>
+#include <string>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
 #include <stdint.h>
+#include <google/protobuf/arena.h>
 #include "plog.pb.h"
 
 #define PL_CURRENT_VERSION 2
-// compression level
-#define PL_Z_LEVEL 9
+// default compression level. Z_BEST_COMPRESSION is several times slower
+// for a few percent smaller logs. Override with PANDALOG_ZLEVEL.
+#define PL_Z_LEVEL Z_DEFAULT_COMPRESSION
+// default upper bound on compression threads. Override with PANDALOG_THREADS;
+// 0 compresses and writes chunks synchronously.
+#define PL_MAX_THREADS 4
+// reset the entry arena after entries of this serialized size, even mid-chunk
+#define PL_ARENA_MAX (8 * 1024 * 1024)
 // 16 MB chunk
 #define PL_CHUNKSIZE (1024 * 1024 * 16)
 // header at most this many bytes
@@ -64,10 +78,11 @@ struct PandalogCcChunk {
     uint32_t size;              // in bytes of a chunk
     uint32_t zsize;             // in bytes of a compressed chunk. 
     unsigned char *buf;         // uncompressed chunk data
+    uint32_t buf_size;          // allocated size of buf, can exceed size while writing
     unsigned char *buf_p;       // pointer into uncompressed chunk (used while writing)
     unsigned char *zbuf;        // corresponding compressed chunk
     // these are used while writing to remember things needed for dir entry
-    uint32_t start_instr;       // first instruction in current chunk 
+    uint64_t start_instr;       // first instruction in current chunk 
     uint64_t start_pos;         // pos in file of start of current chunk
     // these are used while reading and contain current chunk data, expanded into pl entries
     std::vector<std::unique_ptr<panda::LogEntry>> entries;    // this will be array of entries in current chunk 
@@ -76,6 +91,86 @@ struct PandalogCcChunk {
     uint32_t ind_entry;         // index into array of entries
 };
 
+// A chunk handed off to the writer
+struct PandalogCcJob {
+    uint32_t chunk_num;
+    unsigned char *buf;         // uncompressed chunk data (owned by the job)
+    uint32_t buf_size;          // allocated size of buf
+    unsigned long size;         // bytes of buf in use
+    uint32_t num_entries;
+    std::vector<unsigned char> zbuf;  // compressed chunk, once done
+    bool done;
+};
+
+// Compresses chunks on a pool of threads and appends them to the log file,
+// in chunk order, from a writer thread, so that the thread producing log
+// entries doesn't wait for zlib or the disk. At most a few chunks per
+// compression thread are in flight; past that, submit() blocks.
+class PandalogCcWriter {
+public:
+    PandalogCcWriter() : file(NULL), level(PL_Z_LEVEL), num_threads(0),
+        next_write(0), in_flight(0), stopping(false) {}
+    ~PandalogCcWriter() { stop(); }
+
+    // chunks will be written to file, starting at its current put position
+    void start(std::fstream *file, int level, unsigned num_threads);
+
+    // hands off buf, holding size bytes of chunk chunk_num. Returns a
+    // buffer of at least buf_size bytes for the next chunk.
+    unsigned char *submit(uint32_t chunk_num, unsigned char *buf,
+                          uint32_t *buf_size, unsigned long size,
+                          uint32_t num_entries);
+
+    // waits until every submitted chunk has been written, then stops the
+    // threads. pos[i] is set to the file position of chunk i.
+    void finish(std::vector<uint64_t> &pos);
+
+private:
+    void compress_job(PandalogCcJob *job);
+    void write_job(PandalogCcJob *job);
+    unsigned char *get_buf(uint32_t *buf_size);
+    void compress_loop();
+    void write_loop();
+    void stop();
+
+    std::fstream *file;
+    int level;
+    unsigned num_threads;
+    std::vector<std::thread> threads;
+    std::mutex lock;
+    std::condition_variable work_cv;    // signals compression threads
+    std::condition_variable done_cv;    // signals writer and submitter
+    std::vector<PandalogCcJob *> queue;         // waiting for compression
+    std::map<uint32_t, PandalogCcJob *> jobs;   // submitted, not yet written
+    std::vector<std::pair<unsigned char *, uint32_t>> free_bufs;
+    std::vector<uint64_t> written_pos;
+    uint32_t next_write;
+    uint32_t in_flight;
+    bool stopping;
+};
+
+// Limits the entries with a given LogEntry field set that get written.
+// See PandaLog::add_limits().
+struct PandalogCcLimit {
+    std::string type;           // LogEntry field name, or "*" for all entries
+    const google::protobuf::FieldDescriptor *field;   // NULL for "*"
+    // policies; an entry is written only if all of them allow it
+    uint64_t every;             // write every Nth entry
+    double sample;              // write with this probability
+    uint64_t rate;              // token bucket: this many entries...
+    uint64_t rate_instrs;       // ...per this many instructions
+    uint64_t budget;            // max serialized bytes
+    // state
+    bool matched;               // current entry has the field set
+    uint64_t seen;
+    double tokens;
+    uint64_t last_instr;
+    uint64_t bytes;             // serialized bytes written
+    uint64_t kept;              // since last summary entry
+    uint64_t dropped;           // since last summary entry
+    uint64_t total_dropped;
+};
+
 class PandaLog {
     PlMode mode;
     const char *filename;
@@ -83,12 +178,25 @@ class PandaLog {
     PandalogCcDir dir;
     PandalogCcChunk chunk;
     uint32_t chunk_num;
+    PandalogCcWriter writer;
+    // entries from new_entry(). reset when a chunk has been handed off (or
+    // it grows past PL_ARENA_MAX) and no entries from it are outstanding
+    google::protobuf::Arena arena;
+    uint32_t arena_live;        // entries from new_entry() not yet written
+    uint64_t arena_bytes;       // serialized size of entries since last reset
+    std::vector<PandalogCcLimit> limits;
+    bool limits_dropped;        // something was dropped since last summary
+    uint64_t rng_state;
 
 public:    
     //default constructor
     PandaLog(): mode(PL_MODE_UNKNOWN){
         mode = PL_MODE_UNKNOWN;
         chunk_num = 0;
+        arena_live = 0;
+        arena_bytes = 0;
+        limits_dropped = false;
+        rng_state = 0x9E3779B97F4A7C15ull;
     };
 
     // open pandalog for write with this uncompressed chunk size
@@ -109,6 +217,29 @@ public:
 
     void write_entry(std::unique_ptr<panda::LogEntry> entry);
 
+    // Builder API: returns an empty entry allocated from the log's arena,
+    // along with any submessages and strings set on it. Fill it in, then
+    // pass it to write_entry(panda::LogEntry *) or discard_entry(), and
+    // don't touch it afterwards. This avoids a heap allocation per message.
+    //
+    //   panda::LogEntry *ple = globalLog.new_entry();
+    //   ple->mutable_syscall()->set_pid(pid);
+    //   globalLog.write_entry(ple);
+    panda::LogEntry *new_entry(void);
+
+    // writes entry. if it came from new_entry(), releases it.
+    void write_entry(panda::LogEntry *entry);
+
+    // releases an entry from new_entry() without writing it
+    void discard_entry(panda::LogEntry *entry);
+
+    // Adds sampling and rate limits for entry types, from a spec like
+    //   "syscall:every=10;tainted_branch:rate=1000/1M,budget=100M"
+    // See the Pandalog section of the manual. Limits are also read from
+    // PANDALOG_LIMITS when the log is opened for writing. Returns false,
+    // without adding any limit, if spec is malformed.
+    bool add_limits(const char *spec);
+
     std::unique_ptr<panda::LogEntry> read_entry(void);
 
     // seek to the element in pandalog corresponding to this instr
@@ -139,9 +270,24 @@ private:
     // Adds directory entry to list of directory entries. Does not write to log
     void add_dir_entry();
 
-    //Zlib compresses and writes current chunk to log
+    // Hands current chunk off to be zlib compressed and written to log
     void write_current_chunk();
 
+    // serializes entry into the current chunk
+    void append_entry(panda::LogEntry *entry, size_t n);
+
+    // applies limits to entry of serialized size n
+    bool keep_entry(const panda::LogEntry *entry, size_t n);
+    bool limit_allows(PandalogCcLimit &l, uint64_t instr, size_t n);
+
+    // writes a pandalog_dropped entry for each limit that dropped entries
+    // since its last one
+    void write_limit_summaries(uint64_t instr, uint64_t pc);
+
+    // Resets the arena if no entry from it is outstanding and a chunk was
+    // just handed off or it has grown too big
+    void maybe_reset_arena(bool chunk_done);
+
     // Finds index of entry with this instr number
     uint32_t find_ind(uint64_t instr, uint32_t lo, uint32_t high);
 
@@ -149,4 +295,57 @@ private:
     uint32_t find_chunk(uint64_t instr, uint32_t lo, uint32_t high);
 };
 
+// The log written during replay
+extern PandaLog globalLog;
+
+// Read-only, random access to a pandalog. Unlike PandaLog, which reads one
+// entry at a time from the current chunk, this locates chunks by binary
+// search over the directory and can decode chunks on several threads. It
+// holds no per-read state, so it can be shared between threads.
+//
+// Entries written outside of replay (e.g. when a plugin is unloaded) have
+// instr == -1; they are skipped by read_window but seen by read_all.
+class PandaLogReader {
+public:
+    // return false to stop reading
+    typedef std::function<bool(const panda::LogEntry &)> EntryFn;
+
+    PandaLogReader() : fd(-1), chunk_size(0), dir_pos(0) {}
+    ~PandaLogReader() { close(); }
+
+    // returns false if path can't be opened or isn't a pandalog
+    bool open(const char *path);
+    void close(void);
+
+    uint32_t num_chunks(void) const { return dir.num_chunks; }
+
+    // first instruction of chunk i
+    uint64_t chunk_instr(uint32_t i) const { return dir.instr[i]; }
+
+    // index of the chunk holding the first entries for instr
+    uint32_t find_chunk(uint64_t instr) const;
+
+    // decodes every entry in chunk i
+    std::vector<std::unique_ptr<panda::LogEntry>> read_chunk(uint32_t i) const;
+
+    // calls fn, in log order, on every entry with start <= instr < end.
+    // chunks are decoded ahead of fn on num_threads threads, or in the
+    // calling thread if num_threads is 0.
+    void read_window(uint64_t start, uint64_t end, const EntryFn &fn,
+                     unsigned num_threads = 0) const;
+
+    // calls fn, in log order, on every entry in the log
+    void read_all(const EntryFn &fn, unsigned num_threads = 0) const;
+
+private:
+    void read_chunks(uint32_t first, uint32_t last, bool all,
+                     uint64_t start, uint64_t end,
+                     const EntryFn &fn, unsigned num_threads) const;
+
+    int fd;
+    uint32_t chunk_size;
+    uint64_t dir_pos;
+    PandalogCcDir dir;
+};
+
 #endif
@@ -63,24 +63,48 @@ bool ppp_remove_cb_##cb_name(cb_name##_t fptr) ;
   3. create fn for registering a callback
   4. creates a fn for registering a callback in a particlular slot.  Since the
   callbacks are in an array and we will call them in order, one may want to
-  take advantage of that fact by ordering them carefully.  However, be careful
-  as there isnt any attempt, here, to detect if you leave a slot empty
+  take advantage of that fact by ordering them carefully.  Empty slots are
+  skipped.
+
+  Registered callbacks are not run from that array directly.  Whenever the
+  set of callbacks changes, it is compiled into a dense dispatch array with
+  no empty slots, which is what PPP_RUN_CB walks.  So running a callback with
+  no subscribers costs a single compare, and PPP_CHECK_CB is exact.
+
+  PPP_CB_BOILERPLATE_NOTIFY additionally runs the statement `notify` after
+  each change, so plugin A can precompute its own tables (e.g. which events
+  anybody subscribed to) at registration time rather than per event.
 */
 
-#define PPP_CB_BOILERPLATE(cb_name)                                \
+#define PPP_CB_BOILERPLATE_NOTIFY(cb_name, notify)                  \
 cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB];                        \
 int ppp_##cb_name##_num_cb = 0;                                    \
+cb_name##_t ppp_##cb_name##_dispatch[PPP_MAX_CB];                  \
+int ppp_##cb_name##_num_dispatch = 0;                              \
+                                                                   \
+static void ppp_compile_cb_##cb_name(void) {                       \
+  int i, n = 0;                                                    \
+  for (i = 0; i < MIN(PPP_MAX_CB, ppp_##cb_name##_num_cb); i++) {  \
+    if (ppp_##cb_name##_cb[i] != NULL) {                           \
+      ppp_##cb_name##_dispatch[n++] = ppp_##cb_name##_cb[i];       \
+    }                                                              \
+  }                                                                \
+  ppp_##cb_name##_num_dispatch = n;                                \
+  notify;                                                          \
+}                                                                  \
                                                                    \
 void ppp_add_cb_##cb_name(cb_name##_t fptr) {                      \
   assert (ppp_##cb_name##_num_cb < PPP_MAX_CB);                    \
   ppp_##cb_name##_cb[ppp_##cb_name##_num_cb] = fptr;               \
   ppp_##cb_name##_num_cb += 1;                                     \
+  ppp_compile_cb_##cb_name();                                      \
 }                                                                  \
                                                                    \
 void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) { \
   assert (slot_num < PPP_MAX_CB);                                  \
   ppp_##cb_name##_cb[slot_num] = fptr;                             \
-  ppp_##cb_name##_num_cb = MAX(slot_num, ppp_##cb_name##_num_cb);  \
+  ppp_##cb_name##_num_cb = MAX(slot_num + 1, ppp_##cb_name##_num_cb); \
+  ppp_compile_cb_##cb_name();                                      \
 }                                                                  \
 bool ppp_remove_cb_##cb_name(cb_name##_t fptr) {                   \
   int i = 0;                                                       \
@@ -94,41 +118,44 @@ bool ppp_remove_cb_##cb_name(cb_name##_t fptr) {                   \
         ppp_##cb_name##_cb[i] = ppp_##cb_name##_cb[i+1];           \
     }                                                              \
   }                                                                \
+  ppp_compile_cb_##cb_name();                                      \
   return found;                                                    \
 }
 
+#define PPP_CB_BOILERPLATE(cb_name) PPP_CB_BOILERPLATE_NOTIFY(cb_name, )
+
 #define PPP_CB_EXTERN(cb_name) \
 extern cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB]; \
-extern int ppp_##cb_name##_num_cb;
+extern int ppp_##cb_name##_num_cb; \
+extern cb_name##_t ppp_##cb_name##_dispatch[PPP_MAX_CB]; \
+extern int ppp_##cb_name##_num_dispatch;
 
 /*
-  And employ this where you want the callback functions to be called 
+  And employ this where you want the callback functions to be called.
+  The arguments are only evaluated if there is at least one subscriber,
+  but if computing them is expensive, guard with PPP_CHECK_CB.
 */
  
-#define PPP_RUN_CB(cb_name, ...)                                              \
-  {                                                                           \
-    int ppp_cb_ind;                                                           \
-    for (ppp_cb_ind = 0; ppp_cb_ind < ppp_##cb_name##_num_cb; ppp_cb_ind++) { \
-      if (ppp_##cb_name##_cb[ppp_cb_ind] != NULL) {                           \
-    ppp_##cb_name##_cb[ppp_cb_ind]( __VA_ARGS__ ) ;                           \
-      }                                                                       \
-    }                                                                         \
+#define PPP_RUN_CB(cb_name, ...)                                                    \
+  {                                                                                 \
+    int ppp_cb_ind;                                                                 \
+    for (ppp_cb_ind = 0; ppp_cb_ind < ppp_##cb_name##_num_dispatch; ppp_cb_ind++) { \
+      ppp_##cb_name##_dispatch[ppp_cb_ind]( __VA_ARGS__ ) ;                         \
+    }                                                                               \
   }
 
 // If any of the registered functions returns true, take the if body
 // Usage: IF_PPP_RUN_BOOL_CB(...) { printf("True"); }
-#define IF_PPP_RUN_BOOL_CB(cb_name, ...)                                      \
-  bool __ret = false;                                                         \
-  {                                                                           \
-    int ppp_cb_ind;                                                           \
-    for (ppp_cb_ind = 0; ppp_cb_ind < ppp_##cb_name##_num_cb; ppp_cb_ind++) { \
-      if (ppp_##cb_name##_cb[ppp_cb_ind] != NULL) {                           \
-        __ret |= ppp_##cb_name##_cb[ppp_cb_ind]( __VA_ARGS__ ) ;              \
-      }                                                                       \
-    }                                                                         \
+#define IF_PPP_RUN_BOOL_CB(cb_name, ...)                                            \
+  bool __ret = false;                                                               \
+  {                                                                                 \
+    int ppp_cb_ind;                                                                 \
+    for (ppp_cb_ind = 0; ppp_cb_ind < ppp_##cb_name##_num_dispatch; ppp_cb_ind++) { \
+      __ret |= ppp_##cb_name##_dispatch[ppp_cb_ind]( __VA_ARGS__ ) ;                \
+    }                                                                               \
   }; if (__ret)
 
-#define PPP_CHECK_CB(cb_name) (ppp_##cb_name##_num_cb > 0)
+#define PPP_CHECK_CB(cb_name) (ppp_##cb_name##_num_dispatch > 0)
 
 /****************************************************************
 This stuff gets used in "plugin B", i.e., the plugin that wants
@@ -10,6 +10,7 @@
 #ifndef __cplusplus
 #include "qemu/osdep.h"
 #include "cpu.h"
+#include "qemu/uuid.h"
 #else
 #include "panda/cheaders.h"
 #endif
@@ -213,4 +214,41 @@ uint32_t rr_checksum_regs(void);
 
 bool rr_queue_empty(void);
 
+// Writes a snapshot of the VM to file name. With ram_image, guest RAM is
+// written to that RAM image instead of the snapshot, if possible, for
+// replays to map it lazily. With background, it is written by a forked copy
+// of QEMU, whose guest RAM is a copy-on-write image of ours, while the guest
+// runs on; call rr_snapshot_wait() before using the file. Falls back to
+// writing it right away if that isn't possible.
+int rr_save_snapshot(const char *name, const char *ram_image, bool background);
+// Waits for a snapshot being written in the background, if any, and returns
+// its result.
+int rr_snapshot_wait(void);
+
+#ifndef __cplusplus
+// Guest RAM images (see rr_ram_image.c). rr_ram_image_supported checks that
+// guest RAM can be mapped from one; rr_ram_image_probe tells whether the
+// image at path is a cache made from snapshot or one written at record
+// time; rr_ram_image_write makes one from the current contents of RAM, a
+// recorded one if id is given; rr_ram_image_map maps one over guest RAM,
+// which must be done before loading device state from the snapshot, as
+// device load hooks read guest RAM; rr_ram_image_matches_ram then checks
+// that the snapshot didn't resize RAM blocks under the image and, given
+// the ID the snapshot was saved with, that the image was recorded with it.
+// Write and map return 0 on success.
+typedef enum {
+    RR_RAM_IMAGE_NONE,
+    RR_RAM_IMAGE_CACHE,
+    RR_RAM_IMAGE_RECORDED,
+} RRRamImageKind;
+
+bool rr_ram_image_supported(void);
+RRRamImageKind rr_ram_image_probe(const char *path, const char *snapshot);
+int rr_ram_image_write(const char *path, const char *snapshot,
+                       const QemuUUID *id);
+int rr_ram_image_map(const char *path, const char *snapshot);
+bool rr_ram_image_matches_ram(const char *path, const char *snapshot,
+                              const QemuUUID *id);
+#endif
+
 #endif
@@ -79,6 +79,13 @@ extern volatile sig_atomic_t rr_skipped_callsite_location;
 extern volatile sig_atomic_t rr_record_in_progress;
 // should be true iff we are executing device code
 extern volatile sig_atomic_t rr_record_in_main_loop_wait;
+// write the snapshot at the start of a recording in the background
+extern int rr_record_bg_snapshot;
+// create a RAM image for the recording being replayed if it has none
+extern int rr_replay_ram_image;
+// at the start of a recording, write guest RAM to a RAM image rather than
+// to the snapshot
+extern int rr_record_ram_image;
 
 // mz Routine that handles the situation when program points disagree during
 // mz replay. Typically, this means a fatal error - the routine prints some
@@ -74,10 +74,17 @@ struct TCGLLVMRuntime;
 extern __class_compat_var TCGLLVMTranslator *tcg_llvm_translator;
 extern __class_compat_var TCGLLVMRuntime tcg_llvm_runtime;
 
+/* set by -llvm-tiered: JIT blocks quickly first, optimize hot ones later */
+extern int llvm_tiered;
+
 /* defined in vl.c */
 void tcg_llvm_initialize(void);
 void tcg_llvm_destroy(void);
 
+/* defined in cpu-exec.c, called by traces between two blocks */
+uintptr_t tcg_llvm_trace_next(CPUArchState *env, uintptr_t prev_ret,
+    struct TranslationBlock *next);
+
 /* defined in panda/llvm/tcg-llvm.cpp */
 void tcg_llvm_tb_alloc(struct TranslationBlock *tb);
 void tcg_llvm_tb_free(struct TranslationBlock *tb);
@@ -107,8 +114,16 @@ struct TCGLLVMRuntime {
 
 extern "C++" {
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 /***********************************/
 /* External interface for C++ code */
@@ -131,6 +146,93 @@ extern "C++" {
 using NewModuleCallback = std::function<void(llvm::Module *module,
     llvm::legacy::FunctionPassManager *functionPassManager)>;
 
+/* Executions of a block in the first tier before it is optimized */
+#define TCG_LLVM_TIER2_THRESHOLD 64
+/* Background threads optimizing hot blocks */
+#define TCG_LLVM_TIER2_THREADS 2
+/* Most blocks compiled together in one module */
+#define TCG_LLVM_TIER2_MAX_BATCH 256
+/* Bitcode kept around for blocks that may become hot */
+#define TCG_LLVM_TIER2_BITCODE_MAX (64 * 1024 * 1024)
+/* Most blocks fused into one trace */
+#define TCG_LLVM_TRACE_MAX 8
+
+/*
+ * Second tier of the tiered JIT. With -llvm-tiered, blocks are first JITted
+ * on the vCPU thread without codegen optimizations, which is what makes
+ * them cheap to translate. Once a block has run TCG_LLVM_TIER2_THRESHOLD
+ * times, its bitcode is queued here, along with that of the blocks that
+ * usually run after it. Background threads fuse each such chain of blocks
+ * into a trace, one function that runs the blocks in turn and leaves
+ * whenever the next block isn't the expected one (see
+ * tcg_llvm_trace_next()), link the queued traces into one module per batch,
+ * optimize it and JIT it with a second, optimizing LLJIT. The vCPU thread
+ * then switches the first block of each trace over to the new code between
+ * two blocks. Both tiers run the same instrumented IR, so analyses such as
+ * taint see the same operations.
+ */
+class TCGLLVMTier2 {
+    public:
+    struct Block {
+        TranslationBlock *tb;
+        std::string name;
+        std::string bitcode;
+        /* functions the block calls and their address in the first tier,
+         * or 0 if it doesn't define them. The first tier is only used on
+         * the vCPU thread, so they are resolved before the block is
+         * queued. */
+        std::vector<std::pair<std::string, uint64_t>> callees;
+    };
+
+    TCGLLVMTier2(unsigned numThreads);
+    ~TCGLLVMTier2();
+
+    /* Queues a trace of blocks, the first of which is hot */
+    void submit(std::vector<Block> trace);
+
+    /* True when compiled traces are waiting for install() */
+    bool ready() const {
+        return m_ready.load(std::memory_order_acquire);
+    }
+
+    /* Points blocks at their optimized code. Only call between blocks. */
+    void install();
+
+    private:
+    struct Result {
+        /* the blocks of the trace and their function names */
+        std::vector<std::pair<TranslationBlock *, std::string>> blocks;
+        uint8_t *code;
+        uint64_t size;
+    };
+
+    void compileLoop();
+    void compile(std::vector<std::vector<Block>> &batch);
+    std::unique_ptr<llvm::Module> buildTrace(std::vector<Block> &trace,
+        llvm::LLVMContext &ctx, std::string &symbol);
+    void emit(std::unique_ptr<llvm::Module> module,
+        llvm::orc::ThreadSafeContext tsc,
+        std::unordered_map<std::string, Result> &pending,
+        const std::unordered_map<std::string, uint64_t> &tier1Symbols);
+    void defineTier1Symbols(llvm::Module &module,
+        const std::unordered_map<std::string, uint64_t> &tier1Symbols);
+
+    std::unique_ptr<llvm::orc::LLJIT> m_jit;
+
+    std::mutex m_lock;
+    std::condition_variable m_wake;
+    std::deque<std::vector<Block>> m_queue;
+    std::vector<Result> m_results;
+    /* symbols of the first tier already defined in m_jit */
+    std::mutex m_defineLock;
+    std::unordered_set<std::string> m_defined;
+    /* code sizes of the traces in newly loaded objects */
+    std::unordered_map<std::string, uint64_t> m_sizes;
+    std::atomic<bool> m_ready;
+    bool m_stop;
+    std::vector<std::thread> m_threads;
+};
+
 class TCGLLVMTranslator {
     private:
     // List of functions to call when a new module is created
@@ -148,8 +250,11 @@ class TCGLLVMTranslator {
     llvm::StructType *m_CPUArchStateType = nullptr;
     llvm::ExitOnError ExitOnErr;
 
+    // the first tier of the tiered JIT trades code quality for JIT speed
     llvm::orc::JITTargetMachineBuilder JTMB =
-        ExitOnErr(llvm::orc::JITTargetMachineBuilder::detectHost());
+        ExitOnErr(llvm::orc::JITTargetMachineBuilder::detectHost()).
+            setCodeGenOptLevel(llvm_tiered ? llvm::CodeGenOpt::None :
+                llvm::CodeGenOpt::Default);
 
     std::unique_ptr<llvm::orc::LLLazyJIT> jit =
         ExitOnErr(llvm::orc::LLLazyJITBuilder().
@@ -279,6 +384,17 @@ class TCGLLVMTranslator {
 
     void jitPendingModule();
 
+    /* Tiered JIT: second tier, and bitcode of blocks not yet optimized */
+    std::unique_ptr<TCGLLVMTier2> m_tier2;
+    std::unordered_map<TranslationBlock *, TCGLLVMTier2::Block> m_tierBitcode;
+    std::deque<std::pair<TranslationBlock *, std::string>> m_tierOrder;
+    size_t m_tierBitcodeBytes = 0;
+    /* addresses of first tier functions called by blocks, 0 if undefined */
+    std::unordered_map<std::string, uint64_t> m_tier1Symbols;
+
+    void keepBitcode(TranslationBlock *tb, const std::string &name);
+    void promote(TranslationBlock *tb);
+
     public:
     TCGLLVMTranslator();
     ~TCGLLVMTranslator();
@@ -306,6 +422,9 @@ class TCGLLVMTranslator {
     /* Code generation */
     void generateCode(TCGContext *s, TranslationBlock *tb);
 
+    /* Called before each execution of tb when the JIT is tiered */
+    void tierUp(TranslationBlock *tb);
+
     void writeModule(const char* path);
 
     void addNewModuleCallback(NewModuleCallback newModuleCallback) {
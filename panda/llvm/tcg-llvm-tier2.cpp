@@ -0,0 +1,399 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+/*
+ * Second tier of the tiered LLVM JIT (-llvm-tiered), see TCGLLVMTier2 in
+ * tcg-llvm.h. Traces of hot blocks are built, optimized and JITted here, on
+ * background threads, while the vCPU keeps running first tier code.
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/Object/SymbolSize.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Transforms/InstCombine/InstCombine.h>
+#include <llvm/Transforms/IPO.h>
+#include <llvm/Transforms/IPO/AlwaysInliner.h>
+#include <llvm/Transforms/Utils.h>
+
+#include "panda/cheaders.h"
+#include "panda/tcg-llvm.h"
+
+using namespace llvm;
+
+/* prefix of the names of the functions generated for blocks */
+static const char tb_fn_prefix[] = "tcg-llvm-tb-";
+
+TCGLLVMTier2::TCGLLVMTier2(unsigned numThreads)
+    : m_ready(false), m_stop(false)
+{
+    ExitOnError exitOnErr;
+    auto jtmb = exitOnErr(orc::JITTargetMachineBuilder::detectHost());
+    jtmb.setCodeGenOptLevel(CodeGenOpt::Aggressive);
+    m_jit = exitOnErr(orc::LLJITBuilder().
+        setJITTargetMachineBuilder(std::move(jtmb)).
+        create());
+
+    // helpers and plugin functions not found in the first tier
+    m_jit->getMainJITDylib().addGenerator(cantFail(
+        orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+        m_jit->getDataLayout().getGlobalPrefix())));
+
+    // a batch is one object, so the code size of each block comes from the
+    // size of its symbol rather than of its section
+    static_cast<orc::RTDyldObjectLinkingLayer&>(
+            m_jit->getObjLinkingLayer()).setNotifyLoaded(
+        [this](orc::VModuleKey, const object::ObjectFile &obj,
+                const RuntimeDyld::LoadedObjectInfo &) {
+            std::lock_guard<std::mutex> guard(m_lock);
+            for (auto &sym : object::computeSymbolSizes(obj)) {
+                auto name = sym.first.getName();
+                if (!name) {
+                    consumeError(name.takeError());
+                    continue;
+                }
+                if (name->startswith(tb_fn_prefix)) {
+                    m_sizes[name->str()] = sym.second;
+                }
+            }
+        });
+
+    for (unsigned i = 0; i < numThreads; i++) {
+        m_threads.emplace_back(&TCGLLVMTier2::compileLoop, this);
+    }
+}
+
+TCGLLVMTier2::~TCGLLVMTier2()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto &t : m_threads) {
+        t.join();
+    }
+}
+
+void TCGLLVMTier2::submit(std::vector<Block> trace)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_queue.push_back(std::move(trace));
+    }
+    m_wake.notify_one();
+}
+
+void TCGLLVMTier2::install()
+{
+    std::vector<Result> results;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        results.swap(m_results);
+        m_ready.store(false, std::memory_order_relaxed);
+    }
+
+    for (auto &r : results) {
+        // skip traces with blocks that were invalidated, and maybe reused,
+        // since they were queued
+        bool valid = true;
+        for (auto &b : r.blocks) {
+            if (!b.first->llvm_tc_ptr || b.second != b.first->llvm_fn_name) {
+                valid = false;
+                break;
+            }
+        }
+        if (!valid) {
+            continue;
+        }
+        TranslationBlock *tb = r.blocks[0].first;
+        tb->llvm_asm_ptr = r.code;
+        tb->llvm_tc_end = r.code + r.size;
+        tb->llvm_trace_len = r.blocks.size();
+        tb->llvm_tc_ptr = r.code;
+    }
+}
+
+void TCGLLVMTier2::compileLoop()
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    while (true) {
+        m_wake.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+        // blocks tend to get hot together, so give the rest of them a
+        // moment to show up and share the module
+        m_wake.wait_for(lock, std::chrono::milliseconds(10), [this] {
+            return m_stop || m_queue.size() >= TCG_LLVM_TIER2_MAX_BATCH;
+        });
+        if (m_stop) {
+            return;
+        }
+
+        std::vector<std::vector<Block>> batch;
+        while (!m_queue.empty() && batch.size() < TCG_LLVM_TIER2_MAX_BATCH) {
+            batch.push_back(std::move(m_queue.front()));
+            m_queue.pop_front();
+        }
+
+        lock.unlock();
+        compile(batch);
+        lock.lock();
+    }
+}
+
+/* true if both modules define a global symbol with the same name */
+static bool definesSameSymbol(const Module &a, const Module &b)
+{
+    for (const GlobalValue &gv : b.global_values()) {
+        if (gv.isDeclaration() || gv.hasLocalLinkage()) {
+            continue;
+        }
+        const GlobalValue *other = a.getNamedValue(gv.getName());
+        if (other && !other->isDeclaration()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TCGLLVMTier2::compile(std::vector<std::vector<Block>> &batch)
+{
+    // each batch gets its own context, the first tier's is only ever used
+    // on the vCPU thread
+    orc::ThreadSafeContext tsc(std::make_unique<LLVMContext>());
+    std::vector<std::unique_ptr<Module>> modules;
+    std::unordered_map<std::string, Result> pending;
+    std::unordered_map<std::string, uint64_t> tier1Symbols;
+    for (auto &trace : batch) {
+        std::string symbol;
+        auto module = buildTrace(trace, *tsc.getContext(), symbol);
+        if (!module) {
+            continue;
+        }
+        Result &r = pending[symbol];
+        for (auto &b : trace) {
+            r.blocks.emplace_back(b.tb, b.name);
+            for (auto &callee : b.callees) {
+                if (callee.second != 0) {
+                    tier1Symbols.insert(callee);
+                }
+            }
+        }
+        modules.push_back(std::move(module));
+    }
+
+    // link the traces into as few modules as possible
+    while (!modules.empty()) {
+        std::unique_ptr<Module> linked = std::move(modules.front());
+        std::vector<std::unique_ptr<Module>> rest;
+        for (size_t i = 1; i < modules.size(); i++) {
+            if (definesSameSymbol(*linked, *modules[i])) {
+                rest.push_back(std::move(modules[i]));
+            } else if (Linker::linkModules(*linked, std::move(modules[i]))) {
+                std::cerr << "tcg-llvm tier 2: cannot link trace" << std::endl;
+            }
+        }
+        emit(std::move(linked), tsc, pending, tier1Symbols);
+        modules = std::move(rest);
+    }
+}
+
+/*
+ * Returns a module with the functions of the blocks of trace and, if there
+ * is more than one, a trace function calling them in turn, which is what
+ * symbol is set to. The block functions are inlined into the trace, so that
+ * they are optimized together.
+ */
+std::unique_ptr<Module> TCGLLVMTier2::buildTrace(std::vector<Block> &trace,
+        LLVMContext &ctx, std::string &symbol)
+{
+    std::unique_ptr<Module> module;
+    std::vector<Function *> fns;
+    for (auto &b : trace) {
+        auto m = parseBitcodeFile(MemoryBufferRef(b.bitcode, b.name), ctx);
+        if (!m) {
+            logAllUnhandledErrors(m.takeError(), errs(), "tcg-llvm tier 2: ");
+            break;
+        }
+        if (!module) {
+            module = std::move(*m);
+        } else if (definesSameSymbol(*module, **m) ||
+                Linker::linkModules(*module, std::move(*m))) {
+            break;
+        }
+        fns.push_back(module->getFunction(b.name));
+        // bitcode isn't needed anymore
+        std::string().swap(b.bitcode);
+    }
+    if (!module || fns.empty() || fns[0] == nullptr) {
+        return nullptr;
+    }
+    trace.resize(fns.size());
+    symbol = trace[0].name;
+    if (fns.size() == 1) {
+        return module;
+    }
+
+    // returns what the last block that ran returned:
+    //   r = block0(env)
+    //   if ((s = tcg_llvm_trace_next(env, r, tb1)) != 0) return s
+    //   r = block1(env)
+    //   ...
+    //   return r
+    symbol += "-trace";
+    FunctionType *fnType = fns[0]->getFunctionType();
+    Type *wordType = fnType->getReturnType();
+    Type *envType = fnType->getParamType(0);
+    Type *tbType = Type::getInt8PtrTy(ctx);
+    FunctionCallee next = module->getOrInsertFunction("tcg_llvm_trace_next",
+        wordType, envType, wordType, tbType);
+    Function *traceFn = Function::Create(fnType, Function::ExternalLinkage,
+        symbol, module.get());
+    Value *env = traceFn->arg_begin();
+    IRBuilder<> builder(BasicBlock::Create(ctx, "entry", traceFn));
+    Value *ret = nullptr;
+    for (size_t i = 0; i < fns.size(); i++) {
+        if (i > 0) {
+            Value *nextTb = ConstantExpr::getIntToPtr(ConstantInt::get(
+                Type::getIntNTy(ctx, sizeof(uintptr_t) * 8),
+                (uintptr_t)trace[i].tb), tbType);
+            Value *stop = builder.CreateCall(next, {env, ret, nextTb});
+            BasicBlock *cont = BasicBlock::Create(ctx, "block", traceFn);
+            BasicBlock *exit = BasicBlock::Create(ctx, "exit", traceFn);
+            builder.CreateCondBr(builder.CreateICmpEQ(stop,
+                ConstantInt::get(wordType, 0)), cont, exit);
+            builder.SetInsertPoint(exit);
+            builder.CreateRet(stop);
+            builder.SetInsertPoint(cont);
+        }
+        ret = builder.CreateCall(fns[i], {env});
+        fns[i]->setLinkage(GlobalValue::InternalLinkage);
+        fns[i]->addFnAttr(Attribute::AlwaysInline);
+    }
+    builder.CreateRet(ret);
+    return module;
+}
+
+void TCGLLVMTier2::emit(std::unique_ptr<Module> module,
+        orc::ThreadSafeContext tsc,
+        std::unordered_map<std::string, Result> &pending,
+        const std::unordered_map<std::string, uint64_t> &tier1Symbols)
+{
+    legacy::PassManager mpm;
+    mpm.add(createAlwaysInlinerLegacyPass());
+    mpm.add(createGlobalDCEPass());
+    mpm.run(*module);
+
+    legacy::FunctionPassManager fpm(module.get());
+    fpm.add(createPromoteMemoryToRegisterPass());
+    fpm.add(createInstructionCombiningPass());
+    fpm.add(createReassociatePass());
+    fpm.add(createGVNPass());
+    fpm.add(createDeadStoreEliminationPass());
+    fpm.add(createCFGSimplificationPass());
+    fpm.doInitialization();
+    std::vector<std::string> symbols;
+    for (Function &f : *module) {
+        if (f.isDeclaration()) {
+            continue;
+        }
+        fpm.run(f);
+        if (pending.count(f.getName().str())) {
+            symbols.push_back(f.getName().str());
+        }
+    }
+    fpm.doFinalization();
+
+    if (verifyModule(*module, &errs())) {
+        std::cerr << "tcg-llvm tier 2: dropping invalid module" << std::endl;
+        return;
+    }
+
+    defineTier1Symbols(*module, tier1Symbols);
+    if (auto err = m_jit->addIRModule(
+            orc::ThreadSafeModule(std::move(module), tsc))) {
+        logAllUnhandledErrors(std::move(err), errs(), "tcg-llvm tier 2: ");
+        return;
+    }
+
+    // the first lookup compiles the whole module
+    std::vector<Result> results;
+    for (auto &symbol : symbols) {
+        auto sym = m_jit->lookup(symbol);
+        if (!sym) {
+            logAllUnhandledErrors(sym.takeError(), errs(),
+                "tcg-llvm tier 2: ");
+            continue;
+        }
+        Result &r = pending[symbol];
+        r.code = (uint8_t *)sym->getAddress();
+        r.size = 0;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            auto it = m_sizes.find(symbol);
+            if (it != m_sizes.end()) {
+                r.size = it->second;
+                m_sizes.erase(it);
+            }
+        }
+        // without the size, host PCs in the code can't be mapped back to
+        // the block, so it stays in the first tier
+        if (r.size == 0) {
+            continue;
+        }
+        results.push_back(std::move(r));
+    }
+
+    if (!results.empty()) {
+        std::lock_guard<std::mutex> guard(m_lock);
+        for (auto &r : results) {
+            m_results.push_back(std::move(r));
+        }
+        m_ready.store(true, std::memory_order_release);
+    }
+}
+
+/*
+ * The blocks call helpers and other functions that were JITted by the first
+ * tier, and must call the same instances of them. Their addresses come with
+ * the blocks, see Block::callees.
+ */
+void TCGLLVMTier2::defineTier1Symbols(Module &module,
+        const std::unordered_map<std::string, uint64_t> &tier1Symbols)
+{
+    std::lock_guard<std::mutex> guard(m_defineLock);
+    orc::SymbolMap symbols;
+    for (const GlobalValue &gv : module.global_values()) {
+        if (!gv.isDeclaration() || gv.hasLocalLinkage()) {
+            continue;
+        }
+        const Function *f = dyn_cast<Function>(&gv);
+        if (f && f->isIntrinsic()) {
+            continue;
+        }
+        std::string name = gv.getName().str();
+        if (m_defined.count(name)) {
+            continue;
+        }
+        auto it = tier1Symbols.find(name);
+        if (it == tier1Symbols.end()) {
+            // left to the search of the process' symbols
+            continue;
+        }
+        symbols[m_jit->mangleAndIntern(name)] = JITEvaluatedSymbol(
+            it->second, JITSymbolFlags::Exported);
+        m_defined.insert(name);
+    }
+    if (!symbols.empty()) {
+        cantFail(m_jit->getMainJITDylib().define(
+            orc::absoluteSymbols(std::move(symbols))));
+    }
+}
@@ -78,6 +78,8 @@ extern "C" {
     /* This data is accessible from generated code */
     TCGLLVMRuntime tcg_llvm_runtime = {};
 
+    int llvm_tiered = 0;
+
     /* the TB whose host assembly size still needs to be determined */
     static struct TranslationBlock *pending_tb;
     static bool need_section_size = false;
@@ -189,6 +191,10 @@ TCGLLVMTranslator::TCGLLVMTranslator()
             getLLVMAssemblySize;
     static_cast<orc::RTDyldObjectLinkingLayer&>(
             jit->getObjLinkingLayer()).setNotifyLoaded(notify_loaded_fn);
+
+    if (llvm_tiered) {
+        m_tier2 = std::make_unique<TCGLLVMTier2>(TCG_LLVM_TIER2_THREADS);
+    }
 }
 
 void TCGLLVMTranslator::adjustTypeSize(unsigned target, Value **v1) {
@@ -1317,6 +1323,119 @@ void TCGLLVMTranslator::jitPendingModule()
 }
 
 
+void TCGLLVMTranslator::keepBitcode(TranslationBlock *tb,
+        const std::string &name)
+{
+    TCGLLVMTier2::Block block{tb, name};
+    raw_string_ostream os(block.bitcode);
+    WriteBitcodeToFile(*m_module, os);
+    os.flush();
+
+    // resolved by promote()
+    for (const GlobalValue &gv : m_module->global_values()) {
+        const Function *f = dyn_cast<Function>(&gv);
+        if (gv.isDeclaration() && !gv.hasLocalLinkage() &&
+                !(f && f->isIntrinsic())) {
+            block.callees.emplace_back(gv.getName().str(), 0);
+        }
+    }
+
+    auto it = m_tierBitcode.find(tb);
+    if (it != m_tierBitcode.end()) {
+        m_tierBitcodeBytes -= it->second.bitcode.size();
+    }
+    m_tierBitcodeBytes += block.bitcode.size();
+    m_tierBitcode[tb] = std::move(block);
+    m_tierOrder.emplace_back(tb, name);
+
+    // forget the oldest blocks first; blocks that get hot usually do so
+    // soon after they are translated
+    while (m_tierBitcodeBytes > TCG_LLVM_TIER2_BITCODE_MAX) {
+        auto old = m_tierOrder.front();
+        m_tierOrder.pop_front();
+        auto oit = m_tierBitcode.find(old.first);
+        if (oit != m_tierBitcode.end() && oit->second.name == old.second) {
+            m_tierBitcodeBytes -= oit->second.bitcode.size();
+            m_tierBitcode.erase(oit);
+        }
+    }
+}
+
+/* Does a trace through tb go on with the block that usually follows it? */
+static bool tierTraceContinues(TranslationBlock *tb)
+{
+    uint32_t runs = std::min<uint32_t>(tb->llvm_exec_count,
+        TCG_LLVM_TIER2_THRESHOLD);
+    return tb->llvm_trace_next != nullptr && tb->llvm_trace_count > 0 &&
+        tb->llvm_trace_count * 2 >= runs;
+}
+
+void TCGLLVMTranslator::promote(TranslationBlock *tb)
+{
+    // follow the blocks that usually run after tb for as long as their
+    // bitcode is still around
+    std::vector<TCGLLVMTier2::Block> trace;
+    std::unordered_set<TranslationBlock *> seen;
+    for (TranslationBlock *cur = tb; cur && trace.size() < TCG_LLVM_TRACE_MAX;
+            cur = tierTraceContinues(cur) ? cur->llvm_trace_next : nullptr) {
+        auto it = m_tierBitcode.find(cur);
+        // the bitcode may have been dropped, or belong to an earlier block
+        // that used the same TranslationBlock
+        if (it == m_tierBitcode.end() || !cur->llvm_tc_ptr ||
+                it->second.name != cur->llvm_fn_name ||
+                !seen.insert(cur).second) {
+            break;
+        }
+        trace.push_back(it->second);
+        // looking them up may materialize lazy modules in our context, so
+        // it's done here rather than by the second tier's threads
+        for (auto &callee : trace.back().callees) {
+            auto sit = m_tier1Symbols.find(callee.first);
+            if (sit == m_tier1Symbols.end()) {
+                auto sym = jit->lookup(callee.first);
+                uint64_t addr = 0;
+                if (sym) {
+                    addr = sym->getAddress();
+                } else {
+                    // left to the search of the process' symbols
+                    consumeError(sym.takeError());
+                }
+                sit = m_tier1Symbols.emplace(callee.first, addr).first;
+            }
+            callee.second = sit->second;
+        }
+    }
+    if (!trace.empty()) {
+        m_tier2->submit(std::move(trace));
+    }
+}
+
+void TCGLLVMTranslator::tierUp(TranslationBlock *tb)
+{
+    if (m_tier2->ready()) {
+        m_tier2->install();
+    }
+
+    // profile which block follows the previous one, by majority vote,
+    // until the previous one is optimized
+    TranslationBlock *prev = tcg_llvm_runtime.last_tb;
+    if (prev && prev->llvm_exec_count < TCG_LLVM_TIER2_THRESHOLD) {
+        if (prev->llvm_trace_next == tb) {
+            prev->llvm_trace_count++;
+        } else if (prev->llvm_trace_count == 0) {
+            prev->llvm_trace_next = tb;
+            prev->llvm_trace_count = 1;
+        } else {
+            prev->llvm_trace_count--;
+        }
+    }
+
+    if (tb->llvm_exec_count < TCG_LLVM_TIER2_THRESHOLD &&
+            ++tb->llvm_exec_count == TCG_LLVM_TIER2_THRESHOLD) {
+        promote(tb);
+    }
+}
+
 void TCGLLVMTranslator::generateCode(TCGContext *s, TranslationBlock *tb)
 {
     assert(tb->llvm_tc_ptr == nullptr);
@@ -1447,6 +1566,12 @@ void TCGLLVMTranslator::generateCode(TCGContext *s, TranslationBlock *tb)
 #endif
 
     if(execute_llvm || qemu_loglevel_mask(CPU_LOG_LLVM_ASM)) {
+        // the function is gone once the module is JITted, so keep its
+        // bitcode in case the block becomes hot
+        if (m_tier2 && execute_llvm) {
+            keepBitcode(tb, fName.str());
+        }
+
         jitPendingModule();
 
         auto symbol = jit->lookup(fName.str());
@@ -1511,6 +1636,9 @@ void TCGLLVMTranslator::generateCode(TCGContext *s, TranslationBlock *tb)
  */
 TCGLLVMTranslator::~TCGLLVMTranslator()
 {
+    // stop the background compiles before the JIT they link against goes
+    m_tier2.reset();
+
     if (m_functionPassManager) {
         delete m_functionPassManager;
         m_functionPassManager = nullptr;
@@ -1584,6 +1712,10 @@ void tcg_llvm_tb_alloc(TranslationBlock *tb)
     tb->llvm_asm_ptr = nullptr;
     tb->llvm_tc_ptr = nullptr;
     tb->llvm_tc_end = nullptr;
+    tb->llvm_exec_count = 0;
+    tb->llvm_trace_next = nullptr;
+    tb->llvm_trace_count = 0;
+    tb->llvm_trace_len = 0;
 }
 
 void tcg_llvm_tb_free(TranslationBlock *tb)
@@ -1593,6 +1725,10 @@ void tcg_llvm_tb_free(TranslationBlock *tb)
         tb->llvm_asm_ptr = nullptr;
         tb->llvm_tc_ptr = nullptr;
         tb->llvm_tc_end = nullptr;
+        tb->llvm_exec_count = 0;
+        tb->llvm_trace_next = nullptr;
+        tb->llvm_trace_count = 0;
+        tb->llvm_trace_len = 0;
     }
 }
 
@@ -1607,6 +1743,9 @@ const char* tcg_llvm_get_func_name(TranslationBlock *tb)
 
 uintptr_t tcg_llvm_qemu_tb_exec(CPUArchState *env, TranslationBlock *tb)
 {
+    if (llvm_tiered) {
+        tcg_llvm_translator->tierUp(tb);
+    }
     tcg_llvm_runtime.last_tb = tb;
     uintptr_t next_tb;
     next_tb = ((uintptr_t (*)(void*)) tb->llvm_tc_ptr)(env);
@@ -654,11 +654,19 @@ void asidstory_before_block_exec(CPUState *env, TranslationBlock *tb) {
         scale = ((double) num_cells) / ((double) max_instr);
     }
 
+    // This runs for every block, so use the OSI variants that fill our own
+    // structs instead of allocating new ones every time.
+    static OsiProc current_proc_buf = {};
+    OsiProc *current_proc = NULL;
+    if (get_current_process_into(env, &current_proc_buf)) {
+        current_proc = &current_proc_buf;
+    }
+    OsiThread t;
+
     // all this is about figuring out if and when we know the current process
     switch (process_mode) {
 
     case Process_known: {
-        OsiProc *current_proc = get_current_process(env);
         if (check_proc(current_proc)) {
             if (0 != strcmp(current_proc->name, first_good_proc->name)) {
                 // process name changed -- execve?
@@ -671,38 +679,30 @@ void asidstory_before_block_exec(CPUState *env, TranslationBlock *tb) {
                 }
 
                 first_good_proc = copy_osiproc(current_proc, first_good_proc);
-                OsiThread *t = get_current_thread(env);
-                first_good_proc_tid = t->tid;
+                first_good_proc_tid = get_current_thread_into(env, &t) ? t.tid : 0;
                 instr_first_good_proc = curr_instr;
                 process_mode = Process_suspicious;
                 process_counter = PROCESS_GOOD_NUM;
                 PPP_RUN_CB(on_proc_change, env, asid_at_asid_changed, first_good_proc);
-                free_osithread(t);
             }
         }
-        free_osiproc(current_proc);
         break;
     }
     case Process_unknown: {
         if (debug) printf("before_bb: process_mode unknown\n");
-        OsiProc *current_proc = get_current_process(env);
         if (check_proc(current_proc)) {
             // first good proc
             first_good_proc = copy_osiproc(current_proc, first_good_proc);
-            OsiThread *t = get_current_thread(env);
-            first_good_proc_tid = t->tid;
+            first_good_proc_tid = get_current_thread_into(env, &t) ? t.tid : 0;
             first_good_proc_ppid = first_good_proc->ppid;
             instr_first_good_proc = get_instr_count();
             process_mode = Process_suspicious;
             process_counter = PROCESS_GOOD_NUM;
             if (debug) printf ("before_bb: process_mode suspicious.  %d %s\n", (int) current_proc->pid, current_proc->name);
-            free_osithread(t);
         }
-        free_osiproc(current_proc);
         break;
     }
     case Process_suspicious: {
-        OsiProc *current_proc = get_current_process(env);
         if (check_proc(current_proc) && (process_same(current_proc, first_good_proc))) {
             // proc good and also stable
             process_counter--;
@@ -719,7 +719,6 @@ void asidstory_before_block_exec(CPUState *env, TranslationBlock *tb) {
             process_mode = Process_unknown;
             if (debug) printf ("before_bb: process_mode unknown\n");
         }
-        free_osiproc(current_proc);
         break;
     }
     default: {}
@@ -28,6 +28,7 @@ PANDAENDCOMMENT */
 #include <algorithm>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <capstone/capstone.h>
@@ -91,8 +92,8 @@ enum instr_type {
 };
 
 struct stack_entry {
-    target_ulong pc;
-    instr_type kind;
+    target_ulong pc;        // return address
+    target_ulong function;  // entry point of the called function
 };
 
 #define MAX_STACK_DIFF 5000
@@ -114,15 +115,34 @@ typedef std::tuple<target_ulong, target_ulong, bool> stackid;
 target_ulong cached_sp = 0;
 target_ulong cached_asid = 0;
 
+struct stackid_hash {
+    size_t operator()(const stackid &si) const {
+        uint64_t h = (uint64_t)std::get<0>(si) * 0x9E3779B97F4A7C15ull;
+        h ^= (uint64_t)std::get<1>(si) + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+        return (size_t)(h ^ std::get<2>(si));
+    }
+};
+
 // stackid -> shadow stack
-std::map<stackid, std::vector<stack_entry>> callstacks;
-// stackid -> function entry points
-std::map<stackid, std::vector<target_ulong>> function_stacks;
-// EIP -> instr_type
-std::map<target_ulong, instr_type> call_cache;
+std::unordered_map<stackid, std::vector<stack_entry>, stackid_hash> callstacks;
 // stackid -> address of Stopped block
 std::map<stackid, target_ulong> stoppedInfo;
 
+// The most recently used shadow stack. Consecutive blocks almost always run
+// on the same one, so this saves the hash lookup.
+static stackid last_stackid;
+static std::vector<stack_entry> *last_stack = NULL;
+
+// The stack id is computed once per block, in before_block_exec, and reused
+// by API calls made while the block runs. The ASID and privilege level are
+// rechecked before reusing it, in case the block was left through an
+// exception. after_block_exec recomputes it to push a call unless stacks
+// are per ASID, since a thread switch or an interrupt in the block may have
+// changed it without changing those.
+static bool block_stack_valid = false;
+static target_ulong block_asid;
+static bool block_in_kernel;
+
 int last_ret_size = 0;
 
 void verbose_log(const char *msg, TranslationBlock *tb, stackid curStackid,
@@ -188,12 +208,19 @@ static stackid get_heuristic_stackid(CPUState* cpu) {
             cursi = std::make_tuple(asid, sp, 0);
         }
         else {
-            // Find the closest stack pointer we've seen
-            auto lb = std::lower_bound(stackset.begin(), stackset.end(), sp);
-            target_ulong stack1 = *lb;
-            lb--;
-            target_ulong stack2 = *lb;
-            target_ulong stack = (std::imaxabs(stack1 - sp) < std::imaxabs(stack2 - sp)) ? stack1 : stack2;
+            // Find the closest stack pointer we've seen (using the set's own
+            // lower_bound, std::lower_bound is linear on a set)
+            auto hi = stackset.lower_bound(sp);
+            target_ulong stack;
+            if (hi == stackset.end()) {
+                stack = *std::prev(hi);
+            } else if (hi == stackset.begin()) {
+                stack = *hi;
+            } else {
+                target_ulong stack1 = *hi;
+                target_ulong stack2 = *std::prev(hi);
+                stack = (std::imaxabs(stack1 - sp) < std::imaxabs(stack2 - sp)) ? stack1 : stack2;
+            }
             int diff = std::imaxabs(stack-sp);
             if (diff < MAX_STACK_DIFF) {
                 cursi = std::make_tuple(asid, stack, 0);
@@ -233,6 +260,24 @@ static stackid get_stackid(CPUState* cpu) {
     // end of function get_stackid
 }
 
+static std::vector<stack_entry> &get_stack(const stackid &si) {
+    if (last_stack == NULL || si != last_stackid) {
+        last_stack = &callstacks[si];
+        last_stackid = si;
+    }
+    return *last_stack;
+}
+
+// Makes last_stackid/last_stack refer to the stack the CPU is running on
+static std::vector<stack_entry> &current_stack(CPUState *cpu) {
+    if (block_stack_valid &&
+        block_asid == panda_current_asid(cpu) &&
+        block_in_kernel == panda_in_kernel(cpu)) {
+        return *last_stack;
+    }
+    return get_stack(get_stackid(cpu));
+}
+
 instr_type disas_block(CPUArchState* env, target_ulong pc, int size) {
     unsigned char *buf = (unsigned char *) malloc(size);
     int err = panda_virtual_memory_rw(ENV_GET_CPU(env), pc, buf, size, 0);
@@ -317,14 +362,17 @@ done2:
 void after_block_translate(CPUState *cpu, TranslationBlock *tb) {
     CPUArchState *env = static_cast<CPUArchState *>(cpu->env_ptr);
 
-    call_cache[tb->pc] = disas_block(env, tb->pc, tb->size);
+    tb->panda_end_type = disas_block(env, tb->pc, tb->size);
 
     return;
 }
 
 void before_block_exec(CPUState *cpu, TranslationBlock *tb) {
-  std::vector<stack_entry> &v = callstacks[get_stackid(cpu)];
-  std::vector<target_ulong> &w = function_stacks[get_stackid(cpu)];
+  block_stack_valid = false;
+  std::vector<stack_entry> &v = get_stack(get_stackid(cpu));
+  block_asid = panda_current_asid(cpu);
+  block_in_kernel = panda_in_kernel(cpu);
+  block_stack_valid = true;
   if (v.empty()) {
     return;
   }
@@ -335,9 +383,8 @@ void before_block_exec(CPUState *cpu, TranslationBlock *tb) {
       // printf("Matched at depth %d\n", v.size()-i);
       // v.erase(v.begin()+i, v.end());
 
-      PPP_RUN_CB(on_ret, cpu, w[i]);
+      PPP_RUN_CB(on_ret, cpu, v[i].function);
       v.erase(v.begin() + i, v.end());
-      w.erase(w.begin() + i, w.end());
 
       break;
     }
@@ -350,27 +397,28 @@ void after_block_exec(CPUState* cpu, TranslationBlock *tb, uint8_t exitCode) {
     uint32_t flags = 0x0;
 
     if (TB_EXIT_IDX1 < exitCode) {
+        block_stack_valid = false;
         return;
     }
 
     CPUArchState *env = (CPUArchState *)cpu->env_ptr;
-    instr_type tb_type = call_cache[tb->pc];
-    stackid curStackid = get_stackid(cpu);
+    instr_type tb_type = (instr_type)tb->panda_end_type;
 
     if (tb_type == INSTR_CALL) {
-        stack_entry se = {tb->pc + tb->size, tb_type};
-        callstacks[curStackid].push_back(se);
-
-        // Also track the function that gets called
-        // This retrieves the pc in an architecture-neutral way
+        // This retrieves the pc of the function that gets called in an
+        // architecture-neutral way
         cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
-        function_stacks[curStackid].push_back(pc);
+        stack_entry se = {tb->pc + tb->size, pc};
+        std::vector<stack_entry> &v = (STACK_ASID == stack_segregation)
+            ? current_stack(cpu) : get_stack(get_stackid(cpu));
+        v.push_back(se);
 
         PPP_RUN_CB(on_call, cpu, pc);
     } else if (tb_type == INSTR_RET) {
         //printf("Just executed a RET in TB " TARGET_FMT_lx "\n", tb->pc);
         //if (next) printf("Next TB: " TARGET_FMT_lx "\n", next->pc);
     }
+    block_stack_valid = false;
 }
 
 
@@ -378,7 +426,7 @@ void after_block_exec(CPUState* cpu, TranslationBlock *tb, uint8_t exitCode) {
  * @brief Fills preallocated buffer \p callers with up to \p n call addresses.
  */
 uint32_t get_callers(target_ulong callers[], uint32_t n, CPUState* cpu) {
-    std::vector<stack_entry> &v = callstacks[get_stackid(cpu)];
+    std::vector<stack_entry> &v = current_stack(cpu);
 
     n = std::min((uint32_t)v.size(), n);
     for (uint32_t i=0; i<n; i++) { callers[i] = v[v.size()-1-i].pc; }
@@ -392,7 +440,7 @@ uint32_t get_callers(target_ulong callers[], uint32_t n, CPUState* cpu) {
  */
 Panda__CallStack *pandalog_callstack_create() {
     assert(pandalog);
-    std::vector<stack_entry> &v = callstacks[get_stackid(first_cpu)];
+    std::vector<stack_entry> &v = current_stack(first_cpu);
 
     Panda__CallStack *cs = (Panda__CallStack *)malloc(sizeof(Panda__CallStack));
     *cs = PANDA__CALL_STACK__INIT;
@@ -418,10 +466,10 @@ void pandalog_callstack_free(Panda__CallStack *cs) {
  * @brief Fills preallocated buffer \p functions with up to \p n function addresses.
  */
 uint32_t get_functions(target_ulong functions[], uint32_t n, CPUState* cpu) {
-    std::vector<target_ulong> &v = function_stacks[get_stackid(cpu)];
+    std::vector<stack_entry> &v = current_stack(cpu);
 
     n = std::min((uint32_t)v.size(), n);
-    for (uint32_t i=0; i<n; i++) { functions[i] = v[v.size()-1-i]; }
+    for (uint32_t i=0; i<n; i++) { functions[i] = v[v.size()-1-i].function; }
     return n;
 }
 
@@ -431,7 +479,8 @@ void get_prog_point(CPUState* cpu, prog_point *p) {
     CPUArchState *env = static_cast<CPUArchState *>(cpu->env_ptr);
 
     // Get stack ID
-    stackid curStackid = get_stackid(cpu);
+    current_stack(cpu);
+    stackid curStackid = last_stackid;
 
     // Lump all kernel-mode CR3s together
     if(!panda_in_kernel(cpu)) {
@@ -0,0 +1,153 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __PROG_POINT_TABLE_H
+#define __PROG_POINT_TABLE_H
+
+/*
+ * Hash table from prog_points to per-tap state, for plugins that look up a
+ * tap point on every memory access (stringsearch, tapindex, unigrams, ...).
+ *
+ * Entries are stored inline in an open-addressed (linear probing) table, and
+ * the slot of the most recent lookup is remembered, since consecutive
+ * accesses very often come from the same tap point. Entries can't be removed
+ * individually. As with std::vector, inserting may move the values, so don't
+ * hold on to a reference across an insertion into the same table.
+ *
+ * Iteration order is arbitrary; use sorted() to write reports in the same
+ * order a std::map<prog_point, V> would have used.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "prog_point.h"
+
+template<typename V>
+class ProgPointTable {
+public:
+    ProgPointTable() { clear(); }
+
+    void clear() {
+        slots_.clear();
+        slots_.resize(16);
+        count_ = 0;
+        last_ = NONE;
+    }
+
+    size_t size() const { return count_; }
+
+    bool empty() const { return count_ == 0; }
+
+    // Returns the value for p, or NULL if p isn't in the table.
+    V *find(const prog_point &p) {
+        size_t i = lookup(p);
+        return (i == NONE) ? NULL : &slots_[i].value;
+    }
+
+    // Returns the value for p, default-constructing it if needed.
+    V &operator[](const prog_point &p) {
+        size_t i = lookup(p);
+        if (i != NONE) return slots_[i].value;
+        if ((count_ + 1) * 2 > slots_.size()) {
+            grow();
+        }
+        i = probe(slots_, p);
+        Slot &s = slots_[i];
+        s.used = true;
+        memcpy(&s.key, &p, sizeof(p));
+        count_++;
+        last_ = i;
+        return s.value;
+    }
+
+    template<typename F>
+    void for_each(F fn) {
+        for (auto &s : slots_) {
+            if (s.used) fn(s.key, s.value);
+        }
+    }
+
+    // All entries, ordered by prog_point::operator<.
+    std::vector<std::pair<const prog_point *, V *>> sorted() {
+        std::vector<std::pair<const prog_point *, V *>> out;
+        out.reserve(count_);
+        for (auto &s : slots_) {
+            if (s.used) out.push_back(std::make_pair(&s.key, &s.value));
+        }
+        std::sort(out.begin(), out.end(),
+            [](const std::pair<const prog_point *, V *> &a,
+               const std::pair<const prog_point *, V *> &b) {
+                return *a.first < *b.first;
+            });
+        return out;
+    }
+
+private:
+    static const size_t NONE = (size_t)-1;
+
+    struct Slot {
+        Slot() : used(false) { memset(&key, 0, sizeof(key)); }
+        prog_point key;
+        bool used;
+        V value;
+    };
+
+    static uint64_t mix(uint64_t h, uint64_t v) {
+        h ^= v + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+        return h;
+    }
+
+    static size_t hash(const prog_point &p) {
+        uint64_t h = (uint64_t)p.pc * 0x9E3779B97F4A7C15ull;
+        h = mix(h, p.caller);
+        h = mix(h, p.sidFirst);
+        h = mix(h, p.sidSecond);
+        h = mix(h, ((uint64_t)p.stackKind << 1) | p.isKernelMode);
+        return (size_t)(h ^ (h >> 29));
+    }
+
+    static size_t probe(const std::vector<Slot> &slots, const prog_point &p) {
+        size_t mask = slots.size() - 1;
+        size_t i = hash(p) & mask;
+        while (slots[i].used && !(slots[i].key == p)) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    size_t lookup(const prog_point &p) {
+        if (last_ != NONE && slots_[last_].key == p) {
+            return last_;
+        }
+        size_t i = probe(slots_, p);
+        if (!slots_[i].used) return NONE;
+        last_ = i;
+        return i;
+    }
+
+    void grow() {
+        std::vector<Slot> bigger(slots_.size() * 2);
+        for (auto &s : slots_) {
+            if (!s.used) continue;
+            Slot &d = bigger[probe(bigger, s.key)];
+            d.used = true;
+            memcpy(&d.key, &s.key, sizeof(s.key));
+            d.value = std::move(s.value);
+        }
+        slots_.swap(bigger);
+        last_ = NONE;
+    }
+
+    std::vector<Slot> slots_;
+    size_t count_;
+    size_t last_;
+};
+
+#endif
@@ -20,6 +20,7 @@ PANDAENDCOMMENT */
 #include <map> 
 #include <set>
 #include <algorithm>
+#include <memory>
 #include "panda/plugin.h"
 #include "osi/osi_types.h"
 #include "osi/osi_ext.h"
@@ -98,22 +99,66 @@ inline bool operator<(const pair<string, target_ulong>& s, const pair<string, ta
     return s_comp;
 }
 
-// https://stackoverflow.com/questions/32685540/why-cant-i-compile-an-unordered-map-with-a-pair-as-key
-// Only for pairs of std::hash-able types for simplicity.
-// You can of course template this struct to allow other hash functions
-struct pair_hash {
-    template <class T1, class T2>
-    std::size_t operator () (const std::pair<T1,T2> &p) const {
-        auto h1 = std::hash<T1>{}(p.first);
-        auto h2 = std::hash<T2>{}(p.second);
-        return h1 ^ h2;  
+/*
+ * The dynamic symbols of one library image, parsed once and shared by every
+ * process that maps the same file (at whatever base). Symbols are stored as
+ * offsets from the load base in two sorted arrays: by offset, for
+ * address -> symbol lookups, and by name.
+ */
+struct image_symbol {
+    target_ulong offset;
+    uint32_t name;      // offset into library_image::names
+};
+
+struct library_image {
+    string names;                    // NUL-separated symbol names
+    vector<image_symbol> by_offset;  // sorted by offset
+    vector<uint32_t> by_name;        // indices into by_offset, sorted by name
+    // checked before reusing the image for a mapping with the same
+    // fingerprint, in case of a collision
+    target_ulong module_size;
+    uint64_t symtab_sample;          // hash of the first symtab entries
+
+    const char *name_of(const image_symbol &s) const {
+        return names.c_str() + s.name;
     }
+
+    const image_symbol *find(const char *name) const {
+        auto it = lower_bound(by_name.begin(), by_name.end(), name,
+            [this](uint32_t i, const char *n) { return strcmp(name_of(by_offset[i]), n) < 0; });
+        if (it == by_name.end() || strcmp(name_of(by_offset[*it]), name) != 0) {
+            return NULL;
+        }
+        return &by_offset[*it];
+    }
+
+    // closest symbol at or below offset
+    const image_symbol *best_match(target_ulong offset) const {
+        auto it = upper_bound(by_offset.begin(), by_offset.end(), offset,
+            [](target_ulong o, const image_symbol &s) { return o < s.offset; });
+        if (it == by_offset.begin()) {
+            return NULL;
+        }
+        return &*(it - 1);
+    }
+};
+
+// A library image bound to a base address in one address space
+struct loaded_module {
+    string name;
+    target_ulong base;
+    shared_ptr<library_image> image;
 };
 
-// [section name, address] -> map of symbol name to symbols 
-unordered_map<pair<target_ulong,string>, unordered_map<string,struct symbol>, pair_hash> seen_libraries;
-// asid -> section_name ->  symbols map pointer
-unordered_map<target_ulong, unordered_map<string, unordered_map<string,struct symbol>*>> symbols;
+struct asid_symbols {
+    vector<loaded_module> modules;  // sorted by base
+    set<string> names;              // names of the modules above
+};
+
+// content fingerprint of an image -> parsed symbols
+unordered_map<uint64_t, shared_ptr<library_image>> images;
+// asid -> modules resolved in that address space
+unordered_map<target_ulong, asid_symbols> symbols;
 
 // section -> set of structs
 // section -> name -> set struct
@@ -125,61 +170,62 @@ void (*dlsym_hooks_flush_pc)(target_ulong pc);
 
 void hook_symbol_resolution(struct hook_symbol_resolve *h){
     // ISSUE: Doesn't resolve for hooks that have been previously resolved.
-    //printf("adding hook \"%s\" \"%s\" %llx\n", h->section, h->name, (long long unsigned int) h->cb);
     string section(h->section);
     string name(h->name);
     hooks[section][name].insert(*h);
 }
 
 
-void new_assignment_check_symbols(CPUState* cpu, unordered_map<string, struct symbol> ss, OsiModule* m){
+struct symbol make_symbol(const library_image &image, const image_symbol &is,
+                          const string &section, target_ulong base){
+    struct symbol s;
+    memset(&s, 0, sizeof(struct symbol));
+    s.address = base + is.offset;
+    strncpy((char*)&s.name, image.name_of(is), sizeof(s.name)-2);
+    strncpy((char*)&s.section, section.c_str(), sizeof(s.section)-2);
+    return s;
+}
+
+void new_assignment_check_symbols(CPUState* cpu, const library_image &image, OsiModule* m){
     string module(m->name);
     vector<tuple<struct hook_symbol_resolve, struct symbol, OsiModule>> symbols_to_flush;
 
-    set<string> matching_libs;
-    matching_libs.insert("");
-
-    for (auto strs : hooks){
-        string lib = strs.first;
-        auto h = strs.second;
-        if (!h.empty() && module.find(lib) != std::string::npos && !module.empty()){
-            matching_libs.insert(lib);
+    // only look at hooks whose library matches this module
+    for (auto &lib_hooks : hooks){
+        const string &lib = lib_hooks.first;
+        if (!lib.empty() && (module.empty() || module.find(lib) == std::string::npos)){
+            continue;
         }
-    }
-
-    for (string lib : matching_libs){
-        for (auto symbol_matcher : hooks[lib]){
-            string symname = symbol_matcher.first;
-            set<struct hook_symbol_resolve> h = symbol_matcher.second;
-            for (auto hook_candidate: h){
-                if (hook_candidate.enabled){
-                    if (symname.empty()){
-                        if (hook_candidate.hook_offset){
-                            struct symbol s;
-                            memset(&s, 0, sizeof(struct symbol));
-                            s.address = m->base + hook_candidate.offset;
-                            strncpy((char*)&s.section, m->name, sizeof(s.section)-2);
-                            symbols_to_flush.push_back(make_tuple(hook_candidate,s, *m));
-                        }else{
-                            for (auto sym: ss){
-                                symbols_to_flush.push_back(make_tuple(hook_candidate, sym.second, *m));
-                            }
-                        }
-                    }else{
-                        auto it = ss.find(symname);
-                        if (it != ss.end()){
-                            auto a = *it;
-                            symbols_to_flush.push_back(make_tuple(hook_candidate, a.second, *m));
-                        }
+        for (auto &symbol_matcher : lib_hooks.second){
+            const string &symname = symbol_matcher.first;
+            const image_symbol *match = NULL;
+            if (!symname.empty()){
+                match = image.find(symname.c_str());
+                if (match == NULL){
+                    continue;
+                }
+            }
+            for (auto &hook_candidate : symbol_matcher.second){
+                if (!hook_candidate.enabled){
+                    continue;
+                }
+                if (match != NULL){
+                    symbols_to_flush.push_back(make_tuple(hook_candidate, make_symbol(image, *match, module, m->base), *m));
+                }else if (hook_candidate.hook_offset){
+                    struct symbol s;
+                    memset(&s, 0, sizeof(struct symbol));
+                    s.address = m->base + hook_candidate.offset;
+                    strncpy((char*)&s.section, m->name, sizeof(s.section)-2);
+                    symbols_to_flush.push_back(make_tuple(hook_candidate, s, *m));
+                }else{
+                    for (auto &is : image.by_offset){
+                        symbols_to_flush.push_back(make_tuple(hook_candidate, make_symbol(image, is, module, m->base), *m));
                     }
                 }
             }
         }
     }
-    if (!symbols_to_flush.empty()){
-        //panda_do_flush_tb();
-        //printf("%s hooking %d symbols in %s\n", procname, (int)symbols_to_flush.size(), m->name);
-    }
+    // callbacks may register new hooks, so don't run them while iterating
     while (!symbols_to_flush.empty()){
         auto p = symbols_to_flush.back();
         auto hook_candidate = get<0>(p);
@@ -188,32 +234,23 @@ void new_assignment_check_symbols(CPUState* cpu, unordered_map<string, struct sy
         (*(hook_candidate.cb))(cpu, &hook_candidate, s, &m);
         symbols_to_flush.pop_back();
     }
-    //printf("finished adding symbols for %s:%s\n", procname, m->name);
 }
 
 struct symbol resolve_symbol(CPUState* cpu, target_ulong asid, char* section_name, char* symbol){
     update_symbols_in_space(cpu);
 
-    for (const auto section : symbols[asid]){
-        string n = section.first;
-        auto section_vec = section.second;
-        size_t found;
-        if (section_name == NULL){
-            found = 0;
-        }else{
-            found = n.find(section_name); 
-        }
-        //section name is A "does string exist in section"
-        if (found != string::npos){
-            string sym(symbol);
-            auto it = section_vec->find(sym);
-            if (it != section_vec->end()){
-                struct symbol val = it->second;
-                string val_str (val.name);
-                strncpy((char*) &val.section, section.first.c_str(), sizeof(val.section) -2);
-                return val;
+    auto as = symbols.find(asid);
+    if (as != symbols.end()){
+        for (const auto &lm : as->second.modules){
+            //section name is A "does string exist in section"
+            if (section_name != NULL && lm.name.find(section_name) == string::npos){
+                continue;
             }
-        } 
+            const image_symbol *is = lm.image->find(symbol);
+            if (is != NULL){
+                return make_symbol(*lm.image, *is, lm.name, lm.base);
+            }
+        }
     }
     struct symbol blank;
     blank.address = 0;
@@ -228,26 +265,45 @@ struct symbol get_best_matching_symbol(CPUState* cpu, target_ulong address, targ
     best_candidate.address = 0;
     memset((char*) & best_candidate.name, 0, MAX_PATH_LEN);
     memset((char*) & best_candidate.section, 0, MAX_PATH_LEN);
-    for (const auto& section : symbols[asid]){
-        unordered_map<string, struct symbol> section_symbols = *section.second;
-        for (auto i : section_symbols){
-            struct symbol it = i.second;
-            if (it.address > address){
-                if (it.address == address){
-                    // if we found a match just break and move on.
-                    memcpy(&best_candidate, &it, sizeof(struct symbol));
-                    break;
-                }
-                if (it.address > best_candidate.address){
-                    //copy it
-                    memcpy(&best_candidate, &it, sizeof(struct symbol));
-                }
-            }
-        }
+
+    auto as = symbols.find(asid);
+    if (as == symbols.end()){
+        return best_candidate;
+    }
+    // find the module containing address, then the closest symbol in it
+    auto &modules = as->second.modules;
+    auto it = upper_bound(modules.begin(), modules.end(), address,
+        [](target_ulong a, const loaded_module &lm) { return a < lm.base; });
+    if (it == modules.begin()){
+        return best_candidate;
+    }
+    const loaded_module &lm = *(it - 1);
+    const image_symbol *is = lm.image->best_match(address - lm.base);
+    if (is != NULL){
+        best_candidate = make_symbol(*lm.image, *is, lm.name, lm.base);
     }
     return best_candidate;
 }
 
+// FNV-1a, used to fingerprint library images
+static inline uint64_t fnv1a(uint64_t h, const void *data, size_t len){
+    const uint8_t *p = (const uint8_t *)data;
+    for (size_t i = 0; i < len; i++){
+        h ^= p[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+// hash of the first symtab entries of an image, or 0 if they can't be read
+uint64_t symtab_sample(CPUState* cpu, target_ulong symtab){
+    ELF(Sym) syms[8];
+    if (panda_virtual_memory_read(cpu, symtab, (uint8_t*)syms, sizeof(syms)) != MEMTX_OK){
+        return 0;
+    }
+    return fnv1a(0xcbf29ce484222325ull, syms, sizeof(syms));
+}
+
 string read_str(CPUState* cpu, target_ulong ptr){
     string buf = "";
     char tmp;
@@ -371,198 +427,229 @@ int get_numelements_symtab(CPUState* cpu, target_ulong base, target_ulong dt_has
 void helper(){};
 
 
+void bind_module(CPUState* cpu, target_ulong asid, OsiModule *m, shared_ptr<library_image> image){
+    asid_symbols &as = symbols[asid];
+    loaded_module lm;
+    lm.name = m->name;
+    lm.base = m->base;
+    lm.image = image;
+    auto it = upper_bound(as.modules.begin(), as.modules.end(), lm.base,
+        [](target_ulong b, const loaded_module &o) { return b < o.base; });
+    as.modules.insert(it, lm);
+    as.names.insert(lm.name);
+    new_assignment_check_symbols(cpu, *image, m);
+}
+
+// Returns a pointer to the len bytes of guest memory at addr: in place when
+// they are contiguous in host memory, otherwise copied into buf. Only valid
+// until the guest runs again, and not to be written to.
+const char *view_or_read(CPUState* cpu, target_ulong addr, size_t len, vector<char> &buf){
+    struct iovec iov;
+    if (len == 0){
+        return "";
+    }
+    if (panda_virtual_memory_view(cpu, addr, len, &iov, 1) == 1){
+        return (const char *)iov.iov_base;
+    }
+    buf.resize(len);
+    if (panda_virtual_memory_read(cpu, addr, (uint8_t*)buf.data(), len) != MEMTX_OK){
+        return NULL;
+    }
+    return buf.data();
+}
+
+shared_ptr<library_image> parse_image(CPUState* cpu, OsiProc *current, OsiModule *m, target_ulong symtab, target_ulong strtab,
+                                      target_ulong strtab_size, int numelements_symtab){
+    target_ulong symtab_size = numelements_symtab * sizeof(ELF(Sym));
+    vector<char> symtab_buf;
+    vector<char> strtab_buf;
+
+    const char *symtab_data = view_or_read(cpu, symtab, symtab_size, symtab_buf);
+    if (symtab_data == NULL){
+        error_case(current->name, m->name, "8 CNR SYMTAB");
+        return NULL;
+    }
+    const char *strtab_data = view_or_read(cpu, strtab, strtab_size, strtab_buf);
+    if (strtab_data == NULL){
+        error_case(current->name, m->name, "7 CNR STRTAB");
+        return NULL;
+    }
+
+    shared_ptr<library_image> image = make_shared<library_image>();
+    for (int i = 0; i < numelements_symtab; i++){
+        // copied out, the table may be guest memory
+        ELF(Sym) a;
+        memcpy(&a, symtab_data + i*sizeof(ELF(Sym)), sizeof(a));
+        fixupendian(a.st_name);
+        fixupendian(a.st_value);
+        if (a.st_name < strtab_size && a.st_value != 0){
+            const char *name = &strtab_data[a.st_name];
+            size_t len = strnlen(name, min((size_t)(strtab_size - a.st_name), (size_t)MAX_PATH_LEN-2));
+            image_symbol is;
+            is.offset = a.st_value;
+            is.name = image->names.size();
+            image->names.append(name, len);
+            image->names.push_back('\0');
+            image->by_offset.push_back(is);
+        }
+    }
+    stable_sort(image->by_offset.begin(), image->by_offset.end(),
+        [](const image_symbol &x, const image_symbol &y) { return x.offset < y.offset; });
+    image->by_name.resize(image->by_offset.size());
+    for (uint32_t i = 0; i < image->by_name.size(); i++){
+        image->by_name[i] = i;
+    }
+    library_image *img = image.get();
+    // ties by offset, so that lookups of a duplicate name are deterministic
+    stable_sort(image->by_name.begin(), image->by_name.end(), [img](uint32_t x, uint32_t y) {
+        return strcmp(img->name_of(img->by_offset[x]), img->name_of(img->by_offset[y])) < 0;
+    });
+    return image;
+}
+
 void find_symbols(CPUState* cpu, target_ulong asid, OsiProc *current, OsiModule *m){
     if (m->name == NULL){
         error_case(current->name, m->name, "m->name is NULL");
         return;
     }
-    string name(m->name);
 
-    // we already read this one
-    if (symbols[asid].find(name) != symbols[asid].end() && symbols[asid][name]->size() > 0){
-        error_case(current->name, m->name, " in symbols[asid] already and has");
-        //printf("%s %s already exists \n", current->name, m->name);
+    // we already resolved this one in this address space
+    auto as = symbols.find(asid);
+    if (as != symbols.end() && as->second.names.count(m->name)){
+        error_case(current->name, m->name, " in symbols[asid] already");
         return;
     }
 
-    pair<target_ulong, string> candidate(m->base, name);
-
-    auto it = seen_libraries.find(candidate);
-    if (it != seen_libraries.end()) {
-        //printf("COPY %s:%s for asid " TARGET_PTR_FMT "  and base of " TARGET_PTR_FMT "\n",  current->name, m->name, panda_current_asid(cpu), m->base);
-        //printf("size of ASID before is %d\n", (int)symbols[asid].size());
-        symbols[asid][name] = &seen_libraries[candidate];
-        //printf("size of ASID after is %d\n", (int)symbols[asid].size());
-        new_assignment_check_symbols(cpu, seen_libraries[candidate], m);
-        return;
-    }
     // static variable to store first 4 bytes of mapping
     char elf_magic[4];
 
     // read first 4 bytes
-    if (likely(panda_virtual_memory_read(cpu, m->base, (uint8_t*)elf_magic, 4) != MEMTX_OK)){            
+    if (likely(panda_virtual_memory_read(cpu, m->base, (uint8_t*)elf_magic, 4) != MEMTX_OK)){
         error_case(current->name, m->name, "3 CNRB");
         // can't read page.
         return;
     }
     // is it an ELF header?
-    if (unlikely(elf_magic[0] == '\x7f' && elf_magic[1] == 'E' && elf_magic[2] == 'L' && elf_magic[3] == 'F')){
-        ELF(Ehdr) ehdr;
-        // attempt to read memory allocation
-        if (panda_virtual_memory_read(cpu, m->base, (uint8_t*)&ehdr, sizeof(ELF(Ehdr))) != MEMTX_OK){
-            error_case(current->name, m->name, "4 CNREH");
-            //printf("cant read elf header\n");
-            return;
-        }
-
-
-        target_ulong phnum = ehdr.e_phnum;
-        target_ulong phoff = ehdr.e_phoff;
-        fixupendian(phnum);
-        fixupendian(phoff);
+    if (!(elf_magic[0] == '\x7f' && elf_magic[1] == 'E' && elf_magic[2] == 'L' && elf_magic[3] == 'F')){
+        error_case(current->name, m->name, "NOT AN ELF HEADER");
+        return;
+    }
+    ELF(Ehdr) ehdr;
+    // attempt to read memory allocation
+    if (panda_virtual_memory_read(cpu, m->base, (uint8_t*)&ehdr, sizeof(ELF(Ehdr))) != MEMTX_OK){
+        error_case(current->name, m->name, "4 CNREH");
+        return;
+    }
 
-        ELF(Phdr) dynamic_phdr;
+    target_ulong phnum = ehdr.e_phnum;
+    target_ulong phoff = ehdr.e_phoff;
+    fixupendian(phnum);
+    fixupendian(phoff);
 
-        //printf("Read Phdr from 0x%x + 0x%x + j*0x%lx\n", m->base, phoff, (sizeof(ELF(Phdr))));
+    ELF(Phdr) dynamic_phdr;
 
-        for (int j=0; j<phnum; j++){
-            if (panda_virtual_memory_read(cpu, m->base + phoff + (j*sizeof(ELF(Phdr))), (uint8_t*)&dynamic_phdr, sizeof(ELF(Phdr))) != MEMTX_OK){
-                error_case(current->name, m->name, "5 DPHDR");
-                return;
-            }
+    for (int j=0; j<phnum; j++){
+        if (panda_virtual_memory_read(cpu, m->base + phoff + (j*sizeof(ELF(Phdr))), (uint8_t*)&dynamic_phdr, sizeof(ELF(Phdr))) != MEMTX_OK){
+            error_case(current->name, m->name, "5 DPHDR");
+            return;
+        }
 
-            fixupendian(dynamic_phdr.p_type)
+        fixupendian(dynamic_phdr.p_type)
 
-            if (dynamic_phdr.p_type == PT_DYNAMIC){
-                break;
-            }else if (dynamic_phdr.p_type == PT_NULL){
-                error_case(current->name, m->name, "PTNULL");
-                //printf("hit PT_NULL\n");
-                return;
-            }else if (j == phnum -1){
-                error_case(current->name, m->name, "END");
-                //printf("hit phnum-1\n");
-                return;
-            }
+        if (dynamic_phdr.p_type == PT_DYNAMIC){
+            break;
+        }else if (dynamic_phdr.p_type == PT_NULL){
+            error_case(current->name, m->name, "PTNULL");
+            return;
+        }else if (j == phnum -1){
+            error_case(current->name, m->name, "END");
+            return;
         }
-        fixupendian(dynamic_phdr.p_filesz);
-        int numelements_dyn = dynamic_phdr.p_filesz / sizeof(ELF(Dyn));
-        // iterate over dynamic program headers and find strtab
-        // and symtab
-        ELF(Dyn) tag;
-        target_ulong strtab = 0, symtab = 0, strtab_size = 0, dt_hash = 0, gnu_hash = 0;
-        int j = 0;
-
-        fixupendian(dynamic_phdr.p_vaddr);
-        while (j < numelements_dyn){
-            //printf("Read Dyn PHDR from 0x%x + 0x%x + j*0x%lx\n", m->base, dynamic_phdr.p_vaddr, (sizeof(ELF(Phdr))));
-            if (panda_virtual_memory_read(cpu, m->base + dynamic_phdr.p_vaddr + (j*sizeof(ELF(Dyn))), (uint8_t*)&tag, sizeof(ELF(Dyn))) != MEMTX_OK){
-                //printf("%s:%s Failed to read entry %d\n", name.c_str(), current->name, j);
-                error_case(current->name, m->name, "5 DPDR");
-                return;
-            }
-
-            fixupendian(tag.d_tag);
-            fixupendian(tag.d_un.d_ptr);
-
-            if (tag.d_tag == DT_STRTAB){
-                //printf("Found DT_STRTAB\n");
-                strtab = tag.d_un.d_ptr;
-            }else if (tag.d_tag == DT_SYMTAB){
-                //printf("Found DT_SYMTAB\n");
-                symtab = tag.d_un.d_ptr;
-            }else if (tag.d_tag == DT_STRSZ ){
-                //printf("Found DT_STRSZ\n");
-                strtab_size = tag.d_un.d_ptr;
-            }else if (tag.d_tag == DT_HASH){
-                //printf("Found DT_HASH\n");
-                dt_hash = tag.d_un.d_ptr;
-            }else if (tag.d_tag == DT_GNU_HASH){
-                //printf("Found DT_GNU_HASH\n");
-                gnu_hash = tag.d_un.d_ptr;
-            }else if (tag.d_tag == DT_NULL){
-                //printf("Found DT_NULL \n");
-                j = numelements_dyn;
-                //break;
-            }
+    }
+    fixupendian(dynamic_phdr.p_filesz);
+    fixupendian(dynamic_phdr.p_vaddr);
+    int numelements_dyn = dynamic_phdr.p_filesz / sizeof(ELF(Dyn));
+
+    // read the whole dynamic section at once
+    vector<ELF(Dyn)> dyn(numelements_dyn);
+    if (numelements_dyn == 0 ||
+        panda_virtual_memory_read(cpu, m->base + dynamic_phdr.p_vaddr, (uint8_t*)dyn.data(), numelements_dyn*sizeof(ELF(Dyn))) != MEMTX_OK){
+        error_case(current->name, m->name, "5 DPDR");
+        return;
+    }
 
-            j++;
-        }  
+    // iterate over dynamic program headers and find strtab
+    // and symtab. At the same time, fingerprint the image from its ELF
+    // header and its dynamic section with addresses made base-relative,
+    // so every mapping of the same file gets the same key.
+    target_ulong strtab = 0, symtab = 0, strtab_size = 0, dt_hash = 0, gnu_hash = 0;
+    uint64_t fingerprint = fnv1a(0xcbf29ce484222325ull, &ehdr, sizeof(ehdr));
+    for (int j = 0; j < numelements_dyn; j++){
+        ELF(Dyn) tag = dyn[j];
+        fixupendian(tag.d_tag);
+        fixupendian(tag.d_un.d_ptr);
 
-        // some of these are offsets. some are fully qualified
-        // addresses. this is a gimmick that can sort-of tell.
-        // probably better to replace this at some point
-        if (strtab < m->base){
-            strtab += m->base;
-        }
-        if (symtab < m->base){
-            symtab += m->base;
-        }
-        if (dt_hash < m->base){
-            dt_hash += m->base;
+        if (tag.d_tag == DT_STRTAB){
+            strtab = tag.d_un.d_ptr;
+        }else if (tag.d_tag == DT_SYMTAB){
+            symtab = tag.d_un.d_ptr;
+        }else if (tag.d_tag == DT_STRSZ ){
+            strtab_size = tag.d_un.d_ptr;
+        }else if (tag.d_tag == DT_HASH){
+            dt_hash = tag.d_un.d_ptr;
+        }else if (tag.d_tag == DT_GNU_HASH){
+            gnu_hash = tag.d_un.d_ptr;
+        }else if (tag.d_tag == DT_NULL){
+            break;
         }
-        if (gnu_hash < m->base){
-            gnu_hash += m->base;
+
+        target_ulong val = tag.d_un.d_ptr;
+        if (val >= m->base){
+            val -= m->base;
         }
+        target_ulong key[2] = { (target_ulong)tag.d_tag, val };
+        fingerprint = fnv1a(fingerprint, key, sizeof(key));
+    }
 
-        //printf("strtab: %llx symtab: %llx hash: %llx\n", (long long unsigned int) strtab, (long long unsigned int)symtab, (long long unsigned int) dt_hash);
+    // some of these are offsets. some are fully qualified
+    // addresses. this is a gimmick that can sort-of tell.
+    // probably better to replace this at some point
+    if (strtab < m->base){
+        strtab += m->base;
+    }
+    if (symtab < m->base){
+        symtab += m->base;
+    }
+    if (dt_hash < m->base){
+        dt_hash += m->base;
+    }
+    if (gnu_hash < m->base){
+        gnu_hash += m->base;
+    }
 
-        int numelements_symtab = get_numelements_symtab(cpu,m->base, dt_hash, gnu_hash, m->base + dynamic_phdr.p_vaddr, symtab, numelements_dyn);
-        if (numelements_symtab == -1){
-            error_case(current->name, m->name, "6 GETELEMENTSSYMTAB");
-            //printf("numelements_symtab not working\n");
-            return;
-        }
+    uint64_t sample = symtab_sample(cpu, symtab);
+    auto known = images.find(fingerprint);
+    if (known != images.end() && known->second->module_size == m->size &&
+        known->second->symtab_sample == sample){
+        bind_module(cpu, asid, m, known->second);
+        return;
+    }
 
-        target_ulong symtab_size = numelements_symtab * sizeof(ELF(Sym));
-
-        //printf("symtab_size %llx strtab_size %llx\n",(long long unsigned int)symtab_size, (long long unsigned int)strtab_size);
-
-        char* symtab_buf = (char*)malloc(symtab_size);
-        char* strtab_buf = (char*)malloc(strtab_size);
-
-        //printf("symtab %llx\n", (long long unsigned int) symtab);
-        //printf("symtab: 0x" TARGET_FMT_lx "  0x" TARGET_FMT_lx "\n", symtab, strtab);
-        if (panda_virtual_memory_read(cpu, symtab, (uint8_t*)symtab_buf, symtab_size) == MEMTX_OK){
-                if (panda_virtual_memory_read(cpu, strtab, (uint8_t*) strtab_buf, strtab_size) == MEMTX_OK){
-                int i = 0; 
-                //for (int idx =0; idx < strtab_size; idx++)
-                //  printf("Strtab[%d]: %c\n", idx, strtab_buf[idx]);
-
-                pair<target_ulong, string> c(m->base, name);
-
-                for (;i<numelements_symtab; i++){
-                    ELF(Sym)* a = (ELF(Sym)*) (symtab_buf + i*sizeof(ELF(Sym)));
-                    fixupendian(a->st_name);
-                    fixupendian(a->st_value);
-                    if (a->st_name < strtab_size && a->st_value != 0){
-                        struct symbol s;
-                        strncpy((char*)&s.name, &strtab_buf[a->st_name], sizeof(s.name)-2);
-                        strncpy((char*)&s.section, m->name, sizeof(s.section)-2);
-                        s.address = m->base + a->st_value;
-                        //printf("found symbol %s %s 0x%llx\n",s.section, &strtab_buf[a->st_name],(long long unsigned int)s.address);
-                        string sym_name(s.name);
-                        seen_libraries[c][sym_name] = s;
-                    }
-                }
-                if (seen_libraries[c].size() > 0){
-                    symbols[asid][name] = &seen_libraries[c];
-                    new_assignment_check_symbols(cpu, seen_libraries[c], m);
-                    error_case(current->name, m->name, "SUCCESS");
-                    //printf("Successful on %s. Found %d symbols " TARGET_FMT_lx "\n", m->name, (int)seen_libraries[c].size(), m->base);
-                }
-                //printf("CURRENT PC: %llx\n", (long long unsigned int) panda_current_pc(cpu));
-            }else{
-                error_case(current->name, m->name, "7 CNR STRTAB");
-            }
-        }else{
-            error_case(current->name, m->name, "8 CNR SYMTAB");
-        }
-        free(symtab_buf);
-        free(strtab_buf);
+    int numelements_symtab = get_numelements_symtab(cpu,m->base, dt_hash, gnu_hash, m->base + dynamic_phdr.p_vaddr, symtab, numelements_dyn);
+    if (numelements_symtab == -1){
+        error_case(current->name, m->name, "6 GETELEMENTSSYMTAB");
+        return;
+    }
+
+    shared_ptr<library_image> image = parse_image(cpu, current, m, symtab, strtab, strtab_size, numelements_symtab);
+    if (image == NULL){
         return;
     }
-    error_case(current->name, m->name, "NOT AN ELF HEADER");
+    image->module_size = m->size;
+    image->symtab_sample = sample;
+    images[fingerprint] = image;
+    bind_module(cpu, asid, m, image);
+    error_case(current->name, m->name, "SUCCESS");
 }
 
 
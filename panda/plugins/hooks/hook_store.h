@@ -0,0 +1,286 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Luke Craig                  luke.craig@ll.mit.edu
+ *  Andrew Fasano               andrew.fasano@ll.mit.edu
+ *  Nick Gregory                ngregory@nyu.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __HOOK_STORE_H__
+#define __HOOK_STORE_H__
+
+/*
+ * Storage for hooks, optimized for "which hooks are at this address?"
+ * queries on every block.
+ *
+ * Hooks are bucketed by guest page in an open-addressed table. Each bucket
+ * is a small vector of hook pointers sorted by (addr, asid, type, cb), so a
+ * lookup is one hash probe plus a binary search over the hooks on that page.
+ * A HookStore keeps one such table per ASID and caches the table of the
+ * current ASID, since consecutive blocks almost always run in the same one.
+ */
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+bool operator<(const struct hook &a, const struct hook &b);
+
+static inline bool hook_ptr_less(const struct hook *a, const struct hook *b) {
+    return *a < *b;
+}
+
+static inline target_ulong hook_page(target_ulong addr) {
+    return addr >> TARGET_PAGE_BITS;
+}
+
+/*
+ * Open-addressed (linear probing) map from guest page numbers to V. Entries
+ * are never removed, an emptied bucket simply stays around for reuse.
+ */
+template<typename V>
+class PageMap {
+public:
+    PageMap() : slots_(16), count_(0) {}
+
+    V *find(target_ulong page) {
+        size_t mask = slots_.size() - 1;
+        for (size_t i = hash(page) & mask; ; i = (i + 1) & mask) {
+            Slot &s = slots_[i];
+            if (!s.used) return nullptr;
+            if (s.page == page) return &s.value;
+        }
+    }
+
+    V &operator[](target_ulong page) {
+        if ((count_ + 1) * 2 > slots_.size()) {
+            grow();
+        }
+        Slot &s = probe(slots_, page);
+        if (!s.used) {
+            s.used = true;
+            s.page = page;
+            count_++;
+        }
+        return s.value;
+    }
+
+    template<typename F>
+    void for_each(F fn) {
+        for (auto &s : slots_) {
+            if (s.used) fn(s.page, s.value);
+        }
+    }
+
+private:
+    struct Slot {
+        Slot() : page(0), used(false) {}
+        target_ulong page;
+        bool used;
+        V value;
+    };
+
+    static size_t hash(target_ulong page) {
+        uint64_t h = (uint64_t)page * 0x9E3779B97F4A7C15ull;
+        return (size_t)(h ^ (h >> 32));
+    }
+
+    static Slot &probe(std::vector<Slot> &slots, target_ulong page) {
+        size_t mask = slots.size() - 1;
+        size_t i = hash(page) & mask;
+        while (slots[i].used && slots[i].page != page) {
+            i = (i + 1) & mask;
+        }
+        return slots[i];
+    }
+
+    void grow() {
+        std::vector<Slot> bigger(slots_.size() * 2);
+        for (auto &s : slots_) {
+            if (!s.used) continue;
+            Slot &d = probe(bigger, s.page);
+            d.used = true;
+            d.page = s.page;
+            d.value = std::move(s.value);
+        }
+        slots_.swap(bigger);
+    }
+
+    std::vector<Slot> slots_;
+    size_t count_;
+};
+
+/*
+ * Page-bucketed, sorted index of hooks. Does not own the hooks.
+ */
+class HookTable {
+public:
+    typedef std::vector<struct hook *> Bucket;
+
+    // Returns false (and doesn't insert) if an identical hook is present.
+    bool insert(struct hook *h) {
+        Bucket &b = pages_[hook_page(h->addr)];
+        auto it = std::lower_bound(b.begin(), b.end(), h, hook_ptr_less);
+        if (it != b.end() && !(*h < **it)) {
+            return false;
+        }
+        b.insert(it, h);
+        return true;
+    }
+
+    void remove(struct hook *h) {
+        Bucket *b = pages_.find(hook_page(h->addr));
+        if (!b) return;
+        auto it = std::find(b->begin(), b->end(), h);
+        if (it != b->end()) b->erase(it);
+    }
+
+    Bucket *bucket(target_ulong addr) {
+        return pages_.find(hook_page(addr));
+    }
+
+    // Index of the first hook in b at or above addr.
+    static size_t first_at(Bucket &b, target_ulong addr) {
+        auto it = std::lower_bound(b.begin(), b.end(), addr,
+            [](const struct hook *h, target_ulong a) { return h->addr < a; });
+        return it - b.begin();
+    }
+
+    // Calls fn on every hook with start <= addr < end, in address order.
+    template<typename F>
+    void for_each_in(target_ulong start, target_ulong end, F fn) {
+        if (start >= end) return;
+        for (target_ulong p = hook_page(start); p <= hook_page(end - 1); p++) {
+            Bucket *b = pages_.find(p);
+            if (!b) continue;
+            for (size_t i = first_at(*b, start);
+                 i < b->size() && (*b)[i]->addr < end; i++) {
+                fn((*b)[i]);
+            }
+        }
+    }
+
+    template<typename F>
+    void for_each(F fn) {
+        pages_.for_each([&](target_ulong, Bucket &b) {
+            for (auto h : b) fn(h);
+        });
+    }
+
+    // Remove (without freeing) every hook for which pred returns true.
+    template<typename P>
+    void remove_if(P pred) {
+        pages_.for_each([&](target_ulong, Bucket &b) {
+            b.erase(std::remove_if(b.begin(), b.end(), pred), b.end());
+        });
+    }
+
+private:
+    PageMap<Bucket> pages_;
+};
+
+/*
+ * Per-ASID hook tables. Owns its hooks: a hook that gets disabled is
+ * removed and freed right after the callback that disabled it returns.
+ */
+class HookStore {
+public:
+    HookStore() : live_(0) { reset_cache(); }
+
+    ~HookStore() {
+        for (auto &t : tables_) {
+            t.second.for_each([](struct hook *h) { delete h; });
+        }
+    }
+
+    bool empty() const { return live_ == 0; }
+
+    void insert(const struct hook &h) {
+        struct hook *copy = new struct hook(h);
+        if (tables_[h.asid].insert(copy)) {
+            live_++;
+        } else {
+            delete copy;
+        }
+        reset_cache();
+    }
+
+    void erase(target_ulong asid) {
+        auto it = tables_.find(asid);
+        if (it == tables_.end()) return;
+        it->second.for_each([&](struct hook *h) { delete h; live_--; });
+        tables_.erase(it);
+        reset_cache();
+    }
+
+    /*
+     * Calls fn on every enabled hook at exactly addr, first for the given
+     * ASID and then for ASID 0 (which matches any ASID).
+     */
+    template<typename F>
+    void run_at(target_ulong asid, target_ulong addr, F fn) {
+        if (!cached_ || asid != cached_asid_) {
+            cached_ = true;
+            cached_asid_ = asid;
+            cached_table_ = lookup(asid);
+        }
+        run_table(cached_table_, addr, fn);
+        if (asid != 0) {
+            if (!zero_cached_) {
+                zero_table_ = lookup(0);
+                zero_cached_ = true;
+            }
+            run_table(zero_table_, addr, fn);
+        }
+    }
+
+private:
+    HookTable *lookup(target_ulong asid) {
+        auto it = tables_.find(asid);
+        return it == tables_.end() ? nullptr : &it->second;
+    }
+
+    void reset_cache() {
+        cached_ = false;
+        cached_asid_ = 0;
+        cached_table_ = nullptr;
+        zero_cached_ = false;
+        zero_table_ = nullptr;
+    }
+
+    template<typename F>
+    void run_table(HookTable *t, target_ulong addr, F &fn) {
+        if (!t) return;
+        HookTable::Bucket *b = t->bucket(addr);
+        if (!b) return;
+        size_t i = HookTable::first_at(*b, addr);
+        while (i < b->size() && (*b)[i]->addr == addr) {
+            struct hook *h = (*b)[i];
+            if (likely(h->enabled)) {
+                fn(h);
+                // Hooks disabled by their callback are never run again
+                if (!h->enabled) {
+                    b->erase(b->begin() + i);
+                    delete h;
+                    live_--;
+                    continue;
+                }
+            }
+            i++;
+        }
+    }
+
+    std::unordered_map<target_ulong, HookTable> tables_;
+    size_t live_;
+
+    bool cached_;
+    target_ulong cached_asid_;
+    HookTable *cached_table_;
+    bool zero_cached_;
+    HookTable *zero_table_;
+};
+
+#endif
@@ -36,6 +36,8 @@ void uninit_plugin(void *);
 void hooks_flush_pc(target_ulong pc);
 }
 
+#include "hook_store.h"
+
 using namespace std;
 
 bool operator==(const struct hook &a, const struct hook &b){
@@ -55,10 +57,22 @@ bool operator<(const struct hook &a, const struct hook &b){
 
 #define SUPPORT_CALLBACK_TYPE(name) \
     vector<struct hook> temp_ ## name ## _hooks; \
-    unordered_map<target_ulong, set<struct hook>> name ## _hooks; \
+    HookStore name ## _hooks; \
     panda_cb name ## _callback;
 
-SUPPORT_CALLBACK_TYPE(before_tcg_codegen)
+/*
+ * before_tcg_codegen hooks are resolved at translation time and called
+ * directly from the generated code, so the translated block holds a pointer
+ * to the hook. They are indexed across all ASIDs (the ASID is checked when
+ * the hook runs) and are never freed while the plugin is loaded: a hook that
+ * is disabled is only unlinked and parked in retired_tcg_hooks.
+ */
+vector<struct hook> temp_before_tcg_codegen_hooks;
+HookTable before_tcg_codegen_hooks;
+size_t num_tcg_hooks = 0;
+vector<struct hook *> retired_tcg_hooks;
+panda_cb before_tcg_codegen_callback;
+
 SUPPORT_CALLBACK_TYPE(before_block_translate)
 SUPPORT_CALLBACK_TYPE(after_block_translate)
 SUPPORT_CALLBACK_TYPE(before_block_exec_invalidate_opt)
@@ -203,10 +217,14 @@ void add_hook(struct hook* h) {
     }
 }
 
-#define MAKE_HOOK_FN_START(UPPER_CB_NAME, NAME, VALUE, PC) \
+static inline bool hook_mode_matches(const struct hook *h, bool in_kernel) {
+    return h->km == MODE_ANY || (in_kernel && h->km == MODE_KERNEL_ONLY) || (!in_kernel && h->km == MODE_USER_ONLY);
+}
+
+#define MAKE_HOOK_FN_START(UPPER_CB_NAME, NAME, VALUE) \
     if (unlikely(! temp_ ## NAME ## _hooks .empty())){ \
         for (auto &h: temp_ ## NAME ## _hooks) { \
-            NAME ## _hooks[h.asid].insert(h); \
+            NAME ## _hooks.insert(h); \
         } \
         temp_ ## NAME ## _hooks .clear(); \
     } \
@@ -215,45 +233,20 @@ void add_hook(struct hook* h) {
         return VALUE; \
     } \
     target_ulong asid = panda_current_asid(cpu); \
-    bool in_kernel = panda_in_kernel(cpu); \
-    struct hook hook_container; \
-    memset(&hook_container, 0, sizeof(hook_container)); \
-    hook_container.addr = PC; \
-    set<struct hook>::iterator it;
-
-#define LOOP_ASID_CHECK(NAME, EXPR, COMPARATOR_TO_BLOCK)\
-    hook_container.asid = asid; \
-    it = NAME ## _hooks[asid].lower_bound(hook_container); \
-    while(it != NAME ## _hooks[asid].end() && it->addr COMPARATOR_TO_BLOCK){ \
-        auto h = (hook*)&(*it); \
-        if (likely(h->enabled)){ \
-            if (h->asid == asid){ \
-                if (h->km == MODE_ANY || (in_kernel && h->km == MODE_KERNEL_ONLY) || (!in_kernel && h->km == MODE_USER_ONLY)){ \
-                    EXPR \
-                    if (!h->enabled){ \
-                        it = NAME ## _hooks[asid].erase(it); \
-                        continue; \
-                    } \
-                    /*memcpy((void*)&(*it), (void*)&h, sizeof(struct hook));*/ \
-                } \
-            } \
-        }\
-        ++it; \
-    }
+    bool in_kernel = panda_in_kernel(cpu);
 
-#define HOOK_GENERIC_RET_EXPR(EXPR, UPPER_CB_NAME, NAME, VALUE, COMPARATOR_TO_BLOCK, PC) \
-    MAKE_HOOK_FN_START(UPPER_CB_NAME, NAME, VALUE, PC) \
-    LOOP_ASID_CHECK(NAME, EXPR, COMPARATOR_TO_BLOCK) \
-    if (asid != 0){ \
-        asid = 0; \
-        LOOP_ASID_CHECK(NAME, EXPR, COMPARATOR_TO_BLOCK) \
-    }
+#define HOOK_GENERIC_RET_EXPR(EXPR, UPPER_CB_NAME, NAME, VALUE, PC) \
+    MAKE_HOOK_FN_START(UPPER_CB_NAME, NAME, VALUE) \
+    NAME ## _hooks.run_at(asid, PC, [&](struct hook *h) { \
+        if (hook_mode_matches(h, in_kernel)){ \
+            EXPR \
+        } \
+    });
 
 
 #define MAKE_HOOK_VOID(UPPER_CB_NAME, NAME, PASSED_ARGS, PC, ...) \
 void cb_ ## NAME ## _callback PASSED_ARGS { \
-    /*printf("VOID calling %llx guest_pc %llx\n", (long long unsigned int) panda_current_pc(cpu), (long long unsigned int)cpu->panda_guest_pc);*/\
-    HOOK_GENERIC_RET_EXPR( (*(h->cb.NAME))(__VA_ARGS__);, UPPER_CB_NAME, NAME, , == hook_container.addr, PC) \
+    HOOK_GENERIC_RET_EXPR( (*(h->cb.NAME))(__VA_ARGS__);, UPPER_CB_NAME, NAME, , PC) \
 }
 
 // first level hook that goes to other hooks?
@@ -261,66 +254,66 @@ void cb_ ## NAME ## _callback PASSED_ARGS { \
 #define MAKE_HOOK_BOOL(UPPER_CB_NAME, NAME, PASSED_ARGS, PC, ...) \
 bool cb_ ## NAME ## _callback PASSED_ARGS { \
     bool ret = false; \
-    HOOK_GENERIC_RET_EXPR(ret |= (*(h->cb.NAME))(__VA_ARGS__);, UPPER_CB_NAME, NAME, false, == hook_container.addr, PC) \
+    HOOK_GENERIC_RET_EXPR(ret |= (*(h->cb.NAME))(__VA_ARGS__);, UPPER_CB_NAME, NAME, false, PC) \
     return ret; \
 }
-    
-void cb_tcg_codegen_middle_filter(CPUState* cpu, TranslationBlock *tb) {
-    HOOK_GENERIC_RET_EXPR(/*printf("TCG calling %llx from %llx with hook %llx guest_pc %llx\n", (long long unsigned int) panda_current_pc(cpu), (long long unsigned int)tb->pc, (long long unsigned int)h->addr, (long long unsigned int)cpu->panda_guest_pc); printf("made it to hook %p\n", (void*)h->cb.before_block_exec);*/ (*(h->cb.before_tcg_codegen))(cpu, tb, h);, BEFORE_TCG_CODEGEN, before_tcg_codegen, , < tb->pc + tb->size, tb->pc );
+
+void retire_tcg_hook(struct hook *h) {
+    before_tcg_codegen_hooks.remove(h);
+    num_tcg_hooks--;
+    retired_tcg_hooks.push_back(h);
+    hooks_flush_pc(h->addr);
+}
+
+// Called from the generated code of a block for one specific hook.
+void cb_tcg_codegen_hook(CPUState* cpu, TranslationBlock *tb, struct hook *h) {
+    if (unlikely(!h->enabled)) {
+        return;
+    }
+    if (h->asid != 0 && h->asid != panda_current_asid(cpu)) {
+        return;
+    }
+    if (!hook_mode_matches(h, panda_in_kernel(cpu))) {
+        return;
+    }
+    (*(h->cb.before_tcg_codegen))(cpu, tb, h);
+    if (!h->enabled) {
+        retire_tcg_hook(h);
+    }
 }
 
 void cb_before_tcg_codegen_callback (CPUState* cpu, TranslationBlock *tb) {
     if (unlikely(! temp_before_tcg_codegen_hooks.empty())){
         for (auto &h: temp_before_tcg_codegen_hooks) {
-            before_tcg_codegen_hooks[h.asid].insert(h);
+            struct hook *copy = new struct hook(h);
+            if (before_tcg_codegen_hooks.insert(copy)) {
+                num_tcg_hooks++;
+            } else {
+                delete copy;
+            }
         }
         temp_before_tcg_codegen_hooks.clear();
     }
-    if (unlikely(before_tcg_codegen_hooks.empty())){
+    if (unlikely(num_tcg_hooks == 0)){
         panda_disable_callback(self, PANDA_CB_BEFORE_TCG_CODEGEN, before_tcg_codegen_callback);
+        return;
     }
-    bool in_kernel = panda_in_kernel(cpu);
-    struct hook hook_container;
-    set<target_ulong> inserted_addresses;
-    memset(&hook_container, 0, sizeof(hook_container));
-    hook_container.addr = tb->pc;
-    TCGOp *first_instr = NULL;
-    for (auto& a : before_tcg_codegen_hooks){
-        target_ulong asid = a.first;
-        set<struct hook>::iterator it;
-        hook_container.asid = asid;
-        it = before_tcg_codegen_hooks[asid].lower_bound(hook_container); 
-        while(it != before_tcg_codegen_hooks[asid].end() && it->addr < tb->pc + tb->size){
-            auto h = (hook*)&(*it);
-            if (likely(h->enabled)){
-                if (h->asid == asid){ 
-                    if (h->km == MODE_ANY || (in_kernel && h->km == MODE_KERNEL_ONLY) || (!in_kernel && h->km == MODE_USER_ONLY)){
-                        auto exclude = inserted_addresses.find(h->addr);
-                        if (exclude == inserted_addresses.end()){
-                            TCGOp* op = NULL;
-                            if (h->addr == tb->pc){
-                                if (!first_instr) {
-                                    first_instr = find_first_guest_insn();
-                                }
-                                op = first_instr;
-                            }else{
-                                op = find_guest_insn_by_addr(h->addr);
-                            }
-                            if (op != NULL){
-                                insert_call(&op, cb_tcg_codegen_middle_filter, cpu, tb);
-                                inserted_addresses.insert(h->addr);
-                            }
-                        } 
-                    }
-                } 
-            }else{
-                printf("erasing hook\n");
-                it = before_tcg_codegen_hooks[asid].erase(it);
-                continue;
-            }
-            ++it;
+    TCGOp *op = NULL;
+    target_ulong op_addr = 0;
+    // Hooks come back sorted by address, so hooks sharing an address are
+    // inserted one after the other, in order, after that instruction's marker.
+    before_tcg_codegen_hooks.for_each_in(tb->pc, tb->pc + tb->size, [&](struct hook *h) {
+        if (!h->enabled) {
+            return;
         }
-    }
+        if (op == NULL || op_addr != h->addr) {
+            op = (h->addr == tb->pc) ? find_first_guest_insn() : find_guest_insn_by_addr(h->addr);
+            op_addr = h->addr;
+        }
+        if (op != NULL) {
+            insert_call(&op, cb_tcg_codegen_hook, cpu, tb, h);
+        }
+    });
 }
 
 
@@ -339,7 +332,13 @@ MAKE_HOOK_VOID(START_BLOCK_EXEC, start_block_exec, (CPUState *cpu, TranslationBl
 MAKE_HOOK_VOID(END_BLOCK_EXEC, end_block_exec, (CPUState *cpu, TranslationBlock *tb), tb->pc, cpu, tb, h)
 
 void erase_asid(target_ulong asid){
-    before_tcg_codegen_hooks.erase(asid);
+    before_tcg_codegen_hooks.remove_if([&](struct hook *h) {
+        if (h->asid != asid) return false;
+        h->enabled = false;
+        num_tcg_hooks--;
+        retired_tcg_hooks.push_back(h);
+        return true;
+    });
     before_block_translate_hooks.erase(asid);
     after_block_translate_hooks.erase(asid);
     before_block_exec_invalidate_opt_hooks.erase(asid);
@@ -379,4 +378,8 @@ void uninit_plugin(void *self) {
     // into our exited plugin.
     panda_do_flush_tb();
     disable_hooking();
+    before_tcg_codegen_hooks.for_each([](struct hook *h) { delete h; });
+    for (auto h : retired_tcg_hooks) {
+        delete h;
+    }
 }
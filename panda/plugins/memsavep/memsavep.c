@@ -18,8 +18,11 @@ PANDAENDCOMMENT */
 #include "panda/plugin.h"
 #include "panda/rr/rr_log.h"
 #include "panda/rr/rr_api.h"
+#include "exec/address-spaces.h"
 
 #include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 bool dump_done = false;
 
@@ -29,62 +32,327 @@ static uint64_t instr_count = 0;
 static const char *filename = NULL;
 static const char* register_filename = NULL;
 static uint64_t pmem_len = 0;
+static int threads = 0;
+
+// Incremental mode: a full image at the first point, then only the pages
+// written since the previous point, appended to <file>.delta and listed in
+// <file>.idx.
+static GArray *points = NULL;
+static guint point_idx = 0;
+static uint64_t every = 0;
+static uint64_t next_point = UINT64_MAX;
+static uint64_t points_done = 0;
+static int delta_fd = -1;
+static FILE *index_file = NULL;
+// Directly readable sections of physical memory at the last point
+static GArray *last_layout = NULL;
+
+#define MEMSAVEP_INDEX_MAGIC "PANDAMSI"
+#define MEMSAVEP_INDEX_VERSION 1
 
 bool init_plugin(void *);
 void uninit_plugin(void *);
 void before_block_exec(CPUState *env, TranslationBlock *tb);
 void dump_memory(void);
 
-static const uint8_t _zero_block[1024] = {0};
-static void actually_dump_physical_memory(FILE* out, size_t len)
+// Index entry: len bytes of guest physical memory at addr, stored at offset
+// in the delta file.
+typedef struct {
+    uint64_t addr;
+    uint64_t len;
+    uint64_t offset;
+} DeltaRange;
+
+typedef struct {
+    int fd;
+    uint64_t len;
+    uint64_t end;       // delta mode: end of the data written to fd
+    GArray *ranges;     // delta mode: DeltaRanges written, else NULL
+    GMutex lock;
+    bool failed;
+} DumpState;
+
+// Called from the RAM scan's worker threads; each writes its own part of
+// the file. In a full image, anything that isn't RAM stays a (sparse) hole,
+// i.e. zeros.
+static void dump_range(hwaddr addr, uint8_t *host, size_t len, void *opaque)
 {
-    hwaddr addr = 0;
-    uint8_t block[sizeof(_zero_block)];
+    DumpState *ds = (DumpState *)opaque;
+    uint64_t off = addr;
 
-    if (!out)
+    if (addr >= ds->len)
         return;
-
+    if (len > ds->len - addr)
+        len = ds->len - addr;
+    if (ds->ranges)
+    {
+        DeltaRange r = { addr, len, atomic_fetch_add(&ds->end, len) };
+        off = r.offset;
+        g_mutex_lock(&ds->lock);
+        g_array_append_val(ds->ranges, r);
+        g_mutex_unlock(&ds->lock);
+    }
     while (len != 0)
     {
-        size_t l = sizeof(block);
-        if (l > len)
-            l = len;
-        if (panda_physical_memory_rw(addr, block, l, false) == MEMTX_OK)
-            fwrite(block, 1, l, out);
-        else
-            fwrite(_zero_block, 1, l, out);
-        addr += l;
-        len -= l;
+        ssize_t n = pwrite(ds->fd, host, len, off);
+        if (n <= 0)
+        {
+            ds->failed = true;
+            return;
+        }
+        host += n;
+        off += n;
+        len -= n;
     }
 }
 
-void dump_memory(void){
-    FILE* out = fopen(filename, "wb");
-    actually_dump_physical_memory(out, pmem_len);
-    fclose(out);
-    if (register_filename)
+static bool dump_image(const char *name)
+{
+    DumpState ds = { .len = pmem_len, .failed = false };
+    uint64_t scanned;
+
+    ds.fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (ds.fd < 0 || ftruncate(ds.fd, pmem_len) != 0)
+        ds.failed = true;
+    else
+    {
+        scanned = panda_ram_scan(dump_range, &ds, threads, 0);
+        // All of guest RAM is mapped somewhere, but for what devices hide
+        // below 1MB on a PC (VGA, BIOS shadows).
+        if (scanned + 0x100000 < ram_size)
+            printf("memsavep: Warning: only found %" PRIu64 " bytes of RAM "
+                   "out of %" PRIu64 ".\n", scanned, (uint64_t)ram_size);
+    }
+    if (ds.fd >= 0)
+        close(ds.fd);
+    if (ds.failed)
+        printf("memsavep: Error writing %s.\n", name);
+    return !ds.failed;
+}
+
+// A section of physical memory, and where in RAM it comes from
+typedef struct {
+    uint64_t addr;
+    uint64_t len;
+    uint64_t ram;
+} LayoutSection;
+
+static void add_layout_section(MemoryRegionSection *section, void *opaque)
+{
+    LayoutSection s = {
+        section->offset_within_address_space, int128_get64(section->size),
+        memory_region_get_ram_addr(section->mr) + section->offset_within_region
+    };
+    g_array_append_val((GArray *)opaque, s);
+}
+
+// Returns the current layout of physical memory, in address order.
+static GArray *get_layout(void)
+{
+    GArray *layout = g_array_new(false, false, sizeof(LayoutSection));
+
+    rcu_read_lock();
+    address_space_foreach_direct_section(&address_space_memory,
+                                         add_layout_section, layout);
+    rcu_read_unlock();
+    return layout;
+}
+
+static bool same_layout(GArray *a, GArray *b)
+{
+    return a->len == b->len &&
+        memcmp(a->data, b->data, a->len * sizeof(LayoutSection)) == 0;
+}
+
+// Adds ranges of zeros to the delta for what was mapped in old but isn't in
+// cur, where a full image has holes. Their data is left as a hole in the
+// delta file.
+static void add_unmapped_ranges(DumpState *ds, GArray *old, GArray *cur)
+{
+    for (guint i = 0; i < old->len; i++)
     {
-        if ((out = fopen(register_filename, "w")) != NULL)
+        LayoutSection *o = &g_array_index(old, LayoutSection, i);
+        uint64_t start = o->addr, end = MIN(o->addr + o->len, pmem_len);
+        for (guint j = 0; j < cur->len && start < end; j++)
         {
-            CPUState* cpu;
-            CPU_FOREACH(cpu)
+            LayoutSection *c = &g_array_index(cur, LayoutSection, j);
+            if (c->addr + c->len <= start)
+                continue;
+            if (c->addr >= end)
+                break;
+            if (c->addr > start)
             {
-                fprintf(out, "CPU#%d\n", cpu->cpu_index);
-                cpu_dump_state(cpu, out, fprintf, CPU_DUMP_FPU);
+                DeltaRange r = { start, c->addr - start, ds->end };
+                ds->end += r.len;
+                g_array_append_val(ds->ranges, r);
             }
-            fclose(out);
+            start = c->addr + c->len;
+        }
+        if (start < end)
+        {
+            DeltaRange r = { start, end - start, ds->end };
+            ds->end += r.len;
+            g_array_append_val(ds->ranges, r);
         }
     }
+}
+
+static gint cmp_delta_range(gconstpointer a, gconstpointer b)
+{
+    uint64_t x = ((const DeltaRange *)a)->addr;
+    uint64_t y = ((const DeltaRange *)b)->addr;
+    return x < y ? -1 : x > y;
+}
+
+// Appends the pages written since the last point to the delta file, and
+// their list to the index.
+static bool dump_delta(uint64_t instr)
+{
+    DumpState ds = { .fd = delta_fd, .len = pmem_len, .failed = false };
+    GArray *layout = get_layout();
+    uint64_t hdr[2];
+
+    ds.end = lseek(delta_fd, 0, SEEK_END);
+    ds.ranges = g_array_new(false, false, sizeof(DeltaRange));
+    // Remapping memory (e.g. the PAM registers of a PC) changes what is at
+    // an address without writing to it, so then everything is saved again.
+    if (!same_layout(layout, last_layout))
+    {
+        add_unmapped_ranges(&ds, last_layout, layout);
+        panda_ram_dirty_mark_all();
+    }
+    g_array_free(last_layout, true);
+    last_layout = layout;
+    g_mutex_init(&ds.lock);
+    panda_ram_scan(dump_range, &ds, threads, PANDA_RAM_SCAN_DIRTY);
+    g_mutex_clear(&ds.lock);
+    // unmapped ranges at the end are holes
+    if (ftruncate(delta_fd, ds.end) != 0)
+        ds.failed = true;
+
+    g_array_sort(ds.ranges, cmp_delta_range);
+    hdr[0] = instr;
+    hdr[1] = ds.ranges->len;
+    if (fwrite(hdr, sizeof(hdr), 1, index_file) != 1 ||
+        fwrite(ds.ranges->data, sizeof(DeltaRange), ds.ranges->len,
+               index_file) != ds.ranges->len ||
+        fflush(index_file) != 0)
+        ds.failed = true;
+    if (ds.failed)
+        printf("memsavep: Error writing delta at instruction %" PRIu64 ".\n", instr);
+    g_array_free(ds.ranges, true);
+    return !ds.failed;
+}
+
+static bool start_incremental(uint64_t instr)
+{
+    char *name;
+    struct {
+        char magic[8];
+        uint32_t version;
+        uint32_t page_size;
+        uint64_t pmem_len;
+    } hdr = { MEMSAVEP_INDEX_MAGIC, MEMSAVEP_INDEX_VERSION, TARGET_PAGE_SIZE, pmem_len };
+    uint64_t base[2] = { instr, 0 };
+
+    if (!dump_image(filename))
+        return false;
+    last_layout = get_layout();
+
+    name = g_strdup_printf("%s.delta", filename);
+    delta_fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    g_free(name);
+    name = g_strdup_printf("%s.idx", filename);
+    index_file = fopen(name, "wb");
+    g_free(name);
+    if (delta_fd < 0 || !index_file)
+    {
+        printf("memsavep: Error creating the delta and index files.\n");
+        return false;
+    }
+    // The base image is the first point, with no ranges of its own.
+    fwrite(&hdr, sizeof(hdr), 1, index_file);
+    fwrite(base, sizeof(base), 1, index_file);
+    fflush(index_file);
+    return true;
+}
+
+static void dump_registers(uint64_t instr)
+{
+    FILE *out;
+
+    if (!register_filename)
+        return;
+    // In incremental mode, each point's registers are appended.
+    if ((out = fopen(register_filename, points_done ? "a" : "w")) != NULL)
+    {
+        CPUState* cpu;
+        if (points)
+            fprintf(out, "instr %" PRIu64 "\n", instr);
+        CPU_FOREACH(cpu)
+        {
+            fprintf(out, "CPU#%d\n", cpu->cpu_index);
+            cpu_dump_state(cpu, out, fprintf, CPU_DUMP_FPU);
+        }
+        fclose(out);
+    }
+}
+
+void dump_memory(void){
+    dump_image(filename);
+    dump_registers(rr_get_guest_instr_count());
     dump_done = true;
 
     if(should_close_after_dump)
         panda_replay_end();
 }
 
+// Returns the first point after instruction instr.
+static uint64_t get_next_point(uint64_t instr)
+{
+    uint64_t next = UINT64_MAX;
+
+    while (point_idx < points->len && g_array_index(points, uint64_t, point_idx) <= instr)
+        point_idx++;
+    if (point_idx < points->len)
+        next = g_array_index(points, uint64_t, point_idx);
+    if (every && instr / every + 1 <= UINT64_MAX / every)
+        next = MIN(next, (instr / every + 1) * every);
+    return next;
+}
+
+static void dump_point(uint64_t instr)
+{
+    bool ok;
+
+    if (points_done == 0) {
+        printf("memsavep: Instruction count reached, saving memory to %s.\n", filename);
+        ok = start_incremental(instr);
+    } else {
+        printf("memsavep: Instruction count reached, saving changes to %s.delta.\n", filename);
+        ok = dump_delta(instr);
+    }
+    dump_registers(instr);
+    points_done++;
+    // Pages written from now on go into the next delta.
+    panda_ram_dirty_reset();
+
+    next_point = get_next_point(instr);
+    if (!ok || next_point == UINT64_MAX) {
+        dump_done = true;
+        if(should_close_after_dump)
+            panda_replay_end();
+    }
+}
+
 void before_block_exec(CPUState *env, TranslationBlock *tb) {
     if (dump_done) return;
 
-    if (instr_count && rr_get_guest_instr_count() > instr_count) {
+    if (points) {
+        uint64_t instr = rr_get_guest_instr_count();
+        if (instr > next_point)
+            dump_point(instr);
+    } else if (instr_count && rr_get_guest_instr_count() > instr_count) {
         printf("memsavep: Instruction count reached, saving memory to %s.\n", filename);
         dump_memory();
     } else if (rr_get_percentage() > percent) {
@@ -95,16 +363,48 @@ void before_block_exec(CPUState *env, TranslationBlock *tb) {
     return;
 }
 
+static gint cmp_uint64(gconstpointer a, gconstpointer b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
 bool init_plugin(void *self) {
+    const char *instr_counts;
+
     panda_cb pcb = { .before_block_exec = before_block_exec };
     panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
 
     panda_arg_list *args = panda_get_args("memsavep");
     percent = panda_parse_double_opt(args, "percent", 200, "dump memory after a given percentage of the replay is reached");
     instr_count = panda_parse_uint64_opt(args, "instrcount", 0, "dump memory after a given instruction count is reached");
+    instr_counts = panda_parse_string_opt(args, "instrcounts", NULL, "dump memory incrementally at these instruction counts, separated by _");
+    every = panda_parse_uint64_opt(args, "every", 0, "dump memory incrementally every this many instructions");
     filename = panda_parse_string_opt(args, "file", "memsavep.raw", "filename of the memory dump to create");
     register_filename = panda_parse_string_opt(args, "regfile", NULL, "filename of the register file to create");
     pmem_len = panda_parse_uint64_opt(args, "size", ram_size, "number of bytes of physical memory");
+    threads = panda_parse_uint32_opt(args, "threads", 0, "threads writing the dump (0 for one per host CPU)");
+
+    if (instr_counts || every) {
+        points = g_array_new(false, false, sizeof(uint64_t));
+        if (instr_counts) {
+            gchar **counts = g_strsplit(instr_counts, "_", -1);
+            for (gchar **c = counts; *c; c++) {
+                uint64_t n = g_ascii_strtoull(*c, NULL, 0);
+                g_array_append_val(points, n);
+            }
+            g_strfreev(counts);
+        }
+        if (instr_count)
+            g_array_append_val(points, instr_count);
+        g_array_sort(points, cmp_uint64);
+        if (points->len)
+            next_point = g_array_index(points, uint64_t, 0);
+        if (every)
+            next_point = MIN(next_point, every);
+        return true;
+    }
 
     if(!instr_count && percent > 100.0){
         printf("memsavep: You should specify either one of percent or instrcount");
@@ -115,5 +415,12 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-
+    if (delta_fd >= 0)
+        close(delta_fd);
+    if (index_file)
+        fclose(index_file);
+    if (points)
+        g_array_free(points, true);
+    if (last_layout)
+        g_array_free(last_layout, true);
 }
@@ -46,6 +46,11 @@ PPP_PROT_REG_CB(on_get_current_thread)
 PPP_PROT_REG_CB(on_get_process_pid)
 PPP_PROT_REG_CB(on_get_process_ppid)
 
+PPP_PROT_REG_CB(on_get_current_process_into)
+PPP_PROT_REG_CB(on_get_current_thread_into)
+PPP_PROT_REG_CB(on_get_current_process_pid)
+PPP_PROT_REG_CB(on_get_mappings_into)
+
 PPP_PROT_REG_CB(on_task_change)
 
 PPP_CB_BOILERPLATE(on_get_processes)
@@ -59,6 +64,11 @@ PPP_CB_BOILERPLATE(on_get_current_thread)
 PPP_CB_BOILERPLATE(on_get_process_pid)
 PPP_CB_BOILERPLATE(on_get_process_ppid)
 
+PPP_CB_BOILERPLATE(on_get_current_process_into)
+PPP_CB_BOILERPLATE(on_get_current_thread_into)
+PPP_CB_BOILERPLATE(on_get_current_process_pid)
+PPP_CB_BOILERPLATE(on_get_mappings_into)
+
 PPP_CB_BOILERPLATE(on_task_change)
 
 // The copious use of pointers to pointers in this file is due to
@@ -125,6 +135,74 @@ target_pid_t get_process_ppid(CPUState *cpu, const OsiProcHandle *h) {
     return ppid;
 }
 
+// The *_into variants fall back to the allocating callbacks when the OSI
+// provider doesn't implement them, so they work with any provider.
+
+bool get_current_process_into(CPUState *cpu, OsiProc *p) {
+    bool found = false;
+    if (PPP_CHECK_CB(on_get_current_process_into)) {
+        PPP_RUN_CB(on_get_current_process_into, cpu, p, &found);
+        return found;
+    }
+
+    OsiProc *q = get_current_process(cpu);
+    if (q == NULL) return false;
+    char *name = p->name;
+    memcpy(p, q, sizeof(OsiProc));
+    p->name = name;
+    p->pages = NULL;
+    osi_name_assign(&p->name, q->name);
+    free_osiproc(q);
+    return true;
+}
+
+bool get_current_thread_into(CPUState *cpu, OsiThread *t) {
+    bool found = false;
+    if (PPP_CHECK_CB(on_get_current_thread_into)) {
+        PPP_RUN_CB(on_get_current_thread_into, cpu, t, &found);
+        return found;
+    }
+
+    OsiThread *u = get_current_thread(cpu);
+    if (u == NULL) return false;
+    *t = *u;
+    free_osithread(u);
+    return true;
+}
+
+target_pid_t get_current_process_pid(CPUState *cpu) {
+    target_pid_t pid = (target_pid_t)-1;
+    if (PPP_CHECK_CB(on_get_current_process_pid)) {
+        PPP_RUN_CB(on_get_current_process_pid, cpu, &pid);
+        return pid;
+    }
+
+    OsiProc *p = get_current_process(cpu);
+    if (p != NULL) {
+        pid = p->pid;
+        free_osiproc(p);
+    }
+    return pid;
+}
+
+bool get_mappings_into(CPUState *cpu, OsiProc *p, GArray *out) {
+    bool found = false;
+    if (PPP_CHECK_CB(on_get_mappings_into)) {
+        PPP_RUN_CB(on_get_mappings_into, cpu, p, out, &found);
+    } else {
+        GArray *m = get_mappings(cpu, p);
+        if (m != NULL) {
+            osi_module_array_assign(out, m);
+            g_array_free(m, true);
+            found = true;
+        }
+    }
+    if (!found) {
+        osi_module_array_assign(out, NULL);
+    }
+    return found;
+}
+
 void notify_task_change(CPUState *cpu)
 {
     PPP_RUN_CB(on_task_change, cpu);
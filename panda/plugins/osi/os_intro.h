@@ -22,4 +22,11 @@ typedef void (*on_task_change_t)(CPUState *);
 
 // END_PYPANDA_NEEDS_THIS -- do not delete this comment!
 
+// Variants filling caller-owned structs, see osi_int_fns.h.
+// The bool is set to true when the struct was filled.
+typedef void (*on_get_current_process_into_t)(CPUState *, OsiProc *, bool *);
+typedef void (*on_get_current_thread_into_t)(CPUState *, OsiThread *, bool *);
+typedef void (*on_get_current_process_pid_t)(CPUState *, target_pid_t *);
+typedef void (*on_get_mappings_into_t)(CPUState *, OsiProc *, GArray *, bool *);
+
 #endif
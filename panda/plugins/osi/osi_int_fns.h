@@ -48,4 +48,38 @@ target_pid_t get_process_ppid(CPUState *cpu, const OsiProcHandle *h);
 
 void notify_task_change(CPUState *cpu);
 
+// Allocation-free variants of the above for callers that query OSI very
+// often. They fill structs owned by the caller, which must be zeroed before
+// their first use and can then be reused across calls. Names in these structs
+// are interned strings shared with OSI and must not be modified or freed;
+// release the structs with osi_release_proc/osi_module_array_free instead.
+
+// fills p with the currently running process, returns false if unavailable
+bool get_current_process_into(CPUState *cpu, OsiProc *p);
+
+// fills t with the current thread, returns false if unavailable
+bool get_current_thread_into(CPUState *cpu, OsiThread *t);
+
+// returns the pid of the currently running process, or -1
+target_pid_t get_current_process_pid(CPUState *cpu);
+
+// replaces the contents of out (from osi_module_array_new) with the mappings of p
+bool get_mappings_into(CPUState *cpu, OsiProc *p, GArray *out);
+
+// drops the name reference held by p and zeroes it
+void osi_release_proc(OsiProc *p);
+
+// GArray of OsiModule with interned names, for get_mappings_into
+GArray *osi_module_array_new(void);
+void osi_module_array_assign(GArray *out, GArray *from);
+void osi_module_array_free(GArray *a);
+
+// interned, reference-counted name strings
+const char *osi_intern_name(const char *name);
+const char *osi_name_ref(const char *name);
+void osi_name_unref(const char *name);
+
+// points *slot to an interned copy of name, releasing the previous name
+void osi_name_assign(char **slot, const char *name);
+
 // END_PYPANDA_NEEDS_THIS -- do not delete this comment!
@@ -0,0 +1,149 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+/*
+ * Interned, reference-counted strings for the names in OSI structs filled
+ * by the *_into APIs.
+ *
+ * The same few process and library names are reported over and over, so
+ * instead of g_strdup'ing them into every result, each distinct name is
+ * stored once and results hold references to it. Consumers can compare
+ * interned names by pointer. Names whose last reference is dropped are kept
+ * around for a while, since a process name that goes away usually comes
+ * back soon, and are only freed once they make up most of the table.
+ */
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include <glib.h>
+
+#include "panda/plugin.h"
+
+#include "osi_types.h"
+#include "osi_int_fns.h"
+
+#define OSI_NAMES_MIN_SWEEP 4096
+
+typedef struct osi_name_struct {
+    guint refs;
+    char str[];
+} OsiName;
+
+static GHashTable *names = NULL;
+static guint num_dead = 0;
+
+static inline OsiName *name_entry(const char *s) {
+    return (OsiName *)(s - offsetof(OsiName, str));
+}
+
+static gboolean name_is_dead(gpointer key, gpointer value, gpointer data) {
+    OsiName *n = (OsiName *)value;
+    if (n->refs != 0) return FALSE;
+    g_free(n);
+    return TRUE;
+}
+
+static void sweep_names(void) {
+    g_hash_table_foreach_remove(names, name_is_dead, NULL);
+    num_dead = 0;
+}
+
+const char *osi_intern_name(const char *name) {
+    if (name == NULL) return NULL;
+    if (names == NULL) {
+        names = g_hash_table_new(g_str_hash, g_str_equal);
+    }
+
+    OsiName *n = (OsiName *)g_hash_table_lookup(names, name);
+    if (n == NULL) {
+        size_t len = strlen(name);
+        n = (OsiName *)g_malloc(sizeof(OsiName) + len + 1);
+        n->refs = 0;
+        memcpy(n->str, name, len + 1);
+        g_hash_table_insert(names, n->str, n);
+    } else if (n->refs == 0) {
+        num_dead--;
+    }
+    n->refs++;
+    return n->str;
+}
+
+const char *osi_name_ref(const char *name) {
+    if (name != NULL) {
+        name_entry(name)->refs++;
+    }
+    return name;
+}
+
+void osi_name_unref(const char *name) {
+    if (name == NULL) return;
+    OsiName *n = name_entry(name);
+    assert(n->refs > 0);
+    if (--n->refs > 0) return;
+
+    num_dead++;
+    if (num_dead >= OSI_NAMES_MIN_SWEEP &&
+        num_dead * 2 > g_hash_table_size(names)) {
+        sweep_names();
+    }
+}
+
+void osi_name_assign(char **slot, const char *name) {
+    // Fast path: the name is the same as last time.
+    if (*slot != NULL && name != NULL && strcmp(*slot, name) == 0) return;
+    const char *old = *slot;
+    *slot = (char *)osi_intern_name(name);
+    osi_name_unref(old);
+}
+
+void osi_release_proc(OsiProc *p) {
+    if (p == NULL) return;
+    osi_name_unref(p->name);
+    memset(p, 0, sizeof(OsiProc));
+}
+
+static void release_module(OsiModule *m) {
+    osi_name_unref(m->file);
+    osi_name_unref(m->name);
+    memset(m, 0, sizeof(OsiModule));
+}
+
+GArray *osi_module_array_new(void) {
+    // Not using a clear func: elements are released explicitly, so that
+    // shrinking the array doesn't depend on the GLib version.
+    return g_array_sized_new(false, true, sizeof(OsiModule), 128);
+}
+
+void osi_module_array_assign(GArray *out, GArray *from) {
+    guint n = (from == NULL) ? 0 : from->len;
+    for (guint i = n; i < out->len; i++) {
+        release_module(&g_array_index(out, OsiModule, i));
+    }
+    guint old_len = out->len;
+    g_array_set_size(out, n);
+    if (n > old_len) {
+        memset(&g_array_index(out, OsiModule, old_len), 0,
+               (n - old_len) * sizeof(OsiModule));
+    }
+
+    for (guint i = 0; i < n; i++) {
+        OsiModule *m = &g_array_index(out, OsiModule, i);
+        OsiModule *f = &g_array_index(from, OsiModule, i);
+        m->modd = f->modd;
+        m->base = f->base;
+        m->size = f->size;
+        osi_name_assign(&m->file, f->file);
+        osi_name_assign(&m->name, f->name);
+    }
+}
+
+void osi_module_array_free(GArray *a) {
+    if (a == NULL) return;
+    osi_module_array_assign(a, NULL);
+    g_array_free(a, true);
+}
+
+/* vim:set tabstop=4 softtabstop=4 expandtab: */
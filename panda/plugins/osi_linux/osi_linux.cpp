@@ -19,6 +19,7 @@
 #include "osi/os_intro.h"
 #include "utils/kernelinfo/kernelinfo.h"
 #include "osi_linux.h"
+#include "osi_linux_cache.h"
 #include "syscalls2/syscalls_ext_typedefs.h"
 
 #include "default_profile.h"
@@ -48,7 +49,11 @@ void on_get_current_process(CPUState *env, OsiProc **out_p);
 void on_get_current_process_handle(CPUState *env, OsiProcHandle **out_p);
 void on_get_process(CPUState *, const OsiProcHandle *, OsiProc **);
 void on_get_mappings(CPUState *env, OsiProc *p, GArray **out);
-void on_get_current_thread(CPUState *env, OsiThread *t);
+void on_get_current_thread(CPUState *env, OsiThread **out);
+void on_get_current_process_into(CPUState *env, OsiProc *p, bool *found);
+void on_get_current_thread_into(CPUState *env, OsiThread *t, bool *found);
+void on_get_current_process_pid(CPUState *env, target_pid_t *pid);
+void on_get_mappings_into(CPUState *env, OsiProc *p, GArray *out, bool *found);
 
 void init_per_cpu_offsets(CPUState *cpu);
 struct kernelinfo ki;
@@ -57,6 +62,7 @@ struct KernelProfile const *kernel_profile;
 extern const char *qemu_file;
 static bool osi_initialized;
 static bool first_osi_check = true;
+static OsiLinuxCache osi_cache;
 
 /* ******************************************************************
  Helpers
@@ -144,9 +150,10 @@ static void fill_osiprochandle(CPUState *cpu, OsiProcHandle *h,
 }
 
 /**
- * @brief Fills an OsiProc struct. Any existing contents are overwritten.
+ * @brief Fills all fields of an OsiProc struct except the name.
+ * Any existing contents (including the name pointer) are overwritten.
  */
-void fill_osiproc(CPUState *cpu, OsiProc *p, target_ptr_t task_addr) {
+static void fill_osiproc_info(CPUState *cpu, OsiProc *p, target_ptr_t task_addr) {
     struct_get_ret_t UNUSED(err);
     memset(p, 0, sizeof(OsiProc));
 
@@ -161,7 +168,6 @@ void fill_osiproc(CPUState *cpu, OsiProc *p, target_ptr_t task_addr) {
     p->asid = p->asid ? panda_virt_to_phys(cpu, p->asid) : (target_ulong) NULL;
     p->taskd = kernel_profile->get_group_leader(cpu, task_addr);
 
-    p->name = get_name(cpu, task_addr, p->name);
     p->pid = get_tgid(cpu, task_addr);
     //p->ppid = get_real_parent_pid(cpu, task_addr);
     p->pages = NULL;  // OsiPage - TODO
@@ -184,6 +190,14 @@ void fill_osiproc(CPUState *cpu, OsiProc *p, target_ptr_t task_addr) {
     }
 }
 
+/**
+ * @brief Fills an OsiProc struct. Any existing contents are overwritten.
+ */
+void fill_osiproc(CPUState *cpu, OsiProc *p, target_ptr_t task_addr) {
+    fill_osiproc_info(cpu, p, task_addr);
+    p->name = get_name(cpu, task_addr, p->name);
+}
+
 /**
  * @brief Fills an OsiModule struct.
  */
@@ -231,8 +245,13 @@ static void fill_osimodule(CPUState *env, OsiModule *m, target_ptr_t vma_addr) {
 void fill_osithread(CPUState *env, OsiThread *t,
                            target_ptr_t task_addr) {
     memset(t, 0, sizeof(*t));
-    t->tid = get_pid(env, task_addr);
-    t->pid = get_tgid(env, task_addr);
+    struct_fields task(env, task_addr, {{ki.task.pid_offset, sizeof(int)},
+                                        {ki.task.tgid_offset, sizeof(int)}});
+    int tid = 0, pid = 0;
+    task.get(&tid, ki.task.pid_offset);
+    task.get(&pid, ki.task.tgid_offset);
+    t->tid = flipbadendian(tid);
+    t->pid = flipbadendian(pid);
 }
 
 /* ******************************************************************
@@ -314,14 +333,40 @@ bool osi_guest_is_ready(CPUState *cpu, void** ret) {
  PPP Callbacks
 ****************************************************************** */
 
+/**
+ * @brief Fails a list query the same way an uncached failed read would.
+ */
+static inline void drop_result(GArray **out) {
+    if (*out != NULL) {
+        g_array_free(*out, true);
+    }
+    *out = NULL;
+}
+
 /**
  * @brief PPP callback to retrieve process list from the running OS.
  *
  */
 void on_get_processes(CPUState *env, GArray **out) {
     if (!osi_guest_is_ready(env, (void**)out)) return;
-    // instantiate and call function from get_process_info template
-    get_process_info<>(env, out, fill_osiproc, free_osiproc_contents);
+
+    if (!osi_cache.enabled) {
+        // instantiate and call function from get_process_info template
+        get_process_info<>(env, out, fill_osiproc, free_osiproc_contents);
+        return;
+    }
+
+    if (osi_cache.processes() == NULL) {
+        GArray *ps = NULL;
+        get_process_info<>(env, &ps, fill_osiproc, free_osiproc_contents);
+        if (ps == NULL) {
+            // Don't cache failures, the list may be readable later on.
+            drop_result(out);
+            return;
+        }
+        osi_cache.set_processes(ps);
+    }
+    append_cached<>(out, osi_cache.processes(), copy_osiproc, free_osiproc_contents);
 }
 
 /**
@@ -330,8 +375,62 @@ void on_get_processes(CPUState *env, GArray **out) {
 void on_get_process_handles(CPUState *env, GArray **out) {
     if (!osi_guest_is_ready(env, (void**)out)) return;
 
-    // instantiate and call function from get_process_info template
-    get_process_info<>(env, out, fill_osiprochandle, free_osiprochandle_contents);
+    if (!osi_cache.enabled) {
+        // instantiate and call function from get_process_info template
+        get_process_info<>(env, out, fill_osiprochandle, free_osiprochandle_contents);
+        return;
+    }
+
+    if (osi_cache.handles() == NULL) {
+        GArray *hs = NULL;
+        get_process_info<>(env, &hs, fill_osiprochandle, free_osiprochandle_contents);
+        if (hs == NULL) {
+            drop_result(out);
+            return;
+        }
+        osi_cache.set_handles(hs);
+    }
+    // OsiProcHandle has no pointers, so a plain copy is enough.
+    append_cached<OsiProcHandle>(out, osi_cache.handles(), NULL, free_osiprochandle_contents);
+}
+
+/**
+ * @brief Returns info about the currently running process, or NULL.
+ * The info is re-read from the guest only when the current task, its name
+ * or the cache generation change. The returned struct is owned by this
+ * function and is only valid until the next call.
+ */
+static const OsiProc *get_current_proc_cached(CPUState *env) {
+    static target_ptr_t last_ts = 0x0;
+    static uint64_t last_generation = 0;
+    static void *cached_comm_ptr = NULL;
+    static OsiProc cached = {};
+    // OsiPage - TODO
+
+    target_ptr_t ts = kernel_profile->get_current_task_struct(env);
+    if (0x0 == ts) return NULL;
+
+    if (cached.name == NULL) {
+        // comm may not be NUL-terminated, keep an extra byte for that
+        cached.name = (char *)g_malloc0(ki.task.comm_size + 1);
+    }
+    if ((ts != last_ts) || (NULL == cached_comm_ptr) ||
+        (last_generation != osi_cache.generation()) ||
+        (0 != strncmp((char *)cached_comm_ptr, cached.name,
+                      ki.task.comm_size))) {
+        char *name = cached.name;
+        fill_osiproc_info(env, &cached, ts);
+        cached.name = name;
+        if (-1 == panda_virtual_memory_rw(env, ts + ki.task.comm_offset,
+                                          (uint8_t *)name, ki.task.comm_size, 0)) {
+            strncpy(name, "N/A", ki.task.comm_size);
+        }
+        last_ts = ts;
+        last_generation = osi_cache.generation();
+        cached_comm_ptr = panda_map_virt_to_host(
+            env, ts + ki.task.comm_offset, ki.task.comm_size);
+    }
+    return &cached;
 }
 
 /**
@@ -340,47 +439,37 @@ void on_get_process_handles(CPUState *env, GArray **out) {
 void on_get_current_process(CPUState *env, OsiProc **out) {
     if (!osi_guest_is_ready(env, (void**)out)) return;
 
-    static target_ptr_t last_ts = 0x0;
-    static target_ptr_t cached_taskd = 0x0;
-    static target_ptr_t cached_asid = 0x0;
-    static char *cached_name = (char *)g_malloc0(ki.task.comm_size);
-    static target_ptr_t cached_pid = -1;
-    static target_ptr_t cached_ppid = -1;
-    static void *cached_comm_ptr = NULL;
-    static uint64_t cached_start_time = 0;
-    // OsiPage - TODO
+    const OsiProc *c = get_current_proc_cached(env);
+    *out = (c == NULL) ? NULL : copy_osiproc((OsiProc *)c, NULL);
+}
+
+/**
+ * @brief PPP callback to fill a caller-owned OsiProc with info about the
+ * currently running process. Doesn't allocate, the name is interned.
+ */
+void on_get_current_process_into(CPUState *env, OsiProc *p, bool *found) {
+    if (!osi_guest_is_ready(env, NULL)) return;
+
+    const OsiProc *c = get_current_proc_cached(env);
+    if (c == NULL) return;
+
+    char *name = p->name;
+    memcpy(p, c, sizeof(OsiProc));
+    p->name = name;
+    osi_name_assign(&p->name, c->name);
+    *found = true;
+}
+
+/**
+ * @brief PPP callback to retrieve the pid of the currently running process.
+ */
+void on_get_current_process_pid(CPUState *env, target_pid_t *pid) {
+    if (!osi_guest_is_ready(env, NULL)) return;
 
-    OsiProc *p = NULL;
     target_ptr_t ts = kernel_profile->get_current_task_struct(env);
     if (0x0 != ts) {
-        p = (OsiProc *)g_malloc(sizeof(*p));
-        if ((ts != last_ts) || (NULL == cached_comm_ptr) ||
-            (0 != strncmp((char *)cached_comm_ptr, cached_name,
-                          ki.task.comm_size))) {
-            last_ts = ts;
-            fill_osiproc(env, p, ts);
-
-            // update the cache
-            cached_taskd = p->taskd;
-            cached_asid = p->asid;
-            memset(cached_name, 0, ki.task.comm_size);
-            strncpy(cached_name, p->name, ki.task.comm_size);
-            cached_pid = p->pid;
-            cached_ppid = p->ppid;
-	    cached_start_time = p->create_time;
-            cached_comm_ptr = panda_map_virt_to_host(
-                env, ts + ki.task.comm_offset, ki.task.comm_size);
-        } else {
-            p->taskd = cached_taskd;
-            p->asid = cached_asid;
-            p->name = g_strdup(cached_name);
-            p->pid = cached_pid;
-            p->ppid = cached_ppid;
-            p->pages = NULL;
-	    p->create_time = cached_start_time;
-        }
+        *pid = get_tgid(env, ts);
     }
-    *out = p;
 }
 
 /**
@@ -414,22 +503,15 @@ void on_get_process(CPUState *env, const OsiProcHandle *h, OsiProc **out) {
 }
 
 /**
- * @brief PPP callback to retrieve OsiModules from the running OS.
- *
- * Current implementation returns all the memory areas mapped by the
- * process and the files they were mapped from. Libraries that have
- * many mappings will appear multiple times.
- *
- * @todo Remove duplicates from results.
+ * @brief Walks the VMA list of a task and appends the OsiModules to *out.
+ * On failure, *out is freed and set to NULL.
  */
-void on_get_mappings(CPUState *env, OsiProc *p, GArray **out) {
-    if (!osi_guest_is_ready(env, (void**)out)) return;
-
+static void read_mappings(CPUState *env, target_ptr_t taskd, GArray **out) {
     OsiModule m;
     target_ptr_t vma_first, vma_current;
 
     // Read the module info for the process.
-    vma_first = vma_current = get_vma_first(env, p->taskd);
+    vma_first = vma_current = get_vma_first(env, taskd);
     if (vma_current == (target_ptr_t)NULL) goto error0;
 
     if (*out == NULL) {
@@ -455,35 +537,115 @@ error0:
     return;
 }
 
+/**
+ * @brief PPP callback to retrieve OsiModules from the running OS.
+ *
+ * Current implementation returns all the memory areas mapped by the
+ * process and the files they were mapped from. Libraries that have
+ * many mappings will appear multiple times.
+ *
+ * @todo Remove duplicates from results.
+ */
+void on_get_mappings(CPUState *env, OsiProc *p, GArray **out) {
+    if (!osi_guest_is_ready(env, (void**)out)) return;
 
+    target_ptr_t mm = osi_cache.enabled ? get_task_mm(env, p->taskd) : (target_ptr_t)NULL;
+    if (mm == (target_ptr_t)NULL) {
+        // Cache disabled, or a kernel thread without mappings.
+        read_mappings(env, p->taskd, out);
+        return;
+    }
+
+    GArray *ms = osi_cache.mappings(mm);
+    if (ms == NULL) {
+        read_mappings(env, p->taskd, &ms);
+        if (ms == NULL) {
+            drop_result(out);
+            return;
+        }
+        osi_cache.set_mappings(mm, ms);
+    }
+    append_cached<>(out, ms, copy_osimod, free_osimodule_contents);
+}
 
 /**
- * @brief PPP callback to retrieve current thread.
+ * @brief PPP callback to replace the contents of a caller-owned OsiModule
+ * array with the mappings of a process. Names are interned, so this doesn't
+ * allocate unless the mappings have to be read from the guest.
  */
-void on_get_current_thread(CPUState *env, OsiThread **out) {
+void on_get_mappings_into(CPUState *env, OsiProc *p, GArray *out, bool *found) {
+    if (!osi_guest_is_ready(env, NULL)) return;
+
+    target_ptr_t mm = osi_cache.enabled ? get_task_mm(env, p->taskd) : (target_ptr_t)NULL;
+    GArray *ms = (mm == (target_ptr_t)NULL) ? NULL : osi_cache.mappings(mm);
+    if (ms != NULL) {
+        osi_module_array_assign(out, ms);
+        *found = true;
+        return;
+    }
+
+    read_mappings(env, p->taskd, &ms);
+    if (ms == NULL) return;
+    osi_module_array_assign(out, ms);
+    *found = true;
+    if (mm != (target_ptr_t)NULL) {
+        osi_cache.set_mappings(mm, ms);
+    } else {
+        g_array_free(ms, true);
+    }
+}
+
+/**
+ * @brief Fills t with the current thread. Returns false if there's no
+ * current task.
+ */
+static bool get_current_thread_cached(CPUState *env, OsiThread *t) {
     static target_ptr_t last_ts = 0x0;
+    static uint64_t last_generation = 0;
     static target_pid_t cached_tid = 0;
     static target_pid_t cached_pid = 0;
 
-    if (!osi_guest_is_ready(env, (void**)out)) return;
-
-    OsiThread *t = NULL;
     target_ptr_t ts = kernel_profile->get_current_task_struct(env);
-    if (0x0 != ts) {
-        t = (OsiThread *)g_malloc(sizeof(OsiThread));
-        if (last_ts != ts) {
-            fill_osithread(env, t, ts);
-            cached_tid = t->tid;
-            cached_pid = t->pid;
-        } else {
-            t->tid = cached_tid;
-            t->pid = cached_pid;
-        }
+    if (0x0 == ts) return false;
+
+    // A task's tid/tgid only change when it execs (or its thread group
+    // leader does), which bumps the cache generation.
+    if (last_ts != ts || last_generation != osi_cache.generation() ||
+        !osi_cache.enabled) {
+        fill_osithread(env, t, ts);
+        last_ts = ts;
+        last_generation = osi_cache.generation();
+        cached_tid = t->tid;
+        cached_pid = t->pid;
+    } else {
+        t->tid = cached_tid;
+        t->pid = cached_pid;
     }
+    return true;
+}
+
+/**
+ * @brief PPP callback to retrieve current thread.
+ */
+void on_get_current_thread(CPUState *env, OsiThread **out) {
+    if (!osi_guest_is_ready(env, (void**)out)) return;
 
+    OsiThread *t = (OsiThread *)g_malloc(sizeof(OsiThread));
+    if (!get_current_thread_cached(env, t)) {
+        g_free(t);
+        t = NULL;
+    }
     *out = t;
 }
 
+/**
+ * @brief PPP callback to fill a caller-owned OsiThread with the current thread.
+ */
+void on_get_current_thread_into(CPUState *env, OsiThread *t, bool *found) {
+    if (!osi_guest_is_ready(env, NULL)) return;
+    *found = get_current_thread_cached(env, t);
+}
+
 /**
  * @brief PPP callback to retrieve the process pid from a handle.
  */
@@ -566,6 +728,78 @@ unsigned long long  osi_linux_fd_to_pos(CPUState *env, OsiProc *p, int fd) {
     return get_fd_pos(env, ts_current, fd);
 }
 
+uint64_t osi_linux_cache_generation(void) {
+    return osi_cache.generation();
+}
+
+/* ******************************************************************
+ Cache invalidation
+****************************************************************** */
+#if defined(TARGET_I386) || defined(TARGET_ARM) || defined(TARGET_MIPS)
+
+/**
+ * @brief Drops the cached mappings of the address space of the current task.
+ */
+static void current_mappings_changed(CPUState *cpu) {
+    target_ptr_t ts = kernel_profile->get_current_task_struct(cpu);
+    if (ts == (target_ptr_t)NULL) {
+        osi_cache.flush();
+        return;
+    }
+    osi_cache.mappings_changed(get_task_mm(cpu, ts));
+}
+
+/**
+ * @brief syscalls2 callback for syscalls that change the mappings of the
+ * calling process. The template matches the signature of any syscall.
+ */
+template <typename... Args>
+static void mappings_syscall(CPUState *cpu, target_ulong pc, Args...) {
+    if (!osi_initialized) return;
+    current_mappings_changed(cpu);
+}
+
+/**
+ * @brief syscalls2 callback for syscalls that create processes. The new
+ * process may reuse the task_struct or mm_struct of a dead one, so all
+ * mappings are dropped as well.
+ */
+template <typename... Args>
+static void fork_syscall(CPUState *cpu, target_ulong pc, Args...) {
+    osi_cache.flush();
+}
+
+/**
+ * @brief syscalls2 callback for syscalls that terminate the calling process
+ * or thread. These don't return, so this is hooked on entry.
+ */
+template <typename... Args>
+static void exit_syscall(CPUState *cpu, target_ulong pc, Args...) {
+    osi_cache.processes_changed();
+    if (!osi_initialized) return;
+    current_mappings_changed(cpu);
+}
+
+/**
+ * @brief syscalls2 callback for syscalls that may rename the calling
+ * process (e.g. prctl(PR_SET_NAME)).
+ */
+template <typename... Args>
+static void rename_syscall(CPUState *cpu, target_ulong pc, Args...) {
+    osi_cache.processes_changed();
+}
+
+/**
+ * @brief The process list is read starting from the current task, and may
+ * contain tasks created without a syscall (e.g. kernel threads), so it is
+ * only trusted while the same address space keeps running.
+ */
+static int cache_asid_changed(CPUState *cpu, target_ulong oldval, target_ulong newval) {
+    osi_cache.processes_changed();
+    return 0;
+}
+#endif
+
 
 
 /* ******************************************************************
@@ -676,6 +910,7 @@ void restore_after_snapshot(CPUState* cpu) {
     // it runs at the first syscall (and asserts if it fails)
     osi_initialized=false;
     first_osi_check = true;
+    osi_cache.flush();
     PPP_REG_CB("syscalls2", on_all_sys_enter, on_first_syscall);
 }
 
@@ -730,11 +965,19 @@ static void exec_check(CPUState *cpu)
     target_ptr_t ts = kernel_profile->get_current_task_struct(cpu);
     auto it = tasks_in_execve.find(ts);
     if (tasks_in_execve.end() != it && !panda_in_kernel(cpu)) {
+        osi_cache.processes_changed();
+        current_mappings_changed(cpu);
         notify_task_change(cpu);
         tasks_in_execve.erase(ts);
     }
 }
 
+static void task_change_hook(CPUState *cpu)
+{
+    osi_cache.processes_changed();
+    notify_task_change(cpu);
+}
+
 static void before_tcg_codegen_callback(CPUState *cpu, TranslationBlock *tb)
 {
     TCGOp *op = find_first_guest_insn();
@@ -743,7 +986,7 @@ static void before_tcg_codegen_callback(CPUState *cpu, TranslationBlock *tb)
 
     if (0x0 != ki.task.switch_task_hook_addr && tb->pc == ki.task.switch_task_hook_addr) {
         // Instrument the task switch address.
-        insert_call(&op, notify_task_change, cpu);
+        insert_call(&op, task_change_hook, cpu);
     }
 }
 #endif
@@ -784,6 +1027,7 @@ bool init_plugin(void *self) {
     char *kconf_file = g_strdup(panda_parse_string_opt(plugin_args, "kconf_file", NULL, "file containing kernel configuration information"));
     char *kconf_group = g_strdup(panda_parse_string_opt(plugin_args, "kconf_group", NULL, "kernel profile to use"));
     osi_initialized = panda_parse_bool_opt(plugin_args, "load_now", "Raise a fatal error if OSI cannot be initialized immediately");
+    osi_cache.enabled = !panda_parse_bool_opt(plugin_args, "no_cache", "Walk guest kernel lists on every process/mapping query instead of caching the results");
     panda_free_args(plugin_args);
 
     if (!kconf_file) {
@@ -859,6 +1103,10 @@ bool init_plugin(void *self) {
     PPP_REG_CB("osi", on_get_current_thread, on_get_current_thread);
     PPP_REG_CB("osi", on_get_process_pid, on_get_process_pid);
     PPP_REG_CB("osi", on_get_process_ppid, on_get_process_ppid);
+    PPP_REG_CB("osi", on_get_current_process_into, on_get_current_process_into);
+    PPP_REG_CB("osi", on_get_current_thread_into, on_get_current_thread_into);
+    PPP_REG_CB("osi", on_get_current_process_pid, on_get_current_process_pid);
+    PPP_REG_CB("osi", on_get_mappings_into, on_get_mappings_into);
 
     // By default, we'll request syscalls2 to load on first syscall
     panda_require("syscalls2");
@@ -877,6 +1125,58 @@ bool init_plugin(void *self) {
         exec_enter(cpu);
     });
 
+    // Invalidate the process list and mappings caches.
+    {
+        panda_cb pcb = { .asid_changed = cache_asid_changed };
+        panda_register_callback(self, PANDA_CB_ASID_CHANGED, pcb);
+    }
+    PPP_REG_CB("syscalls2", on_sys_clone_return, fork_syscall);
+#if defined(TARGET_AARCH64)
+    PPP_REG_CB("syscalls2", on_sys_clone3_return, fork_syscall);
+#else
+    PPP_REG_CB("syscalls2", on_sys_fork_return, fork_syscall);
+#endif
+#if !defined(TARGET_AARCH64) && !defined(TARGET_MIPS)
+    PPP_REG_CB("syscalls2", on_sys_vfork_return, fork_syscall);
+#endif
+    PPP_REG_CB("syscalls2", on_sys_exit_enter, exit_syscall);
+    PPP_REG_CB("syscalls2", on_sys_exit_group_enter, exit_syscall);
+    PPP_REG_CB("syscalls2", on_sys_prctl_return, rename_syscall);
+
+    PPP_REG_CB("syscalls2", on_sys_munmap_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_mprotect_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_mremap_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_brk_return, mappings_syscall);
+    // these split or merge mappings when they change part of one
+    PPP_REG_CB("syscalls2", on_sys_madvise_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_mlock_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_mlock2_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_munlock_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_mlockall_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_munlockall_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_mbind_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_remap_file_pages_return, mappings_syscall);
+#if !defined(TARGET_ARM) || defined(TARGET_AARCH64)
+    PPP_REG_CB("syscalls2", on_sys_pkey_mprotect_return, mappings_syscall);
+#endif
+#if defined(TARGET_I386) && !defined(TARGET_X86_64)
+    PPP_REG_CB("syscalls2", on_sys_mmap_pgoff_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_old_mmap_return, mappings_syscall);
+#elif defined(TARGET_ARM) && !defined(TARGET_AARCH64)
+    PPP_REG_CB("syscalls2", on_do_mmap2_return, mappings_syscall);
+#else
+    PPP_REG_CB("syscalls2", on_sys_mmap_return, mappings_syscall);
+#endif
+#if defined(TARGET_MIPS)
+    PPP_REG_CB("syscalls2", on_mmap2_return, mappings_syscall);
+#endif
+#if defined(TARGET_I386) && !defined(TARGET_X86_64)
+    PPP_REG_CB("syscalls2", on_sys_ipc_return, mappings_syscall);
+#else
+    PPP_REG_CB("syscalls2", on_sys_shmat_return, mappings_syscall);
+    PPP_REG_CB("syscalls2", on_sys_shmdt_return, mappings_syscall);
+#endif
+
     return true;
 #else
     fprintf(stderr, PLUGIN_NAME "Unsupported guest architecture\n");
@@ -898,6 +1198,7 @@ void uninit_plugin(void *self) {
     // Nothing to do...
 #endif
     osi_initialized=false;
+    osi_cache.flush();
     return;
 }
 
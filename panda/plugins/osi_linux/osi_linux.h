@@ -19,6 +19,7 @@
 #if defined(__cplusplus)
 #include <cstdint>
 #include <initializer_list>
+#include <vector>
 #include <glib.h>
 #endif
 #include "panda/plugin.h"
@@ -51,7 +52,7 @@ struct_get_ret_t struct_get(CPUState *cpu, T *v, target_ptr_t ptr, off_t offset)
         return struct_get_ret_t::ERROR_DEREF;
     }
 
-    switch(panda_virtual_memory_rw(cpu, ptr+offset, (uint8_t *)v, sizeof(T), 0)) {
+    switch(panda_virtual_memory_read_cached(cpu, ptr+offset, (uint8_t *)v, sizeof(T))) {
         case -1:
             memset((uint8_t *)v, 0, sizeof(T));
             return struct_get_ret_t::ERROR_MEMORY;
@@ -97,6 +98,70 @@ struct_get_ret_t struct_get(CPUState *cpu, T *v, target_ptr_t ptr, std::initiali
     //printf("Struct_get final 0x%x => 0x%x\n", ptr, *v);
     return ret;
 }
+
+/**
+ * @brief A field of a kernel struct: its offset, from kernelinfo.conf, and
+ * its size. See struct_fields.
+ */
+struct struct_field {
+    off_t offset;
+    size_t size;
+};
+
+/**
+ * @brief Layout-driven reader for several fields of one kernel struct.
+ * read() fetches the bytes spanning all the fields with a single guest read,
+ * and get() then extracts them, instead of one guest read per field:
+ *
+ *     struct_fields task(cpu, ts, {{ki.task.pid_offset, sizeof(int)},
+ *                                  {ki.task.tgid_offset, sizeof(int)}});
+ *     int pid, tgid;
+ *     task.get(&pid, ki.task.pid_offset);
+ *     task.get(&tgid, ki.task.tgid_offset);
+ *
+ * Fields too far apart to be read at once are read one by one by get().
+ */
+class struct_fields {
+public:
+    struct_fields(CPUState *cpu, target_ptr_t ptr,
+                  std::initializer_list<struct_field> fields)
+        : cpu_(cpu), ptr_(ptr), start_(0), ok_(false) {
+        if (ptr == (target_ptr_t)NULL || fields.size() == 0) return;
+        off_t start = fields.begin()->offset;
+        off_t end = start;
+        for (auto &f : fields) {
+            start = MIN(start, f.offset);
+            end = MAX(end, (off_t)(f.offset + f.size));
+        }
+        if (end - start > max_span) return;
+        start_ = start;
+        data_.resize(end - start);
+        ok_ = (panda_virtual_memory_read_cached(cpu, ptr + start, data_.data(),
+                                                data_.size()) == 0);
+    }
+
+    /**
+     * @brief Copies the field at offset into *v, like struct_get() does.
+     */
+    template <typename T>
+    struct_get_ret_t get(T *v, off_t offset) const {
+        if (ok_ && offset >= start_ &&
+            (size_t)(offset - start_) + sizeof(T) <= data_.size()) {
+            memcpy(v, &data_[offset - start_], sizeof(T));
+            return struct_get_ret_t::SUCCESS;
+        }
+        return struct_get(cpu_, v, ptr_, offset);
+    }
+
+private:
+    static const off_t max_span = 4096;
+
+    CPUState *cpu_;
+    target_ptr_t ptr_;
+    off_t start_;
+    bool ok_;
+    std::vector<uint8_t> data_;
+};
 #endif
 
 /**
@@ -110,7 +175,7 @@ struct_get_ret_t struct_get(CPUState *cpu, T *v, target_ptr_t ptr, std::initiali
 #define IMPLEMENT_OFFSET_GET(_name, _paramName, _retType, _offset, _errorRetValue) \
 static inline _retType _name(CPUState* env, target_ptr_t _paramName) { \
     _retType _t; \
-    if (-1 == panda_virtual_memory_rw(env, _paramName + _offset, (uint8_t *)&_t, sizeof(_retType), 0)) { \
+    if (-1 == panda_virtual_memory_read_cached(env, _paramName + _offset, (uint8_t *)&_t, sizeof(_retType))) { \
         return (_errorRetValue); \
     } \
     return (flipbadendian(_t)); \
@@ -131,7 +196,7 @@ static inline _retType _name(CPUState* env, target_ptr_t _paramName) { \
     _retType _t; \
     if (_offset == NULL)\
         return 0; \
-    if (-1 == panda_virtual_memory_rw(env, _paramName + _offset, (uint8_t *)&_t, sizeof(_retType), 0)) { \
+    if (-1 == panda_virtual_memory_read_cached(env, _paramName + _offset, (uint8_t *)&_t, sizeof(_retType))) { \
         return (_errorRetValue); \
     } \
     return (flipbadendian(_t)); \
@@ -152,10 +217,10 @@ static inline _retType _name(CPUState* env, target_ptr_t _paramName) { \
 static inline _retType2 _name(CPUState* env, target_ptr_t _paramName) { \
     _retType1 _t1; \
     _retType2 _t2; \
-    if (-1 == panda_virtual_memory_rw(env, _paramName + _offset1, (uint8_t *)&_t1, sizeof(_retType1), 0)) { \
+    if (-1 == panda_virtual_memory_read_cached(env, _paramName + _offset1, (uint8_t *)&_t1, sizeof(_retType1))) { \
         return (_errorRetValue); \
     } \
-    if (-1 == panda_virtual_memory_rw(env, flipbadendian(_t1) + _offset2, (uint8_t *)&_t2, sizeof(_retType2), 0)) { \
+    if (-1 == panda_virtual_memory_read_cached(env, flipbadendian(_t1) + _offset2, (uint8_t *)&_t2, sizeof(_retType2))) { \
         return (_errorRetValue); \
     } \
     return (flipbadendian(_t2)); \
@@ -179,7 +244,7 @@ static inline int _funcName(CPUState* env, target_ptr_t _paramName, _retType* _r
     size_t ret_size = ((_retSize) == OG_AUTOSIZE) ? sizeof(_retType) : (_retSize); \
     OG_printf(#_funcName ":1:" TARGET_PTR_FMT ":%d\n", _paramName, _offset); \
     OG_printf(#_funcName ":2:" TARGET_PTR_FMT ":%zu\n", _paramName + _offset, ret_size); \
-    if (-1 == panda_virtual_memory_rw(env, _paramName + _offset, (uint8_t *)_retName, ret_size, 0)) { \
+    if (-1 == panda_virtual_memory_read_cached(env, _paramName + _offset, (uint8_t *)_retName, ret_size)) { \
         return OG_ERROR_MEMORY; \
     } \
     OG_printf(#_funcName ":3:ok\n"); \
@@ -198,7 +263,7 @@ static inline int _funcName(CPUState* env, target_ptr_t _paramName, _retType* _r
     size_t ret_size = ((_retSize) == OG_AUTOSIZE) ? sizeof(_retType) : (_retSize); \
     OG_printf(#_funcName ":1:" TARGET_PTR_FMT ":%d\n", _paramName, _offset1); \
     OG_printf(#_funcName ":2:" TARGET_PTR_FMT ":%zu\n", _paramName + _offset1, sizeof(target_ptr_t)); \
-    if (-1 == panda_virtual_memory_rw(env, _paramName + _offset1, (uint8_t *)&_p1, sizeof(target_ptr_t), 0)) { \
+    if (-1 == panda_virtual_memory_read_cached(env, _paramName + _offset1, (uint8_t *)&_p1, sizeof(target_ptr_t))) { \
         return OG_ERROR_MEMORY; \
     } \
     OG_printf(#_funcName ":3:" TARGET_PTR_FMT ":%d\n", _p1, _offset2); \
@@ -206,7 +271,7 @@ static inline int _funcName(CPUState* env, target_ptr_t _paramName, _retType* _r
         return OG_ERROR_DEREF; \
     } \
     OG_printf(#_funcName ":4:" TARGET_PTR_FMT ":%zu\n", _p1 + _offset2, ret_size); \
-    if (-1 == panda_virtual_memory_rw(env, _p1 + _offset2, (uint8_t *)_retName, ret_size, 0)) { \
+    if (-1 == panda_virtual_memory_read_cached(env, _p1 + _offset2, (uint8_t *)_retName, ret_size)) { \
         return OG_ERROR_MEMORY; \
     } \
     OG_printf(#_funcName ":5:ok\n"); \
@@ -243,6 +308,12 @@ IMPLEMENT_OFFSET_GET(get_tgid, task_struct, int, ki.task.tgid_offset, 0)
  */
 IMPLEMENT_OPTIONAL_OFFSET_GET(get_start_time, task_struct, uint64_t, ki.task.start_time_offset, 0)
 
+/**
+ * @brief Retrieves the address of the mm_struct from a task_struct.
+ * Kernel threads have no mm_struct, so 0 is returned for them.
+ */
+IMPLEMENT_OFFSET_GET(get_task_mm, task_struct, target_ptr_t, ki.task.mm_offset, 0)
+
 
 /**
  * @brief Retrieves the address of the mm_struct from a task_struct.
@@ -372,7 +443,7 @@ static inline target_ptr_t get_fd_file(CPUState *env, target_ptr_t fd_file_array
     fd_file_ptr = fd_file_array+n*sizeof(target_ptr_t);
 
     // Read address of the file struct.
-    if (-1 == panda_virtual_memory_rw(env, fd_file_ptr, (uint8_t *)&fd_file, sizeof(target_ptr_t), 0)) {
+    if (-1 == panda_virtual_memory_read_cached(env, fd_file_ptr, (uint8_t *)&fd_file, sizeof(target_ptr_t))) {
         return (target_ptr_t)NULL;
     }
     fixupendian(fd_file_ptr);
@@ -454,7 +525,7 @@ static inline char *read_dentry_name(CPUState *env, target_ptr_t dentry) {
 
         target_ptr_t guest_addr = *(target_ptr_t *)(d_name + ki.qstr.name_offset);
         fixupendian(guest_addr);
-        og_err1 = panda_virtual_memory_rw(env, guest_addr, (uint8_t *)pcomp, pcomp_length*sizeof(char), 0);
+        og_err1 = panda_virtual_memory_read_cached(env, guest_addr, (uint8_t *)pcomp, pcomp_length*sizeof(char));
 
     // I think this aims to be a re-implementation of the Linux kernel function
     // __dentry_path but the logic seems pretty different.
@@ -599,7 +670,7 @@ static inline char *read_vfsmount_name(CPUState *env, target_ptr_t vfsmount) {
 static inline char *get_name(CPUState *env, target_ptr_t task_struct, char *name) {
     if (name == NULL) { name = (char *)g_malloc0(ki.task.comm_size * sizeof(char)); }
     else { name = (char *)g_realloc(name, ki.task.comm_size * sizeof(char)); }
-    if (-1 == panda_virtual_memory_rw(env, task_struct + ki.task.comm_offset, (uint8_t *)name, ki.task.comm_size * sizeof(char), 0)) {
+    if (-1 == panda_virtual_memory_read_cached(env, task_struct + ki.task.comm_offset, (uint8_t *)name, ki.task.comm_size * sizeof(char))) {
         strncpy(name, "N/A", ki.task.comm_size*sizeof(char));
     }
     return name;
@@ -0,0 +1,131 @@
+/*!
+ * @file osi_linux_cache.h
+ * @brief Host-side cache of the guest process list and memory mappings.
+ *
+ * Listing processes or the mappings of a process means walking a kernel
+ * list in guest memory, which is too expensive to do on every call when a
+ * plugin asks for it on every block or every memory access. The results are
+ * instead kept here until a guest event that may have changed them:
+ *  - the process lists are dropped when a process is created, exits, execs
+ *    or renames itself, and whenever the ASID or the current task changes;
+ *  - the mappings are kept per mm_struct, and an mm_struct's mappings are
+ *    dropped when one of its tasks maps, unmaps or remaps memory, calls a
+ *    syscall that may split mappings (madvise, mlock, pkey_mprotect...),
+ *    execs or exits. Stack growth on page faults goes unseen. All mappings
+ *    are dropped when a process is created, since the mm_struct of a dead
+ *    process may be reused by the new one.
+ * A generation counter is bumped on every invalidation, so that callers can
+ * tell whether anything they derived from earlier results may be stale.
+ *
+ * @copyright This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ */
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <glib.h>
+
+class OsiLinuxCache {
+public:
+    OsiLinuxCache() : enabled(true), generation_(0), procs_(NULL), handles_(NULL) {}
+    ~OsiLinuxCache() { flush(); }
+
+    /** @brief When false, callers bypass the cache altogether. */
+    bool enabled;
+
+    uint64_t generation() const { return generation_; }
+
+    /** @brief Cached process list (GArray of OsiProc), or NULL. */
+    GArray *processes() const { return procs_; }
+
+    /** @brief Cached process handle list (GArray of OsiProcHandle), or NULL. */
+    GArray *handles() const { return handles_; }
+
+    /** @brief Cached mappings (GArray of OsiModule) of mm, or NULL. */
+    GArray *mappings(target_ptr_t mm) const {
+        auto it = mappings_.find(mm);
+        return (it == mappings_.end()) ? NULL : it->second;
+    }
+
+    /** @brief The following take ownership of the array they are given. */
+    void set_processes(GArray *a) { replace(&procs_, a); }
+    void set_handles(GArray *a) { replace(&handles_, a); }
+    void set_mappings(target_ptr_t mm, GArray *a) {
+        GArray *&slot = mappings_[mm];
+        if (slot != NULL) g_array_free(slot, true);
+        slot = a;
+    }
+
+    /** @brief Called when the set of processes or their names may have changed. */
+    void processes_changed() {
+        generation_++;
+        drop(&procs_);
+        drop(&handles_);
+    }
+
+    /** @brief Called when the mappings of mm may have changed. */
+    void mappings_changed(target_ptr_t mm) {
+        generation_++;
+        auto it = mappings_.find(mm);
+        if (it == mappings_.end()) return;
+        g_array_free(it->second, true);
+        mappings_.erase(it);
+    }
+
+    /** @brief Drops everything. */
+    void flush() {
+        processes_changed();
+        for (auto &m : mappings_) {
+            g_array_free(m.second, true);
+        }
+        mappings_.clear();
+    }
+
+private:
+    void replace(GArray **slot, GArray *a) {
+        drop(slot);
+        *slot = a;
+    }
+
+    static void drop(GArray **slot) {
+        if (*slot != NULL) {
+            g_array_free(*slot, true);
+            *slot = NULL;
+        }
+    }
+
+    uint64_t generation_;
+    GArray *procs_;
+    GArray *handles_;
+    std::unordered_map<target_ptr_t, GArray *> mappings_;
+};
+
+/**
+ * @brief Appends copies of the elements of a cached array to *out,
+ * allocating *out if needed like the get_process_info() template does.
+ */
+template <typename ET>
+void append_cached(GArray **out, GArray *from,
+                   ET *(*copy_element)(ET *, ET *),
+                   void (*free_element_contents)(ET *)) {
+    if (*out == NULL) {
+        // g_array_sized_new() args: zero_term, clear, element_sz, reserved_sz
+        *out = g_array_sized_new(false, false, sizeof(ET), from->len);
+        g_array_set_clear_func(*out, (GDestroyNotify)free_element_contents);
+    }
+    guint first = (*out)->len;
+    g_array_set_size(*out, first + from->len);
+    for (guint i = 0; i < from->len; i++) {
+        ET *to = &g_array_index(*out, ET, first + i);
+        ET *elem = &g_array_index(from, ET, i);
+        if (copy_element != NULL) {
+            memset(to, 0, sizeof(ET));
+            copy_element(elem, to);
+        } else {
+            memcpy(to, elem, sizeof(ET));
+        }
+    }
+}
+
+/* vim:set tabstop=4 softtabstop=4 expandtab: */
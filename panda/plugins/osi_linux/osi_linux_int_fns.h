@@ -16,6 +16,9 @@ char *osi_linux_fd_to_filename(CPUState *env, OsiProc *p, int fd);
 // returns pos in a file 
 unsigned long long osi_linux_fd_to_pos(CPUState *env, OsiProc *p, int fd);
 
+// returns a counter that changes whenever cached process or mapping info is dropped
+uint64_t osi_linux_cache_generation(void);
+
 // END_PYPANDA_NEEDS_THIS -- do not delete this comment!
 
 /* vim:set tabstop=4 softtabstop=4 expandtab: */
@@ -35,6 +35,7 @@ static uint64_t end_count;
 
 static char *nondet_name;
 static char *snp_name;
+static char *ram_image_name;
 
 static FILE *oldlog = NULL;
 static FILE *newlog = NULL;
@@ -49,6 +50,11 @@ static RR_prog_point pp_last_copied_log_entry;
 
 static bool snipping = false;
 static bool done = false;
+static bool bg_snapshot = false;
+static bool ram_image = false;
+
+// stdio buffer size for the old and new logs
+#define SCISSORS_IO_BUF_SIZE (4 << 20)
 
 static RR_prog_point copy_entry(void);
 static void sassert(bool condition, int which);
@@ -79,6 +85,16 @@ static INLINEIT void rr_fcopy(void *ptr, size_t size, size_t nmemb, FILE *oldlog
     rr_fwrite(ptr, size, nmemb, newlog);
 }
 
+// Copies the len bytes of a variable-size payload through a fixed buffer.
+static void rr_fcopy_bytes(size_t len, FILE *oldlog, FILE *newlog) {
+    static uint8_t buf[64 * 1024];
+    while (len > 0) {
+        size_t l = len < sizeof(buf) ? len : sizeof(buf);
+        rr_fcopy(buf, 1, l, oldlog, newlog);
+        len -= l;
+    }
+}
+
 static INLINEIT RR_log_entry *alloc_new_entry(void) 
 {
     static RR_log_entry *new_entry = NULL;
@@ -156,26 +172,17 @@ static RR_prog_point copy_entry(void) {
             switch(args->kind) {
                 case RR_CALL_CPU_MEM_RW:
                     RR_COPY_ITEM(args->variant.cpu_mem_rw_args);
-                    args->variant.cpu_mem_rw_args.buf =
-                        g_malloc(args->variant.cpu_mem_rw_args.len);
-                    rr_fcopy(args->variant.cpu_mem_rw_args.buf, 1,
-                            args->variant.cpu_mem_rw_args.len,
+                    rr_fcopy_bytes(args->variant.cpu_mem_rw_args.len,
                             oldlog, newlog);
                     break;
                 case RR_CALL_CPU_MEM_UNMAP:
                     RR_COPY_ITEM(args->variant.cpu_mem_unmap);
-                    args->variant.cpu_mem_unmap.buf =
-                        g_malloc(args->variant.cpu_mem_unmap.len);
-                    rr_fcopy(args->variant.cpu_mem_unmap.buf, 1,
-                                args->variant.cpu_mem_unmap.len,
+                    rr_fcopy_bytes(args->variant.cpu_mem_unmap.len,
                                 oldlog, newlog);
                     break;
                 case RR_CALL_MEM_REGION_CHANGE:
                     RR_COPY_ITEM(args->variant.mem_region_change_args);
-                    args->variant.mem_region_change_args.name =
-                        g_malloc0(args->variant.mem_region_change_args.len + 1);
-                    rr_fcopy(args->variant.mem_region_change_args.name, 1,
-                            args->variant.mem_region_change_args.len,
+                    rr_fcopy_bytes(args->variant.mem_region_change_args.len,
                             oldlog, newlog);
                     break;
                 case RR_CALL_HD_TRANSFER:
@@ -186,10 +193,7 @@ static RR_prog_point copy_entry(void) {
                     break;
                 case RR_CALL_HANDLE_PACKET:
                     RR_COPY_ITEM(args->variant.handle_packet_args);
-                    args->variant.handle_packet_args.buf =
-                        g_malloc(args->variant.handle_packet_args.size);
-                    rr_fcopy(args->variant.handle_packet_args.buf,
-                            args->variant.handle_packet_args.size, 1,
+                    rr_fcopy_bytes(args->variant.handle_packet_args.size,
                             oldlog, newlog);
                     break;
                 case RR_CALL_SERIAL_READ:
@@ -223,6 +227,7 @@ static RR_prog_point copy_entry(void) {
 
 static void start_snip(uint64_t count) {
     sassert((oldlog = fopen(rr_nondet_log->name, "r")), 8);
+    setvbuf(oldlog, NULL, _IOFBF, SCISSORS_IO_BUF_SIZE);
     rr_nondet_log_type = rr_nondet_log->type;
     rr_nondet_log_size = rr_nondet_log->size;
     sassert(fread(&orig_last_prog_point, sizeof(RR_prog_point), 1, oldlog) == 1, 9);
@@ -233,18 +238,16 @@ static void start_snip(uint64_t count) {
     
     // Force running state
     global_state_store_running();
-    printf("writing snapshot:\t%s\n", snp_name);
-    QIOChannelFile* ioc =
-        qio_channel_file_new_path(snp_name, O_WRONLY | O_CREAT, 0660, NULL);
-    QEMUFile* snp = qemu_fopen_channel_output(QIO_CHANNEL(ioc));
-    qemu_savevm_state(snp, NULL);
-    qemu_fclose(snp);
+    printf("writing snapshot:\t%s%s\n", snp_name,
+           bg_snapshot ? " (in the background)" : "");
+    rr_save_snapshot(snp_name, ram_image ? ram_image_name : NULL, bg_snapshot);
     
     printf("Beginning cut-and-paste process at prog point: % " PRId64 "\n", (uint64_t) rr_get_guest_instr_count());
 
     printf("Writing entries to %s...\n", nondet_name);
     newlog = fopen(nondet_name, "w");
     sassert(newlog, 10);
+    setvbuf(newlog, NULL, _IOFBF, SCISSORS_IO_BUF_SIZE);
     // We'll fix this up later.
     RR_prog_point prog_point = {0};
     fwrite(&prog_point.guest_instr_count,
@@ -315,6 +318,9 @@ static void end_snip(void) {
             sizeof(prog_point.guest_instr_count), 1, newlog);
     fclose(newlog);
 
+    if (rr_snapshot_wait() != 0) {
+        printf("Error writing snapshot %s\n", snp_name);
+    }
     done = true;
 }
 
@@ -378,6 +384,8 @@ bool init_plugin(void *self) {
         name = panda_parse_string_req(args, "name", "name of the scissored replay");
         start_count = panda_parse_uint64_opt(args, "start", 0, "starting instruction count");
         end_count = panda_parse_uint64_opt(args, "end", UINT64_MAX, "ending instruction count");
+        bg_snapshot = panda_parse_bool_opt(args, "bg_snapshot", "write the snapshot from a copy-on-write copy of the VM while the replay goes on");
+        ram_image = panda_parse_bool_opt(args, "ram_image", "write guest RAM to a RAM image, which replays map on demand, rather than to the snapshot");
     }
 
     // we will seg fault in savevm if path to scissors files doesnt exist...
@@ -404,6 +412,7 @@ bool init_plugin(void *self) {
     needed = snprintf(NULL, 0, "%s-rr-snp", name);
     snp_name = malloc(needed+1);
     snprintf(snp_name, needed+1, "%s-rr-snp", name);
+    ram_image_name = g_strdup_printf("%s-rr-ram", name);
 
     return true;
 }
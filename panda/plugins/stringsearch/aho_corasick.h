@@ -0,0 +1,215 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __STRINGSEARCH_AHO_CORASICK_H_
+#define __STRINGSEARCH_AHO_CORASICK_H_
+
+/*
+ * Aho-Corasick automaton over byte strings.
+ *
+ * The search state is a single uint32_t, so a caller can keep one state per
+ * tap point and feed it bytes as they are seen in memory accesses. Every
+ * pattern ending at the current byte is reported, including patterns that
+ * overlap or are suffixes of each other. The cost per byte is amortized
+ * constant, independent of the number of patterns.
+ *
+ * Inputs may be folded through a byte table (e.g. to lower-case them) before
+ * they're matched; patterns are folded the same way when the automaton is
+ * built.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+class AhoCorasick {
+public:
+    static const uint32_t ROOT = 0;
+    static const int32_t NO_PATTERN = -1;
+
+    AhoCorasick() { clear(); }
+
+    void clear() {
+        nodes_.assign(1, Node());
+        edges_.clear();
+        build_children_.assign(1, std::map<uint8_t, uint32_t>());
+        memset(root_next_, 0, sizeof(root_next_));
+        memset(first_bytes_, 0, sizeof(first_bytes_));
+        num_first_bytes_ = 0;
+        single_first_ = 0;
+        for (int i = 0; i < 256; i++) fold_[i] = i;
+    }
+
+    void set_fold(const uint8_t fold[256]) {
+        memcpy(fold_, fold, sizeof(fold_));
+    }
+
+    // Adds a pattern with the given id. Must be followed by build().
+    void add(const uint8_t *pat, size_t len, int32_t id) {
+        uint32_t s = ROOT;
+        for (size_t i = 0; i < len; i++) {
+            uint8_t c = fold_[pat[i]];
+            auto &children = build_children_[s];
+            auto it = children.find(c);
+            if (it == children.end()) {
+                uint32_t n = nodes_.size();
+                nodes_.push_back(Node());
+                nodes_[n].depth = nodes_[s].depth + 1;
+                build_children_.push_back(std::map<uint8_t, uint32_t>());
+                build_children_[s][c] = n;
+                s = n;
+            } else {
+                s = it->second;
+            }
+        }
+        nodes_[s].pattern = id;
+    }
+
+    // Computes failure links and packs the trie for searching.
+    void build() {
+        edges_.clear();
+        for (uint32_t s = 0; s < nodes_.size(); s++) {
+            nodes_[s].edge_start = edges_.size();
+            for (auto &c : build_children_[s]) {
+                edges_.push_back(Edge(c.first, c.second));
+            }
+            nodes_[s].edge_end = edges_.size();
+        }
+
+        for (auto &c : build_children_[ROOT]) {
+            root_next_[c.first] = c.second;
+        }
+        num_first_bytes_ = 0;
+        for (int b = 0; b < 256; b++) {
+            first_bytes_[b] = root_next_[fold_[b]] != ROOT;
+            if (first_bytes_[b]) {
+                num_first_bytes_++;
+                single_first_ = b;
+            }
+        }
+
+        // Breadth-first, so that a node's failure link is known before
+        // its children's are computed.
+        std::vector<uint32_t> queue;
+        for (auto &c : build_children_[ROOT]) {
+            nodes_[c.second].fail = ROOT;
+            queue.push_back(c.second);
+        }
+        for (size_t q = 0; q < queue.size(); q++) {
+            uint32_t s = queue[q];
+            Node &n = nodes_[s];
+            n.output = (nodes_[n.fail].pattern != NO_PATTERN)
+                ? n.fail : nodes_[n.fail].output;
+            for (auto &c : build_children_[s]) {
+                nodes_[c.second].fail = next(n.fail, c.first);
+                queue.push_back(c.second);
+            }
+        }
+        build_children_.clear();
+    }
+
+    bool empty() const { return nodes_.size() == 1; }
+
+    // Number of input bytes that can start a match.
+    int num_first_bytes() const { return num_first_bytes_; }
+
+    // Index of the first byte in buf[0, len) that can start a match, or len.
+    size_t skip(const uint8_t *buf, size_t len) const {
+        if (num_first_bytes_ == 1) {
+            // libc's memchr is vectorized
+            const void *p = memchr(buf, single_first_, len);
+            return p ? (const uint8_t *)p - buf : len;
+        }
+        size_t i = 0;
+        while (i < len && !first_bytes_[buf[i]]) i++;
+        return i;
+    }
+
+    // Advances state by one input byte.
+    uint32_t step(uint32_t s, uint8_t b) const {
+        return next(s, fold_[b]);
+    }
+
+    // Pattern id ending at state s, or NO_PATTERN.
+    int32_t pattern(uint32_t s) const { return nodes_[s].pattern; }
+
+    // Next state on the chain of states whose patterns also end here, or ROOT.
+    uint32_t output(uint32_t s) const { return nodes_[s].output; }
+
+    // Length of the string that leads to state s.
+    uint32_t depth(uint32_t s) const { return nodes_[s].depth; }
+
+    /*
+     * Feeds buf to the automaton starting at *state, calling
+     * fn(pattern_id, end_offset) for every match, where end_offset is the
+     * index in buf of the match's last byte.
+     */
+    template<typename F>
+    void scan(uint32_t *state, const uint8_t *buf, size_t len, F fn) const {
+        uint32_t s = *state;
+        for (size_t i = 0; i < len; i++) {
+            if (s == ROOT) {
+                i += skip(buf + i, len - i);
+                if (i == len) break;
+            }
+            s = step(s, buf[i]);
+            uint32_t o = (nodes_[s].pattern != NO_PATTERN) ? s : nodes_[s].output;
+            for (; o != ROOT; o = nodes_[o].output) {
+                fn(nodes_[o].pattern, i);
+            }
+        }
+        *state = s;
+    }
+
+private:
+    struct Node {
+        Node() : fail(ROOT), output(ROOT), pattern(NO_PATTERN), depth(0),
+                 edge_start(0), edge_end(0) {}
+        uint32_t fail;
+        uint32_t output;
+        int32_t pattern;
+        uint32_t depth;
+        uint32_t edge_start;
+        uint32_t edge_end;
+    };
+
+    struct Edge {
+        Edge(uint8_t b, uint32_t t) : byte(b), target(t) {}
+        uint8_t byte;
+        uint32_t target;
+    };
+
+    uint32_t child(uint32_t s, uint8_t c) const {
+        const Node &n = nodes_[s];
+        auto lo = edges_.begin() + n.edge_start;
+        auto hi = edges_.begin() + n.edge_end;
+        auto it = std::lower_bound(lo, hi, c,
+            [](const Edge &e, uint8_t c) { return e.byte < c; });
+        return (it != hi && it->byte == c) ? it->target : ROOT;
+    }
+
+    uint32_t next(uint32_t s, uint8_t c) const {
+        while (s != ROOT) {
+            uint32_t t = child(s, c);
+            if (t != ROOT) return t;
+            s = nodes_[s].fail;
+        }
+        return root_next_[c];
+    }
+
+    std::vector<Node> nodes_;
+    std::vector<Edge> edges_;
+    std::vector<std::map<uint8_t, uint32_t>> build_children_;
+    uint32_t root_next_[256];
+    bool first_bytes_[256];
+    int num_first_bytes_;
+    uint8_t single_first_;
+    uint8_t fold_[256];
+};
+
+#endif
@@ -20,6 +20,7 @@ PANDAENDCOMMENT */
 #include <ctype.h>
 #include <math.h>
 #include <map>
+#include <vector>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -34,6 +35,9 @@ extern "C" {
 
 #include "callstack_instr/callstack_instr.h"
 #include "callstack_instr/callstack_instr_ext.h"
+#include "callstack_instr/prog_point_table.h"
+
+#include "aho_corasick.h"
 
 using namespace std;
 
@@ -55,15 +59,12 @@ void* self_ptr;
 panda_cb pcb_memread;
 panda_cb pcb_memwrite;
 bool verbose = false;
+bool nocase = false;
+bool utf16 = false;
 
-// Silly: since we use these as map values, they have to be
-// copy constructible. Plain arrays aren't, but structs containing
-// arrays are. So we make these goofy wrappers.
+// Per tap point match counts, indexed like search_strings
 struct match_strings {
-    int val[MAX_STRINGS];
-};
-struct string_pos {
-    uint32_t val[MAX_STRINGS];
+    std::vector<int> val;
 };
 struct fullstack {
     int n;
@@ -74,78 +75,154 @@ struct fullstack {
     stack_type stackKind;
 };
 
-std::map<prog_point,fullstack> matchstacks;
-std::map<prog_point,match_strings> matches;
-std::map<prog_point,string_pos> read_text_tracker;
-std::map<prog_point,string_pos> write_text_tracker;
-uint8_t tofind[MAX_STRINGS][MAX_STRLEN];
-uint32_t strlens[MAX_STRINGS];
-int num_strings = 0;
+// A search string, or one of its variants (e.g. UTF-16), as it is matched
+// against memory. str_idxs are the indices of the search strings it came
+// from: several fold to the same pattern with nocase, or if repeated.
+struct pattern {
+    std::vector<uint8_t> bytes;
+    std::vector<int> str_idxs;
+};
+
+ProgPointTable<fullstack> matchstacks;
+ProgPointTable<match_strings> matches;
+// Automaton state of each tap point
+ProgPointTable<uint32_t> read_text_tracker;
+ProgPointTable<uint32_t> write_text_tracker;
+std::vector<std::vector<uint8_t>> search_strings;
+std::vector<pattern> patterns;
+AhoCorasick automaton;
+bool automaton_dirty = false;
 int n_callers = 16;
 
 // this creates BOTH the global for this callback fn (on_ssm_func)
 // and the function used by other plugins to register a fn (add_on_ssm)
 PPP_CB_BOILERPLATE(on_ssm)
 
-// this creates the 
+// folded is keyed on the patterns added so far, as the automaton sees them
+static void add_pattern(const std::vector<uint8_t> &bytes, int str_idx,
+                        std::map<std::vector<uint8_t>, int> &folded) {
+    std::vector<uint8_t> key(bytes);
+    if (nocase) {
+        for (uint8_t &c : key) c = tolower(c);
+    }
+    auto it = folded.find(key);
+    if (it != folded.end()) {
+        // the automaton has room for a single pattern per state
+        std::vector<int> &str_idxs = patterns[it->second].str_idxs;
+        // a one character string is its own UTF-16 variant
+        if (str_idxs.back() != str_idx) str_idxs.push_back(str_idx);
+        return;
+    }
+    pattern pat = { bytes, { str_idx } };
+    patterns.push_back(pat);
+    folded[key] = patterns.size() - 1;
+    automaton.add(bytes.data(), bytes.size(), patterns.size() - 1);
+}
+
+// Recompiles the automaton after search_strings changed. Tap point states
+// refer to the old automaton, so they are reset.
+static void rebuild_automaton() {
+    std::map<std::vector<uint8_t>, int> folded;
+    patterns.clear();
+    automaton.clear();
+    if (nocase) {
+        uint8_t fold[256];
+        for (int i = 0; i < 256; i++) fold[i] = tolower(i);
+        automaton.set_fold(fold);
+    }
+    for (size_t i = 0; i < search_strings.size(); i++) {
+        add_pattern(search_strings[i], i, folded);
+        if (utf16) {
+            std::vector<uint8_t> wide;
+            for (uint8_t c : search_strings[i]) {
+                wide.push_back(c);
+                wide.push_back(0);
+            }
+            // Drop the trailing NUL so matches end on the last character
+            wide.pop_back();
+            add_pattern(wide, i, folded);
+        }
+    }
+    automaton.build();
+    read_text_tracker.clear();
+    write_text_tracker.clear();
+    automaton_dirty = false;
+}
+
+static void update_callbacks() {
+    if (!search_strings.empty()) {
+        panda_enable_callback(self_ptr, PANDA_CB_VIRT_MEM_AFTER_READ,  pcb_memread);
+        panda_enable_callback(self_ptr, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb_memwrite);
+    } else {
+        panda_disable_callback(self_ptr, PANDA_CB_VIRT_MEM_AFTER_READ,  pcb_memread);
+        panda_disable_callback(self_ptr, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb_memwrite);
+    }
+}
+
+static void report_match(CPUState *env, target_ulong pc, target_ulong addr,
+                         size_t end, prog_point &p, pattern &pat,
+                         bool is_write) {
+    uint32_t len = pat.bytes.size();
+    // Victory!
+    char *sid_string = get_stackid_string(p);
+    std::vector<int> &counts = matches[p].val;
+    if (counts.size() < search_strings.size()) {
+        counts.resize(search_strings.size());
+    }
+    for (int str_idx : pat.str_idxs) {
+        if (verbose) {
+          printf("%s Match of str %d at: instr_count=%" PRIu64 " :  "
+                 TARGET_FMT_lx " " TARGET_FMT_lx " %s\n",
+                 (is_write ? "WRITE" : "READ"), str_idx,
+                 rr_get_guest_instr_count(), p.caller, p.pc, sid_string);
+        }
+        counts[str_idx]++;
+    }
+    g_free(sid_string);
+
+    // Also get the full stack here
+    fullstack f = {0};
+    f.n = get_callers(f.callers, n_callers, env);
+    f.pc = p.pc;
+    f.sidFirst = p.sidFirst;
+    f.sidSecond = p.sidSecond;
+    f.stackKind = p.stackKind;
+    matchstacks[p] = f;
+
+    // Check if the full string is in memory.
+    std::vector<uint8_t> tmp(len);
+    target_ulong match_addr = (addr + end) - (len - 1);
+    bool in_memory = panda_virtual_memory_read(env, match_addr, tmp.data(), len) == 0;
+    for (uint32_t i = 0; in_memory && i < len; i++) {
+        in_memory = nocase ? tolower(tmp[i]) == tolower(pat.bytes[i])
+                           : tmp[i] == pat.bytes[i];
+    }
+
+    // call the i-found-a-match registered callbacks here
+    PPP_RUN_CB(on_ssm, env, pc, in_memory ? match_addr : addr,
+               pat.bytes.data(), len, is_write, in_memory);
+}
 
 void mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                   size_t size, uint8_t *buf, bool is_write,
-                  std::map<prog_point, string_pos> &text_tracker) {
+                  ProgPointTable<uint32_t> &text_tracker) {
+    if (unlikely(automaton_dirty)) {
+        rebuild_automaton();
+    }
+
     prog_point p = {};
     get_prog_point(env, &p);
 
-    string_pos &sp = text_tracker[p];
-
-    for (unsigned int i = 0; i < size; i++) {
-        uint8_t val = ((uint8_t *)buf)[i];
-        for(int str_idx = 0; str_idx < num_strings; str_idx++) {
-            if (tofind[str_idx][sp.val[str_idx]] == val)
-                sp.val[str_idx]++;
-            else
-                sp.val[str_idx] = 0;
-
-            if (sp.val[str_idx] == strlens[str_idx]) {
-                // Victory!
-                char *sid_string = get_stackid_string(p);
-                if (verbose) {
-                  printf("%s Match of str %d at: instr_count=%" PRIu64 " :  "
-                         TARGET_FMT_lx " " TARGET_FMT_lx " %s\n",
-                         (is_write ? "WRITE" : "READ"), str_idx,
-                         rr_get_guest_instr_count(), p.caller, p.pc, sid_string);
-                }
-                matches[p].val[str_idx]++;
-                sp.val[str_idx] = 0;
-                g_free(sid_string);
-
-                // Also get the full stack here
-                fullstack f = {0};
-                f.n = get_callers(f.callers, n_callers, env);
-                f.pc = p.pc;
-                f.sidFirst = p.sidFirst;
-                f.sidSecond = p.sidSecond;
-                f.stackKind = p.stackKind;
-                matchstacks[p] = f;
-
-                // Check if the full string is in memory.
-                uint8_t *tmp =
-                    (uint8_t *)calloc(strlens[str_idx] + 1, sizeof(*tmp));
-                target_ulong match_addr = (addr + i) - (strlens[str_idx] - 1);
-                panda_virtual_memory_read(env, match_addr, tmp,
-                                          strlens[str_idx]);
-                bool in_memory =
-                    memcmp(tmp, tofind[str_idx], strlens[str_idx]) == 0;
-                free(tmp);
-
-                // call the i-found-a-match registered callbacks here
-                PPP_RUN_CB(on_ssm, env, pc, in_memory ? match_addr : addr,
-                           tofind[str_idx], strlens[str_idx], is_write,
-                           in_memory);
-            }
-        }
+    // Tap points are only tracked once they may be in the middle of a match
+    uint32_t *state = text_tracker.find(p);
+    if (!state) {
+        if (automaton.skip(buf, size) == size) return;
+        state = &text_tracker[p];
     }
- 
-    return;
+
+    automaton.scan(state, buf, size, [&](int32_t id, size_t end) {
+        report_match(env, pc, addr, end, p, patterns[id], is_write);
+    });
 }
 
 void mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr,
@@ -162,6 +239,16 @@ void mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
 
 FILE *mem_report = NULL;
 
+static int find_string(const uint8_t *str, size_t len) {
+    for (size_t i = 0; i < search_strings.size(); i++) {
+        if (search_strings[i].size() == len &&
+            memcmp(search_strings[i].data(), str, len) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 bool add_string(const char* arg_str) {
   // Add a string to the list of strings we're searching for. 
 
@@ -177,55 +264,35 @@ bool add_string(const char* arg_str) {
   }
 
   // If string already present it's okay
-  for (int str_idx = 0; str_idx < num_strings; str_idx++) {
-      if (strncmp(arg_str, (char*)tofind[str_idx], strlens[str_idx]) == 0) {
-        return true;
-      }
-  }
-
-  if (num_strings >= MAX_STRINGS-1) {
-    printf("Warning [stringsearch]: out of string slots (using %d)\n", num_strings);
-    return false;
+  if (find_string((const uint8_t *)arg_str, arg_len) >= 0) {
+      return true;
   }
 
-  memcpy(tofind[num_strings], arg_str, arg_len);
-  strlens[num_strings] = arg_len;
-  num_strings++;
+  search_strings.push_back(std::vector<uint8_t>(arg_str, arg_str + arg_len));
+  automaton_dirty = true;
   if (verbose) {
       printf("[stringsearch] Adding string %s\n", arg_str);
   }
 
-  if (num_strings == 1) {
-      // First string - enable callback
-      panda_enable_callback(self_ptr, PANDA_CB_VIRT_MEM_AFTER_READ,  pcb_memread);
-      panda_enable_callback(self_ptr, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb_memwrite);
-  }
-
-
+  update_callbacks();
   return true;
 }
 
 bool remove_string(const char* arg_str) {
-    // Remove the first match from our list
-    for (int str_idx = 0; str_idx < num_strings; str_idx++) {
-        if (strncmp(arg_str, (char*)tofind[str_idx], strlens[str_idx]) == 0) {
-            memmove( &tofind[str_idx],  &(tofind[str_idx+1]), (sizeof(uint8_t )*(num_strings-str_idx)));
-            memmove(&strlens[str_idx], &(strlens[str_idx+1]), (sizeof(uint32_t)*(num_strings-str_idx)));
-            num_strings--;
-
-            if (num_strings == 0) {
-                // No strings enabled. Disable callback
-                panda_disable_callback(self_ptr, PANDA_CB_VIRT_MEM_AFTER_READ,  pcb_memread);
-                panda_disable_callback(self_ptr, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb_memwrite);
-            }
-            return true;
-        }
+    int str_idx = find_string((const uint8_t *)arg_str, strlen(arg_str));
+    if (str_idx < 0) {
+        return false;
     }
-    return false;
+    search_strings.erase(search_strings.begin() + str_idx);
+    automaton_dirty = true;
+    update_callbacks();
+    return true;
 }
 
 void reset_strings() {
-  num_strings = 0;
+  search_strings.clear();
+  automaton_dirty = true;
+  update_callbacks();
 }
 
 bool init_plugin(void *self) {
@@ -245,13 +312,18 @@ bool init_plugin(void *self) {
 
     panda_arg_list *args = panda_get_args("stringsearch");
 
+    verbose = panda_parse_bool_opt(args, "verbose",
+                                             "enables verbose logging");
+    nocase = panda_parse_bool_opt(args, "nocase",
+                                  "match ASCII letters case-insensitively");
+    utf16 = panda_parse_bool_opt(args, "utf16",
+                                 "also match the UTF-16LE encoding of each string");
+
     const char *arg_str = panda_parse_string_opt(args, "str", "", "a single string to search for");
     size_t arg_len = strlen(arg_str);
     if (arg_len > 0) {
         add_string(arg_str);
     }
-    verbose = panda_parse_bool_opt(args, "verbose",
-                                             "enables verbose logging");
 
     n_callers = panda_parse_uint64_opt(args, "callers", 16, "depth of callstack for matches");
     if (n_callers > MAX_CALLERS) n_callers = MAX_CALLERS;
@@ -263,8 +335,8 @@ bool init_plugin(void *self) {
 
         printf ("search strings file [%s]\n", stringsfile.c_str());
 
-        std::ifstream search_strings(stringsfile);
-        if (!search_strings) {
+        std::ifstream search_strings_file(stringsfile);
+        if (!search_strings_file) {
             printf("Couldn't open %s; no strings to search for. Exiting.\n", stringsfile.c_str());
             return false;
         }
@@ -276,38 +348,34 @@ bool init_plugin(void *self) {
         // in parses hex strings according to the above description and
         // over-long strings are simply truncated instead of ignored with an error
         std::string line;
-        while(std::getline(search_strings, line)) {
+        while(std::getline(search_strings_file, line)) {
             std::istringstream iss(line);
+            std::vector<uint8_t> str;
 
-            if (line[0] == '"') {
-                size_t len = line.size() - 2;
-                memcpy(tofind[num_strings], line.substr(1, len).c_str(), len);
-                strlens[num_strings] = len;
+            if (line.empty()) {
+                continue;
+            } else if (line[0] == '"') {
+                size_t len = std::min(line.size() < 2 ? 0 : line.size() - 2, (size_t)MAX_STRLEN);
+                str.assign(line.begin() + 1, line.begin() + 1 + len);
             } else {
                 std::string x;
-                int i = 0;
                 while (std::getline(iss, x, ':')) {
-                    tofind[num_strings][i++] = (uint8_t)strtoul(x.c_str(), NULL, 16);
-                    if (i >= MAX_STRLEN) {
-                        printf("WARN: Reached max number of characters (%d) on string %d, truncating.\n", MAX_STRLEN, num_strings);
+                    str.push_back((uint8_t)strtoul(x.c_str(), NULL, 16));
+                    if (str.size() >= MAX_STRLEN) {
+                        printf("WARN: Reached max number of characters (%d) on string %zu, truncating.\n", MAX_STRLEN, search_strings.size());
                         break;
                     }
                 }
-                strlens[num_strings] = i;
             }
-
-            printf("stringsearch: added string of length %d to search set\n", strlens[num_strings]);
-
-            if(++num_strings >= MAX_STRINGS) {
-                printf("WARN: maximum number of strings (%d) reached, will not load any more.\n", MAX_STRINGS);
-                break;
+            if (str.empty() || find_string(str.data(), str.size()) >= 0) {
+                continue;
             }
+
+            printf("stringsearch: added string of length %zu to search set\n", str.size());
+            search_strings.push_back(str);
         }
-        if (num_strings == 1) {
-            // First string - enable callback
-            panda_enable_callback(self, PANDA_CB_VIRT_MEM_AFTER_READ,  pcb_memread);
-            panda_enable_callback(self, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb_memwrite);
-        }
+        automaton_dirty = true;
+        update_callbacks();
     }
 
     std::string matchfile = prefix;
@@ -331,23 +399,23 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    std::map<prog_point,match_strings>::iterator it;
-    for(it = matches.begin(); it != matches.end(); it++) {
+    for (auto &it : matches.sorted()) {
         // Print prog point
 
         // Most recent callers are returned first, so print them
         // out in reverse order
-        fullstack &f = matchstacks[it->first];
+        fullstack &f = *matchstacks.find(*it.first);
         for (int i = f.n-1; i >= 0; i--) {
             fprintf(mem_report, TARGET_FMT_lx " ", f.callers[i]);
         }
         fprintf(mem_report, TARGET_FMT_lx " ", f.pc);
-        char *sid_string = get_stackid_string(it->first);
+        char *sid_string = get_stackid_string(*it.first);
         fprintf(mem_report, "%s ", sid_string);
 
         // Print strings that matched and how many times
-        for(int i = 0; i < num_strings; i++)
-            fprintf(mem_report, " %d", it->second.val[i]);
+        std::vector<int> &counts = it.second->val;
+        for(size_t i = 0; i < search_strings.size(); i++)
+            fprintf(mem_report, " %d", i < counts.size() ? counts[i] : 0);
         fprintf(mem_report, "\n");
         g_free(sid_string);
     }
@@ -4,7 +4,6 @@
 #define __STRINGSEARCH_H_
 
 
-#define MAX_STRINGS 100
 #define MAX_CALLERS 128
 #define MAX_STRLEN  1024
 
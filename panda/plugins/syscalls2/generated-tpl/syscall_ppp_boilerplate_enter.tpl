@@ -1,12 +1,12 @@
 {%- for arch, syscalls in syscalls_arch|dictsort -%}
 #if {{architectures[arch].qemu_target}}
 {%- for syscall_name, syscall in syscalls|dictsort %}
-PPP_CB_BOILERPLATE(on_{{syscall.name}}_enter)
+PPP_CB_BOILERPLATE_NOTIFY(on_{{syscall.name}}_enter, syscalls_subscriptions_dirty = true)
 {%- endfor %}
 #endif
 {% endfor %}
-PPP_CB_BOILERPLATE(on_unknown_sys_enter)
-PPP_CB_BOILERPLATE(on_all_sys_enter)
-PPP_CB_BOILERPLATE(on_all_sys_enter2)
+PPP_CB_BOILERPLATE_NOTIFY(on_unknown_sys_enter, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_all_sys_enter, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_all_sys_enter2, syscalls_subscriptions_dirty = true)
 
 /* vim: set tabstop=4 softtabstop=4 noexpandtab ft=cpp: */
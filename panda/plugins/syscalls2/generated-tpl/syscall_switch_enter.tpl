@@ -14,6 +14,33 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+#if {{arch_conf.qemu_target}}
+/**
+ * @brief SYSCALL_SUB_* bits for each system call, in switch order. The last
+ * entry is used for system calls we have no prototype for.
+ */
+static uint8_t syscall_sub_{{os}}_{{arch}}[{{syscalls|length + 1}}];
+
+/**
+ * @brief Recomputes the subscription bits from the registered callbacks.
+ */
+static void syscall_sub_update_{{os}}_{{arch}}(void) {
+	bool all_enter = PPP_CHECK_CB(on_all_sys_enter);
+	bool all_enter2 = PPP_CHECK_CB(on_all_sys_enter2);
+	bool all_return = PPP_CHECK_CB(on_all_sys_return);
+	bool all_return2 = PPP_CHECK_CB(on_all_sys_return2);
+	{%- for syscall in syscalls %}
+	syscall_sub_{{os}}_{{arch}}[{{loop.index0}}] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_{{syscall.name}}_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_{{syscall.name}}_return), {{ 'true' if syscall.panda_noreturn else 'false' }});
+	{%- endfor %}
+	syscall_sub_{{os}}_{{arch}}[{{syscalls|length}}] = syscall_sub_bits(
+			all_enter || PPP_CHECK_CB(on_unknown_sys_enter), all_enter2,
+			all_return || PPP_CHECK_CB(on_unknown_sys_return), all_return2, false);
+	syscalls_subscriptions_dirty = false;
+}
+#endif
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
@@ -21,45 +48,59 @@ extern "C" {
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
  * system call return callbacks.
+ *
+ * System calls nobody subscribed to return right away, without reading
+ * their arguments or tracking their return.
  */
 void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc) {
 #if {{arch_conf.qemu_target}}
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {0};
 	ctx.no = {{arch_conf.rt_callno_reg}};
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
-	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
+	uint8_t sub;			// SYSCALL_SUB_* bits for this system call
+
+	if (unlikely(syscalls_subscriptions_dirty)) {
+		syscall_sub_update_{{os}}_{{arch}}();
+	}
 
 	switch (ctx.no) {
 	{%- for syscall in syscalls %}
 	// {{syscall.no}} {{syscall.rettype}} {{syscall.name}} {{syscall.args_raw}}
 	case {{syscall.no}}: {
+		sub = syscall_sub_{{os}}_{{arch}}[{{loop.index0}}];
+		if (!sub) return;
 		panda_noreturn = {{ 'true' if syscall.panda_noreturn else 'false' }};
-		{%- if syscall.args|length > 0 %}
-		{%- for arg in syscall.args %}
-		{{arg.emit_temp_assignment()}}
-		{%- endfor %}
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_{{syscall.name}}_return)))) {
+		if (sub & SYSCALL_SUB_ARGS) {
+			{%- if syscall.args|length > 0 %}
 			{%- for arg in syscall.args %}
-			{{arg.emit_memcpy_temp_to_ref()}}
+			{{arg.emit_temp_assignment()}}
 			{%- endfor %}
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_{{syscall.name}}_return)))) {
+				{%- for arg in syscall.args %}
+				{{arg.emit_memcpy_temp_to_ref()}}
+				{%- endfor %}
+			}
+			{%- endif %}
+			PPP_RUN_CB(on_{{syscall.name}}_enter, {{syscall.cargs}});
 		}
-		{%- endif %}
-		PPP_RUN_CB(on_{{syscall.name}}_enter, {{syscall.cargs}});
 	}; break;
 	{%- endfor %}
 	default:
+		sub = syscall_sub_{{os}}_{{arch}}[{{syscalls|length}}];
+		if (!sub) return;
 		panda_noreturn = false;
 		PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, ctx.no);
 	} // switch (ctx.no)
 
+	ctx.asid = panda_current_asid(cpu);
+	ctx.retaddr = calc_retaddr(cpu, pc);
+	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (sub & SYSCALL_SUB_RETURN) {
 		struct hook h;
 		h.addr = ctx.retaddr;
 		h.asid = ctx.asid;
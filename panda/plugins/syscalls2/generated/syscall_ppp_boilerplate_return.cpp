@@ -1,2543 +1,2543 @@
 #if defined(TARGET_ARM) && !defined(TARGET_AARCH64)
-PPP_CB_BOILERPLATE(on_ARM_breakpoint_return)
-PPP_CB_BOILERPLATE(on_ARM_cacheflush_return)
-PPP_CB_BOILERPLATE(on_ARM_set_tls_return)
-PPP_CB_BOILERPLATE(on_ARM_user26_mode_return)
-PPP_CB_BOILERPLATE(on_ARM_usr32_mode_return)
-PPP_CB_BOILERPLATE(on_do_mmap2_return)
-PPP_CB_BOILERPLATE(on_sys_accept_return)
-PPP_CB_BOILERPLATE(on_sys_accept4_return)
-PPP_CB_BOILERPLATE(on_sys_access_return)
-PPP_CB_BOILERPLATE(on_sys_acct_return)
-PPP_CB_BOILERPLATE(on_sys_add_key_return)
-PPP_CB_BOILERPLATE(on_sys_adjtimex_return)
-PPP_CB_BOILERPLATE(on_sys_alarm_return)
-PPP_CB_BOILERPLATE(on_sys_arm_fadvise64_64_return)
-PPP_CB_BOILERPLATE(on_sys_bdflush_return)
-PPP_CB_BOILERPLATE(on_sys_bind_return)
-PPP_CB_BOILERPLATE(on_sys_bpf_return)
-PPP_CB_BOILERPLATE(on_sys_brk_return)
-PPP_CB_BOILERPLATE(on_sys_capget_return)
-PPP_CB_BOILERPLATE(on_sys_capset_return)
-PPP_CB_BOILERPLATE(on_sys_chdir_return)
-PPP_CB_BOILERPLATE(on_sys_chmod_return)
-PPP_CB_BOILERPLATE(on_sys_chown_return)
-PPP_CB_BOILERPLATE(on_sys_chown16_return)
-PPP_CB_BOILERPLATE(on_sys_chroot_return)
-PPP_CB_BOILERPLATE(on_sys_clock_adjtime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_getres_return)
-PPP_CB_BOILERPLATE(on_sys_clock_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_clock_settime_return)
-PPP_CB_BOILERPLATE(on_sys_clone_return)
-PPP_CB_BOILERPLATE(on_sys_close_return)
-PPP_CB_BOILERPLATE(on_sys_connect_return)
-PPP_CB_BOILERPLATE(on_sys_creat_return)
-PPP_CB_BOILERPLATE(on_sys_delete_module_return)
-PPP_CB_BOILERPLATE(on_sys_dup_return)
-PPP_CB_BOILERPLATE(on_sys_dup2_return)
-PPP_CB_BOILERPLATE(on_sys_dup3_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create1_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_ctl_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_pwait_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_wait_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd2_return)
-PPP_CB_BOILERPLATE(on_sys_execve_return)
-PPP_CB_BOILERPLATE(on_sys_execveat_return)
-PPP_CB_BOILERPLATE(on_sys_exit_return)
-PPP_CB_BOILERPLATE(on_sys_exit_group_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat_return)
-PPP_CB_BOILERPLATE(on_sys_fallocate_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_mark_return)
-PPP_CB_BOILERPLATE(on_sys_fchdir_return)
-PPP_CB_BOILERPLATE(on_sys_fchmod_return)
-PPP_CB_BOILERPLATE(on_sys_fchmodat_return)
-PPP_CB_BOILERPLATE(on_sys_fchown_return)
-PPP_CB_BOILERPLATE(on_sys_fchown16_return)
-PPP_CB_BOILERPLATE(on_sys_fchownat_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl64_return)
-PPP_CB_BOILERPLATE(on_sys_fdatasync_return)
-PPP_CB_BOILERPLATE(on_sys_fgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_finit_module_return)
-PPP_CB_BOILERPLATE(on_sys_flistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_flock_return)
-PPP_CB_BOILERPLATE(on_sys_fork_return)
-PPP_CB_BOILERPLATE(on_sys_fremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_fsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_fstat64_return)
-PPP_CB_BOILERPLATE(on_sys_fstatat64_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs64_return)
-PPP_CB_BOILERPLATE(on_sys_fsync_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate64_return)
-PPP_CB_BOILERPLATE(on_sys_futex_return)
-PPP_CB_BOILERPLATE(on_sys_futimesat_return)
-PPP_CB_BOILERPLATE(on_sys_get_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_get_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_getcpu_return)
-PPP_CB_BOILERPLATE(on_sys_getcwd_return)
-PPP_CB_BOILERPLATE(on_sys_getdents_return)
-PPP_CB_BOILERPLATE(on_sys_getdents64_return)
-PPP_CB_BOILERPLATE(on_sys_getegid_return)
-PPP_CB_BOILERPLATE(on_sys_getegid16_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid16_return)
-PPP_CB_BOILERPLATE(on_sys_getgid_return)
-PPP_CB_BOILERPLATE(on_sys_getgid16_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups16_return)
-PPP_CB_BOILERPLATE(on_sys_getitimer_return)
-PPP_CB_BOILERPLATE(on_sys_getpeername_return)
-PPP_CB_BOILERPLATE(on_sys_getpgid_return)
-PPP_CB_BOILERPLATE(on_sys_getpgrp_return)
-PPP_CB_BOILERPLATE(on_sys_getpid_return)
-PPP_CB_BOILERPLATE(on_sys_getppid_return)
-PPP_CB_BOILERPLATE(on_sys_getpriority_return)
-PPP_CB_BOILERPLATE(on_sys_getrandom_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid16_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid16_return)
-PPP_CB_BOILERPLATE(on_sys_getrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_getrusage_return)
-PPP_CB_BOILERPLATE(on_sys_getsid_return)
-PPP_CB_BOILERPLATE(on_sys_getsockname_return)
-PPP_CB_BOILERPLATE(on_sys_getsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_gettid_return)
-PPP_CB_BOILERPLATE(on_sys_gettimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_getuid_return)
-PPP_CB_BOILERPLATE(on_sys_getuid16_return)
-PPP_CB_BOILERPLATE(on_sys_getxattr_return)
-PPP_CB_BOILERPLATE(on_sys_init_module_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_add_watch_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init1_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_rm_watch_return)
-PPP_CB_BOILERPLATE(on_sys_io_cancel_return)
-PPP_CB_BOILERPLATE(on_sys_io_destroy_return)
-PPP_CB_BOILERPLATE(on_sys_io_getevents_return)
-PPP_CB_BOILERPLATE(on_sys_io_setup_return)
-PPP_CB_BOILERPLATE(on_sys_io_submit_return)
-PPP_CB_BOILERPLATE(on_sys_ioctl_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_get_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_set_return)
-PPP_CB_BOILERPLATE(on_sys_ipc_return)
-PPP_CB_BOILERPLATE(on_sys_kcmp_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_load_return)
-PPP_CB_BOILERPLATE(on_sys_keyctl_return)
-PPP_CB_BOILERPLATE(on_sys_kill_return)
-PPP_CB_BOILERPLATE(on_sys_lchown_return)
-PPP_CB_BOILERPLATE(on_sys_lchown16_return)
-PPP_CB_BOILERPLATE(on_sys_lgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_link_return)
-PPP_CB_BOILERPLATE(on_sys_linkat_return)
-PPP_CB_BOILERPLATE(on_sys_listen_return)
-PPP_CB_BOILERPLATE(on_sys_listxattr_return)
-PPP_CB_BOILERPLATE(on_sys_llistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_llseek_return)
-PPP_CB_BOILERPLATE(on_sys_lookup_dcookie_return)
-PPP_CB_BOILERPLATE(on_sys_lremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_lseek_return)
-PPP_CB_BOILERPLATE(on_sys_lsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_lstat64_return)
-PPP_CB_BOILERPLATE(on_sys_madvise_return)
-PPP_CB_BOILERPLATE(on_sys_mbind_return)
-PPP_CB_BOILERPLATE(on_sys_membarrier_return)
-PPP_CB_BOILERPLATE(on_sys_memfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_mincore_return)
-PPP_CB_BOILERPLATE(on_sys_mkdir_return)
-PPP_CB_BOILERPLATE(on_sys_mkdirat_return)
-PPP_CB_BOILERPLATE(on_sys_mknod_return)
-PPP_CB_BOILERPLATE(on_sys_mknodat_return)
-PPP_CB_BOILERPLATE(on_sys_mlock_return)
-PPP_CB_BOILERPLATE(on_sys_mlock2_return)
-PPP_CB_BOILERPLATE(on_sys_mlockall_return)
-PPP_CB_BOILERPLATE(on_sys_mount_return)
-PPP_CB_BOILERPLATE(on_sys_move_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_mq_getsetattr_return)
-PPP_CB_BOILERPLATE(on_sys_mq_notify_return)
-PPP_CB_BOILERPLATE(on_sys_mq_open_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedreceive_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedsend_return)
-PPP_CB_BOILERPLATE(on_sys_mq_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_mremap_return)
-PPP_CB_BOILERPLATE(on_sys_msgctl_return)
-PPP_CB_BOILERPLATE(on_sys_msgget_return)
-PPP_CB_BOILERPLATE(on_sys_msgrcv_return)
-PPP_CB_BOILERPLATE(on_sys_msgsnd_return)
-PPP_CB_BOILERPLATE(on_sys_msync_return)
-PPP_CB_BOILERPLATE(on_sys_munlock_return)
-PPP_CB_BOILERPLATE(on_sys_munlockall_return)
-PPP_CB_BOILERPLATE(on_sys_munmap_return)
-PPP_CB_BOILERPLATE(on_sys_name_to_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_newfstat_return)
-PPP_CB_BOILERPLATE(on_sys_newlstat_return)
-PPP_CB_BOILERPLATE(on_sys_newstat_return)
-PPP_CB_BOILERPLATE(on_sys_newuname_return)
-PPP_CB_BOILERPLATE(on_sys_nice_return)
-PPP_CB_BOILERPLATE(on_sys_open_return)
-PPP_CB_BOILERPLATE(on_sys_open_by_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_openat_return)
-PPP_CB_BOILERPLATE(on_sys_pause_return)
-PPP_CB_BOILERPLATE(on_sys_pciconfig_iobase_return)
-PPP_CB_BOILERPLATE(on_sys_pciconfig_read_return)
-PPP_CB_BOILERPLATE(on_sys_pciconfig_write_return)
-PPP_CB_BOILERPLATE(on_sys_perf_event_open_return)
-PPP_CB_BOILERPLATE(on_sys_personality_return)
-PPP_CB_BOILERPLATE(on_sys_pipe_return)
-PPP_CB_BOILERPLATE(on_sys_pipe2_return)
-PPP_CB_BOILERPLATE(on_sys_pivot_root_return)
-PPP_CB_BOILERPLATE(on_sys_poll_return)
-PPP_CB_BOILERPLATE(on_sys_ppoll_return)
-PPP_CB_BOILERPLATE(on_sys_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_pread64_return)
-PPP_CB_BOILERPLATE(on_sys_preadv_return)
-PPP_CB_BOILERPLATE(on_sys_prlimit64_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_readv_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_writev_return)
-PPP_CB_BOILERPLATE(on_sys_pselect6_return)
-PPP_CB_BOILERPLATE(on_sys_ptrace_return)
-PPP_CB_BOILERPLATE(on_sys_pwrite64_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev_return)
-PPP_CB_BOILERPLATE(on_sys_quotactl_return)
-PPP_CB_BOILERPLATE(on_sys_read_return)
-PPP_CB_BOILERPLATE(on_sys_readahead_return)
-PPP_CB_BOILERPLATE(on_sys_readlink_return)
-PPP_CB_BOILERPLATE(on_sys_readlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_readv_return)
-PPP_CB_BOILERPLATE(on_sys_reboot_return)
-PPP_CB_BOILERPLATE(on_sys_recv_return)
-PPP_CB_BOILERPLATE(on_sys_recvfrom_return)
-PPP_CB_BOILERPLATE(on_sys_recvmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_recvmsg_return)
-PPP_CB_BOILERPLATE(on_sys_remap_file_pages_return)
-PPP_CB_BOILERPLATE(on_sys_removexattr_return)
-PPP_CB_BOILERPLATE(on_sys_rename_return)
-PPP_CB_BOILERPLATE(on_sys_renameat_return)
-PPP_CB_BOILERPLATE(on_sys_renameat2_return)
-PPP_CB_BOILERPLATE(on_sys_request_key_return)
-PPP_CB_BOILERPLATE(on_sys_restart_syscall_return)
-PPP_CB_BOILERPLATE(on_sys_rmdir_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigtimedwait_return)
-PPP_CB_BOILERPLATE(on_sys_rt_tgsigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_max_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_min_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_rr_get_interval_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_yield_return)
-PPP_CB_BOILERPLATE(on_sys_seccomp_return)
-PPP_CB_BOILERPLATE(on_sys_select_return)
-PPP_CB_BOILERPLATE(on_sys_semctl_return)
-PPP_CB_BOILERPLATE(on_sys_semget_return)
-PPP_CB_BOILERPLATE(on_sys_semop_return)
-PPP_CB_BOILERPLATE(on_sys_semtimedop_return)
-PPP_CB_BOILERPLATE(on_sys_send_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile64_return)
-PPP_CB_BOILERPLATE(on_sys_sendmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendto_return)
-PPP_CB_BOILERPLATE(on_sys_set_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_set_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_set_tid_address_return)
-PPP_CB_BOILERPLATE(on_sys_setdomainname_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid16_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setgid_return)
-PPP_CB_BOILERPLATE(on_sys_setgid16_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups16_return)
-PPP_CB_BOILERPLATE(on_sys_sethostname_return)
-PPP_CB_BOILERPLATE(on_sys_setitimer_return)
-PPP_CB_BOILERPLATE(on_sys_setns_return)
-PPP_CB_BOILERPLATE(on_sys_setpgid_return)
-PPP_CB_BOILERPLATE(on_sys_setpriority_return)
-PPP_CB_BOILERPLATE(on_sys_setregid_return)
-PPP_CB_BOILERPLATE(on_sys_setregid16_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid16_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_setsid_return)
-PPP_CB_BOILERPLATE(on_sys_setsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_settimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_setuid_return)
-PPP_CB_BOILERPLATE(on_sys_setuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setxattr_return)
-PPP_CB_BOILERPLATE(on_sys_shmat_return)
-PPP_CB_BOILERPLATE(on_sys_shmctl_return)
-PPP_CB_BOILERPLATE(on_sys_shmdt_return)
-PPP_CB_BOILERPLATE(on_sys_shmget_return)
-PPP_CB_BOILERPLATE(on_sys_shutdown_return)
-PPP_CB_BOILERPLATE(on_sys_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_sigaltstack_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd4_return)
-PPP_CB_BOILERPLATE(on_sys_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_socket_return)
-PPP_CB_BOILERPLATE(on_sys_socketcall_return)
-PPP_CB_BOILERPLATE(on_sys_socketpair_return)
-PPP_CB_BOILERPLATE(on_sys_splice_return)
-PPP_CB_BOILERPLATE(on_sys_stat64_return)
-PPP_CB_BOILERPLATE(on_sys_statfs_return)
-PPP_CB_BOILERPLATE(on_sys_statfs64_return)
-PPP_CB_BOILERPLATE(on_sys_stime_return)
-PPP_CB_BOILERPLATE(on_sys_swapoff_return)
-PPP_CB_BOILERPLATE(on_sys_swapon_return)
-PPP_CB_BOILERPLATE(on_sys_symlink_return)
-PPP_CB_BOILERPLATE(on_sys_symlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_sync_return)
-PPP_CB_BOILERPLATE(on_sys_sync_file_range2_return)
-PPP_CB_BOILERPLATE(on_sys_syncfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysctl_return)
-PPP_CB_BOILERPLATE(on_sys_sysfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysinfo_return)
-PPP_CB_BOILERPLATE(on_sys_syslog_return)
-PPP_CB_BOILERPLATE(on_sys_tee_return)
-PPP_CB_BOILERPLATE(on_sys_tgkill_return)
-PPP_CB_BOILERPLATE(on_sys_time_return)
-PPP_CB_BOILERPLATE(on_sys_timer_create_return)
-PPP_CB_BOILERPLATE(on_sys_timer_delete_return)
-PPP_CB_BOILERPLATE(on_sys_timer_getoverrun_return)
-PPP_CB_BOILERPLATE(on_sys_timer_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timer_settime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_settime_return)
-PPP_CB_BOILERPLATE(on_sys_times_return)
-PPP_CB_BOILERPLATE(on_sys_tkill_return)
-PPP_CB_BOILERPLATE(on_sys_truncate_return)
-PPP_CB_BOILERPLATE(on_sys_truncate64_return)
-PPP_CB_BOILERPLATE(on_sys_umask_return)
-PPP_CB_BOILERPLATE(on_sys_umount_return)
-PPP_CB_BOILERPLATE(on_sys_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_unlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_unshare_return)
-PPP_CB_BOILERPLATE(on_sys_uselib_return)
-PPP_CB_BOILERPLATE(on_sys_userfaultfd_return)
-PPP_CB_BOILERPLATE(on_sys_ustat_return)
-PPP_CB_BOILERPLATE(on_sys_utime_return)
-PPP_CB_BOILERPLATE(on_sys_utimensat_return)
-PPP_CB_BOILERPLATE(on_sys_utimes_return)
-PPP_CB_BOILERPLATE(on_sys_vfork_return)
-PPP_CB_BOILERPLATE(on_sys_vhangup_return)
-PPP_CB_BOILERPLATE(on_sys_vmsplice_return)
-PPP_CB_BOILERPLATE(on_sys_wait4_return)
-PPP_CB_BOILERPLATE(on_sys_waitid_return)
-PPP_CB_BOILERPLATE(on_sys_write_return)
-PPP_CB_BOILERPLATE(on_sys_writev_return)
+PPP_CB_BOILERPLATE_NOTIFY(on_ARM_breakpoint_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ARM_cacheflush_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ARM_set_tls_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ARM_user26_mode_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ARM_usr32_mode_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_do_mmap2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_access_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_acct_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_add_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_adjtimex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_alarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_arm_fadvise64_64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bdflush_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bpf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_brk_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capset_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chown16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chroot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_adjtime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_getres_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clone_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_close_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_connect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_creat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_delete_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup3_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_ctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_pwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_wait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execveat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_group_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_faccessat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fallocate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_mark_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchown16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchownat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fcntl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fcntl64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fdatasync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_finit_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatfs64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ftruncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ftruncate64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futimesat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcpu_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcwd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getegid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getegid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_geteuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_geteuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgroups16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpeername_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgrp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getppid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrandom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrusage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_init_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_add_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_rm_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_cancel_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_destroy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_getevents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_setup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_submit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_set_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ipc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kcmp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kexec_load_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_keyctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lchown16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_linkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_llistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_llseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lookup_dcookie_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lstat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_madvise_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mbind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_membarrier_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_memfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mincore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdirat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_move_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_getsetattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_notify_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedreceive_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedsend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mremap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgrcv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgsnd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_name_to_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newfstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newlstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newuname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_by_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_openat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pause_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pciconfig_iobase_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pciconfig_read_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pciconfig_write_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_perf_event_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_personality_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pivot_root_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_poll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ppoll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pread64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prlimit64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_writev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pselect6_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ptrace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwrite64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_quotactl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_read_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readahead_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_reboot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvfrom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_remap_file_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_removexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rename_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_request_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_restart_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rmdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigtimedwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_tgsigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_max_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_min_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_rr_get_interval_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_yield_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_seccomp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_select_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semop_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semtimedop_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_send_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendfile64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendto_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_tid_address_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setdomainname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgroups16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sethostname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setns_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setregid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setregid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setreuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setreuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_settimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmdt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shutdown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigaltstack_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socket_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socketcall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socketpair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_splice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_stat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statfs64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_stime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapoff_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapon_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_file_range2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syncfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syslog_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tee_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tgkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_time_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_delete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_getoverrun_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_times_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_truncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_truncate64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unshare_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_uselib_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_userfaultfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ustat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimensat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimes_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vfork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vhangup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vmsplice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_wait4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_waitid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_write_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_writev_return, syscalls_subscriptions_dirty = true)
 #endif
 #if defined(TARGET_ARM) && defined(TARGET_AARCH64)
-PPP_CB_BOILERPLATE(on_sys_accept_return)
-PPP_CB_BOILERPLATE(on_sys_accept4_return)
-PPP_CB_BOILERPLATE(on_sys_acct_return)
-PPP_CB_BOILERPLATE(on_sys_add_key_return)
-PPP_CB_BOILERPLATE(on_sys_adjtimex_return)
-PPP_CB_BOILERPLATE(on_sys_bind_return)
-PPP_CB_BOILERPLATE(on_sys_bpf_return)
-PPP_CB_BOILERPLATE(on_sys_brk_return)
-PPP_CB_BOILERPLATE(on_sys_capget_return)
-PPP_CB_BOILERPLATE(on_sys_capset_return)
-PPP_CB_BOILERPLATE(on_sys_chdir_return)
-PPP_CB_BOILERPLATE(on_sys_chroot_return)
-PPP_CB_BOILERPLATE(on_sys_clock_adjtime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_getres_return)
-PPP_CB_BOILERPLATE(on_sys_clock_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_clock_settime_return)
-PPP_CB_BOILERPLATE(on_sys_clone_return)
-PPP_CB_BOILERPLATE(on_sys_clone3_return)
-PPP_CB_BOILERPLATE(on_sys_close_return)
-PPP_CB_BOILERPLATE(on_sys_connect_return)
-PPP_CB_BOILERPLATE(on_sys_copy_file_range_return)
-PPP_CB_BOILERPLATE(on_sys_delete_module_return)
-PPP_CB_BOILERPLATE(on_sys_dup_return)
-PPP_CB_BOILERPLATE(on_sys_dup3_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create1_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_ctl_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_pwait_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd2_return)
-PPP_CB_BOILERPLATE(on_sys_execve_return)
-PPP_CB_BOILERPLATE(on_sys_execveat_return)
-PPP_CB_BOILERPLATE(on_sys_exit_return)
-PPP_CB_BOILERPLATE(on_sys_exit_group_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat2_return)
-PPP_CB_BOILERPLATE(on_sys_fadvise64_return)
-PPP_CB_BOILERPLATE(on_sys_fallocate_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_mark_return)
-PPP_CB_BOILERPLATE(on_sys_fchdir_return)
-PPP_CB_BOILERPLATE(on_sys_fchmod_return)
-PPP_CB_BOILERPLATE(on_sys_fchmodat_return)
-PPP_CB_BOILERPLATE(on_sys_fchown_return)
-PPP_CB_BOILERPLATE(on_sys_fchownat_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl_return)
-PPP_CB_BOILERPLATE(on_sys_fdatasync_return)
-PPP_CB_BOILERPLATE(on_sys_fgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_finit_module_return)
-PPP_CB_BOILERPLATE(on_sys_flistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_flock_return)
-PPP_CB_BOILERPLATE(on_sys_fremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_fsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_fstat_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs_return)
-PPP_CB_BOILERPLATE(on_sys_fsync_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate_return)
-PPP_CB_BOILERPLATE(on_sys_futex_return)
-PPP_CB_BOILERPLATE(on_sys_get_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_get_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_getcpu_return)
-PPP_CB_BOILERPLATE(on_sys_getcwd_return)
-PPP_CB_BOILERPLATE(on_sys_getdents64_return)
-PPP_CB_BOILERPLATE(on_sys_getegid_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid_return)
-PPP_CB_BOILERPLATE(on_sys_getgid_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups_return)
-PPP_CB_BOILERPLATE(on_sys_getitimer_return)
-PPP_CB_BOILERPLATE(on_sys_getpeername_return)
-PPP_CB_BOILERPLATE(on_sys_getpgid_return)
-PPP_CB_BOILERPLATE(on_sys_getpid_return)
-PPP_CB_BOILERPLATE(on_sys_getppid_return)
-PPP_CB_BOILERPLATE(on_sys_getpriority_return)
-PPP_CB_BOILERPLATE(on_sys_getrandom_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid_return)
-PPP_CB_BOILERPLATE(on_sys_getrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_getrusage_return)
-PPP_CB_BOILERPLATE(on_sys_getsid_return)
-PPP_CB_BOILERPLATE(on_sys_getsockname_return)
-PPP_CB_BOILERPLATE(on_sys_getsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_gettid_return)
-PPP_CB_BOILERPLATE(on_sys_gettimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_getuid_return)
-PPP_CB_BOILERPLATE(on_sys_getxattr_return)
-PPP_CB_BOILERPLATE(on_sys_init_module_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_add_watch_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init1_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_rm_watch_return)
-PPP_CB_BOILERPLATE(on_sys_io_cancel_return)
-PPP_CB_BOILERPLATE(on_sys_io_destroy_return)
-PPP_CB_BOILERPLATE(on_sys_io_getevents_return)
-PPP_CB_BOILERPLATE(on_sys_io_setup_return)
-PPP_CB_BOILERPLATE(on_sys_io_submit_return)
-PPP_CB_BOILERPLATE(on_sys_ioctl_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_get_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_set_return)
-PPP_CB_BOILERPLATE(on_sys_kcmp_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_file_load_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_load_return)
-PPP_CB_BOILERPLATE(on_sys_keyctl_return)
-PPP_CB_BOILERPLATE(on_sys_kill_return)
-PPP_CB_BOILERPLATE(on_sys_lgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_linkat_return)
-PPP_CB_BOILERPLATE(on_sys_listen_return)
-PPP_CB_BOILERPLATE(on_sys_listxattr_return)
-PPP_CB_BOILERPLATE(on_sys_llistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_lookup_dcookie_return)
-PPP_CB_BOILERPLATE(on_sys_lremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_lseek_return)
-PPP_CB_BOILERPLATE(on_sys_lsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_madvise_return)
-PPP_CB_BOILERPLATE(on_sys_mbind_return)
-PPP_CB_BOILERPLATE(on_sys_membarrier_return)
-PPP_CB_BOILERPLATE(on_sys_memfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_migrate_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mincore_return)
-PPP_CB_BOILERPLATE(on_sys_mkdirat_return)
-PPP_CB_BOILERPLATE(on_sys_mknodat_return)
-PPP_CB_BOILERPLATE(on_sys_mlock_return)
-PPP_CB_BOILERPLATE(on_sys_mlock2_return)
-PPP_CB_BOILERPLATE(on_sys_mlockall_return)
-PPP_CB_BOILERPLATE(on_sys_mmap_return)
-PPP_CB_BOILERPLATE(on_sys_mount_return)
-PPP_CB_BOILERPLATE(on_sys_move_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_mq_getsetattr_return)
-PPP_CB_BOILERPLATE(on_sys_mq_notify_return)
-PPP_CB_BOILERPLATE(on_sys_mq_open_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedreceive_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedsend_return)
-PPP_CB_BOILERPLATE(on_sys_mq_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_mremap_return)
-PPP_CB_BOILERPLATE(on_sys_msgctl_return)
-PPP_CB_BOILERPLATE(on_sys_msgget_return)
-PPP_CB_BOILERPLATE(on_sys_msgrcv_return)
-PPP_CB_BOILERPLATE(on_sys_msgsnd_return)
-PPP_CB_BOILERPLATE(on_sys_msync_return)
-PPP_CB_BOILERPLATE(on_sys_munlock_return)
-PPP_CB_BOILERPLATE(on_sys_munlockall_return)
-PPP_CB_BOILERPLATE(on_sys_munmap_return)
-PPP_CB_BOILERPLATE(on_sys_name_to_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_newfstatat_return)
-PPP_CB_BOILERPLATE(on_sys_nfsservctl_return)
-PPP_CB_BOILERPLATE(on_sys_open_by_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_openat_return)
-PPP_CB_BOILERPLATE(on_sys_openat2_return)
-PPP_CB_BOILERPLATE(on_sys_perf_event_open_return)
-PPP_CB_BOILERPLATE(on_sys_personality_return)
-PPP_CB_BOILERPLATE(on_sys_pidfd_getfd_return)
-PPP_CB_BOILERPLATE(on_sys_pidfd_open_return)
-PPP_CB_BOILERPLATE(on_sys_pidfd_send_signal_return)
-PPP_CB_BOILERPLATE(on_sys_pipe2_return)
-PPP_CB_BOILERPLATE(on_sys_pivot_root_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_alloc_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_free_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_ppoll_return)
-PPP_CB_BOILERPLATE(on_sys_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_pread64_return)
-PPP_CB_BOILERPLATE(on_sys_preadv_return)
-PPP_CB_BOILERPLATE(on_sys_preadv2_return)
-PPP_CB_BOILERPLATE(on_sys_prlimit64_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_readv_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_writev_return)
-PPP_CB_BOILERPLATE(on_sys_pselect6_return)
-PPP_CB_BOILERPLATE(on_sys_ptrace_return)
-PPP_CB_BOILERPLATE(on_sys_pwrite64_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev2_return)
-PPP_CB_BOILERPLATE(on_sys_quotactl_return)
-PPP_CB_BOILERPLATE(on_sys_read_return)
-PPP_CB_BOILERPLATE(on_sys_readahead_return)
-PPP_CB_BOILERPLATE(on_sys_readlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_readv_return)
-PPP_CB_BOILERPLATE(on_sys_reboot_return)
-PPP_CB_BOILERPLATE(on_sys_recvfrom_return)
-PPP_CB_BOILERPLATE(on_sys_recvmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_recvmsg_return)
-PPP_CB_BOILERPLATE(on_sys_remap_file_pages_return)
-PPP_CB_BOILERPLATE(on_sys_removexattr_return)
-PPP_CB_BOILERPLATE(on_sys_renameat_return)
-PPP_CB_BOILERPLATE(on_sys_renameat2_return)
-PPP_CB_BOILERPLATE(on_sys_request_key_return)
-PPP_CB_BOILERPLATE(on_sys_restart_syscall_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigtimedwait_return)
-PPP_CB_BOILERPLATE(on_sys_rt_tgsigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_max_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_min_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_rr_get_interval_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_yield_return)
-PPP_CB_BOILERPLATE(on_sys_seccomp_return)
-PPP_CB_BOILERPLATE(on_sys_semctl_return)
-PPP_CB_BOILERPLATE(on_sys_semget_return)
-PPP_CB_BOILERPLATE(on_sys_semop_return)
-PPP_CB_BOILERPLATE(on_sys_semtimedop_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile_return)
-PPP_CB_BOILERPLATE(on_sys_sendmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendto_return)
-PPP_CB_BOILERPLATE(on_sys_set_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_set_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_set_tid_address_return)
-PPP_CB_BOILERPLATE(on_sys_setdomainname_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid_return)
-PPP_CB_BOILERPLATE(on_sys_setgid_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups_return)
-PPP_CB_BOILERPLATE(on_sys_sethostname_return)
-PPP_CB_BOILERPLATE(on_sys_setitimer_return)
-PPP_CB_BOILERPLATE(on_sys_setns_return)
-PPP_CB_BOILERPLATE(on_sys_setpgid_return)
-PPP_CB_BOILERPLATE(on_sys_setpriority_return)
-PPP_CB_BOILERPLATE(on_sys_setregid_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid_return)
-PPP_CB_BOILERPLATE(on_sys_setrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_setsid_return)
-PPP_CB_BOILERPLATE(on_sys_setsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_settimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_setuid_return)
-PPP_CB_BOILERPLATE(on_sys_setxattr_return)
-PPP_CB_BOILERPLATE(on_sys_shmat_return)
-PPP_CB_BOILERPLATE(on_sys_shmctl_return)
-PPP_CB_BOILERPLATE(on_sys_shmdt_return)
-PPP_CB_BOILERPLATE(on_sys_shmget_return)
-PPP_CB_BOILERPLATE(on_sys_shutdown_return)
-PPP_CB_BOILERPLATE(on_sys_sigaltstack_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd4_return)
-PPP_CB_BOILERPLATE(on_sys_socket_return)
-PPP_CB_BOILERPLATE(on_sys_socketpair_return)
-PPP_CB_BOILERPLATE(on_sys_splice_return)
-PPP_CB_BOILERPLATE(on_sys_statfs_return)
-PPP_CB_BOILERPLATE(on_sys_statx_return)
-PPP_CB_BOILERPLATE(on_sys_swapoff_return)
-PPP_CB_BOILERPLATE(on_sys_swapon_return)
-PPP_CB_BOILERPLATE(on_sys_symlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_sync_return)
-PPP_CB_BOILERPLATE(on_sys_sync_file_range_return)
-PPP_CB_BOILERPLATE(on_sys_syncfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysinfo_return)
-PPP_CB_BOILERPLATE(on_sys_syslog_return)
-PPP_CB_BOILERPLATE(on_sys_tee_return)
-PPP_CB_BOILERPLATE(on_sys_tgkill_return)
-PPP_CB_BOILERPLATE(on_sys_timer_create_return)
-PPP_CB_BOILERPLATE(on_sys_timer_delete_return)
-PPP_CB_BOILERPLATE(on_sys_timer_getoverrun_return)
-PPP_CB_BOILERPLATE(on_sys_timer_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timer_settime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_settime_return)
-PPP_CB_BOILERPLATE(on_sys_times_return)
-PPP_CB_BOILERPLATE(on_sys_tkill_return)
-PPP_CB_BOILERPLATE(on_sys_truncate_return)
-PPP_CB_BOILERPLATE(on_sys_umask_return)
-PPP_CB_BOILERPLATE(on_sys_umount2_return)
-PPP_CB_BOILERPLATE(on_sys_uname_return)
-PPP_CB_BOILERPLATE(on_sys_unlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_unshare_return)
-PPP_CB_BOILERPLATE(on_sys_userfaultfd_return)
-PPP_CB_BOILERPLATE(on_sys_utimensat_return)
-PPP_CB_BOILERPLATE(on_sys_vhangup_return)
-PPP_CB_BOILERPLATE(on_sys_vmsplice_return)
-PPP_CB_BOILERPLATE(on_sys_wait4_return)
-PPP_CB_BOILERPLATE(on_sys_waitid_return)
-PPP_CB_BOILERPLATE(on_sys_write_return)
-PPP_CB_BOILERPLATE(on_sys_writev_return)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_acct_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_add_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_adjtimex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bpf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_brk_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capset_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chroot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_adjtime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_getres_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clone_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clone3_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_close_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_connect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_copy_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_delete_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup3_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_ctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_pwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execveat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_group_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_faccessat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_faccessat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fadvise64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fallocate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_mark_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchownat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fcntl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fdatasync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_finit_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ftruncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcpu_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcwd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getegid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_geteuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpeername_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getppid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrandom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrusage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_init_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_add_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_rm_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_cancel_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_destroy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_getevents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_setup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_submit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_set_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kcmp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kexec_file_load_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kexec_load_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_keyctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_linkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_llistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lookup_dcookie_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_madvise_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mbind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_membarrier_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_memfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_migrate_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mincore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdirat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_move_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_getsetattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_notify_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedreceive_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedsend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mremap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgrcv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgsnd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_name_to_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newfstatat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nfsservctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_by_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_openat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_openat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_perf_event_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_personality_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pidfd_getfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pidfd_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pidfd_send_signal_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pivot_root_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_alloc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_free_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ppoll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pread64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prlimit64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_writev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pselect6_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ptrace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwrite64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_quotactl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_read_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readahead_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_reboot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvfrom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_remap_file_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_removexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_request_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_restart_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigtimedwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_tgsigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_max_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_min_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_rr_get_interval_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_yield_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_seccomp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semop_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semtimedop_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendto_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_tid_address_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setdomainname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sethostname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setns_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setregid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setreuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_settimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmdt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shutdown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigaltstack_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socket_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socketpair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_splice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapoff_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapon_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syncfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syslog_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tee_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tgkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_delete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_getoverrun_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_times_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_truncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umount2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_uname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unshare_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_userfaultfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimensat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vhangup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vmsplice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_wait4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_waitid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_write_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_writev_return, syscalls_subscriptions_dirty = true)
 #endif
 #if defined(TARGET_MIPS)
-PPP_CB_BOILERPLATE(on_create_module_return)
-PPP_CB_BOILERPLATE(on_get_kernel_syms_return)
-PPP_CB_BOILERPLATE(on_mmap2_return)
-PPP_CB_BOILERPLATE(on_modify_ldt_return)
-PPP_CB_BOILERPLATE(on_set_thread_area_return)
-PPP_CB_BOILERPLATE(on_sys_accept_return)
-PPP_CB_BOILERPLATE(on_sys_accept4_return)
-PPP_CB_BOILERPLATE(on_sys_access_return)
-PPP_CB_BOILERPLATE(on_sys_acct_return)
-PPP_CB_BOILERPLATE(on_sys_add_key_return)
-PPP_CB_BOILERPLATE(on_sys_adjtimex_time32_return)
-PPP_CB_BOILERPLATE(on_sys_alarm_return)
-PPP_CB_BOILERPLATE(on_sys_bdflush_return)
-PPP_CB_BOILERPLATE(on_sys_bind_return)
-PPP_CB_BOILERPLATE(on_sys_bpf_return)
-PPP_CB_BOILERPLATE(on_sys_brk_return)
-PPP_CB_BOILERPLATE(on_sys_cacheflush_return)
-PPP_CB_BOILERPLATE(on_sys_capget_return)
-PPP_CB_BOILERPLATE(on_sys_capset_return)
-PPP_CB_BOILERPLATE(on_sys_chdir_return)
-PPP_CB_BOILERPLATE(on_sys_chmod_return)
-PPP_CB_BOILERPLATE(on_sys_chown_return)
-PPP_CB_BOILERPLATE(on_sys_chroot_return)
-PPP_CB_BOILERPLATE(on_sys_clock_adjtime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_adjtime32_return)
-PPP_CB_BOILERPLATE(on_sys_clock_getres_return)
-PPP_CB_BOILERPLATE(on_sys_clock_getres_time32_return)
-PPP_CB_BOILERPLATE(on_sys_clock_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_gettime32_return)
-PPP_CB_BOILERPLATE(on_sys_clock_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_clock_nanosleep_time32_return)
-PPP_CB_BOILERPLATE(on_sys_clock_settime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_settime32_return)
-PPP_CB_BOILERPLATE(on_sys_clone_return)
-PPP_CB_BOILERPLATE(on_sys_close_return)
-PPP_CB_BOILERPLATE(on_sys_connect_return)
-PPP_CB_BOILERPLATE(on_sys_copy_file_range_return)
-PPP_CB_BOILERPLATE(on_sys_creat_return)
-PPP_CB_BOILERPLATE(on_sys_delete_module_return)
-PPP_CB_BOILERPLATE(on_sys_dup_return)
-PPP_CB_BOILERPLATE(on_sys_dup2_return)
-PPP_CB_BOILERPLATE(on_sys_dup3_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create1_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_ctl_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_pwait_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_wait_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd2_return)
-PPP_CB_BOILERPLATE(on_sys_execve_return)
-PPP_CB_BOILERPLATE(on_sys_execveat_return)
-PPP_CB_BOILERPLATE(on_sys_exit_return)
-PPP_CB_BOILERPLATE(on_sys_exit_group_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat2_return)
-PPP_CB_BOILERPLATE(on_sys_fadvise64_64_return)
-PPP_CB_BOILERPLATE(on_sys_fallocate_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_mark_return)
-PPP_CB_BOILERPLATE(on_sys_fchdir_return)
-PPP_CB_BOILERPLATE(on_sys_fchmod_return)
-PPP_CB_BOILERPLATE(on_sys_fchmodat_return)
-PPP_CB_BOILERPLATE(on_sys_fchown_return)
-PPP_CB_BOILERPLATE(on_sys_fchownat_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl64_return)
-PPP_CB_BOILERPLATE(on_sys_fdatasync_return)
-PPP_CB_BOILERPLATE(on_sys_fgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_finit_module_return)
-PPP_CB_BOILERPLATE(on_sys_flistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_flock_return)
-PPP_CB_BOILERPLATE(on_sys_fork_return)
-PPP_CB_BOILERPLATE(on_sys_fremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_fsconfig_return)
-PPP_CB_BOILERPLATE(on_sys_fsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_fsmount_return)
-PPP_CB_BOILERPLATE(on_sys_fsopen_return)
-PPP_CB_BOILERPLATE(on_sys_fspick_return)
-PPP_CB_BOILERPLATE(on_sys_fstat_return)
-PPP_CB_BOILERPLATE(on_sys_fstat64_return)
-PPP_CB_BOILERPLATE(on_sys_fstatat64_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs64_return)
-PPP_CB_BOILERPLATE(on_sys_fsync_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate64_return)
-PPP_CB_BOILERPLATE(on_sys_futex_return)
-PPP_CB_BOILERPLATE(on_sys_futex_time32_return)
-PPP_CB_BOILERPLATE(on_sys_futimesat_time32_return)
-PPP_CB_BOILERPLATE(on_sys_get_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_get_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_getcpu_return)
-PPP_CB_BOILERPLATE(on_sys_getcwd_return)
-PPP_CB_BOILERPLATE(on_sys_getdents_return)
-PPP_CB_BOILERPLATE(on_sys_getdents64_return)
-PPP_CB_BOILERPLATE(on_sys_getegid_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid_return)
-PPP_CB_BOILERPLATE(on_sys_getgid_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups_return)
-PPP_CB_BOILERPLATE(on_sys_getitimer_return)
-PPP_CB_BOILERPLATE(on_sys_getpeername_return)
-PPP_CB_BOILERPLATE(on_sys_getpgid_return)
-PPP_CB_BOILERPLATE(on_sys_getpgrp_return)
-PPP_CB_BOILERPLATE(on_sys_getpid_return)
-PPP_CB_BOILERPLATE(on_sys_getppid_return)
-PPP_CB_BOILERPLATE(on_sys_getpriority_return)
-PPP_CB_BOILERPLATE(on_sys_getrandom_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid_return)
-PPP_CB_BOILERPLATE(on_sys_getrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_getrusage_return)
-PPP_CB_BOILERPLATE(on_sys_getsid_return)
-PPP_CB_BOILERPLATE(on_sys_getsockname_return)
-PPP_CB_BOILERPLATE(on_sys_getsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_gettid_return)
-PPP_CB_BOILERPLATE(on_sys_gettimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_getuid_return)
-PPP_CB_BOILERPLATE(on_sys_getxattr_return)
-PPP_CB_BOILERPLATE(on_sys_idle_return)
-PPP_CB_BOILERPLATE(on_sys_init_module_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_add_watch_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init1_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_rm_watch_return)
-PPP_CB_BOILERPLATE(on_sys_io_cancel_return)
-PPP_CB_BOILERPLATE(on_sys_io_destroy_return)
-PPP_CB_BOILERPLATE(on_sys_io_getevents_time32_return)
-PPP_CB_BOILERPLATE(on_sys_io_pgetevents_return)
-PPP_CB_BOILERPLATE(on_sys_io_pgetevents_time32_return)
-PPP_CB_BOILERPLATE(on_sys_io_setup_return)
-PPP_CB_BOILERPLATE(on_sys_io_submit_return)
-PPP_CB_BOILERPLATE(on_sys_io_uring_enter_return)
-PPP_CB_BOILERPLATE(on_sys_io_uring_register_return)
-PPP_CB_BOILERPLATE(on_sys_io_uring_setup_return)
-PPP_CB_BOILERPLATE(on_sys_ioctl_return)
-PPP_CB_BOILERPLATE(on_sys_ioperm_return)
-PPP_CB_BOILERPLATE(on_sys_iopl_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_get_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_set_return)
-PPP_CB_BOILERPLATE(on_sys_ipc_return)
-PPP_CB_BOILERPLATE(on_sys_kcmp_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_load_return)
-PPP_CB_BOILERPLATE(on_sys_keyctl_return)
-PPP_CB_BOILERPLATE(on_sys_kill_return)
-PPP_CB_BOILERPLATE(on_sys_lchown_return)
-PPP_CB_BOILERPLATE(on_sys_lgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_link_return)
-PPP_CB_BOILERPLATE(on_sys_linkat_return)
-PPP_CB_BOILERPLATE(on_sys_listen_return)
-PPP_CB_BOILERPLATE(on_sys_listxattr_return)
-PPP_CB_BOILERPLATE(on_sys_llistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_llseek_return)
-PPP_CB_BOILERPLATE(on_sys_lookup_dcookie_return)
-PPP_CB_BOILERPLATE(on_sys_lremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_lseek_return)
-PPP_CB_BOILERPLATE(on_sys_lsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_lstat_return)
-PPP_CB_BOILERPLATE(on_sys_lstat64_return)
-PPP_CB_BOILERPLATE(on_sys_madvise_return)
-PPP_CB_BOILERPLATE(on_sys_mbind_return)
-PPP_CB_BOILERPLATE(on_sys_membarrier_return)
-PPP_CB_BOILERPLATE(on_sys_memfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_migrate_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mincore_return)
-PPP_CB_BOILERPLATE(on_sys_mkdir_return)
-PPP_CB_BOILERPLATE(on_sys_mkdirat_return)
-PPP_CB_BOILERPLATE(on_sys_mknod_return)
-PPP_CB_BOILERPLATE(on_sys_mknodat_return)
-PPP_CB_BOILERPLATE(on_sys_mlock_return)
-PPP_CB_BOILERPLATE(on_sys_mlock2_return)
-PPP_CB_BOILERPLATE(on_sys_mlockall_return)
-PPP_CB_BOILERPLATE(on_sys_mmap_return)
-PPP_CB_BOILERPLATE(on_sys_mount_return)
-PPP_CB_BOILERPLATE(on_sys_move_mount_return)
-PPP_CB_BOILERPLATE(on_sys_move_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_mq_getsetattr_return)
-PPP_CB_BOILERPLATE(on_sys_mq_notify_return)
-PPP_CB_BOILERPLATE(on_sys_mq_open_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedreceive_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedreceive_time32_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedsend_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedsend_time32_return)
-PPP_CB_BOILERPLATE(on_sys_mq_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_mremap_return)
-PPP_CB_BOILERPLATE(on_sys_msgctl_return)
-PPP_CB_BOILERPLATE(on_sys_msgget_return)
-PPP_CB_BOILERPLATE(on_sys_msgrcv_return)
-PPP_CB_BOILERPLATE(on_sys_msgsnd_return)
-PPP_CB_BOILERPLATE(on_sys_msync_return)
-PPP_CB_BOILERPLATE(on_sys_munlock_return)
-PPP_CB_BOILERPLATE(on_sys_munlockall_return)
-PPP_CB_BOILERPLATE(on_sys_munmap_return)
-PPP_CB_BOILERPLATE(on_sys_name_to_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_nanosleep_time32_return)
-PPP_CB_BOILERPLATE(on_sys_newfstat_return)
-PPP_CB_BOILERPLATE(on_sys_newlstat_return)
-PPP_CB_BOILERPLATE(on_sys_newstat_return)
-PPP_CB_BOILERPLATE(on_sys_newuname_return)
-PPP_CB_BOILERPLATE(on_sys_nfsservctl_return)
-PPP_CB_BOILERPLATE(on_sys_ni_syscall_return)
-PPP_CB_BOILERPLATE(on_sys_nice_return)
-PPP_CB_BOILERPLATE(on_sys_old_readdir_return)
-PPP_CB_BOILERPLATE(on_sys_oldumount_return)
-PPP_CB_BOILERPLATE(on_sys_olduname_return)
-PPP_CB_BOILERPLATE(on_sys_open_return)
-PPP_CB_BOILERPLATE(on_sys_open_by_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_open_tree_return)
-PPP_CB_BOILERPLATE(on_sys_openat_return)
-PPP_CB_BOILERPLATE(on_sys_openat2_return)
-PPP_CB_BOILERPLATE(on_sys_pause_return)
-PPP_CB_BOILERPLATE(on_sys_perf_event_open_return)
-PPP_CB_BOILERPLATE(on_sys_personality_return)
-PPP_CB_BOILERPLATE(on_sys_pidfd_getfd_return)
-PPP_CB_BOILERPLATE(on_sys_pidfd_open_return)
-PPP_CB_BOILERPLATE(on_sys_pidfd_send_signal_return)
-PPP_CB_BOILERPLATE(on_sys_pipe_return)
-PPP_CB_BOILERPLATE(on_sys_pipe2_return)
-PPP_CB_BOILERPLATE(on_sys_pivot_root_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_alloc_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_free_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_poll_return)
-PPP_CB_BOILERPLATE(on_sys_ppoll_return)
-PPP_CB_BOILERPLATE(on_sys_ppoll_time32_return)
-PPP_CB_BOILERPLATE(on_sys_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_pread64_return)
-PPP_CB_BOILERPLATE(on_sys_preadv_return)
-PPP_CB_BOILERPLATE(on_sys_preadv2_return)
-PPP_CB_BOILERPLATE(on_sys_prlimit64_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_readv_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_writev_return)
-PPP_CB_BOILERPLATE(on_sys_pselect6_return)
-PPP_CB_BOILERPLATE(on_sys_pselect6_time32_return)
-PPP_CB_BOILERPLATE(on_sys_ptrace_return)
-PPP_CB_BOILERPLATE(on_sys_pwrite64_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev2_return)
-PPP_CB_BOILERPLATE(on_sys_query_module_return)
-PPP_CB_BOILERPLATE(on_sys_quotactl_return)
-PPP_CB_BOILERPLATE(on_sys_read_return)
-PPP_CB_BOILERPLATE(on_sys_readahead_return)
-PPP_CB_BOILERPLATE(on_sys_readlink_return)
-PPP_CB_BOILERPLATE(on_sys_readlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_readv_return)
-PPP_CB_BOILERPLATE(on_sys_reboot_return)
-PPP_CB_BOILERPLATE(on_sys_recv_return)
-PPP_CB_BOILERPLATE(on_sys_recvfrom_return)
-PPP_CB_BOILERPLATE(on_sys_recvmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_recvmmsg_time32_return)
-PPP_CB_BOILERPLATE(on_sys_recvmsg_return)
-PPP_CB_BOILERPLATE(on_sys_remap_file_pages_return)
-PPP_CB_BOILERPLATE(on_sys_removexattr_return)
-PPP_CB_BOILERPLATE(on_sys_rename_return)
-PPP_CB_BOILERPLATE(on_sys_renameat_return)
-PPP_CB_BOILERPLATE(on_sys_renameat2_return)
-PPP_CB_BOILERPLATE(on_sys_request_key_return)
-PPP_CB_BOILERPLATE(on_sys_restart_syscall_return)
-PPP_CB_BOILERPLATE(on_sys_rmdir_return)
-PPP_CB_BOILERPLATE(on_sys_rseq_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigtimedwait_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigtimedwait_time32_return)
-PPP_CB_BOILERPLATE(on_sys_rt_tgsigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_max_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_min_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_rr_get_interval_return)
-PPP_CB_BOILERPLATE(on_sys_sched_rr_get_interval_time32_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_yield_return)
-PPP_CB_BOILERPLATE(on_sys_seccomp_return)
-PPP_CB_BOILERPLATE(on_sys_select_return)
-PPP_CB_BOILERPLATE(on_sys_semctl_return)
-PPP_CB_BOILERPLATE(on_sys_semget_return)
-PPP_CB_BOILERPLATE(on_sys_semtimedop_return)
-PPP_CB_BOILERPLATE(on_sys_send_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile64_return)
-PPP_CB_BOILERPLATE(on_sys_sendmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendto_return)
-PPP_CB_BOILERPLATE(on_sys_set_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_set_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_set_tid_address_return)
-PPP_CB_BOILERPLATE(on_sys_setdomainname_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid_return)
-PPP_CB_BOILERPLATE(on_sys_setgid_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups_return)
-PPP_CB_BOILERPLATE(on_sys_sethostname_return)
-PPP_CB_BOILERPLATE(on_sys_setitimer_return)
-PPP_CB_BOILERPLATE(on_sys_setns_return)
-PPP_CB_BOILERPLATE(on_sys_setpgid_return)
-PPP_CB_BOILERPLATE(on_sys_setpriority_return)
-PPP_CB_BOILERPLATE(on_sys_setregid_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid_return)
-PPP_CB_BOILERPLATE(on_sys_setrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_setsid_return)
-PPP_CB_BOILERPLATE(on_sys_setsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_settimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_setuid_return)
-PPP_CB_BOILERPLATE(on_sys_setup_return)
-PPP_CB_BOILERPLATE(on_sys_setxattr_return)
-PPP_CB_BOILERPLATE(on_sys_sgetmask_return)
-PPP_CB_BOILERPLATE(on_sys_shmat_return)
-PPP_CB_BOILERPLATE(on_sys_shmctl_return)
-PPP_CB_BOILERPLATE(on_sys_shmdt_return)
-PPP_CB_BOILERPLATE(on_sys_shmget_return)
-PPP_CB_BOILERPLATE(on_sys_shutdown_return)
-PPP_CB_BOILERPLATE(on_sys_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_sigaltstack_return)
-PPP_CB_BOILERPLATE(on_sys_signal_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd4_return)
-PPP_CB_BOILERPLATE(on_sys_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_socket_return)
-PPP_CB_BOILERPLATE(on_sys_socketcall_return)
-PPP_CB_BOILERPLATE(on_sys_socketpair_return)
-PPP_CB_BOILERPLATE(on_sys_splice_return)
-PPP_CB_BOILERPLATE(on_sys_ssetmask_return)
-PPP_CB_BOILERPLATE(on_sys_stat_return)
-PPP_CB_BOILERPLATE(on_sys_stat64_return)
-PPP_CB_BOILERPLATE(on_sys_statfs_return)
-PPP_CB_BOILERPLATE(on_sys_statfs64_return)
-PPP_CB_BOILERPLATE(on_sys_statx_return)
-PPP_CB_BOILERPLATE(on_sys_stime32_return)
-PPP_CB_BOILERPLATE(on_sys_swapoff_return)
-PPP_CB_BOILERPLATE(on_sys_swapon_return)
-PPP_CB_BOILERPLATE(on_sys_symlink_return)
-PPP_CB_BOILERPLATE(on_sys_symlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_sync_return)
-PPP_CB_BOILERPLATE(on_sys_sync_file_range_return)
-PPP_CB_BOILERPLATE(on_sys_syncfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysctl_return)
-PPP_CB_BOILERPLATE(on_sys_sysfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysinfo_return)
-PPP_CB_BOILERPLATE(on_sys_syslog_return)
-PPP_CB_BOILERPLATE(on_sys_tee_return)
-PPP_CB_BOILERPLATE(on_sys_tgkill_return)
-PPP_CB_BOILERPLATE(on_sys_time32_return)
-PPP_CB_BOILERPLATE(on_sys_timer_create_return)
-PPP_CB_BOILERPLATE(on_sys_timer_delete_return)
-PPP_CB_BOILERPLATE(on_sys_timer_getoverrun_return)
-PPP_CB_BOILERPLATE(on_sys_timer_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timer_gettime32_return)
-PPP_CB_BOILERPLATE(on_sys_timer_settime_return)
-PPP_CB_BOILERPLATE(on_sys_timer_settime32_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_gettime32_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_settime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_settime32_return)
-PPP_CB_BOILERPLATE(on_sys_times_return)
-PPP_CB_BOILERPLATE(on_sys_tkill_return)
-PPP_CB_BOILERPLATE(on_sys_truncate_return)
-PPP_CB_BOILERPLATE(on_sys_truncate64_return)
-PPP_CB_BOILERPLATE(on_sys_umask_return)
-PPP_CB_BOILERPLATE(on_sys_umount_return)
-PPP_CB_BOILERPLATE(on_sys_uname_return)
-PPP_CB_BOILERPLATE(on_sys_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_unlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_unshare_return)
-PPP_CB_BOILERPLATE(on_sys_uselib_return)
-PPP_CB_BOILERPLATE(on_sys_userfaultfd_return)
-PPP_CB_BOILERPLATE(on_sys_ustat_return)
-PPP_CB_BOILERPLATE(on_sys_utime32_return)
-PPP_CB_BOILERPLATE(on_sys_utimensat_return)
-PPP_CB_BOILERPLATE(on_sys_utimensat_time32_return)
-PPP_CB_BOILERPLATE(on_sys_utimes_time32_return)
-PPP_CB_BOILERPLATE(on_sys_vhangup_return)
-PPP_CB_BOILERPLATE(on_sys_vmsplice_return)
-PPP_CB_BOILERPLATE(on_sys_wait4_return)
-PPP_CB_BOILERPLATE(on_sys_waitid_return)
-PPP_CB_BOILERPLATE(on_sys_waitpid_return)
-PPP_CB_BOILERPLATE(on_sys_write_return)
-PPP_CB_BOILERPLATE(on_sys_writev_return)
+PPP_CB_BOILERPLATE_NOTIFY(on_create_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_get_kernel_syms_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mmap2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_modify_ldt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_set_thread_area_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_access_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_acct_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_add_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_adjtimex_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_alarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bdflush_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bpf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_brk_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_cacheflush_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capset_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chroot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_adjtime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_adjtime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_getres_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_getres_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_gettime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_nanosleep_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_settime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clone_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_close_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_connect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_copy_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_creat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_delete_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup3_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_ctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_pwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_wait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execveat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_group_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_faccessat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_faccessat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fadvise64_64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fallocate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_mark_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchownat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fcntl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fcntl64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fdatasync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_finit_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsconfig_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsmount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsopen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fspick_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatfs64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ftruncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ftruncate64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futex_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futimesat_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcpu_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcwd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getegid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_geteuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpeername_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgrp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getppid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrandom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrusage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_idle_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_init_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_add_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_rm_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_cancel_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_destroy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_getevents_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_pgetevents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_pgetevents_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_setup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_submit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_uring_enter_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_uring_register_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_uring_setup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioperm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_iopl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_set_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ipc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kcmp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kexec_load_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_keyctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_linkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_llistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_llseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lookup_dcookie_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lstat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_madvise_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mbind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_membarrier_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_memfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_migrate_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mincore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdirat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_move_mount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_move_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_getsetattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_notify_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedreceive_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedreceive_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedsend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedsend_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mremap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgrcv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgsnd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_name_to_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nanosleep_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newfstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newlstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newuname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nfsservctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ni_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_old_readdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_oldumount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_olduname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_by_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_tree_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_openat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_openat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pause_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_perf_event_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_personality_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pidfd_getfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pidfd_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pidfd_send_signal_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pivot_root_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_alloc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_free_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_poll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ppoll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ppoll_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pread64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prlimit64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_writev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pselect6_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pselect6_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ptrace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwrite64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_query_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_quotactl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_read_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readahead_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_reboot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvfrom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmmsg_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_remap_file_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_removexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rename_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_request_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_restart_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rmdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rseq_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigtimedwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigtimedwait_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_tgsigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_max_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_min_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_rr_get_interval_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_rr_get_interval_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_yield_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_seccomp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_select_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semtimedop_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_send_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendfile64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendto_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_tid_address_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setdomainname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sethostname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setns_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setregid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setreuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_settimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sgetmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmdt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shutdown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigaltstack_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signal_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socket_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socketcall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socketpair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_splice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ssetmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_stat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_stat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statfs64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_stime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapoff_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapon_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syncfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syslog_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tee_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tgkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_delete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_getoverrun_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_gettime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_settime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_gettime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_settime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_times_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_truncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_truncate64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_uname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unshare_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_uselib_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_userfaultfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ustat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utime32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimensat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimensat_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimes_time32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vhangup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vmsplice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_wait4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_waitid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_waitpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_write_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_writev_return, syscalls_subscriptions_dirty = true)
 #endif
 #if defined(TARGET_X86_64)
-PPP_CB_BOILERPLATE(on___acl_aclcheck_fd_return)
-PPP_CB_BOILERPLATE(on___acl_aclcheck_file_return)
-PPP_CB_BOILERPLATE(on___acl_aclcheck_link_return)
-PPP_CB_BOILERPLATE(on___acl_delete_fd_return)
-PPP_CB_BOILERPLATE(on___acl_delete_file_return)
-PPP_CB_BOILERPLATE(on___acl_delete_link_return)
-PPP_CB_BOILERPLATE(on___acl_get_fd_return)
-PPP_CB_BOILERPLATE(on___acl_get_file_return)
-PPP_CB_BOILERPLATE(on___acl_get_link_return)
-PPP_CB_BOILERPLATE(on___acl_set_fd_return)
-PPP_CB_BOILERPLATE(on___acl_set_file_return)
-PPP_CB_BOILERPLATE(on___acl_set_link_return)
-PPP_CB_BOILERPLATE(on___cap_rights_get_return)
-PPP_CB_BOILERPLATE(on___getcwd_return)
-PPP_CB_BOILERPLATE(on___mac_execve_return)
-PPP_CB_BOILERPLATE(on___mac_get_fd_return)
-PPP_CB_BOILERPLATE(on___mac_get_file_return)
-PPP_CB_BOILERPLATE(on___mac_get_link_return)
-PPP_CB_BOILERPLATE(on___mac_get_pid_return)
-PPP_CB_BOILERPLATE(on___mac_get_proc_return)
-PPP_CB_BOILERPLATE(on___mac_set_fd_return)
-PPP_CB_BOILERPLATE(on___mac_set_file_return)
-PPP_CB_BOILERPLATE(on___mac_set_link_return)
-PPP_CB_BOILERPLATE(on___mac_set_proc_return)
-PPP_CB_BOILERPLATE(on___realpathat_return)
-PPP_CB_BOILERPLATE(on___semctl_return)
-PPP_CB_BOILERPLATE(on___setugid_return)
-PPP_CB_BOILERPLATE(on___sysctl_return)
-PPP_CB_BOILERPLATE(on___sysctlbyname_return)
-PPP_CB_BOILERPLATE(on__umtx_op_return)
-PPP_CB_BOILERPLATE(on_abort2_return)
-PPP_CB_BOILERPLATE(on_accept_return)
-PPP_CB_BOILERPLATE(on_accept4_return)
-PPP_CB_BOILERPLATE(on_access_return)
-PPP_CB_BOILERPLATE(on_acct_return)
-PPP_CB_BOILERPLATE(on_adjtime_return)
-PPP_CB_BOILERPLATE(on_afs3_syscall_return)
-PPP_CB_BOILERPLATE(on_aio_cancel_return)
-PPP_CB_BOILERPLATE(on_aio_error_return)
-PPP_CB_BOILERPLATE(on_aio_fsync_return)
-PPP_CB_BOILERPLATE(on_aio_mlock_return)
-PPP_CB_BOILERPLATE(on_aio_read_return)
-PPP_CB_BOILERPLATE(on_aio_return_return)
-PPP_CB_BOILERPLATE(on_aio_suspend_return)
-PPP_CB_BOILERPLATE(on_aio_waitcomplete_return)
-PPP_CB_BOILERPLATE(on_aio_write_return)
-PPP_CB_BOILERPLATE(on_audit_return)
-PPP_CB_BOILERPLATE(on_auditctl_return)
-PPP_CB_BOILERPLATE(on_auditon_return)
-PPP_CB_BOILERPLATE(on_bind_return)
-PPP_CB_BOILERPLATE(on_bindat_return)
-PPP_CB_BOILERPLATE(on_cap_enter_return)
-PPP_CB_BOILERPLATE(on_cap_fcntls_get_return)
-PPP_CB_BOILERPLATE(on_cap_fcntls_limit_return)
-PPP_CB_BOILERPLATE(on_cap_getmode_return)
-PPP_CB_BOILERPLATE(on_cap_ioctls_get_return)
-PPP_CB_BOILERPLATE(on_cap_ioctls_limit_return)
-PPP_CB_BOILERPLATE(on_cap_rights_limit_return)
-PPP_CB_BOILERPLATE(on_chdir_return)
-PPP_CB_BOILERPLATE(on_chflags_return)
-PPP_CB_BOILERPLATE(on_chflagsat_return)
-PPP_CB_BOILERPLATE(on_chmod_return)
-PPP_CB_BOILERPLATE(on_chown_return)
-PPP_CB_BOILERPLATE(on_chroot_return)
-PPP_CB_BOILERPLATE(on_clock_getcpuclockid2_return)
-PPP_CB_BOILERPLATE(on_clock_getres_return)
-PPP_CB_BOILERPLATE(on_clock_gettime_return)
-PPP_CB_BOILERPLATE(on_clock_nanosleep_return)
-PPP_CB_BOILERPLATE(on_clock_settime_return)
-PPP_CB_BOILERPLATE(on_close_return)
-PPP_CB_BOILERPLATE(on_close_range_return)
-PPP_CB_BOILERPLATE(on_closefrom_return)
-PPP_CB_BOILERPLATE(on_connect_return)
-PPP_CB_BOILERPLATE(on_connectat_return)
-PPP_CB_BOILERPLATE(on_copy_file_range_return)
-PPP_CB_BOILERPLATE(on_cpuset_return)
-PPP_CB_BOILERPLATE(on_cpuset_getaffinity_return)
-PPP_CB_BOILERPLATE(on_cpuset_getdomain_return)
-PPP_CB_BOILERPLATE(on_cpuset_getid_return)
-PPP_CB_BOILERPLATE(on_cpuset_setaffinity_return)
-PPP_CB_BOILERPLATE(on_cpuset_setdomain_return)
-PPP_CB_BOILERPLATE(on_cpuset_setid_return)
-PPP_CB_BOILERPLATE(on_creat_return)
-PPP_CB_BOILERPLATE(on_dup_return)
-PPP_CB_BOILERPLATE(on_dup2_return)
-PPP_CB_BOILERPLATE(on_eaccess_return)
-PPP_CB_BOILERPLATE(on_execve_return)
-PPP_CB_BOILERPLATE(on_extattr_delete_fd_return)
-PPP_CB_BOILERPLATE(on_extattr_delete_file_return)
-PPP_CB_BOILERPLATE(on_extattr_delete_link_return)
-PPP_CB_BOILERPLATE(on_extattr_get_fd_return)
-PPP_CB_BOILERPLATE(on_extattr_get_file_return)
-PPP_CB_BOILERPLATE(on_extattr_get_link_return)
-PPP_CB_BOILERPLATE(on_extattr_list_fd_return)
-PPP_CB_BOILERPLATE(on_extattr_list_file_return)
-PPP_CB_BOILERPLATE(on_extattr_list_link_return)
-PPP_CB_BOILERPLATE(on_extattr_set_fd_return)
-PPP_CB_BOILERPLATE(on_extattr_set_file_return)
-PPP_CB_BOILERPLATE(on_extattr_set_link_return)
-PPP_CB_BOILERPLATE(on_extattrctl_return)
-PPP_CB_BOILERPLATE(on_faccessat_return)
-PPP_CB_BOILERPLATE(on_fchdir_return)
-PPP_CB_BOILERPLATE(on_fchflags_return)
-PPP_CB_BOILERPLATE(on_fchmod_return)
-PPP_CB_BOILERPLATE(on_fchmodat_return)
-PPP_CB_BOILERPLATE(on_fchown_return)
-PPP_CB_BOILERPLATE(on_fchownat_return)
-PPP_CB_BOILERPLATE(on_fcntl_return)
-PPP_CB_BOILERPLATE(on_fdatasync_return)
-PPP_CB_BOILERPLATE(on_fexecve_return)
-PPP_CB_BOILERPLATE(on_ffclock_getcounter_return)
-PPP_CB_BOILERPLATE(on_ffclock_getestimate_return)
-PPP_CB_BOILERPLATE(on_ffclock_setestimate_return)
-PPP_CB_BOILERPLATE(on_fhlink_return)
-PPP_CB_BOILERPLATE(on_fhlinkat_return)
-PPP_CB_BOILERPLATE(on_fhopen_return)
-PPP_CB_BOILERPLATE(on_fhreadlink_return)
-PPP_CB_BOILERPLATE(on_fhstat_return)
-PPP_CB_BOILERPLATE(on_fhstatfs_return)
-PPP_CB_BOILERPLATE(on_flock_return)
-PPP_CB_BOILERPLATE(on_fork_return)
-PPP_CB_BOILERPLATE(on_fpathconf_return)
-PPP_CB_BOILERPLATE(on_fstat_return)
-PPP_CB_BOILERPLATE(on_fstatat_return)
-PPP_CB_BOILERPLATE(on_fstatfs_return)
-PPP_CB_BOILERPLATE(on_fsync_return)
-PPP_CB_BOILERPLATE(on_ftruncate_return)
-PPP_CB_BOILERPLATE(on_funlinkat_return)
-PPP_CB_BOILERPLATE(on_futimens_return)
-PPP_CB_BOILERPLATE(on_futimes_return)
-PPP_CB_BOILERPLATE(on_futimesat_return)
-PPP_CB_BOILERPLATE(on_getaudit_return)
-PPP_CB_BOILERPLATE(on_getaudit_addr_return)
-PPP_CB_BOILERPLATE(on_getauid_return)
-PPP_CB_BOILERPLATE(on_getcontext_return)
-PPP_CB_BOILERPLATE(on_getdents_return)
-PPP_CB_BOILERPLATE(on_getdirentries_return)
-PPP_CB_BOILERPLATE(on_getdomainname_return)
-PPP_CB_BOILERPLATE(on_getdtablesize_return)
-PPP_CB_BOILERPLATE(on_getegid_return)
-PPP_CB_BOILERPLATE(on_geteuid_return)
-PPP_CB_BOILERPLATE(on_getfh_return)
-PPP_CB_BOILERPLATE(on_getfhat_return)
-PPP_CB_BOILERPLATE(on_getfsstat_return)
-PPP_CB_BOILERPLATE(on_getgid_return)
-PPP_CB_BOILERPLATE(on_getgroups_return)
-PPP_CB_BOILERPLATE(on_gethostid_return)
-PPP_CB_BOILERPLATE(on_gethostname_return)
-PPP_CB_BOILERPLATE(on_getitimer_return)
-PPP_CB_BOILERPLATE(on_getkerninfo_return)
-PPP_CB_BOILERPLATE(on_getlogin_return)
-PPP_CB_BOILERPLATE(on_getloginclass_return)
-PPP_CB_BOILERPLATE(on_getpagesize_return)
-PPP_CB_BOILERPLATE(on_getpeername_return)
-PPP_CB_BOILERPLATE(on_getpgid_return)
-PPP_CB_BOILERPLATE(on_getpgrp_return)
-PPP_CB_BOILERPLATE(on_getpid_return)
-PPP_CB_BOILERPLATE(on_getppid_return)
-PPP_CB_BOILERPLATE(on_getpriority_return)
-PPP_CB_BOILERPLATE(on_getrandom_return)
-PPP_CB_BOILERPLATE(on_getresgid_return)
-PPP_CB_BOILERPLATE(on_getresuid_return)
-PPP_CB_BOILERPLATE(on_getrlimit_return)
-PPP_CB_BOILERPLATE(on_getrusage_return)
-PPP_CB_BOILERPLATE(on_getsid_return)
-PPP_CB_BOILERPLATE(on_getsockname_return)
-PPP_CB_BOILERPLATE(on_getsockopt_return)
-PPP_CB_BOILERPLATE(on_gettimeofday_return)
-PPP_CB_BOILERPLATE(on_getuid_return)
-PPP_CB_BOILERPLATE(on_gssd_syscall_return)
-PPP_CB_BOILERPLATE(on_ioctl_return)
-PPP_CB_BOILERPLATE(on_issetugid_return)
-PPP_CB_BOILERPLATE(on_jail_return)
-PPP_CB_BOILERPLATE(on_jail_attach_return)
-PPP_CB_BOILERPLATE(on_jail_get_return)
-PPP_CB_BOILERPLATE(on_jail_remove_return)
-PPP_CB_BOILERPLATE(on_jail_set_return)
-PPP_CB_BOILERPLATE(on_kenv_return)
-PPP_CB_BOILERPLATE(on_kevent_return)
-PPP_CB_BOILERPLATE(on_kill_return)
-PPP_CB_BOILERPLATE(on_killpg_return)
-PPP_CB_BOILERPLATE(on_kldfind_return)
-PPP_CB_BOILERPLATE(on_kldfirstmod_return)
-PPP_CB_BOILERPLATE(on_kldload_return)
-PPP_CB_BOILERPLATE(on_kldnext_return)
-PPP_CB_BOILERPLATE(on_kldstat_return)
-PPP_CB_BOILERPLATE(on_kldsym_return)
-PPP_CB_BOILERPLATE(on_kldunload_return)
-PPP_CB_BOILERPLATE(on_kldunloadf_return)
-PPP_CB_BOILERPLATE(on_kmq_notify_return)
-PPP_CB_BOILERPLATE(on_kmq_open_return)
-PPP_CB_BOILERPLATE(on_kmq_setattr_return)
-PPP_CB_BOILERPLATE(on_kmq_timedreceive_return)
-PPP_CB_BOILERPLATE(on_kmq_timedsend_return)
-PPP_CB_BOILERPLATE(on_kmq_unlink_return)
-PPP_CB_BOILERPLATE(on_kqueue_return)
-PPP_CB_BOILERPLATE(on_ksem_close_return)
-PPP_CB_BOILERPLATE(on_ksem_destroy_return)
-PPP_CB_BOILERPLATE(on_ksem_getvalue_return)
-PPP_CB_BOILERPLATE(on_ksem_init_return)
-PPP_CB_BOILERPLATE(on_ksem_open_return)
-PPP_CB_BOILERPLATE(on_ksem_post_return)
-PPP_CB_BOILERPLATE(on_ksem_timedwait_return)
-PPP_CB_BOILERPLATE(on_ksem_trywait_return)
-PPP_CB_BOILERPLATE(on_ksem_unlink_return)
-PPP_CB_BOILERPLATE(on_ksem_wait_return)
-PPP_CB_BOILERPLATE(on_ktimer_create_return)
-PPP_CB_BOILERPLATE(on_ktimer_delete_return)
-PPP_CB_BOILERPLATE(on_ktimer_getoverrun_return)
-PPP_CB_BOILERPLATE(on_ktimer_gettime_return)
-PPP_CB_BOILERPLATE(on_ktimer_settime_return)
-PPP_CB_BOILERPLATE(on_ktrace_return)
-PPP_CB_BOILERPLATE(on_lchflags_return)
-PPP_CB_BOILERPLATE(on_lchmod_return)
-PPP_CB_BOILERPLATE(on_lchown_return)
-PPP_CB_BOILERPLATE(on_lgetfh_return)
-PPP_CB_BOILERPLATE(on_link_return)
-PPP_CB_BOILERPLATE(on_linkat_return)
-PPP_CB_BOILERPLATE(on_lio_listio_return)
-PPP_CB_BOILERPLATE(on_listen_return)
-PPP_CB_BOILERPLATE(on_lpathconf_return)
-PPP_CB_BOILERPLATE(on_lseek_return)
-PPP_CB_BOILERPLATE(on_lstat_return)
-PPP_CB_BOILERPLATE(on_lutimes_return)
-PPP_CB_BOILERPLATE(on_mac_syscall_return)
-PPP_CB_BOILERPLATE(on_madvise_return)
-PPP_CB_BOILERPLATE(on_mincore_return)
-PPP_CB_BOILERPLATE(on_minherit_return)
-PPP_CB_BOILERPLATE(on_mkdir_return)
-PPP_CB_BOILERPLATE(on_mkdirat_return)
-PPP_CB_BOILERPLATE(on_mkfifo_return)
-PPP_CB_BOILERPLATE(on_mkfifoat_return)
-PPP_CB_BOILERPLATE(on_mknod_return)
-PPP_CB_BOILERPLATE(on_mknodat_return)
-PPP_CB_BOILERPLATE(on_mlock_return)
-PPP_CB_BOILERPLATE(on_mlockall_return)
-PPP_CB_BOILERPLATE(on_modfind_return)
-PPP_CB_BOILERPLATE(on_modfnext_return)
-PPP_CB_BOILERPLATE(on_modnext_return)
-PPP_CB_BOILERPLATE(on_modstat_return)
-PPP_CB_BOILERPLATE(on_mount_return)
-PPP_CB_BOILERPLATE(on_mprotect_return)
-PPP_CB_BOILERPLATE(on_msgctl_return)
-PPP_CB_BOILERPLATE(on_msgget_return)
-PPP_CB_BOILERPLATE(on_msgrcv_return)
-PPP_CB_BOILERPLATE(on_msgsnd_return)
-PPP_CB_BOILERPLATE(on_msync_return)
-PPP_CB_BOILERPLATE(on_munlock_return)
-PPP_CB_BOILERPLATE(on_munmap_return)
-PPP_CB_BOILERPLATE(on_nanosleep_return)
-PPP_CB_BOILERPLATE(on_nfssvc_return)
-PPP_CB_BOILERPLATE(on_nfstat_return)
-PPP_CB_BOILERPLATE(on_nlm_syscall_return)
-PPP_CB_BOILERPLATE(on_nlstat_return)
-PPP_CB_BOILERPLATE(on_nmount_return)
-PPP_CB_BOILERPLATE(on_nnpfs_syscall_return)
-PPP_CB_BOILERPLATE(on_nosys_return)
-PPP_CB_BOILERPLATE(on_nstat_return)
-PPP_CB_BOILERPLATE(on_ntp_adjtime_return)
-PPP_CB_BOILERPLATE(on_ntp_gettime_return)
-PPP_CB_BOILERPLATE(on_open_return)
-PPP_CB_BOILERPLATE(on_openat_return)
-PPP_CB_BOILERPLATE(on_pathconf_return)
-PPP_CB_BOILERPLATE(on_pdfork_return)
-PPP_CB_BOILERPLATE(on_pdgetpid_return)
-PPP_CB_BOILERPLATE(on_pdkill_return)
-PPP_CB_BOILERPLATE(on_pipe_return)
-PPP_CB_BOILERPLATE(on_pipe2_return)
-PPP_CB_BOILERPLATE(on_poll_return)
-PPP_CB_BOILERPLATE(on_posix_fadvise_return)
-PPP_CB_BOILERPLATE(on_posix_fallocate_return)
-PPP_CB_BOILERPLATE(on_posix_openpt_return)
-PPP_CB_BOILERPLATE(on_ppoll_return)
-PPP_CB_BOILERPLATE(on_pread_return)
-PPP_CB_BOILERPLATE(on_preadv_return)
-PPP_CB_BOILERPLATE(on_procctl_return)
-PPP_CB_BOILERPLATE(on_profil_return)
-PPP_CB_BOILERPLATE(on_pselect_return)
-PPP_CB_BOILERPLATE(on_ptrace_return)
-PPP_CB_BOILERPLATE(on_pwrite_return)
-PPP_CB_BOILERPLATE(on_pwritev_return)
-PPP_CB_BOILERPLATE(on_quota_return)
-PPP_CB_BOILERPLATE(on_quotactl_return)
-PPP_CB_BOILERPLATE(on_rctl_add_rule_return)
-PPP_CB_BOILERPLATE(on_rctl_get_limits_return)
-PPP_CB_BOILERPLATE(on_rctl_get_racct_return)
-PPP_CB_BOILERPLATE(on_rctl_get_rules_return)
-PPP_CB_BOILERPLATE(on_rctl_remove_rule_return)
-PPP_CB_BOILERPLATE(on_read_return)
-PPP_CB_BOILERPLATE(on_readlink_return)
-PPP_CB_BOILERPLATE(on_readlinkat_return)
-PPP_CB_BOILERPLATE(on_readv_return)
-PPP_CB_BOILERPLATE(on_reboot_return)
-PPP_CB_BOILERPLATE(on_recv_return)
-PPP_CB_BOILERPLATE(on_recvfrom_return)
-PPP_CB_BOILERPLATE(on_recvmsg_return)
-PPP_CB_BOILERPLATE(on_rename_return)
-PPP_CB_BOILERPLATE(on_renameat_return)
-PPP_CB_BOILERPLATE(on_revoke_return)
-PPP_CB_BOILERPLATE(on_rfork_return)
-PPP_CB_BOILERPLATE(on_rmdir_return)
-PPP_CB_BOILERPLATE(on_rpctls_syscall_return)
-PPP_CB_BOILERPLATE(on_rtprio_return)
-PPP_CB_BOILERPLATE(on_rtprio_thread_return)
-PPP_CB_BOILERPLATE(on_sbrk_return)
-PPP_CB_BOILERPLATE(on_sched_get_priority_max_return)
-PPP_CB_BOILERPLATE(on_sched_get_priority_min_return)
-PPP_CB_BOILERPLATE(on_sched_getparam_return)
-PPP_CB_BOILERPLATE(on_sched_getscheduler_return)
-PPP_CB_BOILERPLATE(on_sched_rr_get_interval_return)
-PPP_CB_BOILERPLATE(on_sched_setparam_return)
-PPP_CB_BOILERPLATE(on_sched_setscheduler_return)
-PPP_CB_BOILERPLATE(on_sched_yield_return)
-PPP_CB_BOILERPLATE(on_sctp_generic_recvmsg_return)
-PPP_CB_BOILERPLATE(on_sctp_generic_sendmsg_return)
-PPP_CB_BOILERPLATE(on_sctp_generic_sendmsg_iov_return)
-PPP_CB_BOILERPLATE(on_sctp_peeloff_return)
-PPP_CB_BOILERPLATE(on_select_return)
-PPP_CB_BOILERPLATE(on_semget_return)
-PPP_CB_BOILERPLATE(on_semop_return)
-PPP_CB_BOILERPLATE(on_semsys_return)
-PPP_CB_BOILERPLATE(on_send_return)
-PPP_CB_BOILERPLATE(on_sendfile_return)
-PPP_CB_BOILERPLATE(on_sendmsg_return)
-PPP_CB_BOILERPLATE(on_sendto_return)
-PPP_CB_BOILERPLATE(on_setaudit_return)
-PPP_CB_BOILERPLATE(on_setaudit_addr_return)
-PPP_CB_BOILERPLATE(on_setauid_return)
-PPP_CB_BOILERPLATE(on_setcontext_return)
-PPP_CB_BOILERPLATE(on_setdomainname_return)
-PPP_CB_BOILERPLATE(on_setegid_return)
-PPP_CB_BOILERPLATE(on_seteuid_return)
-PPP_CB_BOILERPLATE(on_setfib_return)
-PPP_CB_BOILERPLATE(on_setgid_return)
-PPP_CB_BOILERPLATE(on_setgroups_return)
-PPP_CB_BOILERPLATE(on_sethostid_return)
-PPP_CB_BOILERPLATE(on_sethostname_return)
-PPP_CB_BOILERPLATE(on_setitimer_return)
-PPP_CB_BOILERPLATE(on_setlogin_return)
-PPP_CB_BOILERPLATE(on_setloginclass_return)
-PPP_CB_BOILERPLATE(on_setpgid_return)
-PPP_CB_BOILERPLATE(on_setpriority_return)
-PPP_CB_BOILERPLATE(on_setregid_return)
-PPP_CB_BOILERPLATE(on_setresgid_return)
-PPP_CB_BOILERPLATE(on_setresuid_return)
-PPP_CB_BOILERPLATE(on_setreuid_return)
-PPP_CB_BOILERPLATE(on_setrlimit_return)
-PPP_CB_BOILERPLATE(on_setsid_return)
-PPP_CB_BOILERPLATE(on_setsockopt_return)
-PPP_CB_BOILERPLATE(on_settimeofday_return)
-PPP_CB_BOILERPLATE(on_setuid_return)
-PPP_CB_BOILERPLATE(on_shm_open_return)
-PPP_CB_BOILERPLATE(on_shm_open2_return)
-PPP_CB_BOILERPLATE(on_shm_rename_return)
-PPP_CB_BOILERPLATE(on_shm_unlink_return)
-PPP_CB_BOILERPLATE(on_shmctl_return)
-PPP_CB_BOILERPLATE(on_shmdt_return)
-PPP_CB_BOILERPLATE(on_shmget_return)
-PPP_CB_BOILERPLATE(on_shutdown_return)
-PPP_CB_BOILERPLATE(on_sigaction_return)
-PPP_CB_BOILERPLATE(on_sigaltstack_return)
-PPP_CB_BOILERPLATE(on_sigblock_return)
-PPP_CB_BOILERPLATE(on_sigfastblock_return)
-PPP_CB_BOILERPLATE(on_sigpending_return)
-PPP_CB_BOILERPLATE(on_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sigqueue_return)
-PPP_CB_BOILERPLATE(on_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sigsetmask_return)
-PPP_CB_BOILERPLATE(on_sigstack_return)
-PPP_CB_BOILERPLATE(on_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sigtimedwait_return)
-PPP_CB_BOILERPLATE(on_sigvec_return)
-PPP_CB_BOILERPLATE(on_sigwait_return)
-PPP_CB_BOILERPLATE(on_sigwaitinfo_return)
-PPP_CB_BOILERPLATE(on_socket_return)
-PPP_CB_BOILERPLATE(on_socketpair_return)
-PPP_CB_BOILERPLATE(on_sstk_return)
-PPP_CB_BOILERPLATE(on_stat_return)
-PPP_CB_BOILERPLATE(on_statfs_return)
-PPP_CB_BOILERPLATE(on_swapcontext_return)
-PPP_CB_BOILERPLATE(on_swapoff_return)
-PPP_CB_BOILERPLATE(on_swapon_return)
-PPP_CB_BOILERPLATE(on_symlink_return)
-PPP_CB_BOILERPLATE(on_symlinkat_return)
-PPP_CB_BOILERPLATE(on_sync_return)
-PPP_CB_BOILERPLATE(on_sys_accept_return)
-PPP_CB_BOILERPLATE(on_sys_accept4_return)
-PPP_CB_BOILERPLATE(on_sys_access_return)
-PPP_CB_BOILERPLATE(on_sys_acct_return)
-PPP_CB_BOILERPLATE(on_sys_add_key_return)
-PPP_CB_BOILERPLATE(on_sys_adjtimex_return)
-PPP_CB_BOILERPLATE(on_sys_alarm_return)
-PPP_CB_BOILERPLATE(on_sys_arch_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_bind_return)
-PPP_CB_BOILERPLATE(on_sys_bpf_return)
-PPP_CB_BOILERPLATE(on_sys_brk_return)
-PPP_CB_BOILERPLATE(on_sys_capget_return)
-PPP_CB_BOILERPLATE(on_sys_capset_return)
-PPP_CB_BOILERPLATE(on_sys_chdir_return)
-PPP_CB_BOILERPLATE(on_sys_chmod_return)
-PPP_CB_BOILERPLATE(on_sys_chown_return)
-PPP_CB_BOILERPLATE(on_sys_chroot_return)
-PPP_CB_BOILERPLATE(on_sys_clock_adjtime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_getres_return)
-PPP_CB_BOILERPLATE(on_sys_clock_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_clock_settime_return)
-PPP_CB_BOILERPLATE(on_sys_clone_return)
-PPP_CB_BOILERPLATE(on_sys_close_return)
-PPP_CB_BOILERPLATE(on_sys_connect_return)
-PPP_CB_BOILERPLATE(on_sys_copy_file_range_return)
-PPP_CB_BOILERPLATE(on_sys_creat_return)
-PPP_CB_BOILERPLATE(on_sys_delete_module_return)
-PPP_CB_BOILERPLATE(on_sys_dup_return)
-PPP_CB_BOILERPLATE(on_sys_dup2_return)
-PPP_CB_BOILERPLATE(on_sys_dup3_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create1_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_ctl_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_pwait_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_wait_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd2_return)
-PPP_CB_BOILERPLATE(on_sys_execve_return)
-PPP_CB_BOILERPLATE(on_sys_execveat_return)
-PPP_CB_BOILERPLATE(on_sys_exit_return)
-PPP_CB_BOILERPLATE(on_sys_exit_group_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat_return)
-PPP_CB_BOILERPLATE(on_sys_fadvise64_return)
-PPP_CB_BOILERPLATE(on_sys_fallocate_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_mark_return)
-PPP_CB_BOILERPLATE(on_sys_fchdir_return)
-PPP_CB_BOILERPLATE(on_sys_fchmod_return)
-PPP_CB_BOILERPLATE(on_sys_fchmodat_return)
-PPP_CB_BOILERPLATE(on_sys_fchown_return)
-PPP_CB_BOILERPLATE(on_sys_fchownat_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl_return)
-PPP_CB_BOILERPLATE(on_sys_fdatasync_return)
-PPP_CB_BOILERPLATE(on_sys_fgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_finit_module_return)
-PPP_CB_BOILERPLATE(on_sys_flistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_flock_return)
-PPP_CB_BOILERPLATE(on_sys_fork_return)
-PPP_CB_BOILERPLATE(on_sys_fremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_fsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs_return)
-PPP_CB_BOILERPLATE(on_sys_fsync_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate_return)
-PPP_CB_BOILERPLATE(on_sys_futex_return)
-PPP_CB_BOILERPLATE(on_sys_futimesat_return)
-PPP_CB_BOILERPLATE(on_sys_get_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_get_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_getcpu_return)
-PPP_CB_BOILERPLATE(on_sys_getcwd_return)
-PPP_CB_BOILERPLATE(on_sys_getdents_return)
-PPP_CB_BOILERPLATE(on_sys_getdents64_return)
-PPP_CB_BOILERPLATE(on_sys_getegid_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid_return)
-PPP_CB_BOILERPLATE(on_sys_getgid_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups_return)
-PPP_CB_BOILERPLATE(on_sys_getitimer_return)
-PPP_CB_BOILERPLATE(on_sys_getpeername_return)
-PPP_CB_BOILERPLATE(on_sys_getpgid_return)
-PPP_CB_BOILERPLATE(on_sys_getpgrp_return)
-PPP_CB_BOILERPLATE(on_sys_getpid_return)
-PPP_CB_BOILERPLATE(on_sys_getppid_return)
-PPP_CB_BOILERPLATE(on_sys_getpriority_return)
-PPP_CB_BOILERPLATE(on_sys_getrandom_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid_return)
-PPP_CB_BOILERPLATE(on_sys_getrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_getrusage_return)
-PPP_CB_BOILERPLATE(on_sys_getsid_return)
-PPP_CB_BOILERPLATE(on_sys_getsockname_return)
-PPP_CB_BOILERPLATE(on_sys_getsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_gettid_return)
-PPP_CB_BOILERPLATE(on_sys_gettimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_getuid_return)
-PPP_CB_BOILERPLATE(on_sys_getxattr_return)
-PPP_CB_BOILERPLATE(on_sys_init_module_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_add_watch_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init1_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_rm_watch_return)
-PPP_CB_BOILERPLATE(on_sys_io_cancel_return)
-PPP_CB_BOILERPLATE(on_sys_io_destroy_return)
-PPP_CB_BOILERPLATE(on_sys_io_getevents_return)
-PPP_CB_BOILERPLATE(on_sys_io_setup_return)
-PPP_CB_BOILERPLATE(on_sys_io_submit_return)
-PPP_CB_BOILERPLATE(on_sys_ioctl_return)
-PPP_CB_BOILERPLATE(on_sys_ioperm_return)
-PPP_CB_BOILERPLATE(on_sys_iopl_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_get_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_set_return)
-PPP_CB_BOILERPLATE(on_sys_kcmp_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_file_load_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_load_return)
-PPP_CB_BOILERPLATE(on_sys_keyctl_return)
-PPP_CB_BOILERPLATE(on_sys_kill_return)
-PPP_CB_BOILERPLATE(on_sys_lchown_return)
-PPP_CB_BOILERPLATE(on_sys_lgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_link_return)
-PPP_CB_BOILERPLATE(on_sys_linkat_return)
-PPP_CB_BOILERPLATE(on_sys_listen_return)
-PPP_CB_BOILERPLATE(on_sys_listxattr_return)
-PPP_CB_BOILERPLATE(on_sys_llistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_lookup_dcookie_return)
-PPP_CB_BOILERPLATE(on_sys_lremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_lseek_return)
-PPP_CB_BOILERPLATE(on_sys_lsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_madvise_return)
-PPP_CB_BOILERPLATE(on_sys_mbind_return)
-PPP_CB_BOILERPLATE(on_sys_membarrier_return)
-PPP_CB_BOILERPLATE(on_sys_memfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_migrate_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mincore_return)
-PPP_CB_BOILERPLATE(on_sys_mkdir_return)
-PPP_CB_BOILERPLATE(on_sys_mkdirat_return)
-PPP_CB_BOILERPLATE(on_sys_mknod_return)
-PPP_CB_BOILERPLATE(on_sys_mknodat_return)
-PPP_CB_BOILERPLATE(on_sys_mlock_return)
-PPP_CB_BOILERPLATE(on_sys_mlock2_return)
-PPP_CB_BOILERPLATE(on_sys_mlockall_return)
-PPP_CB_BOILERPLATE(on_sys_mmap_return)
-PPP_CB_BOILERPLATE(on_sys_modify_ldt_return)
-PPP_CB_BOILERPLATE(on_sys_mount_return)
-PPP_CB_BOILERPLATE(on_sys_move_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_mq_getsetattr_return)
-PPP_CB_BOILERPLATE(on_sys_mq_notify_return)
-PPP_CB_BOILERPLATE(on_sys_mq_open_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedreceive_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedsend_return)
-PPP_CB_BOILERPLATE(on_sys_mq_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_mremap_return)
-PPP_CB_BOILERPLATE(on_sys_msgctl_return)
-PPP_CB_BOILERPLATE(on_sys_msgget_return)
-PPP_CB_BOILERPLATE(on_sys_msgrcv_return)
-PPP_CB_BOILERPLATE(on_sys_msgsnd_return)
-PPP_CB_BOILERPLATE(on_sys_msync_return)
-PPP_CB_BOILERPLATE(on_sys_munlock_return)
-PPP_CB_BOILERPLATE(on_sys_munlockall_return)
-PPP_CB_BOILERPLATE(on_sys_munmap_return)
-PPP_CB_BOILERPLATE(on_sys_name_to_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_newfstat_return)
-PPP_CB_BOILERPLATE(on_sys_newfstatat_return)
-PPP_CB_BOILERPLATE(on_sys_newlstat_return)
-PPP_CB_BOILERPLATE(on_sys_newstat_return)
-PPP_CB_BOILERPLATE(on_sys_newuname_return)
-PPP_CB_BOILERPLATE(on_sys_open_return)
-PPP_CB_BOILERPLATE(on_sys_open_by_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_openat_return)
-PPP_CB_BOILERPLATE(on_sys_pause_return)
-PPP_CB_BOILERPLATE(on_sys_perf_event_open_return)
-PPP_CB_BOILERPLATE(on_sys_personality_return)
-PPP_CB_BOILERPLATE(on_sys_pipe_return)
-PPP_CB_BOILERPLATE(on_sys_pipe2_return)
-PPP_CB_BOILERPLATE(on_sys_pivot_root_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_alloc_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_free_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_poll_return)
-PPP_CB_BOILERPLATE(on_sys_ppoll_return)
-PPP_CB_BOILERPLATE(on_sys_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_pread64_return)
-PPP_CB_BOILERPLATE(on_sys_preadv_return)
-PPP_CB_BOILERPLATE(on_sys_preadv2_return)
-PPP_CB_BOILERPLATE(on_sys_prlimit64_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_readv_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_writev_return)
-PPP_CB_BOILERPLATE(on_sys_pselect6_return)
-PPP_CB_BOILERPLATE(on_sys_ptrace_return)
-PPP_CB_BOILERPLATE(on_sys_pwrite64_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev2_return)
-PPP_CB_BOILERPLATE(on_sys_quotactl_return)
-PPP_CB_BOILERPLATE(on_sys_read_return)
-PPP_CB_BOILERPLATE(on_sys_readahead_return)
-PPP_CB_BOILERPLATE(on_sys_readlink_return)
-PPP_CB_BOILERPLATE(on_sys_readlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_readv_return)
-PPP_CB_BOILERPLATE(on_sys_reboot_return)
-PPP_CB_BOILERPLATE(on_sys_recvfrom_return)
-PPP_CB_BOILERPLATE(on_sys_recvmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_recvmsg_return)
-PPP_CB_BOILERPLATE(on_sys_remap_file_pages_return)
-PPP_CB_BOILERPLATE(on_sys_removexattr_return)
-PPP_CB_BOILERPLATE(on_sys_rename_return)
-PPP_CB_BOILERPLATE(on_sys_renameat_return)
-PPP_CB_BOILERPLATE(on_sys_renameat2_return)
-PPP_CB_BOILERPLATE(on_sys_request_key_return)
-PPP_CB_BOILERPLATE(on_sys_restart_syscall_return)
-PPP_CB_BOILERPLATE(on_sys_rmdir_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigtimedwait_return)
-PPP_CB_BOILERPLATE(on_sys_rt_tgsigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_max_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_min_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_rr_get_interval_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_yield_return)
-PPP_CB_BOILERPLATE(on_sys_seccomp_return)
-PPP_CB_BOILERPLATE(on_sys_select_return)
-PPP_CB_BOILERPLATE(on_sys_semctl_return)
-PPP_CB_BOILERPLATE(on_sys_semget_return)
-PPP_CB_BOILERPLATE(on_sys_semop_return)
-PPP_CB_BOILERPLATE(on_sys_semtimedop_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile64_return)
-PPP_CB_BOILERPLATE(on_sys_sendmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendto_return)
-PPP_CB_BOILERPLATE(on_sys_set_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_set_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_set_tid_address_return)
-PPP_CB_BOILERPLATE(on_sys_setdomainname_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid_return)
-PPP_CB_BOILERPLATE(on_sys_setgid_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups_return)
-PPP_CB_BOILERPLATE(on_sys_sethostname_return)
-PPP_CB_BOILERPLATE(on_sys_setitimer_return)
-PPP_CB_BOILERPLATE(on_sys_setns_return)
-PPP_CB_BOILERPLATE(on_sys_setpgid_return)
-PPP_CB_BOILERPLATE(on_sys_setpriority_return)
-PPP_CB_BOILERPLATE(on_sys_setregid_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid_return)
-PPP_CB_BOILERPLATE(on_sys_setrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_setsid_return)
-PPP_CB_BOILERPLATE(on_sys_setsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_settimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_setuid_return)
-PPP_CB_BOILERPLATE(on_sys_setxattr_return)
-PPP_CB_BOILERPLATE(on_sys_shmat_return)
-PPP_CB_BOILERPLATE(on_sys_shmctl_return)
-PPP_CB_BOILERPLATE(on_sys_shmdt_return)
-PPP_CB_BOILERPLATE(on_sys_shmget_return)
-PPP_CB_BOILERPLATE(on_sys_shutdown_return)
-PPP_CB_BOILERPLATE(on_sys_sigaltstack_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd4_return)
-PPP_CB_BOILERPLATE(on_sys_socket_return)
-PPP_CB_BOILERPLATE(on_sys_socketpair_return)
-PPP_CB_BOILERPLATE(on_sys_splice_return)
-PPP_CB_BOILERPLATE(on_sys_statfs_return)
-PPP_CB_BOILERPLATE(on_sys_statx_return)
-PPP_CB_BOILERPLATE(on_sys_swapoff_return)
-PPP_CB_BOILERPLATE(on_sys_swapon_return)
-PPP_CB_BOILERPLATE(on_sys_symlink_return)
-PPP_CB_BOILERPLATE(on_sys_symlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_sync_return)
-PPP_CB_BOILERPLATE(on_sys_sync_file_range_return)
-PPP_CB_BOILERPLATE(on_sys_syncfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysctl_return)
-PPP_CB_BOILERPLATE(on_sys_sysfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysinfo_return)
-PPP_CB_BOILERPLATE(on_sys_syslog_return)
-PPP_CB_BOILERPLATE(on_sys_tee_return)
-PPP_CB_BOILERPLATE(on_sys_tgkill_return)
-PPP_CB_BOILERPLATE(on_sys_time_return)
-PPP_CB_BOILERPLATE(on_sys_timer_create_return)
-PPP_CB_BOILERPLATE(on_sys_timer_delete_return)
-PPP_CB_BOILERPLATE(on_sys_timer_getoverrun_return)
-PPP_CB_BOILERPLATE(on_sys_timer_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timer_settime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_settime_return)
-PPP_CB_BOILERPLATE(on_sys_times_return)
-PPP_CB_BOILERPLATE(on_sys_tkill_return)
-PPP_CB_BOILERPLATE(on_sys_truncate_return)
-PPP_CB_BOILERPLATE(on_sys_umask_return)
-PPP_CB_BOILERPLATE(on_sys_umount_return)
-PPP_CB_BOILERPLATE(on_sys_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_unlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_unshare_return)
-PPP_CB_BOILERPLATE(on_sys_userfaultfd_return)
-PPP_CB_BOILERPLATE(on_sys_ustat_return)
-PPP_CB_BOILERPLATE(on_sys_utime_return)
-PPP_CB_BOILERPLATE(on_sys_utimensat_return)
-PPP_CB_BOILERPLATE(on_sys_utimes_return)
-PPP_CB_BOILERPLATE(on_sys_vfork_return)
-PPP_CB_BOILERPLATE(on_sys_vhangup_return)
-PPP_CB_BOILERPLATE(on_sys_vmsplice_return)
-PPP_CB_BOILERPLATE(on_sys_wait4_return)
-PPP_CB_BOILERPLATE(on_sys_waitid_return)
-PPP_CB_BOILERPLATE(on_sys_write_return)
-PPP_CB_BOILERPLATE(on_sys_writev_return)
-PPP_CB_BOILERPLATE(on_sysarch_return)
-PPP_CB_BOILERPLATE(on_thr_create_return)
-PPP_CB_BOILERPLATE(on_thr_exit_return)
-PPP_CB_BOILERPLATE(on_thr_kill_return)
-PPP_CB_BOILERPLATE(on_thr_kill2_return)
-PPP_CB_BOILERPLATE(on_thr_new_return)
-PPP_CB_BOILERPLATE(on_thr_self_return)
-PPP_CB_BOILERPLATE(on_thr_set_name_return)
-PPP_CB_BOILERPLATE(on_thr_suspend_return)
-PPP_CB_BOILERPLATE(on_thr_wake_return)
-PPP_CB_BOILERPLATE(on_truncate_return)
-PPP_CB_BOILERPLATE(on_umask_return)
-PPP_CB_BOILERPLATE(on_uname_return)
-PPP_CB_BOILERPLATE(on_undelete_return)
-PPP_CB_BOILERPLATE(on_unlink_return)
-PPP_CB_BOILERPLATE(on_unlinkat_return)
-PPP_CB_BOILERPLATE(on_unmount_return)
-PPP_CB_BOILERPLATE(on_utimensat_return)
-PPP_CB_BOILERPLATE(on_utimes_return)
-PPP_CB_BOILERPLATE(on_utrace_return)
-PPP_CB_BOILERPLATE(on_uuidgen_return)
-PPP_CB_BOILERPLATE(on_vadvise_return)
-PPP_CB_BOILERPLATE(on_vfork_return)
-PPP_CB_BOILERPLATE(on_wait_return)
-PPP_CB_BOILERPLATE(on_wait4_return)
-PPP_CB_BOILERPLATE(on_wait6_return)
-PPP_CB_BOILERPLATE(on_write_return)
-PPP_CB_BOILERPLATE(on_writev_return)
-PPP_CB_BOILERPLATE(on_yield_return)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_aclcheck_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_aclcheck_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_aclcheck_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_delete_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_delete_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_delete_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_get_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_get_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_get_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_set_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_set_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___acl_set_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___cap_rights_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___getcwd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_execve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_get_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_get_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_get_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_get_pid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_get_proc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_set_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_set_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_set_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___mac_set_proc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___realpathat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___semctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___setugid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___sysctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on___sysctlbyname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on__umtx_op_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_abort2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_accept_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_accept4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_access_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_acct_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_adjtime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_afs3_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_cancel_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_error_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_fsync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_mlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_read_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_return_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_suspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_waitcomplete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_aio_write_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_audit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_auditctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_auditon_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_bind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_bindat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cap_enter_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cap_fcntls_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cap_fcntls_limit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cap_getmode_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cap_ioctls_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cap_ioctls_limit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cap_rights_limit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_chdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_chflags_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_chflagsat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_chmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_chown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_chroot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_clock_getcpuclockid2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_clock_getres_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_clock_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_clock_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_clock_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_close_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_close_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_closefrom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_connect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_connectat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_copy_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cpuset_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cpuset_getaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cpuset_getdomain_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cpuset_getid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cpuset_setaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cpuset_setdomain_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_cpuset_setid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_creat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_dup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_dup2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_eaccess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_execve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_delete_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_delete_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_delete_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_get_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_get_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_get_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_list_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_list_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_list_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_set_fd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_set_file_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattr_set_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_extattrctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_faccessat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fchdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fchflags_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fchmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fchmodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fchownat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fcntl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fdatasync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fexecve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ffclock_getcounter_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ffclock_getestimate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ffclock_setestimate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fhlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fhlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fhopen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fhreadlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fhstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fhstatfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_flock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fpathconf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fstatat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fstatfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_fsync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ftruncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_funlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_futimens_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_futimes_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_futimesat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getaudit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getaudit_addr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getauid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getcontext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getdents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getdirentries_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getdomainname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getdtablesize_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getegid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_geteuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getfh_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getfhat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getfsstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_gethostid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_gethostname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getkerninfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getlogin_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getloginclass_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getpagesize_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getpeername_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getpgrp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getppid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getrandom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getrusage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getsockname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_gettimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_getuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_gssd_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ioctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_issetugid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_jail_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_jail_attach_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_jail_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_jail_remove_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_jail_set_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kenv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kevent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_killpg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kldfind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kldfirstmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kldload_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kldnext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kldstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kldsym_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kldunload_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kldunloadf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kmq_notify_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kmq_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kmq_setattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kmq_timedreceive_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kmq_timedsend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kmq_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_kqueue_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_close_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_destroy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_getvalue_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_post_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_timedwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_trywait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ksem_wait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ktimer_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ktimer_delete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ktimer_getoverrun_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ktimer_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ktimer_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ktrace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lchflags_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lchmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lgetfh_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_linkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lio_listio_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_listen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lpathconf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_lutimes_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mac_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_madvise_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mincore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_minherit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mkdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mkdirat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mkfifo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mkfifoat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mknod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mknodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_modfind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_modfnext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_modnext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_modstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_msgctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_msgget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_msgrcv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_msgsnd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_msync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_munlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_munmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nfssvc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nfstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nlm_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nlstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nmount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nnpfs_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nosys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_nstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ntp_adjtime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ntp_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_openat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pathconf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pdfork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pdgetpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pdkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pipe_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pipe2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_poll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_posix_fadvise_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_posix_fallocate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_posix_openpt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ppoll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_preadv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_procctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_profil_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pselect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_ptrace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pwrite_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_pwritev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_quota_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_quotactl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rctl_add_rule_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rctl_get_limits_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rctl_get_racct_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rctl_get_rules_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rctl_remove_rule_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_read_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_readlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_readlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_reboot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_recv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_recvfrom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_recvmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rename_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_renameat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_revoke_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rfork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rmdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rpctls_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rtprio_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_rtprio_thread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sbrk_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sched_get_priority_max_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sched_get_priority_min_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sched_getparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sched_getscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sched_rr_get_interval_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sched_setparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sched_setscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sched_yield_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sctp_generic_recvmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sctp_generic_sendmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sctp_generic_sendmsg_iov_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sctp_peeloff_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_select_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_semget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_semop_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_semsys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_send_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sendfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sendmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sendto_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setaudit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setaudit_addr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setauid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setcontext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setdomainname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setegid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_seteuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setfib_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sethostid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sethostname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setlogin_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setloginclass_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setregid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setreuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_settimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_setuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_shm_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_shm_open2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_shm_rename_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_shm_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_shmctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_shmdt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_shmget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_shutdown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigaltstack_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigblock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigfastblock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigqueue_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigsetmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigstack_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigtimedwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigvec_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sigwaitinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_socket_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_socketpair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sstk_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_stat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_statfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_swapcontext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_swapoff_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_swapon_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_symlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_symlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_access_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_acct_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_add_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_adjtimex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_alarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_arch_prctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bpf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_brk_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capset_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chroot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_adjtime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_getres_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clone_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_close_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_connect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_copy_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_creat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_delete_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup3_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_ctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_pwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_wait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execveat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_group_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_faccessat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fadvise64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fallocate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_mark_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchownat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fcntl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fdatasync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_finit_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ftruncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futimesat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcpu_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcwd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getegid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_geteuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpeername_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgrp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getppid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrandom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrusage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_init_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_add_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_rm_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_cancel_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_destroy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_getevents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_setup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_submit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioperm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_iopl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_set_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kcmp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kexec_file_load_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kexec_load_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_keyctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_linkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_llistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lookup_dcookie_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_madvise_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mbind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_membarrier_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_memfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_migrate_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mincore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdirat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_modify_ldt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_move_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_getsetattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_notify_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedreceive_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedsend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mremap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgrcv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msgsnd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_name_to_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newfstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newfstatat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newlstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newuname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_by_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_openat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pause_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_perf_event_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_personality_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pivot_root_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_alloc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_free_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_poll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ppoll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pread64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prlimit64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_writev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pselect6_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ptrace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwrite64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_quotactl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_read_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readahead_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_reboot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvfrom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_remap_file_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_removexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rename_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_request_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_restart_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rmdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigtimedwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_tgsigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_max_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_min_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_rr_get_interval_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_yield_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_seccomp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_select_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semop_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_semtimedop_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendfile64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendto_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_tid_address_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setdomainname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sethostname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setns_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setregid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setreuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_settimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmdt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shmget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shutdown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigaltstack_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socket_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socketpair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_splice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapoff_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapon_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syncfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syslog_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tee_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tgkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_time_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_delete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_getoverrun_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_times_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_truncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unshare_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_userfaultfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ustat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimensat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimes_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vfork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vhangup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vmsplice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_wait4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_waitid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_write_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_writev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sysarch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_exit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_kill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_kill2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_new_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_self_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_set_name_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_suspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_thr_wake_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_truncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_umask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_uname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_undelete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_unlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_unmount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_utimensat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_utimes_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_utrace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_uuidgen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_vadvise_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_vfork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_wait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_wait4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_wait6_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_write_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_writev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_yield_return, syscalls_subscriptions_dirty = true)
 #endif
 #if defined(TARGET_I386) && !defined(TARGET_X86_64)
-PPP_CB_BOILERPLATE(on_NtAcceptConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheck_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckAndAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByType_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByTypeAndAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByTypeResultList_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)
-PPP_CB_BOILERPLATE(on_NtAddAtom_return)
-PPP_CB_BOILERPLATE(on_NtAddBootEntry_return)
-PPP_CB_BOILERPLATE(on_NtAddDriverEntry_return)
-PPP_CB_BOILERPLATE(on_NtAdjustGroupsToken_return)
-PPP_CB_BOILERPLATE(on_NtAdjustPrivilegesToken_return)
-PPP_CB_BOILERPLATE(on_NtAlertResumeThread_return)
-PPP_CB_BOILERPLATE(on_NtAlertThread_return)
-PPP_CB_BOILERPLATE(on_NtAllocateLocallyUniqueId_return)
-PPP_CB_BOILERPLATE(on_NtAllocateReserveObject_return)
-PPP_CB_BOILERPLATE(on_NtAllocateUserPhysicalPages_return)
-PPP_CB_BOILERPLATE(on_NtAllocateUuids_return)
-PPP_CB_BOILERPLATE(on_NtAllocateVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtAlpcAcceptConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCancelMessage_return)
-PPP_CB_BOILERPLATE(on_NtAlpcConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreatePort_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreatePortSection_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreateResourceReserve_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreateSectionView_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreateSecurityContext_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDeletePortSection_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDeleteResourceReserve_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDeleteSectionView_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDeleteSecurityContext_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDisconnectPort_return)
-PPP_CB_BOILERPLATE(on_NtAlpcImpersonateClientOfPort_return)
-PPP_CB_BOILERPLATE(on_NtAlpcOpenSenderProcess_return)
-PPP_CB_BOILERPLATE(on_NtAlpcOpenSenderThread_return)
-PPP_CB_BOILERPLATE(on_NtAlpcQueryInformation_return)
-PPP_CB_BOILERPLATE(on_NtAlpcQueryInformationMessage_return)
-PPP_CB_BOILERPLATE(on_NtAlpcRevokeSecurityContext_return)
-PPP_CB_BOILERPLATE(on_NtAlpcSendWaitReceivePort_return)
-PPP_CB_BOILERPLATE(on_NtAlpcSetInformation_return)
-PPP_CB_BOILERPLATE(on_NtApphelpCacheControl_return)
-PPP_CB_BOILERPLATE(on_NtAreMappedFilesTheSame_return)
-PPP_CB_BOILERPLATE(on_NtAssignProcessToJobObject_return)
-PPP_CB_BOILERPLATE(on_NtCallbackReturn_return)
-PPP_CB_BOILERPLATE(on_NtCancelIoFile_return)
-PPP_CB_BOILERPLATE(on_NtCancelIoFileEx_return)
-PPP_CB_BOILERPLATE(on_NtCancelSynchronousIoFile_return)
-PPP_CB_BOILERPLATE(on_NtCancelTimer_return)
-PPP_CB_BOILERPLATE(on_NtClearEvent_return)
-PPP_CB_BOILERPLATE(on_NtClose_return)
-PPP_CB_BOILERPLATE(on_NtCloseObjectAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtCommitComplete_return)
-PPP_CB_BOILERPLATE(on_NtCommitEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtCommitTransaction_return)
-PPP_CB_BOILERPLATE(on_NtCompactKeys_return)
-PPP_CB_BOILERPLATE(on_NtCompareTokens_return)
-PPP_CB_BOILERPLATE(on_NtCompleteConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtCompressKey_return)
-PPP_CB_BOILERPLATE(on_NtConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtContinue_return)
-PPP_CB_BOILERPLATE(on_NtCreateDebugObject_return)
-PPP_CB_BOILERPLATE(on_NtCreateDirectoryObject_return)
-PPP_CB_BOILERPLATE(on_NtCreateEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtCreateEvent_return)
-PPP_CB_BOILERPLATE(on_NtCreateEventPair_return)
-PPP_CB_BOILERPLATE(on_NtCreateFile_return)
-PPP_CB_BOILERPLATE(on_NtCreateIoCompletion_return)
-PPP_CB_BOILERPLATE(on_NtCreateJobObject_return)
-PPP_CB_BOILERPLATE(on_NtCreateJobSet_return)
-PPP_CB_BOILERPLATE(on_NtCreateKey_return)
-PPP_CB_BOILERPLATE(on_NtCreateKeyedEvent_return)
-PPP_CB_BOILERPLATE(on_NtCreateKeyTransacted_return)
-PPP_CB_BOILERPLATE(on_NtCreateMailslotFile_return)
-PPP_CB_BOILERPLATE(on_NtCreateMutant_return)
-PPP_CB_BOILERPLATE(on_NtCreateNamedPipeFile_return)
-PPP_CB_BOILERPLATE(on_NtCreatePagingFile_return)
-PPP_CB_BOILERPLATE(on_NtCreatePort_return)
-PPP_CB_BOILERPLATE(on_NtCreatePrivateNamespace_return)
-PPP_CB_BOILERPLATE(on_NtCreateProcess_return)
-PPP_CB_BOILERPLATE(on_NtCreateProcessEx_return)
-PPP_CB_BOILERPLATE(on_NtCreateProfile_return)
-PPP_CB_BOILERPLATE(on_NtCreateProfileEx_return)
-PPP_CB_BOILERPLATE(on_NtCreateResourceManager_return)
-PPP_CB_BOILERPLATE(on_NtCreateSection_return)
-PPP_CB_BOILERPLATE(on_NtCreateSemaphore_return)
-PPP_CB_BOILERPLATE(on_NtCreateSymbolicLinkObject_return)
-PPP_CB_BOILERPLATE(on_NtCreateThread_return)
-PPP_CB_BOILERPLATE(on_NtCreateThreadEx_return)
-PPP_CB_BOILERPLATE(on_NtCreateTimer_return)
-PPP_CB_BOILERPLATE(on_NtCreateToken_return)
-PPP_CB_BOILERPLATE(on_NtCreateTransaction_return)
-PPP_CB_BOILERPLATE(on_NtCreateTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtCreateUserProcess_return)
-PPP_CB_BOILERPLATE(on_NtCreateWaitablePort_return)
-PPP_CB_BOILERPLATE(on_NtCreateWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtDebugActiveProcess_return)
-PPP_CB_BOILERPLATE(on_NtDebugContinue_return)
-PPP_CB_BOILERPLATE(on_NtDelayExecution_return)
-PPP_CB_BOILERPLATE(on_NtDeleteAtom_return)
-PPP_CB_BOILERPLATE(on_NtDeleteBootEntry_return)
-PPP_CB_BOILERPLATE(on_NtDeleteDriverEntry_return)
-PPP_CB_BOILERPLATE(on_NtDeleteFile_return)
-PPP_CB_BOILERPLATE(on_NtDeleteKey_return)
-PPP_CB_BOILERPLATE(on_NtDeleteObjectAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtDeletePrivateNamespace_return)
-PPP_CB_BOILERPLATE(on_NtDeleteValueKey_return)
-PPP_CB_BOILERPLATE(on_NtDeviceIoControlFile_return)
-PPP_CB_BOILERPLATE(on_NtDisableLastKnownGood_return)
-PPP_CB_BOILERPLATE(on_NtDisplayString_return)
-PPP_CB_BOILERPLATE(on_NtDrawText_return)
-PPP_CB_BOILERPLATE(on_NtDuplicateObject_return)
-PPP_CB_BOILERPLATE(on_NtDuplicateToken_return)
-PPP_CB_BOILERPLATE(on_NtEnableLastKnownGood_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateBootEntries_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateDriverEntries_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateKey_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateSystemEnvironmentValuesEx_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateTransactionObject_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateValueKey_return)
-PPP_CB_BOILERPLATE(on_NtExtendSection_return)
-PPP_CB_BOILERPLATE(on_NtFilterToken_return)
-PPP_CB_BOILERPLATE(on_NtFindAtom_return)
-PPP_CB_BOILERPLATE(on_NtFlushBuffersFile_return)
-PPP_CB_BOILERPLATE(on_NtFlushInstallUILanguage_return)
-PPP_CB_BOILERPLATE(on_NtFlushInstructionCache_return)
-PPP_CB_BOILERPLATE(on_NtFlushKey_return)
-PPP_CB_BOILERPLATE(on_NtFlushProcessWriteBuffers_return)
-PPP_CB_BOILERPLATE(on_NtFlushVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtFlushWriteBuffer_return)
-PPP_CB_BOILERPLATE(on_NtFreeUserPhysicalPages_return)
-PPP_CB_BOILERPLATE(on_NtFreeVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtFreezeRegistry_return)
-PPP_CB_BOILERPLATE(on_NtFreezeTransactions_return)
-PPP_CB_BOILERPLATE(on_NtFsControlFile_return)
-PPP_CB_BOILERPLATE(on_NtGetContextThread_return)
-PPP_CB_BOILERPLATE(on_NtGetCurrentProcessorNumber_return)
-PPP_CB_BOILERPLATE(on_NtGetDevicePowerState_return)
-PPP_CB_BOILERPLATE(on_NtGetMUIRegistryInfo_return)
-PPP_CB_BOILERPLATE(on_NtGetNextProcess_return)
-PPP_CB_BOILERPLATE(on_NtGetNextThread_return)
-PPP_CB_BOILERPLATE(on_NtGetNlsSectionPtr_return)
-PPP_CB_BOILERPLATE(on_NtGetNotificationResourceManager_return)
-PPP_CB_BOILERPLATE(on_NtGetPlugPlayEvent_return)
-PPP_CB_BOILERPLATE(on_NtGetWriteWatch_return)
-PPP_CB_BOILERPLATE(on_NtImpersonateAnonymousToken_return)
-PPP_CB_BOILERPLATE(on_NtImpersonateClientOfPort_return)
-PPP_CB_BOILERPLATE(on_NtImpersonateThread_return)
-PPP_CB_BOILERPLATE(on_NtInitializeNlsFiles_return)
-PPP_CB_BOILERPLATE(on_NtInitializeRegistry_return)
-PPP_CB_BOILERPLATE(on_NtInitiatePowerAction_return)
-PPP_CB_BOILERPLATE(on_NtIsProcessInJob_return)
-PPP_CB_BOILERPLATE(on_NtIsSystemResumeAutomatic_return)
-PPP_CB_BOILERPLATE(on_NtIsUILanguageComitted_return)
-PPP_CB_BOILERPLATE(on_NtListenPort_return)
-PPP_CB_BOILERPLATE(on_NtLoadDriver_return)
-PPP_CB_BOILERPLATE(on_NtLoadKey_return)
-PPP_CB_BOILERPLATE(on_NtLoadKey2_return)
-PPP_CB_BOILERPLATE(on_NtLoadKeyEx_return)
-PPP_CB_BOILERPLATE(on_NtLockFile_return)
-PPP_CB_BOILERPLATE(on_NtLockProductActivationKeys_return)
-PPP_CB_BOILERPLATE(on_NtLockRegistryKey_return)
-PPP_CB_BOILERPLATE(on_NtLockVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtMakePermanentObject_return)
-PPP_CB_BOILERPLATE(on_NtMakeTemporaryObject_return)
-PPP_CB_BOILERPLATE(on_NtMapCMFModule_return)
-PPP_CB_BOILERPLATE(on_NtMapUserPhysicalPages_return)
-PPP_CB_BOILERPLATE(on_NtMapUserPhysicalPagesScatter_return)
-PPP_CB_BOILERPLATE(on_NtMapViewOfSection_return)
-PPP_CB_BOILERPLATE(on_NtModifyBootEntry_return)
-PPP_CB_BOILERPLATE(on_NtModifyDriverEntry_return)
-PPP_CB_BOILERPLATE(on_NtNotifyChangeDirectoryFile_return)
-PPP_CB_BOILERPLATE(on_NtNotifyChangeKey_return)
-PPP_CB_BOILERPLATE(on_NtNotifyChangeMultipleKeys_return)
-PPP_CB_BOILERPLATE(on_NtNotifyChangeSession_return)
-PPP_CB_BOILERPLATE(on_NtOpenDirectoryObject_return)
-PPP_CB_BOILERPLATE(on_NtOpenEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtOpenEvent_return)
-PPP_CB_BOILERPLATE(on_NtOpenEventPair_return)
-PPP_CB_BOILERPLATE(on_NtOpenFile_return)
-PPP_CB_BOILERPLATE(on_NtOpenIoCompletion_return)
-PPP_CB_BOILERPLATE(on_NtOpenJobObject_return)
-PPP_CB_BOILERPLATE(on_NtOpenKey_return)
-PPP_CB_BOILERPLATE(on_NtOpenKeyedEvent_return)
-PPP_CB_BOILERPLATE(on_NtOpenKeyEx_return)
-PPP_CB_BOILERPLATE(on_NtOpenKeyTransacted_return)
-PPP_CB_BOILERPLATE(on_NtOpenKeyTransactedEx_return)
-PPP_CB_BOILERPLATE(on_NtOpenMutant_return)
-PPP_CB_BOILERPLATE(on_NtOpenObjectAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtOpenPrivateNamespace_return)
-PPP_CB_BOILERPLATE(on_NtOpenProcess_return)
-PPP_CB_BOILERPLATE(on_NtOpenProcessToken_return)
-PPP_CB_BOILERPLATE(on_NtOpenProcessTokenEx_return)
-PPP_CB_BOILERPLATE(on_NtOpenResourceManager_return)
-PPP_CB_BOILERPLATE(on_NtOpenSection_return)
-PPP_CB_BOILERPLATE(on_NtOpenSemaphore_return)
-PPP_CB_BOILERPLATE(on_NtOpenSession_return)
-PPP_CB_BOILERPLATE(on_NtOpenSymbolicLinkObject_return)
-PPP_CB_BOILERPLATE(on_NtOpenThread_return)
-PPP_CB_BOILERPLATE(on_NtOpenThreadToken_return)
-PPP_CB_BOILERPLATE(on_NtOpenThreadTokenEx_return)
-PPP_CB_BOILERPLATE(on_NtOpenTimer_return)
-PPP_CB_BOILERPLATE(on_NtOpenTransaction_return)
-PPP_CB_BOILERPLATE(on_NtOpenTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtPlugPlayControl_return)
-PPP_CB_BOILERPLATE(on_NtPowerInformation_return)
-PPP_CB_BOILERPLATE(on_NtPrepareComplete_return)
-PPP_CB_BOILERPLATE(on_NtPrepareEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtPrePrepareComplete_return)
-PPP_CB_BOILERPLATE(on_NtPrePrepareEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtPrivilegeCheck_return)
-PPP_CB_BOILERPLATE(on_NtPrivilegedServiceAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtPrivilegeObjectAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtPropagationComplete_return)
-PPP_CB_BOILERPLATE(on_NtPropagationFailed_return)
-PPP_CB_BOILERPLATE(on_NtProtectVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtPulseEvent_return)
-PPP_CB_BOILERPLATE(on_NtQueryAttributesFile_return)
-PPP_CB_BOILERPLATE(on_NtQueryBootEntryOrder_return)
-PPP_CB_BOILERPLATE(on_NtQueryBootOptions_return)
-PPP_CB_BOILERPLATE(on_NtQueryDebugFilterState_return)
-PPP_CB_BOILERPLATE(on_NtQueryDefaultLocale_return)
-PPP_CB_BOILERPLATE(on_NtQueryDefaultUILanguage_return)
-PPP_CB_BOILERPLATE(on_NtQueryDirectoryFile_return)
-PPP_CB_BOILERPLATE(on_NtQueryDirectoryObject_return)
-PPP_CB_BOILERPLATE(on_NtQueryDriverEntryOrder_return)
-PPP_CB_BOILERPLATE(on_NtQueryEaFile_return)
-PPP_CB_BOILERPLATE(on_NtQueryEvent_return)
-PPP_CB_BOILERPLATE(on_NtQueryFullAttributesFile_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationAtom_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationJobObject_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationPort_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationProcess_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationResourceManager_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationThread_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationToken_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationTransaction_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtQueryInstallUILanguage_return)
-PPP_CB_BOILERPLATE(on_NtQueryIntervalProfile_return)
-PPP_CB_BOILERPLATE(on_NtQueryIoCompletion_return)
-PPP_CB_BOILERPLATE(on_NtQueryKey_return)
-PPP_CB_BOILERPLATE(on_NtQueryLicenseValue_return)
-PPP_CB_BOILERPLATE(on_NtQueryMultipleValueKey_return)
-PPP_CB_BOILERPLATE(on_NtQueryMutant_return)
-PPP_CB_BOILERPLATE(on_NtQueryObject_return)
-PPP_CB_BOILERPLATE(on_NtQueryOpenSubKeys_return)
-PPP_CB_BOILERPLATE(on_NtQueryOpenSubKeysEx_return)
-PPP_CB_BOILERPLATE(on_NtQueryPerformanceCounter_return)
-PPP_CB_BOILERPLATE(on_NtQueryPortInformationProcess_return)
-PPP_CB_BOILERPLATE(on_NtQueryQuotaInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtQuerySection_return)
-PPP_CB_BOILERPLATE(on_NtQuerySecurityAttributesToken_return)
-PPP_CB_BOILERPLATE(on_NtQuerySecurityObject_return)
-PPP_CB_BOILERPLATE(on_NtQuerySemaphore_return)
-PPP_CB_BOILERPLATE(on_NtQuerySymbolicLinkObject_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemEnvironmentValue_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemEnvironmentValueEx_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemInformation_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemInformationEx_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemTime_return)
-PPP_CB_BOILERPLATE(on_NtQueryTimer_return)
-PPP_CB_BOILERPLATE(on_NtQueryTimerResolution_return)
-PPP_CB_BOILERPLATE(on_NtQueryValueKey_return)
-PPP_CB_BOILERPLATE(on_NtQueryVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtQueryVolumeInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtQueueApcThread_return)
-PPP_CB_BOILERPLATE(on_NtQueueApcThreadEx_return)
-PPP_CB_BOILERPLATE(on_NtRaiseException_return)
-PPP_CB_BOILERPLATE(on_NtRaiseHardError_return)
-PPP_CB_BOILERPLATE(on_NtReadFile_return)
-PPP_CB_BOILERPLATE(on_NtReadFileScatter_return)
-PPP_CB_BOILERPLATE(on_NtReadOnlyEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtReadRequestData_return)
-PPP_CB_BOILERPLATE(on_NtReadVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtRecoverEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtRecoverResourceManager_return)
-PPP_CB_BOILERPLATE(on_NtRecoverTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtRegisterProtocolAddressInformation_return)
-PPP_CB_BOILERPLATE(on_NtRegisterThreadTerminatePort_return)
-PPP_CB_BOILERPLATE(on_NtReleaseKeyedEvent_return)
-PPP_CB_BOILERPLATE(on_NtReleaseMutant_return)
-PPP_CB_BOILERPLATE(on_NtReleaseSemaphore_return)
-PPP_CB_BOILERPLATE(on_NtReleaseWorkerFactoryWorker_return)
-PPP_CB_BOILERPLATE(on_NtRemoveIoCompletion_return)
-PPP_CB_BOILERPLATE(on_NtRemoveIoCompletionEx_return)
-PPP_CB_BOILERPLATE(on_NtRemoveProcessDebug_return)
-PPP_CB_BOILERPLATE(on_NtRenameKey_return)
-PPP_CB_BOILERPLATE(on_NtRenameTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtReplaceKey_return)
-PPP_CB_BOILERPLATE(on_NtReplacePartitionUnit_return)
-PPP_CB_BOILERPLATE(on_NtReplyPort_return)
-PPP_CB_BOILERPLATE(on_NtReplyWaitReceivePort_return)
-PPP_CB_BOILERPLATE(on_NtReplyWaitReceivePortEx_return)
-PPP_CB_BOILERPLATE(on_NtReplyWaitReplyPort_return)
-PPP_CB_BOILERPLATE(on_NtRequestPort_return)
-PPP_CB_BOILERPLATE(on_NtRequestWaitReplyPort_return)
-PPP_CB_BOILERPLATE(on_NtResetEvent_return)
-PPP_CB_BOILERPLATE(on_NtResetWriteWatch_return)
-PPP_CB_BOILERPLATE(on_NtRestoreKey_return)
-PPP_CB_BOILERPLATE(on_NtResumeProcess_return)
-PPP_CB_BOILERPLATE(on_NtResumeThread_return)
-PPP_CB_BOILERPLATE(on_NtRollbackComplete_return)
-PPP_CB_BOILERPLATE(on_NtRollbackEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtRollbackTransaction_return)
-PPP_CB_BOILERPLATE(on_NtRollforwardTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtSaveKey_return)
-PPP_CB_BOILERPLATE(on_NtSaveKeyEx_return)
-PPP_CB_BOILERPLATE(on_NtSaveMergedKeys_return)
-PPP_CB_BOILERPLATE(on_NtSecureConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtSerializeBoot_return)
-PPP_CB_BOILERPLATE(on_NtSetBootEntryOrder_return)
-PPP_CB_BOILERPLATE(on_NtSetBootOptions_return)
-PPP_CB_BOILERPLATE(on_NtSetContextThread_return)
-PPP_CB_BOILERPLATE(on_NtSetDebugFilterState_return)
-PPP_CB_BOILERPLATE(on_NtSetDefaultHardErrorPort_return)
-PPP_CB_BOILERPLATE(on_NtSetDefaultLocale_return)
-PPP_CB_BOILERPLATE(on_NtSetDefaultUILanguage_return)
-PPP_CB_BOILERPLATE(on_NtSetDriverEntryOrder_return)
-PPP_CB_BOILERPLATE(on_NtSetEaFile_return)
-PPP_CB_BOILERPLATE(on_NtSetEvent_return)
-PPP_CB_BOILERPLATE(on_NtSetEventBoostPriority_return)
-PPP_CB_BOILERPLATE(on_NtSetHighEventPair_return)
-PPP_CB_BOILERPLATE(on_NtSetHighWaitLowEventPair_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationDebugObject_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationJobObject_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationKey_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationObject_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationProcess_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationResourceManager_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationThread_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationToken_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationTransaction_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtSetIntervalProfile_return)
-PPP_CB_BOILERPLATE(on_NtSetIoCompletion_return)
-PPP_CB_BOILERPLATE(on_NtSetIoCompletionEx_return)
-PPP_CB_BOILERPLATE(on_NtSetLdtEntries_return)
-PPP_CB_BOILERPLATE(on_NtSetLowEventPair_return)
-PPP_CB_BOILERPLATE(on_NtSetLowWaitHighEventPair_return)
-PPP_CB_BOILERPLATE(on_NtSetQuotaInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtSetSecurityObject_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemEnvironmentValue_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemEnvironmentValueEx_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemInformation_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemPowerState_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemTime_return)
-PPP_CB_BOILERPLATE(on_NtSetThreadExecutionState_return)
-PPP_CB_BOILERPLATE(on_NtSetTimer_return)
-PPP_CB_BOILERPLATE(on_NtSetTimerEx_return)
-PPP_CB_BOILERPLATE(on_NtSetTimerResolution_return)
-PPP_CB_BOILERPLATE(on_NtSetUuidSeed_return)
-PPP_CB_BOILERPLATE(on_NtSetValueKey_return)
-PPP_CB_BOILERPLATE(on_NtSetVolumeInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtShutdownSystem_return)
-PPP_CB_BOILERPLATE(on_NtShutdownWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtSignalAndWaitForSingleObject_return)
-PPP_CB_BOILERPLATE(on_NtSinglePhaseReject_return)
-PPP_CB_BOILERPLATE(on_NtStartProfile_return)
-PPP_CB_BOILERPLATE(on_NtStopProfile_return)
-PPP_CB_BOILERPLATE(on_NtSuspendProcess_return)
-PPP_CB_BOILERPLATE(on_NtSuspendThread_return)
-PPP_CB_BOILERPLATE(on_NtSystemDebugControl_return)
-PPP_CB_BOILERPLATE(on_NtTerminateJobObject_return)
-PPP_CB_BOILERPLATE(on_NtTerminateProcess_return)
-PPP_CB_BOILERPLATE(on_NtTerminateThread_return)
-PPP_CB_BOILERPLATE(on_NtTestAlert_return)
-PPP_CB_BOILERPLATE(on_NtThawRegistry_return)
-PPP_CB_BOILERPLATE(on_NtThawTransactions_return)
-PPP_CB_BOILERPLATE(on_NtTraceControl_return)
-PPP_CB_BOILERPLATE(on_NtTraceEvent_return)
-PPP_CB_BOILERPLATE(on_NtTranslateFilePath_return)
-PPP_CB_BOILERPLATE(on_NtUmsThreadYield_return)
-PPP_CB_BOILERPLATE(on_NtUnloadDriver_return)
-PPP_CB_BOILERPLATE(on_NtUnloadKey_return)
-PPP_CB_BOILERPLATE(on_NtUnloadKey2_return)
-PPP_CB_BOILERPLATE(on_NtUnloadKeyEx_return)
-PPP_CB_BOILERPLATE(on_NtUnlockFile_return)
-PPP_CB_BOILERPLATE(on_NtUnlockVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtUnmapViewOfSection_return)
-PPP_CB_BOILERPLATE(on_NtVdmControl_return)
-PPP_CB_BOILERPLATE(on_NtWaitForDebugEvent_return)
-PPP_CB_BOILERPLATE(on_NtWaitForKeyedEvent_return)
-PPP_CB_BOILERPLATE(on_NtWaitForMultipleObjects_return)
-PPP_CB_BOILERPLATE(on_NtWaitForMultipleObjects32_return)
-PPP_CB_BOILERPLATE(on_NtWaitForSingleObject_return)
-PPP_CB_BOILERPLATE(on_NtWaitForWorkViaWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtWaitHighEventPair_return)
-PPP_CB_BOILERPLATE(on_NtWaitLowEventPair_return)
-PPP_CB_BOILERPLATE(on_NtWorkerFactoryWorkerReady_return)
-PPP_CB_BOILERPLATE(on_NtWriteFile_return)
-PPP_CB_BOILERPLATE(on_NtWriteFileGather_return)
-PPP_CB_BOILERPLATE(on_NtWriteRequestData_return)
-PPP_CB_BOILERPLATE(on_NtWriteVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtYieldExecution_return)
-PPP_CB_BOILERPLATE(on_sys_accept4_return)
-PPP_CB_BOILERPLATE(on_sys_access_return)
-PPP_CB_BOILERPLATE(on_sys_acct_return)
-PPP_CB_BOILERPLATE(on_sys_add_key_return)
-PPP_CB_BOILERPLATE(on_sys_adjtimex_return)
-PPP_CB_BOILERPLATE(on_sys_alarm_return)
-PPP_CB_BOILERPLATE(on_sys_arch_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_bdflush_return)
-PPP_CB_BOILERPLATE(on_sys_bind_return)
-PPP_CB_BOILERPLATE(on_sys_bpf_return)
-PPP_CB_BOILERPLATE(on_sys_brk_return)
-PPP_CB_BOILERPLATE(on_sys_capget_return)
-PPP_CB_BOILERPLATE(on_sys_capset_return)
-PPP_CB_BOILERPLATE(on_sys_chdir_return)
-PPP_CB_BOILERPLATE(on_sys_chmod_return)
-PPP_CB_BOILERPLATE(on_sys_chown_return)
-PPP_CB_BOILERPLATE(on_sys_chown16_return)
-PPP_CB_BOILERPLATE(on_sys_chroot_return)
-PPP_CB_BOILERPLATE(on_sys_clock_adjtime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_getres_return)
-PPP_CB_BOILERPLATE(on_sys_clock_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_clock_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_clock_settime_return)
-PPP_CB_BOILERPLATE(on_sys_clone_return)
-PPP_CB_BOILERPLATE(on_sys_close_return)
-PPP_CB_BOILERPLATE(on_sys_connect_return)
-PPP_CB_BOILERPLATE(on_sys_copy_file_range_return)
-PPP_CB_BOILERPLATE(on_sys_creat_return)
-PPP_CB_BOILERPLATE(on_sys_delete_module_return)
-PPP_CB_BOILERPLATE(on_sys_dup_return)
-PPP_CB_BOILERPLATE(on_sys_dup2_return)
-PPP_CB_BOILERPLATE(on_sys_dup3_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create1_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_ctl_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_pwait_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_wait_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd2_return)
-PPP_CB_BOILERPLATE(on_sys_execve_return)
-PPP_CB_BOILERPLATE(on_sys_execveat_return)
-PPP_CB_BOILERPLATE(on_sys_exit_return)
-PPP_CB_BOILERPLATE(on_sys_exit_group_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat_return)
-PPP_CB_BOILERPLATE(on_sys_fadvise64_return)
-PPP_CB_BOILERPLATE(on_sys_fadvise64_64_return)
-PPP_CB_BOILERPLATE(on_sys_fallocate_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_mark_return)
-PPP_CB_BOILERPLATE(on_sys_fchdir_return)
-PPP_CB_BOILERPLATE(on_sys_fchmod_return)
-PPP_CB_BOILERPLATE(on_sys_fchmodat_return)
-PPP_CB_BOILERPLATE(on_sys_fchown_return)
-PPP_CB_BOILERPLATE(on_sys_fchown16_return)
-PPP_CB_BOILERPLATE(on_sys_fchownat_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl64_return)
-PPP_CB_BOILERPLATE(on_sys_fdatasync_return)
-PPP_CB_BOILERPLATE(on_sys_fgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_finit_module_return)
-PPP_CB_BOILERPLATE(on_sys_flistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_flock_return)
-PPP_CB_BOILERPLATE(on_sys_fork_return)
-PPP_CB_BOILERPLATE(on_sys_fremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_fsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_fstat_return)
-PPP_CB_BOILERPLATE(on_sys_fstat64_return)
-PPP_CB_BOILERPLATE(on_sys_fstatat64_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs64_return)
-PPP_CB_BOILERPLATE(on_sys_fsync_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate64_return)
-PPP_CB_BOILERPLATE(on_sys_futex_return)
-PPP_CB_BOILERPLATE(on_sys_futimesat_return)
-PPP_CB_BOILERPLATE(on_sys_get_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_get_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_get_thread_area_return)
-PPP_CB_BOILERPLATE(on_sys_getcpu_return)
-PPP_CB_BOILERPLATE(on_sys_getcwd_return)
-PPP_CB_BOILERPLATE(on_sys_getdents_return)
-PPP_CB_BOILERPLATE(on_sys_getdents64_return)
-PPP_CB_BOILERPLATE(on_sys_getegid_return)
-PPP_CB_BOILERPLATE(on_sys_getegid16_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid16_return)
-PPP_CB_BOILERPLATE(on_sys_getgid_return)
-PPP_CB_BOILERPLATE(on_sys_getgid16_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups16_return)
-PPP_CB_BOILERPLATE(on_sys_getitimer_return)
-PPP_CB_BOILERPLATE(on_sys_getpeername_return)
-PPP_CB_BOILERPLATE(on_sys_getpgid_return)
-PPP_CB_BOILERPLATE(on_sys_getpgrp_return)
-PPP_CB_BOILERPLATE(on_sys_getpid_return)
-PPP_CB_BOILERPLATE(on_sys_getppid_return)
-PPP_CB_BOILERPLATE(on_sys_getpriority_return)
-PPP_CB_BOILERPLATE(on_sys_getrandom_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid16_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid16_return)
-PPP_CB_BOILERPLATE(on_sys_getrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_getrusage_return)
-PPP_CB_BOILERPLATE(on_sys_getsid_return)
-PPP_CB_BOILERPLATE(on_sys_getsockname_return)
-PPP_CB_BOILERPLATE(on_sys_getsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_gettid_return)
-PPP_CB_BOILERPLATE(on_sys_gettimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_getuid_return)
-PPP_CB_BOILERPLATE(on_sys_getuid16_return)
-PPP_CB_BOILERPLATE(on_sys_getxattr_return)
-PPP_CB_BOILERPLATE(on_sys_init_module_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_add_watch_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init1_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_rm_watch_return)
-PPP_CB_BOILERPLATE(on_sys_io_cancel_return)
-PPP_CB_BOILERPLATE(on_sys_io_destroy_return)
-PPP_CB_BOILERPLATE(on_sys_io_getevents_return)
-PPP_CB_BOILERPLATE(on_sys_io_setup_return)
-PPP_CB_BOILERPLATE(on_sys_io_submit_return)
-PPP_CB_BOILERPLATE(on_sys_ioctl_return)
-PPP_CB_BOILERPLATE(on_sys_ioperm_return)
-PPP_CB_BOILERPLATE(on_sys_iopl_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_get_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_set_return)
-PPP_CB_BOILERPLATE(on_sys_ipc_return)
-PPP_CB_BOILERPLATE(on_sys_kcmp_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_load_return)
-PPP_CB_BOILERPLATE(on_sys_keyctl_return)
-PPP_CB_BOILERPLATE(on_sys_kill_return)
-PPP_CB_BOILERPLATE(on_sys_lchown_return)
-PPP_CB_BOILERPLATE(on_sys_lchown16_return)
-PPP_CB_BOILERPLATE(on_sys_lgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_link_return)
-PPP_CB_BOILERPLATE(on_sys_linkat_return)
-PPP_CB_BOILERPLATE(on_sys_listen_return)
-PPP_CB_BOILERPLATE(on_sys_listxattr_return)
-PPP_CB_BOILERPLATE(on_sys_llistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_llseek_return)
-PPP_CB_BOILERPLATE(on_sys_lookup_dcookie_return)
-PPP_CB_BOILERPLATE(on_sys_lremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_lseek_return)
-PPP_CB_BOILERPLATE(on_sys_lsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_lstat_return)
-PPP_CB_BOILERPLATE(on_sys_lstat64_return)
-PPP_CB_BOILERPLATE(on_sys_madvise_return)
-PPP_CB_BOILERPLATE(on_sys_mbind_return)
-PPP_CB_BOILERPLATE(on_sys_membarrier_return)
-PPP_CB_BOILERPLATE(on_sys_memfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_migrate_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mincore_return)
-PPP_CB_BOILERPLATE(on_sys_mkdir_return)
-PPP_CB_BOILERPLATE(on_sys_mkdirat_return)
-PPP_CB_BOILERPLATE(on_sys_mknod_return)
-PPP_CB_BOILERPLATE(on_sys_mknodat_return)
-PPP_CB_BOILERPLATE(on_sys_mlock_return)
-PPP_CB_BOILERPLATE(on_sys_mlock2_return)
-PPP_CB_BOILERPLATE(on_sys_mlockall_return)
-PPP_CB_BOILERPLATE(on_sys_mmap_pgoff_return)
-PPP_CB_BOILERPLATE(on_sys_modify_ldt_return)
-PPP_CB_BOILERPLATE(on_sys_mount_return)
-PPP_CB_BOILERPLATE(on_sys_move_pages_return)
-PPP_CB_BOILERPLATE(on_sys_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_mq_getsetattr_return)
-PPP_CB_BOILERPLATE(on_sys_mq_notify_return)
-PPP_CB_BOILERPLATE(on_sys_mq_open_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedreceive_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedsend_return)
-PPP_CB_BOILERPLATE(on_sys_mq_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_mremap_return)
-PPP_CB_BOILERPLATE(on_sys_msync_return)
-PPP_CB_BOILERPLATE(on_sys_munlock_return)
-PPP_CB_BOILERPLATE(on_sys_munlockall_return)
-PPP_CB_BOILERPLATE(on_sys_munmap_return)
-PPP_CB_BOILERPLATE(on_sys_name_to_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_newfstat_return)
-PPP_CB_BOILERPLATE(on_sys_newlstat_return)
-PPP_CB_BOILERPLATE(on_sys_newstat_return)
-PPP_CB_BOILERPLATE(on_sys_newuname_return)
-PPP_CB_BOILERPLATE(on_sys_nice_return)
-PPP_CB_BOILERPLATE(on_sys_old_getrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_old_mmap_return)
-PPP_CB_BOILERPLATE(on_sys_old_readdir_return)
-PPP_CB_BOILERPLATE(on_sys_old_select_return)
-PPP_CB_BOILERPLATE(on_sys_oldumount_return)
-PPP_CB_BOILERPLATE(on_sys_olduname_return)
-PPP_CB_BOILERPLATE(on_sys_open_return)
-PPP_CB_BOILERPLATE(on_sys_open_by_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_openat_return)
-PPP_CB_BOILERPLATE(on_sys_pause_return)
-PPP_CB_BOILERPLATE(on_sys_perf_event_open_return)
-PPP_CB_BOILERPLATE(on_sys_personality_return)
-PPP_CB_BOILERPLATE(on_sys_pipe_return)
-PPP_CB_BOILERPLATE(on_sys_pipe2_return)
-PPP_CB_BOILERPLATE(on_sys_pivot_root_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_alloc_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_free_return)
-PPP_CB_BOILERPLATE(on_sys_pkey_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_poll_return)
-PPP_CB_BOILERPLATE(on_sys_ppoll_return)
-PPP_CB_BOILERPLATE(on_sys_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_pread64_return)
-PPP_CB_BOILERPLATE(on_sys_preadv_return)
-PPP_CB_BOILERPLATE(on_sys_preadv2_return)
-PPP_CB_BOILERPLATE(on_sys_prlimit64_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_readv_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_writev_return)
-PPP_CB_BOILERPLATE(on_sys_pselect6_return)
-PPP_CB_BOILERPLATE(on_sys_ptrace_return)
-PPP_CB_BOILERPLATE(on_sys_pwrite64_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev2_return)
-PPP_CB_BOILERPLATE(on_sys_quotactl_return)
-PPP_CB_BOILERPLATE(on_sys_read_return)
-PPP_CB_BOILERPLATE(on_sys_readahead_return)
-PPP_CB_BOILERPLATE(on_sys_readlink_return)
-PPP_CB_BOILERPLATE(on_sys_readlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_readv_return)
-PPP_CB_BOILERPLATE(on_sys_reboot_return)
-PPP_CB_BOILERPLATE(on_sys_recvfrom_return)
-PPP_CB_BOILERPLATE(on_sys_recvmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_recvmsg_return)
-PPP_CB_BOILERPLATE(on_sys_remap_file_pages_return)
-PPP_CB_BOILERPLATE(on_sys_removexattr_return)
-PPP_CB_BOILERPLATE(on_sys_rename_return)
-PPP_CB_BOILERPLATE(on_sys_renameat_return)
-PPP_CB_BOILERPLATE(on_sys_renameat2_return)
-PPP_CB_BOILERPLATE(on_sys_request_key_return)
-PPP_CB_BOILERPLATE(on_sys_restart_syscall_return)
-PPP_CB_BOILERPLATE(on_sys_rmdir_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigtimedwait_return)
-PPP_CB_BOILERPLATE(on_sys_rt_tgsigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_max_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_min_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_rr_get_interval_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setattr_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_sched_yield_return)
-PPP_CB_BOILERPLATE(on_sys_seccomp_return)
-PPP_CB_BOILERPLATE(on_sys_select_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile64_return)
-PPP_CB_BOILERPLATE(on_sys_sendmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sendto_return)
-PPP_CB_BOILERPLATE(on_sys_set_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_set_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_set_thread_area_return)
-PPP_CB_BOILERPLATE(on_sys_set_tid_address_return)
-PPP_CB_BOILERPLATE(on_sys_setdomainname_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid16_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setgid_return)
-PPP_CB_BOILERPLATE(on_sys_setgid16_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups16_return)
-PPP_CB_BOILERPLATE(on_sys_sethostname_return)
-PPP_CB_BOILERPLATE(on_sys_setitimer_return)
-PPP_CB_BOILERPLATE(on_sys_setns_return)
-PPP_CB_BOILERPLATE(on_sys_setpgid_return)
-PPP_CB_BOILERPLATE(on_sys_setpriority_return)
-PPP_CB_BOILERPLATE(on_sys_setregid_return)
-PPP_CB_BOILERPLATE(on_sys_setregid16_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid16_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_setsid_return)
-PPP_CB_BOILERPLATE(on_sys_setsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_settimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_setuid_return)
-PPP_CB_BOILERPLATE(on_sys_setuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setxattr_return)
-PPP_CB_BOILERPLATE(on_sys_sgetmask_return)
-PPP_CB_BOILERPLATE(on_sys_shutdown_return)
-PPP_CB_BOILERPLATE(on_sys_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_sigaltstack_return)
-PPP_CB_BOILERPLATE(on_sys_signal_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd4_return)
-PPP_CB_BOILERPLATE(on_sys_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_socket_return)
-PPP_CB_BOILERPLATE(on_sys_socketcall_return)
-PPP_CB_BOILERPLATE(on_sys_socketpair_return)
-PPP_CB_BOILERPLATE(on_sys_splice_return)
-PPP_CB_BOILERPLATE(on_sys_ssetmask_return)
-PPP_CB_BOILERPLATE(on_sys_stat_return)
-PPP_CB_BOILERPLATE(on_sys_stat64_return)
-PPP_CB_BOILERPLATE(on_sys_statfs_return)
-PPP_CB_BOILERPLATE(on_sys_statfs64_return)
-PPP_CB_BOILERPLATE(on_sys_statx_return)
-PPP_CB_BOILERPLATE(on_sys_stime_return)
-PPP_CB_BOILERPLATE(on_sys_swapoff_return)
-PPP_CB_BOILERPLATE(on_sys_swapon_return)
-PPP_CB_BOILERPLATE(on_sys_symlink_return)
-PPP_CB_BOILERPLATE(on_sys_symlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_sync_return)
-PPP_CB_BOILERPLATE(on_sys_sync_file_range_return)
-PPP_CB_BOILERPLATE(on_sys_syncfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysctl_return)
-PPP_CB_BOILERPLATE(on_sys_sysfs_return)
-PPP_CB_BOILERPLATE(on_sys_sysinfo_return)
-PPP_CB_BOILERPLATE(on_sys_syslog_return)
-PPP_CB_BOILERPLATE(on_sys_tee_return)
-PPP_CB_BOILERPLATE(on_sys_tgkill_return)
-PPP_CB_BOILERPLATE(on_sys_time_return)
-PPP_CB_BOILERPLATE(on_sys_timer_create_return)
-PPP_CB_BOILERPLATE(on_sys_timer_delete_return)
-PPP_CB_BOILERPLATE(on_sys_timer_getoverrun_return)
-PPP_CB_BOILERPLATE(on_sys_timer_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timer_settime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_settime_return)
-PPP_CB_BOILERPLATE(on_sys_times_return)
-PPP_CB_BOILERPLATE(on_sys_tkill_return)
-PPP_CB_BOILERPLATE(on_sys_truncate_return)
-PPP_CB_BOILERPLATE(on_sys_truncate64_return)
-PPP_CB_BOILERPLATE(on_sys_umask_return)
-PPP_CB_BOILERPLATE(on_sys_umount_return)
-PPP_CB_BOILERPLATE(on_sys_uname_return)
-PPP_CB_BOILERPLATE(on_sys_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_unlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_unshare_return)
-PPP_CB_BOILERPLATE(on_sys_uselib_return)
-PPP_CB_BOILERPLATE(on_sys_userfaultfd_return)
-PPP_CB_BOILERPLATE(on_sys_ustat_return)
-PPP_CB_BOILERPLATE(on_sys_utime_return)
-PPP_CB_BOILERPLATE(on_sys_utimensat_return)
-PPP_CB_BOILERPLATE(on_sys_utimes_return)
-PPP_CB_BOILERPLATE(on_sys_vfork_return)
-PPP_CB_BOILERPLATE(on_sys_vhangup_return)
-PPP_CB_BOILERPLATE(on_sys_vm86_return)
-PPP_CB_BOILERPLATE(on_sys_vm86old_return)
-PPP_CB_BOILERPLATE(on_sys_vmsplice_return)
-PPP_CB_BOILERPLATE(on_sys_wait4_return)
-PPP_CB_BOILERPLATE(on_sys_waitid_return)
-PPP_CB_BOILERPLATE(on_sys_waitpid_return)
-PPP_CB_BOILERPLATE(on_sys_write_return)
-PPP_CB_BOILERPLATE(on_sys_writev_return)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAcceptConnectPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAccessCheck_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAccessCheckAndAuditAlarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAccessCheckByType_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAccessCheckByTypeAndAuditAlarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAccessCheckByTypeResultList_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAccessCheckByTypeResultListAndAuditAlarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAddAtom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAddBootEntry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAddDriverEntry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAdjustGroupsToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAdjustPrivilegesToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlertResumeThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlertThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAllocateLocallyUniqueId_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAllocateReserveObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAllocateUserPhysicalPages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAllocateUuids_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAllocateVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcAcceptConnectPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcCancelMessage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcConnectPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcCreatePort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcCreatePortSection_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcCreateResourceReserve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcCreateSectionView_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcCreateSecurityContext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcDeletePortSection_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcDeleteResourceReserve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcDeleteSectionView_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcDeleteSecurityContext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcDisconnectPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcImpersonateClientOfPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcOpenSenderProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcOpenSenderThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcQueryInformation_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcQueryInformationMessage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcRevokeSecurityContext_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcSendWaitReceivePort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAlpcSetInformation_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtApphelpCacheControl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAreMappedFilesTheSame_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtAssignProcessToJobObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCallbackReturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCancelIoFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCancelIoFileEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCancelSynchronousIoFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCancelTimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtClearEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtClose_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCloseObjectAuditAlarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCommitComplete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCommitEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCommitTransaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCompactKeys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCompareTokens_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCompleteConnectPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCompressKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtConnectPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtContinue_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateDebugObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateDirectoryObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateEventPair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateIoCompletion_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateJobObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateJobSet_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateKeyedEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateKeyTransacted_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateMailslotFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateMutant_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateNamedPipeFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreatePagingFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreatePort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreatePrivateNamespace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateProcessEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateProfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateProfileEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateResourceManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateSection_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateSemaphore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateSymbolicLinkObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateThreadEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateTimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateTransaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateTransactionManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateUserProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateWaitablePort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtCreateWorkerFactory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDebugActiveProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDebugContinue_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDelayExecution_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeleteAtom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeleteBootEntry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeleteDriverEntry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeleteFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeleteKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeleteObjectAuditAlarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeletePrivateNamespace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeleteValueKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDeviceIoControlFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDisableLastKnownGood_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDisplayString_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDrawText_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDuplicateObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtDuplicateToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtEnableLastKnownGood_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtEnumerateBootEntries_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtEnumerateDriverEntries_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtEnumerateKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtEnumerateSystemEnvironmentValuesEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtEnumerateTransactionObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtEnumerateValueKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtExtendSection_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFilterToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFindAtom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFlushBuffersFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFlushInstallUILanguage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFlushInstructionCache_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFlushKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFlushProcessWriteBuffers_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFlushVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFlushWriteBuffer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFreeUserPhysicalPages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFreeVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFreezeRegistry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFreezeTransactions_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtFsControlFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetContextThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetCurrentProcessorNumber_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetDevicePowerState_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetMUIRegistryInfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetNextProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetNextThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetNlsSectionPtr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetNotificationResourceManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetPlugPlayEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtGetWriteWatch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtImpersonateAnonymousToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtImpersonateClientOfPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtImpersonateThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtInitializeNlsFiles_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtInitializeRegistry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtInitiatePowerAction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtIsProcessInJob_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtIsSystemResumeAutomatic_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtIsUILanguageComitted_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtListenPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtLoadDriver_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtLoadKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtLoadKey2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtLoadKeyEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtLockFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtLockProductActivationKeys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtLockRegistryKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtLockVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtMakePermanentObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtMakeTemporaryObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtMapCMFModule_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtMapUserPhysicalPages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtMapUserPhysicalPagesScatter_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtMapViewOfSection_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtModifyBootEntry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtModifyDriverEntry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtNotifyChangeDirectoryFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtNotifyChangeKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtNotifyChangeMultipleKeys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtNotifyChangeSession_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenDirectoryObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenEventPair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenIoCompletion_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenJobObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenKeyedEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenKeyEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenKeyTransacted_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenKeyTransactedEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenMutant_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenObjectAuditAlarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenPrivateNamespace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenProcessToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenProcessTokenEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenResourceManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenSection_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenSemaphore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenSession_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenSymbolicLinkObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenThreadToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenThreadTokenEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenTimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenTransaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtOpenTransactionManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPlugPlayControl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPowerInformation_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPrepareComplete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPrepareEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPrePrepareComplete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPrePrepareEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPrivilegeCheck_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPrivilegedServiceAuditAlarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPrivilegeObjectAuditAlarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPropagationComplete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPropagationFailed_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtProtectVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtPulseEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryAttributesFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryBootEntryOrder_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryBootOptions_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryDebugFilterState_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryDefaultLocale_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryDefaultUILanguage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryDirectoryFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryDirectoryObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryDriverEntryOrder_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryEaFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryFullAttributesFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationAtom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationJobObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationResourceManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationTransaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationTransactionManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInformationWorkerFactory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryInstallUILanguage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryIntervalProfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryIoCompletion_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryLicenseValue_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryMultipleValueKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryMutant_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryOpenSubKeys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryOpenSubKeysEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryPerformanceCounter_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryPortInformationProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryQuotaInformationFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySection_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySecurityAttributesToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySecurityObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySemaphore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySymbolicLinkObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySystemEnvironmentValue_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySystemEnvironmentValueEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySystemInformation_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySystemInformationEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQuerySystemTime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryTimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryTimerResolution_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryValueKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueryVolumeInformationFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueueApcThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtQueueApcThreadEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRaiseException_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRaiseHardError_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReadFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReadFileScatter_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReadOnlyEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReadRequestData_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReadVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRecoverEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRecoverResourceManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRecoverTransactionManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRegisterProtocolAddressInformation_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRegisterThreadTerminatePort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReleaseKeyedEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReleaseMutant_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReleaseSemaphore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReleaseWorkerFactoryWorker_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRemoveIoCompletion_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRemoveIoCompletionEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRemoveProcessDebug_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRenameKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRenameTransactionManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReplaceKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReplacePartitionUnit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReplyPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReplyWaitReceivePort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReplyWaitReceivePortEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtReplyWaitReplyPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRequestPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRequestWaitReplyPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtResetEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtResetWriteWatch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRestoreKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtResumeProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtResumeThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRollbackComplete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRollbackEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRollbackTransaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtRollforwardTransactionManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSaveKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSaveKeyEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSaveMergedKeys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSecureConnectPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSerializeBoot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetBootEntryOrder_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetBootOptions_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetContextThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetDebugFilterState_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetDefaultHardErrorPort_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetDefaultLocale_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetDefaultUILanguage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetDriverEntryOrder_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetEaFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetEventBoostPriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetHighEventPair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetHighWaitLowEventPair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationDebugObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationEnlistment_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationJobObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationResourceManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationToken_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationTransaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationTransactionManager_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetInformationWorkerFactory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetIntervalProfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetIoCompletion_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetIoCompletionEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetLdtEntries_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetLowEventPair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetLowWaitHighEventPair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetQuotaInformationFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetSecurityObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetSystemEnvironmentValue_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetSystemEnvironmentValueEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetSystemInformation_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetSystemPowerState_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetSystemTime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetThreadExecutionState_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetTimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetTimerEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetTimerResolution_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetUuidSeed_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetValueKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSetVolumeInformationFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtShutdownSystem_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtShutdownWorkerFactory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSignalAndWaitForSingleObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSinglePhaseReject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtStartProfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtStopProfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSuspendProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSuspendThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtSystemDebugControl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtTerminateJobObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtTerminateProcess_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtTerminateThread_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtTestAlert_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtThawRegistry_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtThawTransactions_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtTraceControl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtTraceEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtTranslateFilePath_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtUmsThreadYield_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtUnloadDriver_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtUnloadKey_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtUnloadKey2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtUnloadKeyEx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtUnlockFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtUnlockVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtUnmapViewOfSection_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtVdmControl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWaitForDebugEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWaitForKeyedEvent_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWaitForMultipleObjects_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWaitForMultipleObjects32_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWaitForSingleObject_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWaitForWorkViaWorkerFactory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWaitHighEventPair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWaitLowEventPair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWorkerFactoryWorkerReady_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWriteFile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWriteFileGather_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWriteRequestData_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtWriteVirtualMemory_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_NtYieldExecution_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_accept4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_access_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_acct_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_add_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_adjtimex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_alarm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_arch_prctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bdflush_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_bpf_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_brk_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capget_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_capset_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chown16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_chroot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_adjtime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_getres_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clock_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_clone_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_close_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_connect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_copy_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_creat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_delete_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_dup3_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_create1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_ctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_pwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_epoll_wait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_eventfd2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execve_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_execveat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_exit_group_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_faccessat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fadvise64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fadvise64_64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fallocate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fanotify_mark_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchmodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchown16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fchownat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fcntl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fcntl64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fdatasync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_finit_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_flock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fstatfs64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_fsync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ftruncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ftruncate64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futex_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_futimesat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_get_thread_area_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcpu_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getcwd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getdents64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getegid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getegid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_geteuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_geteuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getgroups16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpeername_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpgrp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getppid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrandom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getresuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getrusage_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_gettimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_getxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_init_module_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_add_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_init1_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_inotify_rm_watch_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_cancel_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_destroy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_getevents_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_setup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_io_submit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioperm_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_iopl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_get_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ioprio_set_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ipc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kcmp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kexec_load_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_keyctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_kill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lchown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lchown16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lgetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_link_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_linkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listen_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_listxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_llistxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_llseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lookup_dcookie_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lremovexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lseek_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lsetxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_lstat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_madvise_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mbind_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_membarrier_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_memfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_migrate_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mincore_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mkdirat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknod_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mknodat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlock2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mmap_pgoff_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_modify_ldt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_move_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_getsetattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_notify_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedreceive_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_timedsend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mq_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_mremap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_msync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlock_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munlockall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_munmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_name_to_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nanosleep_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newfstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newlstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newstat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_newuname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_nice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_old_getrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_old_mmap_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_old_readdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_old_select_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_oldumount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_olduname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_open_by_handle_at_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_openat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pause_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_perf_event_open_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_personality_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pipe2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pivot_root_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_alloc_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_free_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pkey_mprotect_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_poll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ppoll_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pread64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_preadv2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_prlimit64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_process_vm_writev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pselect6_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ptrace_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwrite64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_pwritev2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_quotactl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_read_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readahead_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_readv_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_reboot_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvfrom_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_recvmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_remap_file_pages_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_removexattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rename_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_renameat2_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_request_key_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_restart_syscall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rmdir_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_sigtimedwait_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_rt_tgsigqueueinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_max_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_get_priority_min_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_getscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_rr_get_interval_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setaffinity_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setparam_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_setscheduler_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sched_yield_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_seccomp_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_select_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendfile_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendfile64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendmsg_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sendto_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_mempolicy_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_robust_list_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_thread_area_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_set_tid_address_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setdomainname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setfsuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgroups_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setgroups16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sethostname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setitimer_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setns_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setpriority_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setregid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setregid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresgid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresgid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setresuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setreuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setreuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setrlimit_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setsockopt_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_settimeofday_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setuid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setuid16_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_setxattr_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sgetmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_shutdown_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigaction_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigaltstack_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signal_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_signalfd4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigpending_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigprocmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigreturn_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sigsuspend_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socket_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socketcall_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_socketpair_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_splice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ssetmask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_stat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_stat64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statfs64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_statx_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_stime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapoff_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_swapon_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_symlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sync_file_range_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syncfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysctl_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysfs_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_sysinfo_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_syslog_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tee_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tgkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_time_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_delete_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_getoverrun_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timer_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_create_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_gettime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_timerfd_settime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_times_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_tkill_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_truncate_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_truncate64_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umask_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_umount_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_uname_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlink_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unlinkat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_unshare_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_uselib_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_userfaultfd_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_ustat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utime_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimensat_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_utimes_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vfork_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vhangup_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vm86_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vm86old_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_vmsplice_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_wait4_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_waitid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_waitpid_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_write_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_sys_writev_return, syscalls_subscriptions_dirty = true)
 #endif
 
-PPP_CB_BOILERPLATE(on_unknown_sys_return)
-PPP_CB_BOILERPLATE(on_all_sys_return)
-PPP_CB_BOILERPLATE(on_all_sys_return2)
+PPP_CB_BOILERPLATE_NOTIFY(on_unknown_sys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_all_sys_return, syscalls_subscriptions_dirty = true)
+PPP_CB_BOILERPLATE_NOTIFY(on_all_sys_return2, syscalls_subscriptions_dirty = true)
 
 /* vim: set tabstop=4 softtabstop=4 noexpandtab ft=cpp: */
\ No newline at end of file
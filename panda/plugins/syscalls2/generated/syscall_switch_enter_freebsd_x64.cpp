@@ -14,6 +14,1390 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+#if defined(TARGET_X86_64)
+/**
+ * @brief SYSCALL_SUB_* bits for each system call, in switch order. The last
+ * entry is used for system calls we have no prototype for.
+ */
+static uint8_t syscall_sub_freebsd_x64[455];
+
+/**
+ * @brief Recomputes the subscription bits from the registered callbacks.
+ */
+static void syscall_sub_update_freebsd_x64(void) {
+	bool all_enter = PPP_CHECK_CB(on_all_sys_enter);
+	bool all_enter2 = PPP_CHECK_CB(on_all_sys_enter2);
+	bool all_return = PPP_CHECK_CB(on_all_sys_return);
+	bool all_return2 = PPP_CHECK_CB(on_all_sys_return2);
+	syscall_sub_freebsd_x64[0] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nosys_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nosys_return), false);
+	syscall_sub_freebsd_x64[1] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_exit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_exit_return), true);
+	syscall_sub_freebsd_x64[2] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fork_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fork_return), false);
+	syscall_sub_freebsd_x64[3] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_read_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_read_return), false);
+	syscall_sub_freebsd_x64[4] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_write_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_write_return), false);
+	syscall_sub_freebsd_x64[5] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_open_return), false);
+	syscall_sub_freebsd_x64[6] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_close_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_close_return), false);
+	syscall_sub_freebsd_x64[7] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_wait4_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_wait4_return), false);
+	syscall_sub_freebsd_x64[8] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_creat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_creat_return), false);
+	syscall_sub_freebsd_x64[9] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_link_return), false);
+	syscall_sub_freebsd_x64[10] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_unlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_unlink_return), false);
+	syscall_sub_freebsd_x64[11] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_chdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_chdir_return), false);
+	syscall_sub_freebsd_x64[12] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fchdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fchdir_return), false);
+	syscall_sub_freebsd_x64[13] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mknod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mknod_return), false);
+	syscall_sub_freebsd_x64[14] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_chmod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_chmod_return), false);
+	syscall_sub_freebsd_x64[15] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_chown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_chown_return), false);
+	syscall_sub_freebsd_x64[16] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getfsstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getfsstat_return), false);
+	syscall_sub_freebsd_x64[17] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getpid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getpid_return), false);
+	syscall_sub_freebsd_x64[18] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mount_return), false);
+	syscall_sub_freebsd_x64[19] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_unmount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_unmount_return), false);
+	syscall_sub_freebsd_x64[20] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setuid_return), false);
+	syscall_sub_freebsd_x64[21] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getuid_return), false);
+	syscall_sub_freebsd_x64[22] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_geteuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_geteuid_return), false);
+	syscall_sub_freebsd_x64[23] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ptrace_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ptrace_return), false);
+	syscall_sub_freebsd_x64[24] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_recvmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_recvmsg_return), false);
+	syscall_sub_freebsd_x64[25] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sendmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sendmsg_return), false);
+	syscall_sub_freebsd_x64[26] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_recvfrom_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_recvfrom_return), false);
+	syscall_sub_freebsd_x64[27] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_accept_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_accept_return), false);
+	syscall_sub_freebsd_x64[28] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getpeername_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getpeername_return), false);
+	syscall_sub_freebsd_x64[29] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getsockname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getsockname_return), false);
+	syscall_sub_freebsd_x64[30] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_access_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_access_return), false);
+	syscall_sub_freebsd_x64[31] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_chflags_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_chflags_return), false);
+	syscall_sub_freebsd_x64[32] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fchflags_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fchflags_return), false);
+	syscall_sub_freebsd_x64[33] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sync_return), false);
+	syscall_sub_freebsd_x64[34] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kill_return), false);
+	syscall_sub_freebsd_x64[35] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_stat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_stat_return), false);
+	syscall_sub_freebsd_x64[36] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getppid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getppid_return), false);
+	syscall_sub_freebsd_x64[37] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lstat_return), false);
+	syscall_sub_freebsd_x64[38] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_dup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_dup_return), false);
+	syscall_sub_freebsd_x64[39] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pipe_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pipe_return), false);
+	syscall_sub_freebsd_x64[40] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getegid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getegid_return), false);
+	syscall_sub_freebsd_x64[41] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_profil_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_profil_return), false);
+	syscall_sub_freebsd_x64[42] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ktrace_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ktrace_return), false);
+	syscall_sub_freebsd_x64[43] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigaction_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigaction_return), false);
+	syscall_sub_freebsd_x64[44] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getgid_return), false);
+	syscall_sub_freebsd_x64[45] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getlogin_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getlogin_return), false);
+	syscall_sub_freebsd_x64[46] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setlogin_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setlogin_return), false);
+	syscall_sub_freebsd_x64[47] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_acct_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_acct_return), false);
+	syscall_sub_freebsd_x64[48] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigaltstack_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigaltstack_return), false);
+	syscall_sub_freebsd_x64[49] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ioctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ioctl_return), false);
+	syscall_sub_freebsd_x64[50] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_reboot_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_reboot_return), false);
+	syscall_sub_freebsd_x64[51] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_revoke_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_revoke_return), false);
+	syscall_sub_freebsd_x64[52] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_symlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_symlink_return), false);
+	syscall_sub_freebsd_x64[53] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_readlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_readlink_return), false);
+	syscall_sub_freebsd_x64[54] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_execve_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_execve_return), true);
+	syscall_sub_freebsd_x64[55] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_umask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_umask_return), false);
+	syscall_sub_freebsd_x64[56] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_chroot_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_chroot_return), false);
+	syscall_sub_freebsd_x64[57] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fstat_return), false);
+	syscall_sub_freebsd_x64[58] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getkerninfo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getkerninfo_return), false);
+	syscall_sub_freebsd_x64[59] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getpagesize_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getpagesize_return), false);
+	syscall_sub_freebsd_x64[60] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_msync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_msync_return), false);
+	syscall_sub_freebsd_x64[61] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_vfork_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_vfork_return), false);
+	syscall_sub_freebsd_x64[62] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sbrk_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sbrk_return), false);
+	syscall_sub_freebsd_x64[63] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sstk_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sstk_return), false);
+	syscall_sub_freebsd_x64[64] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_vadvise_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_vadvise_return), false);
+	syscall_sub_freebsd_x64[65] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_munmap_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_munmap_return), false);
+	syscall_sub_freebsd_x64[66] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mprotect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mprotect_return), false);
+	syscall_sub_freebsd_x64[67] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_madvise_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_madvise_return), false);
+	syscall_sub_freebsd_x64[68] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mincore_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mincore_return), false);
+	syscall_sub_freebsd_x64[69] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getgroups_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getgroups_return), false);
+	syscall_sub_freebsd_x64[70] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setgroups_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setgroups_return), false);
+	syscall_sub_freebsd_x64[71] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getpgrp_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getpgrp_return), false);
+	syscall_sub_freebsd_x64[72] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setpgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setpgid_return), false);
+	syscall_sub_freebsd_x64[73] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setitimer_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setitimer_return), false);
+	syscall_sub_freebsd_x64[74] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_wait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_wait_return), false);
+	syscall_sub_freebsd_x64[75] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_swapon_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_swapon_return), false);
+	syscall_sub_freebsd_x64[76] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getitimer_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getitimer_return), false);
+	syscall_sub_freebsd_x64[77] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_gethostname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_gethostname_return), false);
+	syscall_sub_freebsd_x64[78] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sethostname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sethostname_return), false);
+	syscall_sub_freebsd_x64[79] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getdtablesize_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getdtablesize_return), false);
+	syscall_sub_freebsd_x64[80] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_dup2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_dup2_return), false);
+	syscall_sub_freebsd_x64[81] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fcntl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fcntl_return), false);
+	syscall_sub_freebsd_x64[82] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_select_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_select_return), false);
+	syscall_sub_freebsd_x64[83] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fsync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fsync_return), false);
+	syscall_sub_freebsd_x64[84] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setpriority_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setpriority_return), false);
+	syscall_sub_freebsd_x64[85] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_socket_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_socket_return), false);
+	syscall_sub_freebsd_x64[86] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_connect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_connect_return), false);
+	syscall_sub_freebsd_x64[87] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_accept_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_accept_return), false);
+	syscall_sub_freebsd_x64[88] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getpriority_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getpriority_return), false);
+	syscall_sub_freebsd_x64[89] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_send_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_send_return), false);
+	syscall_sub_freebsd_x64[90] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_recv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_recv_return), false);
+	syscall_sub_freebsd_x64[91] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigreturn_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigreturn_return), false);
+	syscall_sub_freebsd_x64[92] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_bind_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_bind_return), false);
+	syscall_sub_freebsd_x64[93] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setsockopt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setsockopt_return), false);
+	syscall_sub_freebsd_x64[94] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_listen_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_listen_return), false);
+	syscall_sub_freebsd_x64[95] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigvec_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigvec_return), false);
+	syscall_sub_freebsd_x64[96] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigblock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigblock_return), false);
+	syscall_sub_freebsd_x64[97] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigsetmask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigsetmask_return), false);
+	syscall_sub_freebsd_x64[98] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigsuspend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigsuspend_return), false);
+	syscall_sub_freebsd_x64[99] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigstack_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigstack_return), false);
+	syscall_sub_freebsd_x64[100] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_recvmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_recvmsg_return), false);
+	syscall_sub_freebsd_x64[101] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sendmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sendmsg_return), false);
+	syscall_sub_freebsd_x64[102] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_gettimeofday_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_gettimeofday_return), false);
+	syscall_sub_freebsd_x64[103] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getrusage_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getrusage_return), false);
+	syscall_sub_freebsd_x64[104] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getsockopt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getsockopt_return), false);
+	syscall_sub_freebsd_x64[105] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_readv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_readv_return), false);
+	syscall_sub_freebsd_x64[106] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_writev_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_writev_return), false);
+	syscall_sub_freebsd_x64[107] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_settimeofday_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_settimeofday_return), false);
+	syscall_sub_freebsd_x64[108] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fchown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fchown_return), false);
+	syscall_sub_freebsd_x64[109] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fchmod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fchmod_return), false);
+	syscall_sub_freebsd_x64[110] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_recvfrom_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_recvfrom_return), false);
+	syscall_sub_freebsd_x64[111] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setreuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setreuid_return), false);
+	syscall_sub_freebsd_x64[112] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setregid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setregid_return), false);
+	syscall_sub_freebsd_x64[113] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rename_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rename_return), false);
+	syscall_sub_freebsd_x64[114] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_flock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_flock_return), false);
+	syscall_sub_freebsd_x64[115] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mkfifo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mkfifo_return), false);
+	syscall_sub_freebsd_x64[116] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sendto_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sendto_return), false);
+	syscall_sub_freebsd_x64[117] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shutdown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shutdown_return), false);
+	syscall_sub_freebsd_x64[118] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_socketpair_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_socketpair_return), false);
+	syscall_sub_freebsd_x64[119] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mkdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mkdir_return), false);
+	syscall_sub_freebsd_x64[120] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rmdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rmdir_return), false);
+	syscall_sub_freebsd_x64[121] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_utimes_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_utimes_return), false);
+	syscall_sub_freebsd_x64[122] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_adjtime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_adjtime_return), false);
+	syscall_sub_freebsd_x64[123] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getpeername_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getpeername_return), false);
+	syscall_sub_freebsd_x64[124] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_gethostid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_gethostid_return), false);
+	syscall_sub_freebsd_x64[125] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sethostid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sethostid_return), false);
+	syscall_sub_freebsd_x64[126] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getrlimit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getrlimit_return), false);
+	syscall_sub_freebsd_x64[127] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setrlimit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setrlimit_return), false);
+	syscall_sub_freebsd_x64[128] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_killpg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_killpg_return), false);
+	syscall_sub_freebsd_x64[129] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setsid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setsid_return), false);
+	syscall_sub_freebsd_x64[130] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_quotactl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_quotactl_return), false);
+	syscall_sub_freebsd_x64[131] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_quota_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_quota_return), false);
+	syscall_sub_freebsd_x64[132] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getsockname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getsockname_return), false);
+	syscall_sub_freebsd_x64[133] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nlm_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nlm_syscall_return), false);
+	syscall_sub_freebsd_x64[134] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nfssvc_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nfssvc_return), false);
+	syscall_sub_freebsd_x64[135] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getdirentries_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getdirentries_return), false);
+	syscall_sub_freebsd_x64[136] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_statfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_statfs_return), false);
+	syscall_sub_freebsd_x64[137] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fstatfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fstatfs_return), false);
+	syscall_sub_freebsd_x64[138] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lgetfh_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lgetfh_return), false);
+	syscall_sub_freebsd_x64[139] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getfh_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getfh_return), false);
+	syscall_sub_freebsd_x64[140] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getdomainname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getdomainname_return), false);
+	syscall_sub_freebsd_x64[141] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setdomainname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setdomainname_return), false);
+	syscall_sub_freebsd_x64[142] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_uname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_uname_return), false);
+	syscall_sub_freebsd_x64[143] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sysarch_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sysarch_return), false);
+	syscall_sub_freebsd_x64[144] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rtprio_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rtprio_return), false);
+	syscall_sub_freebsd_x64[145] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_semsys_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_semsys_return), false);
+	syscall_sub_freebsd_x64[146] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setfib_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setfib_return), false);
+	syscall_sub_freebsd_x64[147] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ntp_adjtime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ntp_adjtime_return), false);
+	syscall_sub_freebsd_x64[148] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setgid_return), false);
+	syscall_sub_freebsd_x64[149] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setegid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setegid_return), false);
+	syscall_sub_freebsd_x64[150] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_seteuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_seteuid_return), false);
+	syscall_sub_freebsd_x64[151] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_stat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_stat_return), false);
+	syscall_sub_freebsd_x64[152] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fstat_return), false);
+	syscall_sub_freebsd_x64[153] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lstat_return), false);
+	syscall_sub_freebsd_x64[154] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pathconf_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pathconf_return), false);
+	syscall_sub_freebsd_x64[155] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fpathconf_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fpathconf_return), false);
+	syscall_sub_freebsd_x64[156] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getrlimit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getrlimit_return), false);
+	syscall_sub_freebsd_x64[157] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setrlimit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setrlimit_return), false);
+	syscall_sub_freebsd_x64[158] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getdirentries_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getdirentries_return), false);
+	syscall_sub_freebsd_x64[159] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nosys_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nosys_return), false);
+	syscall_sub_freebsd_x64[160] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___sysctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___sysctl_return), false);
+	syscall_sub_freebsd_x64[161] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mlock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mlock_return), false);
+	syscall_sub_freebsd_x64[162] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_munlock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_munlock_return), false);
+	syscall_sub_freebsd_x64[163] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_undelete_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_undelete_return), false);
+	syscall_sub_freebsd_x64[164] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_futimes_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_futimes_return), false);
+	syscall_sub_freebsd_x64[165] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getpgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getpgid_return), false);
+	syscall_sub_freebsd_x64[166] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_poll_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_poll_return), false);
+	syscall_sub_freebsd_x64[167] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___semctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___semctl_return), false);
+	syscall_sub_freebsd_x64[168] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_semget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_semget_return), false);
+	syscall_sub_freebsd_x64[169] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_semop_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_semop_return), false);
+	syscall_sub_freebsd_x64[170] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_msgctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_msgctl_return), false);
+	syscall_sub_freebsd_x64[171] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_msgget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_msgget_return), false);
+	syscall_sub_freebsd_x64[172] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_msgsnd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_msgsnd_return), false);
+	syscall_sub_freebsd_x64[173] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_msgrcv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_msgrcv_return), false);
+	syscall_sub_freebsd_x64[174] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shmctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shmctl_return), false);
+	syscall_sub_freebsd_x64[175] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shmdt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shmdt_return), false);
+	syscall_sub_freebsd_x64[176] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shmget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shmget_return), false);
+	syscall_sub_freebsd_x64[177] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_clock_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_clock_gettime_return), false);
+	syscall_sub_freebsd_x64[178] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_clock_settime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_clock_settime_return), false);
+	syscall_sub_freebsd_x64[179] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_clock_getres_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_clock_getres_return), false);
+	syscall_sub_freebsd_x64[180] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ktimer_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ktimer_create_return), false);
+	syscall_sub_freebsd_x64[181] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ktimer_delete_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ktimer_delete_return), false);
+	syscall_sub_freebsd_x64[182] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ktimer_settime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ktimer_settime_return), false);
+	syscall_sub_freebsd_x64[183] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ktimer_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ktimer_gettime_return), false);
+	syscall_sub_freebsd_x64[184] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ktimer_getoverrun_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ktimer_getoverrun_return), false);
+	syscall_sub_freebsd_x64[185] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nanosleep_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nanosleep_return), false);
+	syscall_sub_freebsd_x64[186] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ffclock_getcounter_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ffclock_getcounter_return), false);
+	syscall_sub_freebsd_x64[187] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ffclock_setestimate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ffclock_setestimate_return), false);
+	syscall_sub_freebsd_x64[188] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ffclock_getestimate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ffclock_getestimate_return), false);
+	syscall_sub_freebsd_x64[189] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_clock_nanosleep_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_clock_nanosleep_return), false);
+	syscall_sub_freebsd_x64[190] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_clock_getcpuclockid2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_clock_getcpuclockid2_return), false);
+	syscall_sub_freebsd_x64[191] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ntp_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ntp_gettime_return), false);
+	syscall_sub_freebsd_x64[192] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_minherit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_minherit_return), false);
+	syscall_sub_freebsd_x64[193] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rfork_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rfork_return), false);
+	syscall_sub_freebsd_x64[194] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_issetugid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_issetugid_return), false);
+	syscall_sub_freebsd_x64[195] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lchown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lchown_return), false);
+	syscall_sub_freebsd_x64[196] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_read_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_read_return), false);
+	syscall_sub_freebsd_x64[197] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_write_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_write_return), false);
+	syscall_sub_freebsd_x64[198] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lio_listio_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lio_listio_return), false);
+	syscall_sub_freebsd_x64[199] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getdents_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getdents_return), false);
+	syscall_sub_freebsd_x64[200] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lchmod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lchmod_return), false);
+	syscall_sub_freebsd_x64[201] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lutimes_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lutimes_return), false);
+	syscall_sub_freebsd_x64[202] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nstat_return), false);
+	syscall_sub_freebsd_x64[203] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nfstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nfstat_return), false);
+	syscall_sub_freebsd_x64[204] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nlstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nlstat_return), false);
+	syscall_sub_freebsd_x64[205] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_preadv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_preadv_return), false);
+	syscall_sub_freebsd_x64[206] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pwritev_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pwritev_return), false);
+	syscall_sub_freebsd_x64[207] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhstatfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhstatfs_return), false);
+	syscall_sub_freebsd_x64[208] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhopen_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhopen_return), false);
+	syscall_sub_freebsd_x64[209] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhstat_return), false);
+	syscall_sub_freebsd_x64[210] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_modnext_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_modnext_return), false);
+	syscall_sub_freebsd_x64[211] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_modstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_modstat_return), false);
+	syscall_sub_freebsd_x64[212] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_modfnext_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_modfnext_return), false);
+	syscall_sub_freebsd_x64[213] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_modfind_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_modfind_return), false);
+	syscall_sub_freebsd_x64[214] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kldload_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kldload_return), false);
+	syscall_sub_freebsd_x64[215] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kldunload_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kldunload_return), false);
+	syscall_sub_freebsd_x64[216] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kldfind_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kldfind_return), false);
+	syscall_sub_freebsd_x64[217] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kldnext_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kldnext_return), false);
+	syscall_sub_freebsd_x64[218] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kldstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kldstat_return), false);
+	syscall_sub_freebsd_x64[219] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kldfirstmod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kldfirstmod_return), false);
+	syscall_sub_freebsd_x64[220] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getsid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getsid_return), false);
+	syscall_sub_freebsd_x64[221] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setresuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setresuid_return), false);
+	syscall_sub_freebsd_x64[222] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setresgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setresgid_return), false);
+	syscall_sub_freebsd_x64[223] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_return_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_return_return), false);
+	syscall_sub_freebsd_x64[224] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_suspend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_suspend_return), false);
+	syscall_sub_freebsd_x64[225] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_cancel_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_cancel_return), false);
+	syscall_sub_freebsd_x64[226] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_error_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_error_return), false);
+	syscall_sub_freebsd_x64[227] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_read_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_read_return), false);
+	syscall_sub_freebsd_x64[228] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_write_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_write_return), false);
+	syscall_sub_freebsd_x64[229] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lio_listio_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lio_listio_return), false);
+	syscall_sub_freebsd_x64[230] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_yield_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_yield_return), false);
+	syscall_sub_freebsd_x64[231] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mlockall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mlockall_return), false);
+	syscall_sub_freebsd_x64[232] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___getcwd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___getcwd_return), false);
+	syscall_sub_freebsd_x64[233] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sched_setparam_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sched_setparam_return), false);
+	syscall_sub_freebsd_x64[234] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sched_getparam_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sched_getparam_return), false);
+	syscall_sub_freebsd_x64[235] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sched_setscheduler_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sched_setscheduler_return), false);
+	syscall_sub_freebsd_x64[236] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sched_getscheduler_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sched_getscheduler_return), false);
+	syscall_sub_freebsd_x64[237] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sched_yield_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sched_yield_return), false);
+	syscall_sub_freebsd_x64[238] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sched_get_priority_max_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sched_get_priority_max_return), false);
+	syscall_sub_freebsd_x64[239] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sched_get_priority_min_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sched_get_priority_min_return), false);
+	syscall_sub_freebsd_x64[240] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sched_rr_get_interval_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sched_rr_get_interval_return), false);
+	syscall_sub_freebsd_x64[241] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_utrace_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_utrace_return), false);
+	syscall_sub_freebsd_x64[242] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sendfile_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sendfile_return), false);
+	syscall_sub_freebsd_x64[243] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kldsym_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kldsym_return), false);
+	syscall_sub_freebsd_x64[244] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_jail_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_jail_return), false);
+	syscall_sub_freebsd_x64[245] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nnpfs_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nnpfs_syscall_return), false);
+	syscall_sub_freebsd_x64[246] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigprocmask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigprocmask_return), false);
+	syscall_sub_freebsd_x64[247] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigsuspend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigsuspend_return), false);
+	syscall_sub_freebsd_x64[248] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigaction_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigaction_return), false);
+	syscall_sub_freebsd_x64[249] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigpending_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigpending_return), false);
+	syscall_sub_freebsd_x64[250] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigreturn_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigreturn_return), false);
+	syscall_sub_freebsd_x64[251] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigtimedwait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigtimedwait_return), false);
+	syscall_sub_freebsd_x64[252] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigwaitinfo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigwaitinfo_return), false);
+	syscall_sub_freebsd_x64[253] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_get_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_get_file_return), false);
+	syscall_sub_freebsd_x64[254] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_set_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_set_file_return), false);
+	syscall_sub_freebsd_x64[255] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_get_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_get_fd_return), false);
+	syscall_sub_freebsd_x64[256] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_set_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_set_fd_return), false);
+	syscall_sub_freebsd_x64[257] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_delete_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_delete_file_return), false);
+	syscall_sub_freebsd_x64[258] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_delete_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_delete_fd_return), false);
+	syscall_sub_freebsd_x64[259] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_aclcheck_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_aclcheck_file_return), false);
+	syscall_sub_freebsd_x64[260] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_aclcheck_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_aclcheck_fd_return), false);
+	syscall_sub_freebsd_x64[261] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattrctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattrctl_return), false);
+	syscall_sub_freebsd_x64[262] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_set_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_set_file_return), false);
+	syscall_sub_freebsd_x64[263] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_get_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_get_file_return), false);
+	syscall_sub_freebsd_x64[264] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_delete_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_delete_file_return), false);
+	syscall_sub_freebsd_x64[265] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_waitcomplete_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_waitcomplete_return), false);
+	syscall_sub_freebsd_x64[266] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getresuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getresuid_return), false);
+	syscall_sub_freebsd_x64[267] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getresgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getresgid_return), false);
+	syscall_sub_freebsd_x64[268] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kqueue_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kqueue_return), false);
+	syscall_sub_freebsd_x64[269] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kevent_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kevent_return), false);
+	syscall_sub_freebsd_x64[270] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_set_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_set_fd_return), false);
+	syscall_sub_freebsd_x64[271] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_get_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_get_fd_return), false);
+	syscall_sub_freebsd_x64[272] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_delete_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_delete_fd_return), false);
+	syscall_sub_freebsd_x64[273] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___setugid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___setugid_return), false);
+	syscall_sub_freebsd_x64[274] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_eaccess_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_eaccess_return), false);
+	syscall_sub_freebsd_x64[275] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_afs3_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_afs3_syscall_return), false);
+	syscall_sub_freebsd_x64[276] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_nmount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_nmount_return), false);
+	syscall_sub_freebsd_x64[277] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_get_proc_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_get_proc_return), false);
+	syscall_sub_freebsd_x64[278] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_set_proc_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_set_proc_return), false);
+	syscall_sub_freebsd_x64[279] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_get_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_get_fd_return), false);
+	syscall_sub_freebsd_x64[280] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_get_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_get_file_return), false);
+	syscall_sub_freebsd_x64[281] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_set_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_set_fd_return), false);
+	syscall_sub_freebsd_x64[282] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_set_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_set_file_return), false);
+	syscall_sub_freebsd_x64[283] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kenv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kenv_return), false);
+	syscall_sub_freebsd_x64[284] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lchflags_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lchflags_return), false);
+	syscall_sub_freebsd_x64[285] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_uuidgen_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_uuidgen_return), false);
+	syscall_sub_freebsd_x64[286] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sendfile_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sendfile_return), false);
+	syscall_sub_freebsd_x64[287] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mac_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mac_syscall_return), false);
+	syscall_sub_freebsd_x64[288] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getfsstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getfsstat_return), false);
+	syscall_sub_freebsd_x64[289] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_statfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_statfs_return), false);
+	syscall_sub_freebsd_x64[290] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fstatfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fstatfs_return), false);
+	syscall_sub_freebsd_x64[291] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhstatfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhstatfs_return), false);
+	syscall_sub_freebsd_x64[292] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_close_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_close_return), false);
+	syscall_sub_freebsd_x64[293] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_post_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_post_return), false);
+	syscall_sub_freebsd_x64[294] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_wait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_wait_return), false);
+	syscall_sub_freebsd_x64[295] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_trywait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_trywait_return), false);
+	syscall_sub_freebsd_x64[296] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_init_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_init_return), false);
+	syscall_sub_freebsd_x64[297] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_open_return), false);
+	syscall_sub_freebsd_x64[298] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_unlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_unlink_return), false);
+	syscall_sub_freebsd_x64[299] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_getvalue_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_getvalue_return), false);
+	syscall_sub_freebsd_x64[300] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_destroy_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_destroy_return), false);
+	syscall_sub_freebsd_x64[301] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_get_pid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_get_pid_return), false);
+	syscall_sub_freebsd_x64[302] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_get_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_get_link_return), false);
+	syscall_sub_freebsd_x64[303] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_set_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_set_link_return), false);
+	syscall_sub_freebsd_x64[304] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_set_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_set_link_return), false);
+	syscall_sub_freebsd_x64[305] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_get_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_get_link_return), false);
+	syscall_sub_freebsd_x64[306] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_delete_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_delete_link_return), false);
+	syscall_sub_freebsd_x64[307] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___mac_execve_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___mac_execve_return), true);
+	syscall_sub_freebsd_x64[308] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigaction_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigaction_return), false);
+	syscall_sub_freebsd_x64[309] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigreturn_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigreturn_return), false);
+	syscall_sub_freebsd_x64[310] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getcontext_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getcontext_return), false);
+	syscall_sub_freebsd_x64[311] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setcontext_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setcontext_return), false);
+	syscall_sub_freebsd_x64[312] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_swapcontext_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_swapcontext_return), false);
+	syscall_sub_freebsd_x64[313] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_swapoff_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_swapoff_return), false);
+	syscall_sub_freebsd_x64[314] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_get_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_get_link_return), false);
+	syscall_sub_freebsd_x64[315] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_set_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_set_link_return), false);
+	syscall_sub_freebsd_x64[316] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_delete_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_delete_link_return), false);
+	syscall_sub_freebsd_x64[317] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___acl_aclcheck_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___acl_aclcheck_link_return), false);
+	syscall_sub_freebsd_x64[318] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigwait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigwait_return), false);
+	syscall_sub_freebsd_x64[319] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_create_return), false);
+	syscall_sub_freebsd_x64[320] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_exit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_exit_return), true);
+	syscall_sub_freebsd_x64[321] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_self_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_self_return), false);
+	syscall_sub_freebsd_x64[322] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_kill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_kill_return), false);
+	syscall_sub_freebsd_x64[323] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_jail_attach_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_jail_attach_return), false);
+	syscall_sub_freebsd_x64[324] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_list_fd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_list_fd_return), false);
+	syscall_sub_freebsd_x64[325] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_list_file_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_list_file_return), false);
+	syscall_sub_freebsd_x64[326] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_extattr_list_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_extattr_list_link_return), false);
+	syscall_sub_freebsd_x64[327] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ksem_timedwait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ksem_timedwait_return), false);
+	syscall_sub_freebsd_x64[328] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_suspend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_suspend_return), false);
+	syscall_sub_freebsd_x64[329] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_wake_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_wake_return), false);
+	syscall_sub_freebsd_x64[330] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kldunloadf_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kldunloadf_return), false);
+	syscall_sub_freebsd_x64[331] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_audit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_audit_return), false);
+	syscall_sub_freebsd_x64[332] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_auditon_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_auditon_return), false);
+	syscall_sub_freebsd_x64[333] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getauid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getauid_return), false);
+	syscall_sub_freebsd_x64[334] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setauid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setauid_return), false);
+	syscall_sub_freebsd_x64[335] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getaudit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getaudit_return), false);
+	syscall_sub_freebsd_x64[336] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setaudit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setaudit_return), false);
+	syscall_sub_freebsd_x64[337] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getaudit_addr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getaudit_addr_return), false);
+	syscall_sub_freebsd_x64[338] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setaudit_addr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setaudit_addr_return), false);
+	syscall_sub_freebsd_x64[339] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_auditctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_auditctl_return), false);
+	syscall_sub_freebsd_x64[340] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on__umtx_op_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on__umtx_op_return), false);
+	syscall_sub_freebsd_x64[341] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_new_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_new_return), false);
+	syscall_sub_freebsd_x64[342] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigqueue_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigqueue_return), false);
+	syscall_sub_freebsd_x64[343] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kmq_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kmq_open_return), false);
+	syscall_sub_freebsd_x64[344] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kmq_setattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kmq_setattr_return), false);
+	syscall_sub_freebsd_x64[345] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kmq_timedreceive_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kmq_timedreceive_return), false);
+	syscall_sub_freebsd_x64[346] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kmq_timedsend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kmq_timedsend_return), false);
+	syscall_sub_freebsd_x64[347] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kmq_notify_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kmq_notify_return), false);
+	syscall_sub_freebsd_x64[348] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kmq_unlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kmq_unlink_return), false);
+	syscall_sub_freebsd_x64[349] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_abort2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_abort2_return), false);
+	syscall_sub_freebsd_x64[350] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_set_name_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_set_name_return), false);
+	syscall_sub_freebsd_x64[351] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_fsync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_fsync_return), false);
+	syscall_sub_freebsd_x64[352] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rtprio_thread_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rtprio_thread_return), false);
+	syscall_sub_freebsd_x64[353] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sctp_peeloff_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sctp_peeloff_return), false);
+	syscall_sub_freebsd_x64[354] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sctp_generic_sendmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sctp_generic_sendmsg_return), false);
+	syscall_sub_freebsd_x64[355] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sctp_generic_sendmsg_iov_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sctp_generic_sendmsg_iov_return), false);
+	syscall_sub_freebsd_x64[356] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sctp_generic_recvmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sctp_generic_recvmsg_return), false);
+	syscall_sub_freebsd_x64[357] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pread_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pread_return), false);
+	syscall_sub_freebsd_x64[358] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pwrite_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pwrite_return), false);
+	syscall_sub_freebsd_x64[359] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lseek_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lseek_return), false);
+	syscall_sub_freebsd_x64[360] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_truncate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_truncate_return), false);
+	syscall_sub_freebsd_x64[361] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ftruncate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ftruncate_return), false);
+	syscall_sub_freebsd_x64[362] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_thr_kill2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_thr_kill2_return), false);
+	syscall_sub_freebsd_x64[363] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shm_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shm_open_return), false);
+	syscall_sub_freebsd_x64[364] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shm_unlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shm_unlink_return), false);
+	syscall_sub_freebsd_x64[365] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cpuset_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cpuset_return), false);
+	syscall_sub_freebsd_x64[366] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cpuset_setid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cpuset_setid_return), false);
+	syscall_sub_freebsd_x64[367] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cpuset_getid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cpuset_getid_return), false);
+	syscall_sub_freebsd_x64[368] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cpuset_getaffinity_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cpuset_getaffinity_return), false);
+	syscall_sub_freebsd_x64[369] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cpuset_setaffinity_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cpuset_setaffinity_return), false);
+	syscall_sub_freebsd_x64[370] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_faccessat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_faccessat_return), false);
+	syscall_sub_freebsd_x64[371] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fchmodat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fchmodat_return), false);
+	syscall_sub_freebsd_x64[372] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fchownat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fchownat_return), false);
+	syscall_sub_freebsd_x64[373] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fexecve_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fexecve_return), true);
+	syscall_sub_freebsd_x64[374] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fstatat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fstatat_return), false);
+	syscall_sub_freebsd_x64[375] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_futimesat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_futimesat_return), false);
+	syscall_sub_freebsd_x64[376] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_linkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_linkat_return), false);
+	syscall_sub_freebsd_x64[377] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mkdirat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mkdirat_return), false);
+	syscall_sub_freebsd_x64[378] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mkfifoat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mkfifoat_return), false);
+	syscall_sub_freebsd_x64[379] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mknodat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mknodat_return), false);
+	syscall_sub_freebsd_x64[380] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_openat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_openat_return), false);
+	syscall_sub_freebsd_x64[381] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_readlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_readlinkat_return), false);
+	syscall_sub_freebsd_x64[382] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_renameat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_renameat_return), false);
+	syscall_sub_freebsd_x64[383] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_symlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_symlinkat_return), false);
+	syscall_sub_freebsd_x64[384] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_unlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_unlinkat_return), false);
+	syscall_sub_freebsd_x64[385] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_posix_openpt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_posix_openpt_return), false);
+	syscall_sub_freebsd_x64[386] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_gssd_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_gssd_syscall_return), false);
+	syscall_sub_freebsd_x64[387] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_jail_get_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_jail_get_return), false);
+	syscall_sub_freebsd_x64[388] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_jail_set_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_jail_set_return), false);
+	syscall_sub_freebsd_x64[389] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_jail_remove_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_jail_remove_return), false);
+	syscall_sub_freebsd_x64[390] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_closefrom_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_closefrom_return), false);
+	syscall_sub_freebsd_x64[391] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___semctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___semctl_return), false);
+	syscall_sub_freebsd_x64[392] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_msgctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_msgctl_return), false);
+	syscall_sub_freebsd_x64[393] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shmctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shmctl_return), false);
+	syscall_sub_freebsd_x64[394] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_lpathconf_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_lpathconf_return), false);
+	syscall_sub_freebsd_x64[395] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___cap_rights_get_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___cap_rights_get_return), false);
+	syscall_sub_freebsd_x64[396] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cap_enter_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cap_enter_return), false);
+	syscall_sub_freebsd_x64[397] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cap_getmode_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cap_getmode_return), false);
+	syscall_sub_freebsd_x64[398] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pdfork_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pdfork_return), false);
+	syscall_sub_freebsd_x64[399] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pdkill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pdkill_return), false);
+	syscall_sub_freebsd_x64[400] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pdgetpid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pdgetpid_return), false);
+	syscall_sub_freebsd_x64[401] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pselect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pselect_return), false);
+	syscall_sub_freebsd_x64[402] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getloginclass_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getloginclass_return), false);
+	syscall_sub_freebsd_x64[403] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_setloginclass_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_setloginclass_return), false);
+	syscall_sub_freebsd_x64[404] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rctl_get_racct_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rctl_get_racct_return), false);
+	syscall_sub_freebsd_x64[405] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rctl_get_rules_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rctl_get_rules_return), false);
+	syscall_sub_freebsd_x64[406] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rctl_get_limits_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rctl_get_limits_return), false);
+	syscall_sub_freebsd_x64[407] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rctl_add_rule_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rctl_add_rule_return), false);
+	syscall_sub_freebsd_x64[408] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rctl_remove_rule_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rctl_remove_rule_return), false);
+	syscall_sub_freebsd_x64[409] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_posix_fallocate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_posix_fallocate_return), false);
+	syscall_sub_freebsd_x64[410] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_posix_fadvise_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_posix_fadvise_return), false);
+	syscall_sub_freebsd_x64[411] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_wait6_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_wait6_return), false);
+	syscall_sub_freebsd_x64[412] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cap_rights_limit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cap_rights_limit_return), false);
+	syscall_sub_freebsd_x64[413] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cap_ioctls_limit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cap_ioctls_limit_return), false);
+	syscall_sub_freebsd_x64[414] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cap_ioctls_get_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cap_ioctls_get_return), false);
+	syscall_sub_freebsd_x64[415] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cap_fcntls_limit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cap_fcntls_limit_return), false);
+	syscall_sub_freebsd_x64[416] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cap_fcntls_get_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cap_fcntls_get_return), false);
+	syscall_sub_freebsd_x64[417] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_bindat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_bindat_return), false);
+	syscall_sub_freebsd_x64[418] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_connectat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_connectat_return), false);
+	syscall_sub_freebsd_x64[419] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_chflagsat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_chflagsat_return), false);
+	syscall_sub_freebsd_x64[420] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_accept4_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_accept4_return), false);
+	syscall_sub_freebsd_x64[421] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_pipe2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_pipe2_return), false);
+	syscall_sub_freebsd_x64[422] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_aio_mlock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_aio_mlock_return), false);
+	syscall_sub_freebsd_x64[423] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_procctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_procctl_return), false);
+	syscall_sub_freebsd_x64[424] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_ppoll_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_ppoll_return), false);
+	syscall_sub_freebsd_x64[425] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_futimens_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_futimens_return), false);
+	syscall_sub_freebsd_x64[426] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_utimensat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_utimensat_return), false);
+	syscall_sub_freebsd_x64[427] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fdatasync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fdatasync_return), false);
+	syscall_sub_freebsd_x64[428] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fstat_return), false);
+	syscall_sub_freebsd_x64[429] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fstatat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fstatat_return), false);
+	syscall_sub_freebsd_x64[430] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhstat_return), false);
+	syscall_sub_freebsd_x64[431] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getdirentries_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getdirentries_return), false);
+	syscall_sub_freebsd_x64[432] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_statfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_statfs_return), false);
+	syscall_sub_freebsd_x64[433] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fstatfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fstatfs_return), false);
+	syscall_sub_freebsd_x64[434] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getfsstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getfsstat_return), false);
+	syscall_sub_freebsd_x64[435] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhstatfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhstatfs_return), false);
+	syscall_sub_freebsd_x64[436] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mknodat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mknodat_return), false);
+	syscall_sub_freebsd_x64[437] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_kevent_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_kevent_return), false);
+	syscall_sub_freebsd_x64[438] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cpuset_getdomain_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cpuset_getdomain_return), false);
+	syscall_sub_freebsd_x64[439] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_cpuset_setdomain_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_cpuset_setdomain_return), false);
+	syscall_sub_freebsd_x64[440] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getrandom_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getrandom_return), false);
+	syscall_sub_freebsd_x64[441] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_getfhat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_getfhat_return), false);
+	syscall_sub_freebsd_x64[442] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhlink_return), false);
+	syscall_sub_freebsd_x64[443] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhlinkat_return), false);
+	syscall_sub_freebsd_x64[444] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_fhreadlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_fhreadlink_return), false);
+	syscall_sub_freebsd_x64[445] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_funlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_funlinkat_return), false);
+	syscall_sub_freebsd_x64[446] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_copy_file_range_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_copy_file_range_return), false);
+	syscall_sub_freebsd_x64[447] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___sysctlbyname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___sysctlbyname_return), false);
+	syscall_sub_freebsd_x64[448] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shm_open2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shm_open2_return), false);
+	syscall_sub_freebsd_x64[449] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_shm_rename_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_shm_rename_return), false);
+	syscall_sub_freebsd_x64[450] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sigfastblock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sigfastblock_return), false);
+	syscall_sub_freebsd_x64[451] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on___realpathat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on___realpathat_return), false);
+	syscall_sub_freebsd_x64[452] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_close_range_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_close_range_return), false);
+	syscall_sub_freebsd_x64[453] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_rpctls_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_rpctls_syscall_return), false);
+	syscall_sub_freebsd_x64[454] = syscall_sub_bits(
+			all_enter || PPP_CHECK_CB(on_unknown_sys_enter), all_enter2,
+			all_return || PPP_CHECK_CB(on_unknown_sys_return), all_return2, false);
+	syscalls_subscriptions_dirty = false;
+}
+#endif
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
@@ -21,6264 +1405,8090 @@ extern "C" {
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
  * system call return callbacks.
+ *
+ * System calls nobody subscribed to return right away, without reading
+ * their arguments or tracking their return.
  */
 void syscall_enter_switch_freebsd_x64(CPUState *cpu, target_ptr_t pc) {
 #if defined(TARGET_X86_64)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {0};
 	ctx.no = env->regs[R_EAX];
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
-	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
+	uint8_t sub;			// SYSCALL_SUB_* bits for this system call
+
+	if (unlikely(syscalls_subscriptions_dirty)) {
+		syscall_sub_update_freebsd_x64();
+	}
 
 	switch (ctx.no) {
 	// 0 int nosys ['void']
 	case 0: {
+		sub = syscall_sub_freebsd_x64[0];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_nosys_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_nosys_enter, cpu, pc);
+		}
 	}; break;
 	// 1 void sys_exit ['int rval']
 	case 1: {
+		sub = syscall_sub_freebsd_x64[1];
+		if (!sub) return;
 		panda_noreturn = true;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_exit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_exit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
 	}; break;
 	// 2 int fork ['void']
 	case 2: {
+		sub = syscall_sub_freebsd_x64[2];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_fork_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_fork_enter, cpu, pc);
+		}
 	}; break;
 	// 3 ssize_t read ['int fd', 'void *buf', 'size_t nbyte']
 	case 3: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_read_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[3];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_read_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_read_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_read_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4 ssize_t write ['int fd', 'const void *buf', 'size_t nbyte']
 	case 4: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_write_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[4];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_write_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_write_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_write_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 5 int open ['const char *path', 'int flags', 'mode_t mode']
 	case 5: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[5];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_open_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_open_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 6 int close ['int fd']
 	case 6: {
+		sub = syscall_sub_freebsd_x64[6];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_close_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_close_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_close_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_close_enter, cpu, pc, arg0);
 	}; break;
 	// 7 int wait4 ['int pid', 'int *status', 'int options', 'struct rusage *rusage']
 	case 7: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_wait4_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[7];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_wait4_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_wait4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_wait4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 8 int creat ['const char *path', 'int mode']
 	case 8: {
+		sub = syscall_sub_freebsd_x64[8];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_creat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_creat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_creat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_creat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 9 int link ['const char *path', 'const char *link']
 	case 9: {
+		sub = syscall_sub_freebsd_x64[9];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_link_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_link_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 10 int unlink ['const char *path']
 	case 10: {
+		sub = syscall_sub_freebsd_x64[10];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_unlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_unlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_unlink_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_unlink_enter, cpu, pc, arg0);
 	}; break;
 	// 12 int chdir ['const char *path']
 	case 12: {
+		sub = syscall_sub_freebsd_x64[11];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_chdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_chdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_chdir_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_chdir_enter, cpu, pc, arg0);
 	}; break;
 	// 13 int fchdir ['int fd']
 	case 13: {
+		sub = syscall_sub_freebsd_x64[12];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fchdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fchdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fchdir_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_fchdir_enter, cpu, pc, arg0);
 	}; break;
 	// 14 int mknod ['const char *path', 'int mode', 'uint32_t dev']
 	case 14: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mknod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[13];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mknod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_mknod_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_mknod_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 15 int chmod ['const char *path', 'mode_t mode']
 	case 15: {
+		sub = syscall_sub_freebsd_x64[14];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_chmod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_chmod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_chmod_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_chmod_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 16 int chown ['const char *path', 'int uid', 'int gid']
 	case 16: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_chown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[15];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_chown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_chown_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_chown_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 18 int getfsstat ['struct ostatfs *buf', 'long bufsize', 'int mode']
 	case 18: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getfsstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[16];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getfsstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getfsstat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getfsstat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 20 pid_t getpid ['void']
 	case 20: {
+		sub = syscall_sub_freebsd_x64[17];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_getpid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_getpid_enter, cpu, pc);
+		}
 	}; break;
 	// 21 int mount ['const char *type', 'const char *path', 'int flags', 'void *data']
 	case 21: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[18];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_mount_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_mount_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 22 int unmount ['const char *path', 'int flags']
 	case 22: {
+		sub = syscall_sub_freebsd_x64[19];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_unmount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_unmount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_unmount_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_unmount_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 23 int setuid ['uid_t uid']
 	case 23: {
+		sub = syscall_sub_freebsd_x64[20];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_setuid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setuid_enter, cpu, pc, arg0);
 	}; break;
 	// 24 uid_t getuid ['void']
 	case 24: {
+		sub = syscall_sub_freebsd_x64[21];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_getuid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_getuid_enter, cpu, pc);
+		}
 	}; break;
 	// 25 uid_t geteuid ['void']
 	case 25: {
+		sub = syscall_sub_freebsd_x64[22];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_geteuid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_geteuid_enter, cpu, pc);
+		}
 	}; break;
 	// 26 int ptrace ['int req', 'pid_t pid', 'caddr_t addr', 'int data']
 	case 26: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ptrace_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[23];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ptrace_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_ptrace_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_ptrace_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 27 int recvmsg ['int s', 'struct msghdr *msg', 'int flags']
 	case 27: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_recvmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[24];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_recvmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_recvmsg_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_recvmsg_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 28 int sendmsg ['int s', 'struct msghdr *msg', 'int flags']
 	case 28: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sendmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[25];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sendmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sendmsg_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sendmsg_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 29 int recvfrom ['int s', 'void *buf', 'size_t len', 'int flags', 'struct sockaddr *from', '__socklen_t *fromlenaddr']
 	case 29: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_recvfrom_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_recvfrom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[26];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_recvfrom_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_recvfrom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 30 int accept ['int s', 'struct sockaddr *name', '__socklen_t *anamelen']
 	case 30: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_accept_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[27];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_accept_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_accept_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_accept_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 31 int getpeername ['int fdes', 'struct sockaddr *asa', '__socklen_t *alen']
 	case 31: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getpeername_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[28];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getpeername_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getpeername_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getpeername_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 32 int getsockname ['int fdes', 'struct sockaddr *asa', '__socklen_t *alen']
 	case 32: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getsockname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[29];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getsockname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getsockname_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getsockname_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 33 int access ['const char *path', 'int amode']
 	case 33: {
+		sub = syscall_sub_freebsd_x64[30];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_access_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_access_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_access_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_access_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 34 int chflags ['const char *path', 'u_long flags']
 	case 34: {
+		sub = syscall_sub_freebsd_x64[31];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_chflags_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_chflags_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+			}
+			PPP_RUN_CB(on_chflags_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_chflags_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 35 int fchflags ['int fd', 'u_long flags']
 	case 35: {
+		sub = syscall_sub_freebsd_x64[32];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fchflags_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fchflags_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+			}
+			PPP_RUN_CB(on_fchflags_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fchflags_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 36 int sync ['void']
 	case 36: {
+		sub = syscall_sub_freebsd_x64[33];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sync_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sync_enter, cpu, pc);
+		}
 	}; break;
 	// 37 int kill ['int pid', 'int signum']
 	case 37: {
+		sub = syscall_sub_freebsd_x64[34];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_kill_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_kill_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 38 int stat ['const char *path', 'struct ostat *ub']
 	case 38: {
+		sub = syscall_sub_freebsd_x64[35];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_stat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_stat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_stat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_stat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 39 pid_t getppid ['void']
 	case 39: {
+		sub = syscall_sub_freebsd_x64[36];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_getppid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_getppid_enter, cpu, pc);
+		}
 	}; break;
 	// 40 int lstat ['const char *path', 'struct ostat *ub']
 	case 40: {
+		sub = syscall_sub_freebsd_x64[37];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_lstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_lstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 41 int dup ['unsigned fd']
 	case 41: {
+		sub = syscall_sub_freebsd_x64[38];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_dup_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_dup_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_dup_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_dup_enter, cpu, pc, arg0);
 	}; break;
 	// 42 int pipe ['void']
 	case 42: {
+		sub = syscall_sub_freebsd_x64[39];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_pipe_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_pipe_enter, cpu, pc);
+		}
 	}; break;
 	// 43 gid_t getegid ['void']
 	case 43: {
+		sub = syscall_sub_freebsd_x64[40];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_getegid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_getegid_enter, cpu, pc);
+		}
 	}; break;
 	// 44 int profil ['char *samples', 'size_t size', 'size_t offset', 'unsigned scale']
 	case 44: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_profil_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[41];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_profil_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_profil_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_profil_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 45 int ktrace ['const char *fname', 'int ops', 'int facs', 'int pid']
 	case 45: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ktrace_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[42];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ktrace_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_ktrace_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_ktrace_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 46 int sigaction ['int signum', 'struct osigaction *nsa', 'struct osigaction *osa']
 	case 46: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigaction_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[43];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigaction_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigaction_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sigaction_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 47 gid_t getgid ['void']
 	case 47: {
+		sub = syscall_sub_freebsd_x64[44];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_getgid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_getgid_enter, cpu, pc);
+		}
 	}; break;
 	// 49 int getlogin ['char *namebuf', 'unsigned namelen']
 	case 49: {
+		sub = syscall_sub_freebsd_x64[45];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getlogin_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getlogin_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_getlogin_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getlogin_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 50 int setlogin ['const char *namebuf']
 	case 50: {
+		sub = syscall_sub_freebsd_x64[46];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setlogin_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setlogin_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setlogin_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setlogin_enter, cpu, pc, arg0);
 	}; break;
 	// 51 int acct ['const char *path']
 	case 51: {
+		sub = syscall_sub_freebsd_x64[47];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_acct_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_acct_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_acct_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_acct_enter, cpu, pc, arg0);
 	}; break;
 	// 53 int sigaltstack ['stack_t *ss', 'stack_t *oss']
 	case 53: {
+		sub = syscall_sub_freebsd_x64[48];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigaltstack_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigaltstack_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigaltstack_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sigaltstack_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 54 int ioctl ['int fd', 'u_long com', 'char *data']
 	case 54: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ioctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[49];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ioctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ioctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_ioctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 55 int reboot ['int opt']
 	case 55: {
+		sub = syscall_sub_freebsd_x64[50];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_reboot_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_reboot_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_reboot_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_reboot_enter, cpu, pc, arg0);
 	}; break;
 	// 56 int revoke ['const char *path']
 	case 56: {
+		sub = syscall_sub_freebsd_x64[51];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_revoke_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_revoke_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_revoke_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_revoke_enter, cpu, pc, arg0);
 	}; break;
 	// 57 int symlink ['const char *path', 'const char *link']
 	case 57: {
+		sub = syscall_sub_freebsd_x64[52];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_symlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_symlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_symlink_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_symlink_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 58 ssize_t readlink ['const char *path', 'char *buf', 'size_t count']
 	case 58: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_readlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[53];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_readlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_readlink_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_readlink_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 59 int execve ['const char *fname', 'char **argv', 'char **envv']
 	case 59: {
+		sub = syscall_sub_freebsd_x64[54];
+		if (!sub) return;
 		panda_noreturn = true;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_execve_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_execve_enter, cpu, pc, arg0, arg1, arg2);
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_execve_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_execve_enter, cpu, pc, arg0, arg1, arg2);
+		}
 	}; break;
 	// 60 int umask ['mode_t newmask']
 	case 60: {
+		sub = syscall_sub_freebsd_x64[55];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_umask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_umask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_umask_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_umask_enter, cpu, pc, arg0);
 	}; break;
 	// 61 int chroot ['const char *path']
 	case 61: {
+		sub = syscall_sub_freebsd_x64[56];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_chroot_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_chroot_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_chroot_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_chroot_enter, cpu, pc, arg0);
 	}; break;
 	// 62 int fstat ['int fd', 'struct ostat *sb']
 	case 62: {
+		sub = syscall_sub_freebsd_x64[57];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 63 int getkerninfo ['int op', 'char *where', 'size_t *size', 'int arg']
 	case 63: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getkerninfo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[58];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getkerninfo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getkerninfo_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_getkerninfo_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 64 int getpagesize ['void']
 	case 64: {
+		sub = syscall_sub_freebsd_x64[59];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_getpagesize_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_getpagesize_enter, cpu, pc);
+		}
 	}; break;
 	// 65 int msync ['void *addr', 'size_t len', 'int flags']
 	case 65: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_msync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[60];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_msync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_msync_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_msync_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 66 int vfork ['void']
 	case 66: {
+		sub = syscall_sub_freebsd_x64[61];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_vfork_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_vfork_enter, cpu, pc);
+		}
 	}; break;
 	// 69 int sbrk ['int incr']
 	case 69: {
+		sub = syscall_sub_freebsd_x64[62];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sbrk_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sbrk_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sbrk_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sbrk_enter, cpu, pc, arg0);
 	}; break;
 	// 70 int sstk ['int incr']
 	case 70: {
+		sub = syscall_sub_freebsd_x64[63];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sstk_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sstk_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sstk_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sstk_enter, cpu, pc, arg0);
 	}; break;
 	// 72 int vadvise ['int anom']
 	case 72: {
+		sub = syscall_sub_freebsd_x64[64];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_vadvise_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_vadvise_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_vadvise_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_vadvise_enter, cpu, pc, arg0);
 	}; break;
 	// 73 int munmap ['void *addr', 'size_t len']
 	case 73: {
+		sub = syscall_sub_freebsd_x64[65];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_munmap_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_munmap_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_munmap_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_munmap_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 74 int mprotect ['void *addr', 'size_t len', 'int prot']
 	case 74: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mprotect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[66];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mprotect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_mprotect_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_mprotect_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 75 int madvise ['void *addr', 'size_t len', 'int behav']
 	case 75: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_madvise_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[67];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_madvise_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_madvise_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_madvise_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 78 int mincore ['const void *addr', 'size_t len', 'char *vec']
 	case 78: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mincore_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[68];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mincore_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_mincore_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_mincore_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 79 int getgroups ['unsigned gidsetsize', 'gid_t *gidset']
 	case 79: {
+		sub = syscall_sub_freebsd_x64[69];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getgroups_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getgroups_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getgroups_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getgroups_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 80 int setgroups ['unsigned gidsetsize', 'gid_t *gidset']
 	case 80: {
+		sub = syscall_sub_freebsd_x64[70];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setgroups_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setgroups_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setgroups_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_setgroups_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 81 int getpgrp ['void']
 	case 81: {
+		sub = syscall_sub_freebsd_x64[71];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_getpgrp_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_getpgrp_enter, cpu, pc);
+		}
 	}; break;
 	// 82 int setpgid ['int pid', 'int pgid']
 	case 82: {
+		sub = syscall_sub_freebsd_x64[72];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setpgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setpgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_setpgid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_setpgid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 83 int setitimer ['unsigned which', 'struct itimerval *itv', 'struct itimerval *oitv']
 	case 83: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setitimer_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[73];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setitimer_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setitimer_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_setitimer_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 84 int wait ['void']
 	case 84: {
+		sub = syscall_sub_freebsd_x64[74];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_wait_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_wait_enter, cpu, pc);
+		}
 	}; break;
 	// 85 int swapon ['const char *name']
 	case 85: {
+		sub = syscall_sub_freebsd_x64[75];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_swapon_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_swapon_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_swapon_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_swapon_enter, cpu, pc, arg0);
 	}; break;
 	// 86 int getitimer ['unsigned which', 'struct itimerval *itv']
 	case 86: {
+		sub = syscall_sub_freebsd_x64[76];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getitimer_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getitimer_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getitimer_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getitimer_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 87 int gethostname ['char *hostname', 'unsigned len']
 	case 87: {
+		sub = syscall_sub_freebsd_x64[77];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_gethostname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_gethostname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_gethostname_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_gethostname_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 88 int sethostname ['char *hostname', 'unsigned len']
 	case 88: {
+		sub = syscall_sub_freebsd_x64[78];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sethostname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sethostname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sethostname_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sethostname_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 89 int getdtablesize ['void']
 	case 89: {
+		sub = syscall_sub_freebsd_x64[79];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_getdtablesize_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_getdtablesize_enter, cpu, pc);
+		}
 	}; break;
 	// 90 int dup2 ['unsigned from', 'unsigned to']
 	case 90: {
+		sub = syscall_sub_freebsd_x64[80];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_dup2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_dup2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_dup2_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_dup2_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 92 int fcntl ['int fd', 'int cmd', 'long arg']
 	case 92: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int64_t arg2 = get_s64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fcntl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int64_t));
+		sub = syscall_sub_freebsd_x64[81];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int64_t arg2 = get_s64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fcntl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int64_t));
+			}
+			PPP_RUN_CB(on_fcntl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_fcntl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 93 int select ['int nd', 'fd_set *in', 'fd_set *ou', 'fd_set *ex', 'struct timeval *tv']
 	case 93: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_select_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_select_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[82];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_select_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_select_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 95 int fsync ['int fd']
 	case 95: {
+		sub = syscall_sub_freebsd_x64[83];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fsync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fsync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fsync_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_fsync_enter, cpu, pc, arg0);
 	}; break;
 	// 96 int setpriority ['int which', 'int who', 'int prio']
 	case 96: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setpriority_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[84];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setpriority_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_setpriority_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_setpriority_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 97 int socket ['int domain', 'int type', 'int protocol']
 	case 97: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_socket_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[85];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_socket_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_socket_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_socket_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 98 int connect ['int s', 'const struct sockaddr *name', 'int namelen']
 	case 98: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_connect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[86];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_connect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_connect_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_connect_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 99 int accept ['int s', 'struct sockaddr *name', 'int *anamelen']
 	case 99: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_accept_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[87];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_accept_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_accept_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_accept_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 100 int getpriority ['int which', 'int who']
 	case 100: {
+		sub = syscall_sub_freebsd_x64[88];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getpriority_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getpriority_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getpriority_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getpriority_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 101 int send ['int s', 'const void *buf', 'int len', 'int flags']
 	case 101: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_send_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[89];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_send_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_send_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_send_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 102 int recv ['int s', 'void *buf', 'int len', 'int flags']
 	case 102: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_recv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[90];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_recv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_recv_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_recv_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 103 int sigreturn ['struct osigcontext *sigcntxp']
 	case 103: {
+		sub = syscall_sub_freebsd_x64[91];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigreturn_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigreturn_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigreturn_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sigreturn_enter, cpu, pc, arg0);
 	}; break;
 	// 104 int bind ['int s', 'const struct sockaddr *name', 'int namelen']
 	case 104: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_bind_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[92];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_bind_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_bind_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_bind_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 105 int setsockopt ['int s', 'int level', 'int name', 'const void *val', 'int valsize']
 	case 105: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setsockopt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_setsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[93];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setsockopt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_setsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 106 int listen ['int s', 'int backlog']
 	case 106: {
+		sub = syscall_sub_freebsd_x64[94];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_listen_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_listen_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_listen_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_listen_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 108 int sigvec ['int signum', 'struct sigvec *nsv', 'struct sigvec *osv']
 	case 108: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigvec_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[95];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigvec_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigvec_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sigvec_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 109 int sigblock ['int mask']
 	case 109: {
+		sub = syscall_sub_freebsd_x64[96];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigblock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigblock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sigblock_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sigblock_enter, cpu, pc, arg0);
 	}; break;
 	// 110 int sigsetmask ['int mask']
 	case 110: {
+		sub = syscall_sub_freebsd_x64[97];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigsetmask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigsetmask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sigsetmask_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sigsetmask_enter, cpu, pc, arg0);
 	}; break;
 	// 111 int sigsuspend ['osigset_t mask']
 	case 111: {
+		sub = syscall_sub_freebsd_x64[98];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigsuspend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigsuspend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sigsuspend_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sigsuspend_enter, cpu, pc, arg0);
 	}; break;
 	// 112 int sigstack ['struct sigstack *nss', 'struct sigstack *oss']
 	case 112: {
+		sub = syscall_sub_freebsd_x64[99];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigstack_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigstack_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigstack_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sigstack_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 113 int recvmsg ['int s', 'struct omsghdr *msg', 'int flags']
 	case 113: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_recvmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[100];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_recvmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_recvmsg_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_recvmsg_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 114 int sendmsg ['int s', 'const void *msg', 'int flags']
 	case 114: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sendmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[101];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sendmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sendmsg_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sendmsg_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 116 int gettimeofday ['struct timeval *tp', 'struct timezone *tzp']
 	case 116: {
+		sub = syscall_sub_freebsd_x64[102];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_gettimeofday_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_gettimeofday_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_gettimeofday_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_gettimeofday_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 117 int getrusage ['int who', 'struct rusage *rusage']
 	case 117: {
+		sub = syscall_sub_freebsd_x64[103];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getrusage_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getrusage_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getrusage_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getrusage_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 118 int getsockopt ['int s', 'int level', 'int name', 'void *val', 'int *avalsize']
 	case 118: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getsockopt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_getsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[104];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getsockopt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 120 int readv ['int fd', 'struct iovec *iovp', 'unsigned iovcnt']
 	case 120: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_readv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[105];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_readv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_readv_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_readv_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 121 int writev ['int fd', 'struct iovec *iovp', 'unsigned iovcnt']
 	case 121: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_writev_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[106];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_writev_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_writev_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_writev_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 122 int settimeofday ['struct timeval *tv', 'struct timezone *tzp']
 	case 122: {
+		sub = syscall_sub_freebsd_x64[107];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_settimeofday_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_settimeofday_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_settimeofday_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_settimeofday_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 123 int fchown ['int fd', 'int uid', 'int gid']
 	case 123: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fchown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[108];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fchown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fchown_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_fchown_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 124 int fchmod ['int fd', 'mode_t mode']
 	case 124: {
+		sub = syscall_sub_freebsd_x64[109];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fchmod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fchmod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_fchmod_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fchmod_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 125 int recvfrom ['int s', 'void *buf', 'size_t len', 'int flags', 'struct sockaddr *from', 'int *fromlenaddr']
 	case 125: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_recvfrom_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_recvfrom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[110];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_recvfrom_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_recvfrom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 126 int setreuid ['int ruid', 'int euid']
 	case 126: {
+		sub = syscall_sub_freebsd_x64[111];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setreuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setreuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_setreuid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_setreuid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 127 int setregid ['int rgid', 'int egid']
 	case 127: {
+		sub = syscall_sub_freebsd_x64[112];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setregid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setregid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_setregid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_setregid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 128 int rename ['const char *from', 'const char *to']
 	case 128: {
+		sub = syscall_sub_freebsd_x64[113];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rename_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rename_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_rename_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_rename_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 131 int flock ['int fd', 'int how']
 	case 131: {
+		sub = syscall_sub_freebsd_x64[114];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_flock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_flock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_flock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_flock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 132 int mkfifo ['const char *path', 'mode_t mode']
 	case 132: {
+		sub = syscall_sub_freebsd_x64[115];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mkfifo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mkfifo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_mkfifo_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_mkfifo_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 133 int sendto ['int s', 'const void *buf', 'size_t len', 'int flags', 'const struct sockaddr *to', 'int tolen']
 	case 133: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sendto_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sendto_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[116];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			int32_t arg5 = get_s32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sendto_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sendto_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 134 int shutdown ['int s', 'int how']
 	case 134: {
+		sub = syscall_sub_freebsd_x64[117];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shutdown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shutdown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_shutdown_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_shutdown_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 135 int socketpair ['int domain', 'int type', 'int protocol', 'int *rsv']
 	case 135: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_socketpair_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[118];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_socketpair_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_socketpair_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_socketpair_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 136 int mkdir ['const char *path', 'mode_t mode']
 	case 136: {
+		sub = syscall_sub_freebsd_x64[119];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mkdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mkdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_mkdir_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_mkdir_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 137 int rmdir ['const char *path']
 	case 137: {
+		sub = syscall_sub_freebsd_x64[120];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rmdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rmdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_rmdir_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_rmdir_enter, cpu, pc, arg0);
 	}; break;
 	// 138 int utimes ['const char *path', 'struct timeval *tptr']
 	case 138: {
+		sub = syscall_sub_freebsd_x64[121];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_utimes_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_utimes_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_utimes_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_utimes_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 140 int adjtime ['struct timeval *delta', 'struct timeval *olddelta']
 	case 140: {
+		sub = syscall_sub_freebsd_x64[122];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_adjtime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_adjtime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_adjtime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_adjtime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 141 int getpeername ['int fdes', 'struct sockaddr *asa', 'int *alen']
 	case 141: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getpeername_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[123];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getpeername_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getpeername_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getpeername_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 142 long gethostid ['void']
 	case 142: {
+		sub = syscall_sub_freebsd_x64[124];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_gethostid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_gethostid_enter, cpu, pc);
+		}
 	}; break;
 	// 143 int sethostid ['long hostid']
 	case 143: {
+		sub = syscall_sub_freebsd_x64[125];
+		if (!sub) return;
 		panda_noreturn = false;
-		int64_t arg0 = get_s64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sethostid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int64_t arg0 = get_s64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sethostid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int64_t));
+			}
+			PPP_RUN_CB(on_sethostid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sethostid_enter, cpu, pc, arg0);
 	}; break;
 	// 144 int getrlimit ['unsigned which', 'struct orlimit *rlp']
 	case 144: {
+		sub = syscall_sub_freebsd_x64[126];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getrlimit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getrlimit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getrlimit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getrlimit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 145 int setrlimit ['unsigned which', 'struct orlimit *rlp']
 	case 145: {
+		sub = syscall_sub_freebsd_x64[127];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setrlimit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setrlimit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setrlimit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_setrlimit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 146 int killpg ['int pgid', 'int signum']
 	case 146: {
+		sub = syscall_sub_freebsd_x64[128];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_killpg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_killpg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_killpg_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_killpg_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 147 int setsid ['void']
 	case 147: {
+		sub = syscall_sub_freebsd_x64[129];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_setsid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_setsid_enter, cpu, pc);
+		}
 	}; break;
 	// 148 int quotactl ['const char *path', 'int cmd', 'int uid', 'void *arg']
 	case 148: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_quotactl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[130];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_quotactl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_quotactl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_quotactl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 149 int quota ['void']
 	case 149: {
+		sub = syscall_sub_freebsd_x64[131];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_quota_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_quota_enter, cpu, pc);
+		}
 	}; break;
 	// 150 int getsockname ['int fdec', 'struct sockaddr *asa', 'int *alen']
 	case 150: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getsockname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[132];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getsockname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getsockname_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getsockname_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 154 int nlm_syscall ['int debug_level', 'int grace_period', 'int addr_count', 'char **addrs']
 	case 154: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_nlm_syscall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[133];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_nlm_syscall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_nlm_syscall_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_nlm_syscall_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 155 int nfssvc ['int flag', 'void *argp']
 	case 155: {
+		sub = syscall_sub_freebsd_x64[134];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_nfssvc_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_nfssvc_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_nfssvc_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_nfssvc_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 156 int getdirentries ['int fd', 'char *buf', 'unsigned count', 'long *basep']
 	case 156: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getdirentries_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[135];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getdirentries_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getdirentries_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_getdirentries_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 157 int statfs ['const char *path', 'struct ostatfs *buf']
 	case 157: {
+		sub = syscall_sub_freebsd_x64[136];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_statfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_statfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_statfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_statfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 158 int fstatfs ['int fd', 'struct ostatfs *buf']
 	case 158: {
+		sub = syscall_sub_freebsd_x64[137];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fstatfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fstatfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fstatfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fstatfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 160 int lgetfh ['const char *fname', 'struct fhandle *fhp']
 	case 160: {
+		sub = syscall_sub_freebsd_x64[138];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lgetfh_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lgetfh_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_lgetfh_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_lgetfh_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 161 int getfh ['const char *fname', 'struct fhandle *fhp']
 	case 161: {
+		sub = syscall_sub_freebsd_x64[139];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getfh_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getfh_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getfh_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getfh_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 162 int getdomainname ['char *domainname', 'int len']
 	case 162: {
+		sub = syscall_sub_freebsd_x64[140];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getdomainname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getdomainname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getdomainname_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getdomainname_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 163 int setdomainname ['char *domainname', 'int len']
 	case 163: {
+		sub = syscall_sub_freebsd_x64[141];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setdomainname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setdomainname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_setdomainname_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_setdomainname_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 164 int uname ['struct utsname *name']
 	case 164: {
+		sub = syscall_sub_freebsd_x64[142];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_uname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_uname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_uname_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_uname_enter, cpu, pc, arg0);
 	}; break;
 	// 165 int sysarch ['int op', 'char *parms']
 	case 165: {
+		sub = syscall_sub_freebsd_x64[143];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sysarch_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sysarch_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sysarch_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sysarch_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 166 int rtprio ['int function', 'pid_t pid', 'struct rtprio *rtp']
 	case 166: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rtprio_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[144];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rtprio_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_rtprio_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_rtprio_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 169 int semsys ['int which', 'int a2', 'int a3', 'int a4', 'int a5']
 	case 169: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_semsys_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_semsys_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[145];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_semsys_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_semsys_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 175 int setfib ['int fibnum']
 	case 175: {
+		sub = syscall_sub_freebsd_x64[146];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setfib_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setfib_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_setfib_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setfib_enter, cpu, pc, arg0);
 	}; break;
 	// 176 int ntp_adjtime ['struct timex *tp']
 	case 176: {
+		sub = syscall_sub_freebsd_x64[147];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ntp_adjtime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ntp_adjtime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ntp_adjtime_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ntp_adjtime_enter, cpu, pc, arg0);
 	}; break;
 	// 181 int setgid ['gid_t gid']
 	case 181: {
+		sub = syscall_sub_freebsd_x64[148];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_setgid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setgid_enter, cpu, pc, arg0);
 	}; break;
 	// 182 int setegid ['gid_t egid']
 	case 182: {
+		sub = syscall_sub_freebsd_x64[149];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setegid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setegid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_setegid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setegid_enter, cpu, pc, arg0);
 	}; break;
 	// 183 int seteuid ['uid_t euid']
 	case 183: {
+		sub = syscall_sub_freebsd_x64[150];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_seteuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_seteuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_seteuid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_seteuid_enter, cpu, pc, arg0);
 	}; break;
 	// 188 int stat ['const char *path', 'struct freebsd11_stat *ub']
 	case 188: {
+		sub = syscall_sub_freebsd_x64[151];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_stat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_stat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_stat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_stat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 189 int fstat ['int fd', 'struct freebsd11_stat *sb']
 	case 189: {
+		sub = syscall_sub_freebsd_x64[152];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 190 int lstat ['const char *path', 'struct freebsd11_stat *ub']
 	case 190: {
+		sub = syscall_sub_freebsd_x64[153];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_lstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_lstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 191 int pathconf ['const char *path', 'int name']
 	case 191: {
+		sub = syscall_sub_freebsd_x64[154];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pathconf_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pathconf_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_pathconf_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_pathconf_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 192 int fpathconf ['int fd', 'int name']
 	case 192: {
+		sub = syscall_sub_freebsd_x64[155];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fpathconf_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fpathconf_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fpathconf_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fpathconf_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 194 int getrlimit ['unsigned which', 'struct rlimit *rlp']
 	case 194: {
+		sub = syscall_sub_freebsd_x64[156];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getrlimit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getrlimit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getrlimit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getrlimit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 195 int setrlimit ['unsigned which', 'struct rlimit *rlp']
 	case 195: {
+		sub = syscall_sub_freebsd_x64[157];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setrlimit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setrlimit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setrlimit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_setrlimit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 196 int getdirentries ['int fd', 'char *buf', 'unsigned count', 'long *basep']
 	case 196: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getdirentries_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[158];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getdirentries_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getdirentries_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_getdirentries_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 198 int nosys ['void']
 	case 198: {
+		sub = syscall_sub_freebsd_x64[159];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_nosys_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_nosys_enter, cpu, pc);
+		}
 	}; break;
 	// 202 int __sysctl ['int *name', 'unsigned namelen', 'void *old', 'size_t *oldlenp', 'const void *new', 'size_t newlen']
 	case 202: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___sysctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on___sysctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[160];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___sysctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on___sysctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 203 int mlock ['const void *addr', 'size_t len']
 	case 203: {
+		sub = syscall_sub_freebsd_x64[161];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mlock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mlock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_mlock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_mlock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 204 int munlock ['const void *addr', 'size_t len']
 	case 204: {
+		sub = syscall_sub_freebsd_x64[162];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_munlock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_munlock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_munlock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_munlock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 205 int undelete ['const char *path']
 	case 205: {
+		sub = syscall_sub_freebsd_x64[163];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_undelete_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_undelete_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_undelete_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_undelete_enter, cpu, pc, arg0);
 	}; break;
 	// 206 int futimes ['int fd', 'struct timeval *tptr']
 	case 206: {
+		sub = syscall_sub_freebsd_x64[164];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_futimes_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_futimes_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_futimes_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_futimes_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 207 int getpgid ['pid_t pid']
 	case 207: {
+		sub = syscall_sub_freebsd_x64[165];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getpgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getpgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getpgid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_getpgid_enter, cpu, pc, arg0);
 	}; break;
 	// 209 int poll ['struct pollfd *fds', 'unsigned nfds', 'int timeout']
 	case 209: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_poll_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[166];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_poll_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_poll_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_poll_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 220 int __semctl ['int semid', 'int semnum', 'int cmd', 'union semun_old *arg']
 	case 220: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___semctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[167];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___semctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___semctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on___semctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 221 int semget ['key_t key', 'int nsems', 'int semflg']
 	case 221: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_semget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[168];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_semget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_semget_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_semget_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 222 int semop ['int semid', 'struct sembuf *sops', 'size_t nsops']
 	case 222: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_semop_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[169];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_semop_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_semop_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_semop_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 224 int msgctl ['int msqid', 'int cmd', 'struct msqid_ds_old *buf']
 	case 224: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_msgctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[170];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_msgctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_msgctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_msgctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 225 int msgget ['key_t key', 'int msgflg']
 	case 225: {
+		sub = syscall_sub_freebsd_x64[171];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_msgget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_msgget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_msgget_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_msgget_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 226 int msgsnd ['int msqid', 'const void *msgp', 'size_t msgsz', 'int msgflg']
 	case 226: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_msgsnd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[172];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_msgsnd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_msgsnd_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_msgsnd_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 227 ssize_t msgrcv ['int msqid', 'void *msgp', 'size_t msgsz', 'long msgtyp', 'int msgflg']
 	case 227: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int64_t arg3 = get_s64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_msgrcv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_msgrcv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[173];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int64_t arg3 = get_s64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_msgrcv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_msgrcv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 229 int shmctl ['int shmid', 'int cmd', 'struct shmid_ds_old *buf']
 	case 229: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shmctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[174];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shmctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_shmctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_shmctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 230 int shmdt ['const void *shmaddr']
 	case 230: {
+		sub = syscall_sub_freebsd_x64[175];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shmdt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shmdt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_shmdt_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_shmdt_enter, cpu, pc, arg0);
 	}; break;
 	// 231 int shmget ['key_t key', 'size_t size', 'int shmflg']
 	case 231: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shmget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[176];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shmget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_shmget_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_shmget_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 232 int clock_gettime ['clockid_t clock_id', 'struct timespec *tp']
 	case 232: {
+		sub = syscall_sub_freebsd_x64[177];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_clock_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_clock_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_clock_gettime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_clock_gettime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 233 int clock_settime ['clockid_t clock_id', 'const struct timespec *tp']
 	case 233: {
+		sub = syscall_sub_freebsd_x64[178];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_clock_settime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_clock_settime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_clock_settime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_clock_settime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 234 int clock_getres ['clockid_t clock_id', 'struct timespec *tp']
 	case 234: {
+		sub = syscall_sub_freebsd_x64[179];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_clock_getres_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_clock_getres_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_clock_getres_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_clock_getres_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 235 int ktimer_create ['clockid_t clock_id', 'struct sigevent *evp', 'int *timerid']
 	case 235: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ktimer_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[180];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ktimer_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ktimer_create_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_ktimer_create_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 236 int ktimer_delete ['int timerid']
 	case 236: {
+		sub = syscall_sub_freebsd_x64[181];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ktimer_delete_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ktimer_delete_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_ktimer_delete_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ktimer_delete_enter, cpu, pc, arg0);
 	}; break;
 	// 237 int ktimer_settime ['int timerid', 'int flags', 'const struct itimerspec *value', 'struct itimerspec *ovalue']
 	case 237: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ktimer_settime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[182];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ktimer_settime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ktimer_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_ktimer_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 238 int ktimer_gettime ['int timerid', 'struct itimerspec *value']
 	case 238: {
+		sub = syscall_sub_freebsd_x64[183];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ktimer_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ktimer_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ktimer_gettime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_ktimer_gettime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 239 int ktimer_getoverrun ['int timerid']
 	case 239: {
+		sub = syscall_sub_freebsd_x64[184];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ktimer_getoverrun_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ktimer_getoverrun_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_ktimer_getoverrun_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ktimer_getoverrun_enter, cpu, pc, arg0);
 	}; break;
 	// 240 int nanosleep ['const struct timespec *rqtp', 'struct timespec *rmtp']
 	case 240: {
+		sub = syscall_sub_freebsd_x64[185];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_nanosleep_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_nanosleep_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_nanosleep_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_nanosleep_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 241 int ffclock_getcounter ['ffcounter *ffcount']
 	case 241: {
+		sub = syscall_sub_freebsd_x64[186];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ffclock_getcounter_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ffclock_getcounter_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ffclock_getcounter_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ffclock_getcounter_enter, cpu, pc, arg0);
 	}; break;
 	// 242 int ffclock_setestimate ['struct ffclock_estimate *cest']
 	case 242: {
+		sub = syscall_sub_freebsd_x64[187];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ffclock_setestimate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ffclock_setestimate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ffclock_setestimate_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ffclock_setestimate_enter, cpu, pc, arg0);
 	}; break;
 	// 243 int ffclock_getestimate ['struct ffclock_estimate *cest']
 	case 243: {
+		sub = syscall_sub_freebsd_x64[188];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ffclock_getestimate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ffclock_getestimate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ffclock_getestimate_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ffclock_getestimate_enter, cpu, pc, arg0);
 	}; break;
 	// 244 int clock_nanosleep ['clockid_t clock_id', 'int flags', 'const struct timespec *rqtp', 'struct timespec *rmtp']
 	case 244: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_clock_nanosleep_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[189];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_clock_nanosleep_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_clock_nanosleep_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_clock_nanosleep_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 247 int clock_getcpuclockid2 ['id_t id', 'int which', 'clockid_t *clock_id']
 	case 247: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_clock_getcpuclockid2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[190];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_clock_getcpuclockid2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_clock_getcpuclockid2_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_clock_getcpuclockid2_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 248 int ntp_gettime ['struct ntptimeval *ntvp']
 	case 248: {
+		sub = syscall_sub_freebsd_x64[191];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ntp_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ntp_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ntp_gettime_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ntp_gettime_enter, cpu, pc, arg0);
 	}; break;
 	// 250 int minherit ['void *addr', 'size_t len', 'int inherit']
 	case 250: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_minherit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[192];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_minherit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_minherit_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_minherit_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 251 int rfork ['int flags']
 	case 251: {
+		sub = syscall_sub_freebsd_x64[193];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rfork_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rfork_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_rfork_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_rfork_enter, cpu, pc, arg0);
 	}; break;
 	// 253 int issetugid ['void']
 	case 253: {
+		sub = syscall_sub_freebsd_x64[194];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_issetugid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_issetugid_enter, cpu, pc);
+		}
 	}; break;
 	// 254 int lchown ['const char *path', 'int uid', 'int gid']
 	case 254: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lchown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[195];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lchown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_lchown_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_lchown_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 255 int aio_read ['struct aiocb *aiocbp']
 	case 255: {
+		sub = syscall_sub_freebsd_x64[196];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_read_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_read_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_read_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_aio_read_enter, cpu, pc, arg0);
 	}; break;
 	// 256 int aio_write ['struct aiocb *aiocbp']
 	case 256: {
+		sub = syscall_sub_freebsd_x64[197];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_write_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_write_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_write_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_aio_write_enter, cpu, pc, arg0);
 	}; break;
 	// 257 int lio_listio ['int mode', 'struct aiocb * const *acb_list', 'int nent', 'struct sigevent *sig']
 	case 257: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lio_listio_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[198];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lio_listio_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_lio_listio_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_lio_listio_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 272 int getdents ['int fd', 'char *buf', 'size_t count']
 	case 272: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getdents_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[199];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getdents_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_getdents_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getdents_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 274 int lchmod ['const char *path', 'mode_t mode']
 	case 274: {
+		sub = syscall_sub_freebsd_x64[200];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lchmod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lchmod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_lchmod_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_lchmod_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 276 int lutimes ['const char *path', 'struct timeval *tptr']
 	case 276: {
+		sub = syscall_sub_freebsd_x64[201];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lutimes_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lutimes_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_lutimes_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_lutimes_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 278 int nstat ['const char *path', 'struct nstat *ub']
 	case 278: {
+		sub = syscall_sub_freebsd_x64[202];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_nstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_nstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_nstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_nstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 279 int nfstat ['int fd', 'struct nstat *sb']
 	case 279: {
+		sub = syscall_sub_freebsd_x64[203];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_nfstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_nfstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_nfstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_nfstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 280 int nlstat ['const char *path', 'struct nstat *ub']
 	case 280: {
+		sub = syscall_sub_freebsd_x64[204];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_nlstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_nlstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_nlstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_nlstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 289 ssize_t preadv ['int fd', 'struct iovec *iovp', 'unsigned iovcnt', 'off_t offset']
 	case 289: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_preadv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[205];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_preadv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_preadv_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_preadv_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 290 ssize_t pwritev ['int fd', 'struct iovec *iovp', 'unsigned iovcnt', 'off_t offset']
 	case 290: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pwritev_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[206];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pwritev_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_pwritev_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_pwritev_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 297 int fhstatfs ['const struct fhandle *u_fhp', 'struct ostatfs *buf']
 	case 297: {
+		sub = syscall_sub_freebsd_x64[207];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhstatfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhstatfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fhstatfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fhstatfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 298 int fhopen ['const struct fhandle *u_fhp', 'int flags']
 	case 298: {
+		sub = syscall_sub_freebsd_x64[208];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhopen_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhopen_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fhopen_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fhopen_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 299 int fhstat ['const struct fhandle *u_fhp', 'struct freebsd11_stat *sb']
 	case 299: {
+		sub = syscall_sub_freebsd_x64[209];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fhstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fhstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 300 int modnext ['int modid']
 	case 300: {
+		sub = syscall_sub_freebsd_x64[210];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_modnext_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_modnext_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_modnext_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_modnext_enter, cpu, pc, arg0);
 	}; break;
 	// 301 int modstat ['int modid', 'struct module_stat *stat']
 	case 301: {
+		sub = syscall_sub_freebsd_x64[211];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_modstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_modstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_modstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_modstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 302 int modfnext ['int modid']
 	case 302: {
+		sub = syscall_sub_freebsd_x64[212];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_modfnext_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_modfnext_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_modfnext_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_modfnext_enter, cpu, pc, arg0);
 	}; break;
 	// 303 int modfind ['const char *name']
 	case 303: {
+		sub = syscall_sub_freebsd_x64[213];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_modfind_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_modfind_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_modfind_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_modfind_enter, cpu, pc, arg0);
 	}; break;
 	// 304 int kldload ['const char *file']
 	case 304: {
+		sub = syscall_sub_freebsd_x64[214];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kldload_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kldload_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kldload_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_kldload_enter, cpu, pc, arg0);
 	}; break;
 	// 305 int kldunload ['int fileid']
 	case 305: {
+		sub = syscall_sub_freebsd_x64[215];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kldunload_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kldunload_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_kldunload_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_kldunload_enter, cpu, pc, arg0);
 	}; break;
 	// 306 int kldfind ['const char *file']
 	case 306: {
+		sub = syscall_sub_freebsd_x64[216];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kldfind_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kldfind_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kldfind_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_kldfind_enter, cpu, pc, arg0);
 	}; break;
 	// 307 int kldnext ['int fileid']
 	case 307: {
+		sub = syscall_sub_freebsd_x64[217];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kldnext_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kldnext_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_kldnext_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_kldnext_enter, cpu, pc, arg0);
 	}; break;
 	// 308 int kldstat ['int fileid', 'struct kld_file_stat *stat']
 	case 308: {
+		sub = syscall_sub_freebsd_x64[218];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kldstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kldstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kldstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_kldstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 309 int kldfirstmod ['int fileid']
 	case 309: {
+		sub = syscall_sub_freebsd_x64[219];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kldfirstmod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kldfirstmod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_kldfirstmod_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_kldfirstmod_enter, cpu, pc, arg0);
 	}; break;
 	// 310 int getsid ['pid_t pid']
 	case 310: {
+		sub = syscall_sub_freebsd_x64[220];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getsid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getsid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getsid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_getsid_enter, cpu, pc, arg0);
 	}; break;
 	// 311 int setresuid ['uid_t ruid', 'uid_t euid', 'uid_t suid']
 	case 311: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setresuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[221];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setresuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_setresuid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_setresuid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 312 int setresgid ['gid_t rgid', 'gid_t egid', 'gid_t sgid']
 	case 312: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setresgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[222];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setresgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_setresgid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_setresgid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 314 ssize_t aio_return ['struct aiocb *aiocbp']
 	case 314: {
+		sub = syscall_sub_freebsd_x64[223];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_return_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_return_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_return_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_aio_return_enter, cpu, pc, arg0);
 	}; break;
 	// 315 int aio_suspend ['struct aiocb * const * aiocbp', 'int nent', 'const struct timespec *timeout']
 	case 315: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_suspend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[224];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_suspend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_suspend_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_aio_suspend_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 316 int aio_cancel ['int fd', 'struct aiocb *aiocbp']
 	case 316: {
+		sub = syscall_sub_freebsd_x64[225];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_cancel_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_cancel_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_cancel_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_aio_cancel_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 317 int aio_error ['struct aiocb *aiocbp']
 	case 317: {
+		sub = syscall_sub_freebsd_x64[226];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_error_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_error_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_error_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_aio_error_enter, cpu, pc, arg0);
 	}; break;
 	// 318 int aio_read ['struct oaiocb *aiocbp']
 	case 318: {
+		sub = syscall_sub_freebsd_x64[227];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_read_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_read_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_read_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_aio_read_enter, cpu, pc, arg0);
 	}; break;
 	// 319 int aio_write ['struct oaiocb *aiocbp']
 	case 319: {
+		sub = syscall_sub_freebsd_x64[228];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_write_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_write_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_write_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_aio_write_enter, cpu, pc, arg0);
 	}; break;
 	// 320 int lio_listio ['int mode', 'struct oaiocb * const *acb_list', 'int nent', 'struct osigevent *sig']
 	case 320: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lio_listio_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[229];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lio_listio_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_lio_listio_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_lio_listio_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 321 int yield ['void']
 	case 321: {
+		sub = syscall_sub_freebsd_x64[230];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_yield_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_yield_enter, cpu, pc);
+		}
 	}; break;
 	// 324 int mlockall ['int how']
 	case 324: {
+		sub = syscall_sub_freebsd_x64[231];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mlockall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mlockall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_mlockall_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_mlockall_enter, cpu, pc, arg0);
 	}; break;
 	// 325 int munlockall(void); 326 int __getcwd ['char *buf', 'size_t buflen']
 	case 325: {
+		sub = syscall_sub_freebsd_x64[232];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___getcwd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___getcwd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on___getcwd_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___getcwd_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 327 int sched_setparam ['pid_t pid', 'const struct sched_param *param']
 	case 327: {
+		sub = syscall_sub_freebsd_x64[233];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sched_setparam_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sched_setparam_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sched_setparam_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sched_setparam_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 328 int sched_getparam ['pid_t pid', 'struct sched_param *param']
 	case 328: {
+		sub = syscall_sub_freebsd_x64[234];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sched_getparam_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sched_getparam_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sched_getparam_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sched_getparam_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 329 int sched_setscheduler ['pid_t pid', 'int policy', 'const struct sched_param *param']
 	case 329: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sched_setscheduler_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[235];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sched_setscheduler_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sched_setscheduler_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sched_setscheduler_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 330 int sched_getscheduler ['pid_t pid']
 	case 330: {
+		sub = syscall_sub_freebsd_x64[236];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sched_getscheduler_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sched_getscheduler_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sched_getscheduler_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sched_getscheduler_enter, cpu, pc, arg0);
 	}; break;
 	// 331 int sched_yield ['void']
 	case 331: {
+		sub = syscall_sub_freebsd_x64[237];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sched_yield_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sched_yield_enter, cpu, pc);
+		}
 	}; break;
 	// 332 int sched_get_priority_max ['int policy']
 	case 332: {
+		sub = syscall_sub_freebsd_x64[238];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sched_get_priority_max_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sched_get_priority_max_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sched_get_priority_max_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sched_get_priority_max_enter, cpu, pc, arg0);
 	}; break;
 	// 333 int sched_get_priority_min ['int policy']
 	case 333: {
+		sub = syscall_sub_freebsd_x64[239];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sched_get_priority_min_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sched_get_priority_min_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sched_get_priority_min_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sched_get_priority_min_enter, cpu, pc, arg0);
 	}; break;
 	// 334 int sched_rr_get_interval ['pid_t pid', 'struct timespec *interval']
 	case 334: {
+		sub = syscall_sub_freebsd_x64[240];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sched_rr_get_interval_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sched_rr_get_interval_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sched_rr_get_interval_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sched_rr_get_interval_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 335 int utrace ['const void *addr', 'size_t len']
 	case 335: {
+		sub = syscall_sub_freebsd_x64[241];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_utrace_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_utrace_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_utrace_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_utrace_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 336 int sendfile ['int fd', 'int s', 'off_t offset', 'size_t nbytes', 'struct sf_hdtr *hdtr', 'off_t *sbytes', 'int flags']
 	case 336: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		int32_t arg6 = get_s32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sendfile_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-			memcpy(ctx.args[6], &arg6, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sendfile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		sub = syscall_sub_freebsd_x64[242];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			int32_t arg6 = get_s32(cpu, 6);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sendfile_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+				memcpy(ctx.args[6], &arg6, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sendfile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		}
 	}; break;
 	// 337 int kldsym ['int fileid', 'int cmd', 'void *data']
 	case 337: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kldsym_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[243];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kldsym_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kldsym_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_kldsym_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 338 int jail ['struct jail *jail']
 	case 338: {
+		sub = syscall_sub_freebsd_x64[244];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_jail_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_jail_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_jail_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_jail_enter, cpu, pc, arg0);
 	}; break;
 	// 339 int nnpfs_syscall ['int operation', 'char *a_pathP', 'int a_opcode', 'void *a_paramsP', 'int a_followSymlinks']
 	case 339: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_nnpfs_syscall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_nnpfs_syscall_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[245];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_nnpfs_syscall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_nnpfs_syscall_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 340 int sigprocmask ['int how', 'const sigset_t *set', 'sigset_t *oset']
 	case 340: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigprocmask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[246];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigprocmask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigprocmask_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sigprocmask_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 341 int sigsuspend ['const sigset_t *sigmask']
 	case 341: {
+		sub = syscall_sub_freebsd_x64[247];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigsuspend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigsuspend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigsuspend_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sigsuspend_enter, cpu, pc, arg0);
 	}; break;
 	// 342 int sigaction ['int sig', 'const struct sigaction *act', 'struct sigaction *oact']
 	case 342: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigaction_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[248];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigaction_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigaction_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sigaction_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 343 int sigpending ['sigset_t *set']
 	case 343: {
+		sub = syscall_sub_freebsd_x64[249];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigpending_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigpending_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigpending_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sigpending_enter, cpu, pc, arg0);
 	}; break;
 	// 344 int sigreturn ['const struct ucontext4 *sigcntxp']
 	case 344: {
+		sub = syscall_sub_freebsd_x64[250];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigreturn_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigreturn_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigreturn_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sigreturn_enter, cpu, pc, arg0);
 	}; break;
 	// 345 int sigtimedwait ['const sigset_t *set', 'siginfo_t *info', 'const struct timespec *timeout']
 	case 345: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigtimedwait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[251];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigtimedwait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigtimedwait_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sigtimedwait_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 346 int sigwaitinfo ['const sigset_t *set', 'siginfo_t *info']
 	case 346: {
+		sub = syscall_sub_freebsd_x64[252];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigwaitinfo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigwaitinfo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigwaitinfo_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sigwaitinfo_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 347 int __acl_get_file ['const char *path', 'acl_type_t type', 'struct acl *aclp']
 	case 347: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_get_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[253];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_get_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_get_file_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_get_file_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 348 int __acl_set_file ['const char *path', 'acl_type_t type', 'struct acl *aclp']
 	case 348: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_set_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[254];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_set_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_set_file_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_set_file_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 349 int __acl_get_fd ['int filedes', 'acl_type_t type', 'struct acl *aclp']
 	case 349: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_get_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[255];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_get_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_get_fd_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_get_fd_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 350 int __acl_set_fd ['int filedes', 'acl_type_t type', 'struct acl *aclp']
 	case 350: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_set_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[256];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_set_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_set_fd_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_set_fd_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 351 int __acl_delete_file ['const char *path', 'acl_type_t type']
 	case 351: {
+		sub = syscall_sub_freebsd_x64[257];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_delete_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_delete_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on___acl_delete_file_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___acl_delete_file_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 352 int __acl_delete_fd ['int filedes', 'acl_type_t type']
 	case 352: {
+		sub = syscall_sub_freebsd_x64[258];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_delete_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_delete_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on___acl_delete_fd_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___acl_delete_fd_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 353 int __acl_aclcheck_file ['const char *path', 'acl_type_t type', 'struct acl *aclp']
 	case 353: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_aclcheck_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[259];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_aclcheck_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_aclcheck_file_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_aclcheck_file_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 354 int __acl_aclcheck_fd ['int filedes', 'acl_type_t type', 'struct acl *aclp']
 	case 354: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_aclcheck_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[260];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_aclcheck_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_aclcheck_fd_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_aclcheck_fd_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 355 int extattrctl ['const char *path', 'int cmd', 'const char *filename', 'int attrnamespace', 'const char *attrname']
 	case 355: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattrctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_extattrctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[261];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattrctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_extattrctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 356 ssize_t extattr_set_file ['const char *path', 'int attrnamespace', 'const char *attrname', 'void *data', 'size_t nbytes']
 	case 356: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_set_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_extattr_set_file_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[262];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_set_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_set_file_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 357 ssize_t extattr_get_file ['const char *path', 'int attrnamespace', 'const char *attrname', 'void *data', 'size_t nbytes']
 	case 357: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_get_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_extattr_get_file_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[263];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_get_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_get_file_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 358 int extattr_delete_file ['const char *path', 'int attrnamespace', 'const char *attrname']
 	case 358: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_delete_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[264];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_delete_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_extattr_delete_file_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_extattr_delete_file_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 359 ssize_t aio_waitcomplete ['struct aiocb **aiocbp', 'struct timespec *timeout']
 	case 359: {
+		sub = syscall_sub_freebsd_x64[265];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_waitcomplete_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_waitcomplete_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_waitcomplete_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_aio_waitcomplete_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 360 int getresuid ['uid_t *ruid', 'uid_t *euid', 'uid_t *suid']
 	case 360: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getresuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[266];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getresuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getresuid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getresuid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 361 int getresgid ['gid_t *rgid', 'gid_t *egid', 'gid_t *sgid']
 	case 361: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getresgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[267];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getresgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getresgid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getresgid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 362 int kqueue ['void']
 	case 362: {
+		sub = syscall_sub_freebsd_x64[268];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_kqueue_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_kqueue_enter, cpu, pc);
+		}
 	}; break;
 	// 363 int kevent ['int fd', 'struct kevent_freebsd11 *changelist', 'int nchanges', 'struct kevent_freebsd11 *eventlist', 'int nevents', 'const struct timespec *timeout']
 	case 363: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kevent_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_kevent_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[269];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kevent_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kevent_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 371 ssize_t extattr_set_fd ['int fd', 'int attrnamespace', 'const char *attrname', 'void *data', 'size_t nbytes']
 	case 371: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_set_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_extattr_set_fd_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[270];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_set_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_set_fd_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 372 ssize_t extattr_get_fd ['int fd', 'int attrnamespace', 'const char *attrname', 'void *data', 'size_t nbytes']
 	case 372: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_get_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_extattr_get_fd_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[271];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_get_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_get_fd_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 373 int extattr_delete_fd ['int fd', 'int attrnamespace', 'const char *attrname']
 	case 373: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_delete_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[272];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_delete_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_extattr_delete_fd_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_extattr_delete_fd_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 374 int __setugid ['int flag']
 	case 374: {
+		sub = syscall_sub_freebsd_x64[273];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___setugid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___setugid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on___setugid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on___setugid_enter, cpu, pc, arg0);
 	}; break;
 	// 376 int eaccess ['const char *path', 'int amode']
 	case 376: {
+		sub = syscall_sub_freebsd_x64[274];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_eaccess_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_eaccess_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_eaccess_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_eaccess_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 377 int afs3_syscall ['long syscall', 'long parm1', 'long parm2', 'long parm3', 'long parm4', 'long parm5', 'long parm6']
 	case 377: {
-		panda_noreturn = false;
-		int64_t arg0 = get_s64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		int64_t arg2 = get_s64(cpu, 2);
-		int64_t arg3 = get_s64(cpu, 3);
-		int64_t arg4 = get_s64(cpu, 4);
-		int64_t arg5 = get_s64(cpu, 5);
-		int64_t arg6 = get_s64(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_afs3_syscall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(int64_t));
-			memcpy(ctx.args[6], &arg6, sizeof(int64_t));
-		}
-		PPP_RUN_CB(on_afs3_syscall_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		sub = syscall_sub_freebsd_x64[275];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int64_t arg0 = get_s64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			int64_t arg2 = get_s64(cpu, 2);
+			int64_t arg3 = get_s64(cpu, 3);
+			int64_t arg4 = get_s64(cpu, 4);
+			int64_t arg5 = get_s64(cpu, 5);
+			int64_t arg6 = get_s64(cpu, 6);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_afs3_syscall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(int64_t));
+				memcpy(ctx.args[6], &arg6, sizeof(int64_t));
+			}
+			PPP_RUN_CB(on_afs3_syscall_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		}
 	}; break;
 	// 378 int nmount ['struct iovec *iovp', 'unsigned int iovcnt', 'int flags']
 	case 378: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_nmount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[276];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_nmount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_nmount_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_nmount_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 384 int __mac_get_proc ['struct mac *mac_p']
 	case 384: {
+		sub = syscall_sub_freebsd_x64[277];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_get_proc_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_get_proc_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_get_proc_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on___mac_get_proc_enter, cpu, pc, arg0);
 	}; break;
 	// 385 int __mac_set_proc ['struct mac *mac_p']
 	case 385: {
+		sub = syscall_sub_freebsd_x64[278];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_set_proc_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_set_proc_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_set_proc_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on___mac_set_proc_enter, cpu, pc, arg0);
 	}; break;
 	// 386 int __mac_get_fd ['int fd', 'struct mac *mac_p']
 	case 386: {
+		sub = syscall_sub_freebsd_x64[279];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_get_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_get_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_get_fd_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___mac_get_fd_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 387 int __mac_get_file ['const char *path_p', 'struct mac *mac_p']
 	case 387: {
+		sub = syscall_sub_freebsd_x64[280];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_get_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_get_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_get_file_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___mac_get_file_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 388 int __mac_set_fd ['int fd', 'struct mac *mac_p']
 	case 388: {
+		sub = syscall_sub_freebsd_x64[281];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_set_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_set_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_set_fd_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___mac_set_fd_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 389 int __mac_set_file ['const char *path_p', 'struct mac *mac_p']
 	case 389: {
+		sub = syscall_sub_freebsd_x64[282];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_set_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_set_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_set_file_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___mac_set_file_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 390 int kenv ['int what', 'const char *name', 'char *value', 'int len']
 	case 390: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kenv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[283];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kenv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_kenv_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_kenv_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 391 int lchflags ['const char *path', 'u_long flags']
 	case 391: {
+		sub = syscall_sub_freebsd_x64[284];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lchflags_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lchflags_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+			}
+			PPP_RUN_CB(on_lchflags_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_lchflags_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 392 int uuidgen ['struct uuid *store', 'int count']
 	case 392: {
+		sub = syscall_sub_freebsd_x64[285];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_uuidgen_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_uuidgen_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_uuidgen_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_uuidgen_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 393 int sendfile ['int fd', 'int s', 'off_t offset', 'size_t nbytes', 'struct sf_hdtr *hdtr', 'off_t *sbytes', 'int flags']
 	case 393: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		int32_t arg6 = get_s32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sendfile_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-			memcpy(ctx.args[6], &arg6, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sendfile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		sub = syscall_sub_freebsd_x64[286];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			int32_t arg6 = get_s32(cpu, 6);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sendfile_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+				memcpy(ctx.args[6], &arg6, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sendfile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		}
 	}; break;
 	// 394 int mac_syscall ['const char *policy', 'int call', 'void *arg']
 	case 394: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mac_syscall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[287];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mac_syscall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_mac_syscall_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_mac_syscall_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 395 int getfsstat ['struct freebsd11_statfs *buf', 'long bufsize', 'int mode']
 	case 395: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getfsstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[288];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getfsstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getfsstat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getfsstat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 396 int statfs ['const char *path', 'struct freebsd11_statfs *buf']
 	case 396: {
+		sub = syscall_sub_freebsd_x64[289];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_statfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_statfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_statfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_statfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 397 int fstatfs ['int fd', 'struct freebsd11_statfs *buf']
 	case 397: {
+		sub = syscall_sub_freebsd_x64[290];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fstatfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fstatfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fstatfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fstatfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 398 int fhstatfs ['const struct fhandle *u_fhp', 'struct freebsd11_statfs *buf']
 	case 398: {
+		sub = syscall_sub_freebsd_x64[291];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhstatfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhstatfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fhstatfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fhstatfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 400 int ksem_close ['semid_t id']
 	case 400: {
+		sub = syscall_sub_freebsd_x64[292];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_close_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_close_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_ksem_close_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ksem_close_enter, cpu, pc, arg0);
 	}; break;
 	// 401 int ksem_post ['semid_t id']
 	case 401: {
+		sub = syscall_sub_freebsd_x64[293];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_post_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_post_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_ksem_post_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ksem_post_enter, cpu, pc, arg0);
 	}; break;
 	// 402 int ksem_wait ['semid_t id']
 	case 402: {
+		sub = syscall_sub_freebsd_x64[294];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_wait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_wait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_ksem_wait_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ksem_wait_enter, cpu, pc, arg0);
 	}; break;
 	// 403 int ksem_trywait ['semid_t id']
 	case 403: {
+		sub = syscall_sub_freebsd_x64[295];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_trywait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_trywait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_ksem_trywait_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ksem_trywait_enter, cpu, pc, arg0);
 	}; break;
 	// 404 int ksem_init ['semid_t *idp', 'unsigned int value']
 	case 404: {
+		sub = syscall_sub_freebsd_x64[296];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_init_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_init_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_ksem_init_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_ksem_init_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 405 int ksem_open ['semid_t *idp', 'const char *name', 'int oflag', 'mode_t mode', 'unsigned int value']
 	case 405: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_ksem_open_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[297];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_ksem_open_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 406 int ksem_unlink ['const char *name']
 	case 406: {
+		sub = syscall_sub_freebsd_x64[298];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_unlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_unlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ksem_unlink_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ksem_unlink_enter, cpu, pc, arg0);
 	}; break;
 	// 407 int ksem_getvalue ['semid_t id', 'int *val']
 	case 407: {
+		sub = syscall_sub_freebsd_x64[299];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_getvalue_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_getvalue_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ksem_getvalue_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_ksem_getvalue_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 408 int ksem_destroy ['semid_t id']
 	case 408: {
+		sub = syscall_sub_freebsd_x64[300];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_destroy_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_destroy_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_ksem_destroy_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_ksem_destroy_enter, cpu, pc, arg0);
 	}; break;
 	// 409 int __mac_get_pid ['pid_t pid', 'struct mac *mac_p']
 	case 409: {
+		sub = syscall_sub_freebsd_x64[301];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_get_pid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_get_pid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_get_pid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___mac_get_pid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 410 int __mac_get_link ['const char *path_p', 'struct mac *mac_p']
 	case 410: {
+		sub = syscall_sub_freebsd_x64[302];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_get_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_get_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_get_link_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___mac_get_link_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 411 int __mac_set_link ['const char *path_p', 'struct mac *mac_p']
 	case 411: {
+		sub = syscall_sub_freebsd_x64[303];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_set_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_set_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_set_link_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___mac_set_link_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 412 ssize_t extattr_set_link ['const char *path', 'int attrnamespace', 'const char *attrname', 'void *data', 'size_t nbytes']
 	case 412: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_set_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_extattr_set_link_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[304];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_set_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_set_link_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 413 ssize_t extattr_get_link ['const char *path', 'int attrnamespace', 'const char *attrname', 'void *data', 'size_t nbytes']
 	case 413: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_get_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_extattr_get_link_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[305];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_get_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_get_link_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 414 int extattr_delete_link ['const char *path', 'int attrnamespace', 'const char *attrname']
 	case 414: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_delete_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[306];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_delete_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_extattr_delete_link_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_extattr_delete_link_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 415 int __mac_execve ['const char *fname', 'char **argv', 'char **envv', 'struct mac *mac_p']
 	case 415: {
+		sub = syscall_sub_freebsd_x64[307];
+		if (!sub) return;
 		panda_noreturn = true;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___mac_execve_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on___mac_execve_enter, cpu, pc, arg0, arg1, arg2, arg3);
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___mac_execve_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___mac_execve_enter, cpu, pc, arg0, arg1, arg2, arg3);
+		}
 	}; break;
 	// 416 int sigaction ['int sig', 'const struct sigaction *act', 'struct sigaction *oact']
 	case 416: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigaction_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[308];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigaction_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigaction_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sigaction_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 417 int sigreturn ['const struct __ucontext *sigcntxp']
 	case 417: {
+		sub = syscall_sub_freebsd_x64[309];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigreturn_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigreturn_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigreturn_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sigreturn_enter, cpu, pc, arg0);
 	}; break;
 	// 421 int getcontext ['struct __ucontext *ucp']
 	case 421: {
+		sub = syscall_sub_freebsd_x64[310];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getcontext_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getcontext_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getcontext_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_getcontext_enter, cpu, pc, arg0);
 	}; break;
 	// 422 int setcontext ['const struct __ucontext *ucp']
 	case 422: {
+		sub = syscall_sub_freebsd_x64[311];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setcontext_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setcontext_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setcontext_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setcontext_enter, cpu, pc, arg0);
 	}; break;
 	// 423 int swapcontext ['struct __ucontext *oucp', 'const struct __ucontext *ucp']
 	case 423: {
+		sub = syscall_sub_freebsd_x64[312];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_swapcontext_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_swapcontext_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_swapcontext_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_swapcontext_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 424 int swapoff ['const char *name']
 	case 424: {
+		sub = syscall_sub_freebsd_x64[313];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_swapoff_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_swapoff_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_swapoff_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_swapoff_enter, cpu, pc, arg0);
 	}; break;
 	// 425 int __acl_get_link ['const char *path', 'acl_type_t type', 'struct acl *aclp']
 	case 425: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_get_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[314];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_get_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_get_link_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_get_link_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 426 int __acl_set_link ['const char *path', 'acl_type_t type', 'struct acl *aclp']
 	case 426: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_set_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[315];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_set_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_set_link_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_set_link_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 427 int __acl_delete_link ['const char *path', 'acl_type_t type']
 	case 427: {
+		sub = syscall_sub_freebsd_x64[316];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_delete_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_delete_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on___acl_delete_link_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on___acl_delete_link_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 428 int __acl_aclcheck_link ['const char *path', 'acl_type_t type', 'struct acl *aclp']
 	case 428: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___acl_aclcheck_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[317];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___acl_aclcheck_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___acl_aclcheck_link_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___acl_aclcheck_link_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 429 int sigwait ['const sigset_t *set', 'int *sig']
 	case 429: {
+		sub = syscall_sub_freebsd_x64[318];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigwait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigwait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigwait_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sigwait_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 430 int thr_create ['ucontext_t *ctx', 'long *id', 'int flags']
 	case 430: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[319];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_thr_create_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_thr_create_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 431 void thr_exit ['long *state']
 	case 431: {
+		sub = syscall_sub_freebsd_x64[320];
+		if (!sub) return;
 		panda_noreturn = true;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_exit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_exit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_thr_exit_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_thr_exit_enter, cpu, pc, arg0);
 	}; break;
 	// 432 int thr_self ['long *id']
 	case 432: {
+		sub = syscall_sub_freebsd_x64[321];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_self_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_self_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_thr_self_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_thr_self_enter, cpu, pc, arg0);
 	}; break;
 	// 433 int thr_kill ['long id', 'int sig']
 	case 433: {
+		sub = syscall_sub_freebsd_x64[322];
+		if (!sub) return;
 		panda_noreturn = false;
-		int64_t arg0 = get_s64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_kill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int64_t arg0 = get_s64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_kill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_thr_kill_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_thr_kill_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 436 int jail_attach ['int jid']
 	case 436: {
+		sub = syscall_sub_freebsd_x64[323];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_jail_attach_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_jail_attach_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_jail_attach_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_jail_attach_enter, cpu, pc, arg0);
 	}; break;
 	// 437 ssize_t extattr_list_fd ['int fd', 'int attrnamespace', 'void *data', 'size_t nbytes']
 	case 437: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_list_fd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[324];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_list_fd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_list_fd_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_extattr_list_fd_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 438 ssize_t extattr_list_file ['const char *path', 'int attrnamespace', 'void *data', 'size_t nbytes']
 	case 438: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_list_file_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[325];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_list_file_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_list_file_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_extattr_list_file_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 439 ssize_t extattr_list_link ['const char *path', 'int attrnamespace', 'void *data', 'size_t nbytes']
 	case 439: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_extattr_list_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[326];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_extattr_list_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_extattr_list_link_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_extattr_list_link_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 441 int ksem_timedwait ['semid_t id', 'const struct timespec *abstime']
 	case 441: {
+		sub = syscall_sub_freebsd_x64[327];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ksem_timedwait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ksem_timedwait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ksem_timedwait_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_ksem_timedwait_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 442 int thr_suspend ['const struct timespec *timeout']
 	case 442: {
+		sub = syscall_sub_freebsd_x64[328];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_suspend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_suspend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_thr_suspend_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_thr_suspend_enter, cpu, pc, arg0);
 	}; break;
 	// 443 int thr_wake ['long id']
 	case 443: {
+		sub = syscall_sub_freebsd_x64[329];
+		if (!sub) return;
 		panda_noreturn = false;
-		int64_t arg0 = get_s64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_wake_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int64_t arg0 = get_s64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_wake_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int64_t));
+			}
+			PPP_RUN_CB(on_thr_wake_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_thr_wake_enter, cpu, pc, arg0);
 	}; break;
 	// 444 int kldunloadf ['int fileid', 'int flags']
 	case 444: {
+		sub = syscall_sub_freebsd_x64[330];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kldunloadf_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kldunloadf_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_kldunloadf_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_kldunloadf_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 445 int audit ['const void *record', 'unsigned length']
 	case 445: {
+		sub = syscall_sub_freebsd_x64[331];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_audit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_audit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_audit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_audit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 446 int auditon ['int cmd', 'void *data', 'unsigned length']
 	case 446: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_auditon_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[332];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_auditon_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_auditon_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_auditon_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 447 int getauid ['uid_t *auid']
 	case 447: {
+		sub = syscall_sub_freebsd_x64[333];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getauid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getauid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getauid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_getauid_enter, cpu, pc, arg0);
 	}; break;
 	// 448 int setauid ['uid_t *auid']
 	case 448: {
+		sub = syscall_sub_freebsd_x64[334];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setauid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setauid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setauid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setauid_enter, cpu, pc, arg0);
 	}; break;
 	// 449 int getaudit ['struct auditinfo *auditinfo']
 	case 449: {
+		sub = syscall_sub_freebsd_x64[335];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getaudit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getaudit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getaudit_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_getaudit_enter, cpu, pc, arg0);
 	}; break;
 	// 450 int setaudit ['struct auditinfo *auditinfo']
 	case 450: {
+		sub = syscall_sub_freebsd_x64[336];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setaudit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setaudit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setaudit_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setaudit_enter, cpu, pc, arg0);
 	}; break;
 	// 451 int getaudit_addr ['struct auditinfo_addr *auditinfo_addr', 'unsigned length']
 	case 451: {
+		sub = syscall_sub_freebsd_x64[337];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getaudit_addr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getaudit_addr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_getaudit_addr_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getaudit_addr_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 452 int setaudit_addr ['struct auditinfo_addr *auditinfo_addr', 'unsigned length']
 	case 452: {
+		sub = syscall_sub_freebsd_x64[338];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setaudit_addr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setaudit_addr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_setaudit_addr_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_setaudit_addr_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 453 int auditctl ['const char *path']
 	case 453: {
+		sub = syscall_sub_freebsd_x64[339];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_auditctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_auditctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_auditctl_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_auditctl_enter, cpu, pc, arg0);
 	}; break;
 	// 454 int _umtx_op ['void *obj', 'int op', 'u_long val', 'void *uaddr1', 'void *uaddr2']
 	case 454: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int64_t arg2 = get_s64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on__umtx_op_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on__umtx_op_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[340];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int64_t arg2 = get_s64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on__umtx_op_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on__umtx_op_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 455 int thr_new ['struct thr_param *param', 'int param_size']
 	case 455: {
+		sub = syscall_sub_freebsd_x64[341];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_new_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_new_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_thr_new_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_thr_new_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 456 int sigqueue ['pid_t pid', 'int signum', 'void *value']
 	case 456: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigqueue_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[342];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigqueue_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigqueue_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sigqueue_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 457 int kmq_open ['const char *path', 'int flags', 'mode_t mode', 'const struct mq_attr *attr']
 	case 457: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kmq_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[343];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kmq_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kmq_open_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_kmq_open_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 458 int kmq_setattr ['int mqd', 'const struct mq_attr *attr', 'struct mq_attr *oattr']
 	case 458: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kmq_setattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[344];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kmq_setattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kmq_setattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_kmq_setattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 459 int kmq_timedreceive ['int mqd', 'char *msg_ptr', 'size_t msg_len', 'unsigned *msg_prio', 'const struct timespec *abs_timeout']
 	case 459: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kmq_timedreceive_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_kmq_timedreceive_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[345];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kmq_timedreceive_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kmq_timedreceive_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 460 int kmq_timedsend ['int mqd', 'const char *msg_ptr', 'size_t msg_len', 'unsigned msg_prio', 'const struct timespec *abs_timeout']
 	case 460: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kmq_timedsend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_kmq_timedsend_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[346];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kmq_timedsend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kmq_timedsend_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 461 int kmq_notify ['int mqd', 'const struct sigevent *sigev']
 	case 461: {
+		sub = syscall_sub_freebsd_x64[347];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kmq_notify_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kmq_notify_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kmq_notify_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_kmq_notify_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 462 int kmq_unlink ['const char *path']
 	case 462: {
+		sub = syscall_sub_freebsd_x64[348];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kmq_unlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kmq_unlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kmq_unlink_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_kmq_unlink_enter, cpu, pc, arg0);
 	}; break;
 	// 463 int abort2 ['const char *why', 'int nargs', 'void **args']
 	case 463: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_abort2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[349];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_abort2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_abort2_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_abort2_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 464 int thr_set_name ['long id', 'const char *name']
 	case 464: {
+		sub = syscall_sub_freebsd_x64[350];
+		if (!sub) return;
 		panda_noreturn = false;
-		int64_t arg0 = get_s64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_set_name_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int64_t arg0 = get_s64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_set_name_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_thr_set_name_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_thr_set_name_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 465 int aio_fsync ['int op', 'struct aiocb *aiocbp']
 	case 465: {
+		sub = syscall_sub_freebsd_x64[351];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_fsync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_fsync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_fsync_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_aio_fsync_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 466 int rtprio_thread ['int function', 'lwpid_t lwpid', 'struct rtprio *rtp']
 	case 466: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rtprio_thread_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[352];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rtprio_thread_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_rtprio_thread_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_rtprio_thread_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 471 int sctp_peeloff ['int sd', 'uint32_t name']
 	case 471: {
+		sub = syscall_sub_freebsd_x64[353];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sctp_peeloff_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sctp_peeloff_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sctp_peeloff_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sctp_peeloff_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 472 int sctp_generic_sendmsg ['int sd', 'void *msg', 'int mlen', 'struct sockaddr *to', '__socklen_t tolen', 'struct sctp_sndrcvinfo *sinfo', 'int flags']
 	case 472: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		int32_t arg6 = get_s32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sctp_generic_sendmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-			memcpy(ctx.args[6], &arg6, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sctp_generic_sendmsg_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		sub = syscall_sub_freebsd_x64[354];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			int32_t arg6 = get_s32(cpu, 6);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sctp_generic_sendmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+				memcpy(ctx.args[6], &arg6, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sctp_generic_sendmsg_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		}
 	}; break;
 	// 473 int sctp_generic_sendmsg_iov ['int sd', 'struct iovec *iov', 'int iovlen', 'struct sockaddr *to', '__socklen_t tolen', 'struct sctp_sndrcvinfo *sinfo', 'int flags']
 	case 473: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		int32_t arg6 = get_s32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sctp_generic_sendmsg_iov_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-			memcpy(ctx.args[6], &arg6, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sctp_generic_sendmsg_iov_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		sub = syscall_sub_freebsd_x64[355];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			int32_t arg6 = get_s32(cpu, 6);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sctp_generic_sendmsg_iov_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+				memcpy(ctx.args[6], &arg6, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sctp_generic_sendmsg_iov_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		}
 	}; break;
 	// 474 int sctp_generic_recvmsg ['int sd', 'struct iovec *iov', 'int iovlen', 'struct sockaddr *from', '__socklen_t *fromlenaddr', 'struct sctp_sndrcvinfo *sinfo', 'int *msg_flags']
 	case 474: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		uint64_t arg6 = get_64(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sctp_generic_recvmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-			memcpy(ctx.args[6], &arg6, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sctp_generic_recvmsg_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		sub = syscall_sub_freebsd_x64[356];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			uint64_t arg6 = get_64(cpu, 6);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sctp_generic_recvmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+				memcpy(ctx.args[6], &arg6, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sctp_generic_recvmsg_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+		}
 	}; break;
 	// 475 ssize_t pread ['int fd', 'void *buf', 'size_t nbyte', 'off_t offset']
 	case 475: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pread_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[357];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pread_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_pread_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_pread_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 476 ssize_t pwrite ['int fd', 'const void *buf', 'size_t nbyte', 'off_t offset']
 	case 476: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pwrite_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[358];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pwrite_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_pwrite_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_pwrite_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 478 off_t lseek ['int fd', 'off_t offset', 'int whence']
 	case 478: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lseek_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[359];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lseek_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_lseek_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_lseek_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 479 int truncate ['const char *path', 'off_t length']
 	case 479: {
+		sub = syscall_sub_freebsd_x64[360];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_truncate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_truncate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_truncate_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_truncate_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 480 int ftruncate ['int fd', 'off_t length']
 	case 480: {
+		sub = syscall_sub_freebsd_x64[361];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ftruncate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ftruncate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ftruncate_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_ftruncate_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 481 int thr_kill2 ['pid_t pid', 'long id', 'int sig']
 	case 481: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_thr_kill2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[362];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_thr_kill2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_thr_kill2_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_thr_kill2_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 482 int shm_open ['const char *path', 'int flags', 'mode_t mode']
 	case 482: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shm_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[363];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shm_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_shm_open_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_shm_open_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 483 int shm_unlink ['const char *path']
 	case 483: {
+		sub = syscall_sub_freebsd_x64[364];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shm_unlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shm_unlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_shm_unlink_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_shm_unlink_enter, cpu, pc, arg0);
 	}; break;
 	// 484 int cpuset ['cpusetid_t *setid']
 	case 484: {
+		sub = syscall_sub_freebsd_x64[365];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cpuset_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cpuset_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_cpuset_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_cpuset_enter, cpu, pc, arg0);
 	}; break;
 	// 485 int cpuset_setid ['cpuwhich_t which', 'id_t id', 'cpusetid_t setid']
 	case 485: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cpuset_setid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[366];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cpuset_setid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_cpuset_setid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_cpuset_setid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 486 int cpuset_getid ['cpulevel_t level', 'cpuwhich_t which', 'id_t id', 'cpusetid_t *setid']
 	case 486: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cpuset_getid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[367];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cpuset_getid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_cpuset_getid_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_cpuset_getid_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 487 int cpuset_getaffinity ['cpulevel_t level', 'cpuwhich_t which', 'id_t id', 'size_t cpusetsize', 'cpuset_t *mask']
 	case 487: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cpuset_getaffinity_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_cpuset_getaffinity_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[368];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cpuset_getaffinity_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_cpuset_getaffinity_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 488 int cpuset_setaffinity ['cpulevel_t level', 'cpuwhich_t which', 'id_t id', 'size_t cpusetsize', 'const cpuset_t *mask']
 	case 488: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cpuset_setaffinity_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_cpuset_setaffinity_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[369];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cpuset_setaffinity_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_cpuset_setaffinity_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 489 int faccessat ['int fd', 'const char *path', 'int amode', 'int flag']
 	case 489: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_faccessat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[370];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_faccessat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_faccessat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_faccessat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 490 int fchmodat ['int fd', 'const char *path', 'mode_t mode', 'int flag']
 	case 490: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fchmodat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[371];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fchmodat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fchmodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_fchmodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 491 int fchownat ['int fd', 'const char *path', 'uid_t uid', 'gid_t gid', 'int flag']
 	case 491: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fchownat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_fchownat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[372];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fchownat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fchownat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 492 int fexecve ['int fd', 'char **argv', 'char **envv']
 	case 492: {
+		sub = syscall_sub_freebsd_x64[373];
+		if (!sub) return;
 		panda_noreturn = true;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fexecve_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_fexecve_enter, cpu, pc, arg0, arg1, arg2);
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fexecve_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fexecve_enter, cpu, pc, arg0, arg1, arg2);
+		}
 	}; break;
 	// 493 int fstatat ['int fd', 'const char *path', 'struct freebsd11_stat *buf', 'int flag']
 	case 493: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fstatat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[374];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fstatat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fstatat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_fstatat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 494 int futimesat ['int fd', 'const char *path', 'struct timeval *times']
 	case 494: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_futimesat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[375];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_futimesat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_futimesat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_futimesat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 495 int linkat ['int fd1', 'const char *path1', 'int fd2', 'const char *path2', 'int flag']
 	case 495: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_linkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_linkat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[376];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_linkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_linkat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 496 int mkdirat ['int fd', 'const char *path', 'mode_t mode']
 	case 496: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mkdirat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[377];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mkdirat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_mkdirat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_mkdirat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 497 int mkfifoat ['int fd', 'const char *path', 'mode_t mode']
 	case 497: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mkfifoat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[378];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mkfifoat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_mkfifoat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_mkfifoat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 498 int mknodat ['int fd', 'const char *path', 'mode_t mode', 'uint32_t dev']
 	case 498: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mknodat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[379];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mknodat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_mknodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_mknodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 499 int openat ['int fd', 'const char *path', 'int flag', 'mode_t mode']
 	case 499: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_openat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[380];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_openat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_openat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_openat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 500 ssize_t readlinkat ['int fd', 'const char *path', 'char *buf', 'size_t bufsize']
 	case 500: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_readlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[381];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_readlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_readlinkat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_readlinkat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 501 int renameat ['int oldfd', 'const char *old', 'int newfd', 'const char *new']
 	case 501: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_renameat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[382];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_renameat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_renameat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_renameat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 502 int symlinkat ['const char *path1', 'int fd', 'const char *path2']
 	case 502: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_symlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[383];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_symlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_symlinkat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_symlinkat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 503 int unlinkat ['int fd', 'const char *path', 'int flag']
 	case 503: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_unlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[384];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_unlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_unlinkat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_unlinkat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 504 int posix_openpt ['int flags']
 	case 504: {
+		sub = syscall_sub_freebsd_x64[385];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_posix_openpt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_posix_openpt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_posix_openpt_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_posix_openpt_enter, cpu, pc, arg0);
 	}; break;
 	// 505 int gssd_syscall ['const char *path']
 	case 505: {
+		sub = syscall_sub_freebsd_x64[386];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_gssd_syscall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_gssd_syscall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_gssd_syscall_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_gssd_syscall_enter, cpu, pc, arg0);
 	}; break;
 	// 506 int jail_get ['struct iovec *iovp', 'unsigned int iovcnt', 'int flags']
 	case 506: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_jail_get_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[387];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_jail_get_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_jail_get_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_jail_get_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 507 int jail_set ['struct iovec *iovp', 'unsigned int iovcnt', 'int flags']
 	case 507: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_jail_set_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[388];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_jail_set_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_jail_set_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_jail_set_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 508 int jail_remove ['int jid']
 	case 508: {
+		sub = syscall_sub_freebsd_x64[389];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_jail_remove_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_jail_remove_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_jail_remove_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_jail_remove_enter, cpu, pc, arg0);
 	}; break;
 	// 509 int closefrom ['int lowfd']
 	case 509: {
+		sub = syscall_sub_freebsd_x64[390];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_closefrom_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_closefrom_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_closefrom_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_closefrom_enter, cpu, pc, arg0);
 	}; break;
 	// 510 int __semctl ['int semid', 'int semnum', 'int cmd', 'union semun *arg']
 	case 510: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___semctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[391];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___semctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___semctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on___semctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 511 int msgctl ['int msqid', 'int cmd', 'struct msqid_ds *buf']
 	case 511: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_msgctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[392];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_msgctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_msgctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_msgctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 512 int shmctl ['int shmid', 'int cmd', 'struct shmid_ds *buf']
 	case 512: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shmctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[393];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shmctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_shmctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_shmctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 513 int lpathconf ['const char *path', 'int name']
 	case 513: {
+		sub = syscall_sub_freebsd_x64[394];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_lpathconf_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_lpathconf_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_lpathconf_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_lpathconf_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 515 int __cap_rights_get ['int version', 'int fd', 'cap_rights_t *rightsp']
 	case 515: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___cap_rights_get_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[395];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___cap_rights_get_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on___cap_rights_get_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on___cap_rights_get_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 516 int cap_enter ['void']
 	case 516: {
+		sub = syscall_sub_freebsd_x64[396];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_cap_enter_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_cap_enter_enter, cpu, pc);
+		}
 	}; break;
 	// 517 int cap_getmode ['unsigned *modep']
 	case 517: {
+		sub = syscall_sub_freebsd_x64[397];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cap_getmode_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cap_getmode_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_cap_getmode_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_cap_getmode_enter, cpu, pc, arg0);
 	}; break;
 	// 518 int pdfork ['int *fdp', 'int flags']
 	case 518: {
+		sub = syscall_sub_freebsd_x64[398];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pdfork_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pdfork_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_pdfork_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_pdfork_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 519 int pdkill ['int fd', 'int signum']
 	case 519: {
+		sub = syscall_sub_freebsd_x64[399];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pdkill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pdkill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_pdkill_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_pdkill_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 520 int pdgetpid ['int fd', 'pid_t *pidp']
 	case 520: {
+		sub = syscall_sub_freebsd_x64[400];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pdgetpid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pdgetpid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_pdgetpid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_pdgetpid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 522 int pselect ['int nd', 'fd_set *in', 'fd_set *ou', 'fd_set *ex', 'const struct timespec *ts', 'const sigset_t *sm']
 	case 522: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pselect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_pselect_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[401];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pselect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_pselect_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 523 int getloginclass ['char *namebuf', 'size_t namelen']
 	case 523: {
+		sub = syscall_sub_freebsd_x64[402];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getloginclass_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getloginclass_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_getloginclass_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_getloginclass_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 524 int setloginclass ['const char *namebuf']
 	case 524: {
+		sub = syscall_sub_freebsd_x64[403];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_setloginclass_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_setloginclass_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_setloginclass_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_setloginclass_enter, cpu, pc, arg0);
 	}; break;
 	// 525 int rctl_get_racct ['const void *inbufp', 'size_t inbuflen', 'void *outbufp', 'size_t outbuflen']
 	case 525: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rctl_get_racct_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[404];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rctl_get_racct_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_rctl_get_racct_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_rctl_get_racct_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 526 int rctl_get_rules ['const void *inbufp', 'size_t inbuflen', 'void *outbufp', 'size_t outbuflen']
 	case 526: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rctl_get_rules_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[405];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rctl_get_rules_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_rctl_get_rules_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_rctl_get_rules_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 527 int rctl_get_limits ['const void *inbufp', 'size_t inbuflen', 'void *outbufp', 'size_t outbuflen']
 	case 527: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rctl_get_limits_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[406];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rctl_get_limits_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_rctl_get_limits_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_rctl_get_limits_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 528 int rctl_add_rule ['const void *inbufp', 'size_t inbuflen', 'void *outbufp', 'size_t outbuflen']
 	case 528: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rctl_add_rule_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[407];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rctl_add_rule_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_rctl_add_rule_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_rctl_add_rule_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 529 int rctl_remove_rule ['const void *inbufp', 'size_t inbuflen', 'void *outbufp', 'size_t outbuflen']
 	case 529: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rctl_remove_rule_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[408];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rctl_remove_rule_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_rctl_remove_rule_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_rctl_remove_rule_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 530 int posix_fallocate ['int fd', 'off_t offset', 'off_t len']
 	case 530: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_posix_fallocate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[409];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_posix_fallocate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_posix_fallocate_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_posix_fallocate_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 531 int posix_fadvise ['int fd', 'off_t offset', 'off_t len', 'int advice']
 	case 531: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_posix_fadvise_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[410];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_posix_fadvise_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_posix_fadvise_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_posix_fadvise_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 532 int wait6 ['idtype_t idtype', 'id_t id', 'int *status', 'int options', 'struct __wrusage *wrusage', 'siginfo_t *info']
 	case 532: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_wait6_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_wait6_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[411];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_wait6_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_wait6_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 533 int cap_rights_limit ['int fd', 'cap_rights_t *rightsp']
 	case 533: {
+		sub = syscall_sub_freebsd_x64[412];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cap_rights_limit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cap_rights_limit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_cap_rights_limit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_cap_rights_limit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 534 int cap_ioctls_limit ['int fd', 'const u_long *cmds', 'size_t ncmds']
 	case 534: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cap_ioctls_limit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[413];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cap_ioctls_limit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_cap_ioctls_limit_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_cap_ioctls_limit_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 535 ssize_t cap_ioctls_get ['int fd', 'u_long *cmds', 'size_t maxcmds']
 	case 535: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cap_ioctls_get_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[414];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cap_ioctls_get_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_cap_ioctls_get_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_cap_ioctls_get_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 536 int cap_fcntls_limit ['int fd', 'uint32_t fcntlrights']
 	case 536: {
+		sub = syscall_sub_freebsd_x64[415];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cap_fcntls_limit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cap_fcntls_limit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_cap_fcntls_limit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_cap_fcntls_limit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 537 int cap_fcntls_get ['int fd', 'uint32_t *fcntlrightsp']
 	case 537: {
+		sub = syscall_sub_freebsd_x64[416];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cap_fcntls_get_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cap_fcntls_get_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_cap_fcntls_get_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_cap_fcntls_get_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 538 int bindat ['int fd', 'int s', 'const struct sockaddr *name', 'int namelen']
 	case 538: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_bindat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[417];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_bindat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_bindat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_bindat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 539 int connectat ['int fd', 'int s', 'const struct sockaddr *name', 'int namelen']
 	case 539: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_connectat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[418];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_connectat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_connectat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_connectat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 540 int chflagsat ['int fd', 'const char *path', 'u_long flags', 'int atflag']
 	case 540: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int64_t arg2 = get_s64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_chflagsat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[419];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int64_t arg2 = get_s64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_chflagsat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_chflagsat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_chflagsat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 541 int accept4 ['int s', 'struct sockaddr *name', '__socklen_t *anamelen', 'int flags']
 	case 541: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_accept4_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[420];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_accept4_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_accept4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_accept4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 542 int pipe2 ['int *fildes', 'int flags']
 	case 542: {
+		sub = syscall_sub_freebsd_x64[421];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_pipe2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_pipe2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_pipe2_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_pipe2_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 543 int aio_mlock ['struct aiocb *aiocbp']
 	case 543: {
+		sub = syscall_sub_freebsd_x64[422];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_aio_mlock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_aio_mlock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_aio_mlock_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_aio_mlock_enter, cpu, pc, arg0);
 	}; break;
 	// 544 int procctl ['idtype_t idtype', 'id_t id', 'int com', 'void *data']
 	case 544: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_procctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[423];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_procctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_procctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_procctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 545 int ppoll ['struct pollfd *fds', 'unsigned nfds', 'const struct timespec *ts', 'const sigset_t *set']
 	case 545: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_ppoll_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[424];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_ppoll_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_ppoll_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_ppoll_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 546 int futimens ['int fd', 'struct timespec *times']
 	case 546: {
+		sub = syscall_sub_freebsd_x64[425];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_futimens_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_futimens_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_futimens_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_futimens_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 547 int utimensat ['int fd', 'const char *path', 'struct timespec *times', 'int flag']
 	case 547: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_utimensat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[426];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_utimensat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_utimensat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_utimensat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 550 int fdatasync ['int fd']
 	case 550: {
+		sub = syscall_sub_freebsd_x64[427];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fdatasync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fdatasync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fdatasync_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_fdatasync_enter, cpu, pc, arg0);
 	}; break;
 	// 551 int fstat ['int fd', 'struct stat *sb']
 	case 551: {
+		sub = syscall_sub_freebsd_x64[428];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 552 int fstatat ['int fd', 'const char *path', 'struct stat *buf', 'int flag']
 	case 552: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fstatat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[429];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fstatat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_fstatat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_fstatat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 553 int fhstat ['const struct fhandle *u_fhp', 'struct stat *sb']
 	case 553: {
+		sub = syscall_sub_freebsd_x64[430];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fhstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fhstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 554 ssize_t getdirentries ['int fd', 'char *buf', 'size_t count', 'off_t *basep']
 	case 554: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getdirentries_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[431];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getdirentries_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_getdirentries_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_getdirentries_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 555 int statfs ['const char *path', 'struct statfs *buf']
 	case 555: {
+		sub = syscall_sub_freebsd_x64[432];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_statfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_statfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_statfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_statfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 556 int fstatfs ['int fd', 'struct statfs *buf']
 	case 556: {
+		sub = syscall_sub_freebsd_x64[433];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fstatfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fstatfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fstatfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fstatfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 557 int getfsstat ['struct statfs *buf', 'long bufsize', 'int mode']
 	case 557: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getfsstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[434];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getfsstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getfsstat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getfsstat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 558 int fhstatfs ['const struct fhandle *u_fhp', 'struct statfs *buf']
 	case 558: {
+		sub = syscall_sub_freebsd_x64[435];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhstatfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhstatfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fhstatfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fhstatfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 559 int mknodat ['int fd', 'const char *path', 'mode_t mode', 'dev_t dev']
 	case 559: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mknodat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[436];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mknodat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_mknodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_mknodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 560 int kevent ['int fd', 'struct kevent *changelist', 'int nchanges', 'struct kevent *eventlist', 'int nevents', 'const struct timespec *timeout']
 	case 560: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_kevent_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_kevent_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[437];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_kevent_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_kevent_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 561 int cpuset_getdomain ['cpulevel_t level', 'cpuwhich_t which', 'id_t id', 'size_t domainsetsize', 'domainset_t *mask', 'int *policy']
 	case 561: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cpuset_getdomain_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_cpuset_getdomain_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[438];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cpuset_getdomain_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_cpuset_getdomain_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 562 int cpuset_setdomain ['cpulevel_t level', 'cpuwhich_t which', 'id_t id', 'size_t domainsetsize', 'domainset_t *mask', 'int policy']
 	case 562: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_cpuset_setdomain_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_cpuset_setdomain_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[439];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			int32_t arg5 = get_s32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_cpuset_setdomain_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_cpuset_setdomain_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 563 int getrandom ['void *buf', 'size_t buflen', 'unsigned int flags']
 	case 563: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getrandom_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[440];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getrandom_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_getrandom_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_getrandom_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 564 int getfhat ['int fd', 'char *path', 'struct fhandle *fhp', 'int flags']
 	case 564: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_getfhat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[441];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_getfhat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_getfhat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_getfhat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 565 int fhlink ['struct fhandle *fhp', 'const char *to']
 	case 565: {
+		sub = syscall_sub_freebsd_x64[442];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fhlink_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_fhlink_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 566 int fhlinkat ['struct fhandle *fhp', 'int tofd', 'const char *to', '']
 	case 566: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_freebsd_x64[443];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_fhlinkat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_fhlinkat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 567 int fhreadlink ['struct fhandle *fhp', 'char *buf', 'size_t bufsize']
 	case 567: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_fhreadlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_freebsd_x64[444];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_fhreadlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_fhreadlink_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_fhreadlink_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 568 int funlinkat ['int dfd', 'const char *path', 'int fd', 'int flag']
 	case 568: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_funlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[445];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_funlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_funlinkat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_funlinkat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 569 ssize_t copy_file_range ['int infd', 'off_t *inoffp', 'int outfd', 'off_t *outoffp', 'size_t len', 'unsigned int flags']
 	case 569: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_copy_file_range_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_copy_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[446];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_copy_file_range_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_copy_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 570 int __sysctlbyname ['const char *name', 'size_t namelen', 'void *old', 'size_t *oldlenp', 'void *new', 'size_t newlen']
 	case 570: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___sysctlbyname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on___sysctlbyname_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_freebsd_x64[447];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___sysctlbyname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on___sysctlbyname_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 571 int shm_open2 ['const char *path', 'int flags', 'mode_t mode', 'int shmflags', 'const char *name']
 	case 571: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shm_open2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_shm_open2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[448];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shm_open2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_shm_open2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 572 int shm_rename ['const char *path_from', 'const char *path_to', 'int flags']
 	case 572: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_shm_rename_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[449];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_shm_rename_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_shm_rename_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_shm_rename_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 573 int sigfastblock ['int cmd', 'uint32_t *ptr']
 	case 573: {
+		sub = syscall_sub_freebsd_x64[450];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sigfastblock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sigfastblock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sigfastblock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sigfastblock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 574 int __realpathat ['int fd', 'const char *path', 'char *buf', 'size_t size', 'int flags']
 	case 574: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on___realpathat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on___realpathat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_freebsd_x64[451];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on___realpathat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on___realpathat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 575 int close_range ['unsigned lowfd', 'unsigned highfd', 'int flags']
 	case 575: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_close_range_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_freebsd_x64[452];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_close_range_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_close_range_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_close_range_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 576 int rpctls_syscall ['int op', 'const char *path']
 	case 576: {
+		sub = syscall_sub_freebsd_x64[453];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_rpctls_syscall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_rpctls_syscall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_rpctls_syscall_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_rpctls_syscall_enter, cpu, pc, arg0, arg1);
 	}; break;
 	default:
+		sub = syscall_sub_freebsd_x64[454];
+		if (!sub) return;
 		panda_noreturn = false;
 		PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, ctx.no);
 	} // switch (ctx.no)
 
+	ctx.asid = panda_current_asid(cpu);
+	ctx.retaddr = calc_retaddr(cpu, pc);
+	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (sub & SYSCALL_SUB_RETURN) {
 		struct hook h;
 		h.addr = ctx.retaddr;
 		h.asid = ctx.asid;
@@ -14,6 +14,877 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+#if defined(TARGET_ARM) && defined(TARGET_AARCH64)
+/**
+ * @brief SYSCALL_SUB_* bits for each system call, in switch order. The last
+ * entry is used for system calls we have no prototype for.
+ */
+static uint8_t syscall_sub_linux_arm64[284];
+
+/**
+ * @brief Recomputes the subscription bits from the registered callbacks.
+ */
+static void syscall_sub_update_linux_arm64(void) {
+	bool all_enter = PPP_CHECK_CB(on_all_sys_enter);
+	bool all_enter2 = PPP_CHECK_CB(on_all_sys_enter2);
+	bool all_return = PPP_CHECK_CB(on_all_sys_return);
+	bool all_return2 = PPP_CHECK_CB(on_all_sys_return2);
+	syscall_sub_linux_arm64[0] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_setup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_setup_return), false);
+	syscall_sub_linux_arm64[1] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_destroy_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_destroy_return), false);
+	syscall_sub_linux_arm64[2] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_submit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_submit_return), false);
+	syscall_sub_linux_arm64[3] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_cancel_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_cancel_return), false);
+	syscall_sub_linux_arm64[4] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_getevents_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_getevents_return), false);
+	syscall_sub_linux_arm64[5] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setxattr_return), false);
+	syscall_sub_linux_arm64[6] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lsetxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lsetxattr_return), false);
+	syscall_sub_linux_arm64[7] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fsetxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fsetxattr_return), false);
+	syscall_sub_linux_arm64[8] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getxattr_return), false);
+	syscall_sub_linux_arm64[9] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lgetxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lgetxattr_return), false);
+	syscall_sub_linux_arm64[10] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fgetxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fgetxattr_return), false);
+	syscall_sub_linux_arm64[11] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_listxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_listxattr_return), false);
+	syscall_sub_linux_arm64[12] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_llistxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_llistxattr_return), false);
+	syscall_sub_linux_arm64[13] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_flistxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_flistxattr_return), false);
+	syscall_sub_linux_arm64[14] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_removexattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_removexattr_return), false);
+	syscall_sub_linux_arm64[15] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lremovexattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lremovexattr_return), false);
+	syscall_sub_linux_arm64[16] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fremovexattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fremovexattr_return), false);
+	syscall_sub_linux_arm64[17] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getcwd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getcwd_return), false);
+	syscall_sub_linux_arm64[18] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lookup_dcookie_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lookup_dcookie_return), false);
+	syscall_sub_linux_arm64[19] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_eventfd2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_eventfd2_return), false);
+	syscall_sub_linux_arm64[20] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_epoll_create1_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_epoll_create1_return), false);
+	syscall_sub_linux_arm64[21] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_epoll_ctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_epoll_ctl_return), false);
+	syscall_sub_linux_arm64[22] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_epoll_pwait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_epoll_pwait_return), false);
+	syscall_sub_linux_arm64[23] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_dup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_dup_return), false);
+	syscall_sub_linux_arm64[24] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_dup3_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_dup3_return), false);
+	syscall_sub_linux_arm64[25] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fcntl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fcntl_return), false);
+	syscall_sub_linux_arm64[26] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_inotify_init1_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_inotify_init1_return), false);
+	syscall_sub_linux_arm64[27] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_inotify_add_watch_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_inotify_add_watch_return), false);
+	syscall_sub_linux_arm64[28] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_inotify_rm_watch_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_inotify_rm_watch_return), false);
+	syscall_sub_linux_arm64[29] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ioctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ioctl_return), false);
+	syscall_sub_linux_arm64[30] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ioprio_set_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ioprio_set_return), false);
+	syscall_sub_linux_arm64[31] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ioprio_get_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ioprio_get_return), false);
+	syscall_sub_linux_arm64[32] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_flock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_flock_return), false);
+	syscall_sub_linux_arm64[33] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mknodat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mknodat_return), false);
+	syscall_sub_linux_arm64[34] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mkdirat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mkdirat_return), false);
+	syscall_sub_linux_arm64[35] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_unlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_unlinkat_return), false);
+	syscall_sub_linux_arm64[36] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_symlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_symlinkat_return), false);
+	syscall_sub_linux_arm64[37] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_linkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_linkat_return), false);
+	syscall_sub_linux_arm64[38] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_renameat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_renameat_return), false);
+	syscall_sub_linux_arm64[39] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_umount2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_umount2_return), false);
+	syscall_sub_linux_arm64[40] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mount_return), false);
+	syscall_sub_linux_arm64[41] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pivot_root_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pivot_root_return), false);
+	syscall_sub_linux_arm64[42] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_nfsservctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_nfsservctl_return), false);
+	syscall_sub_linux_arm64[43] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_statfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_statfs_return), false);
+	syscall_sub_linux_arm64[44] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fstatfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fstatfs_return), false);
+	syscall_sub_linux_arm64[45] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_truncate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_truncate_return), false);
+	syscall_sub_linux_arm64[46] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ftruncate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ftruncate_return), false);
+	syscall_sub_linux_arm64[47] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fallocate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fallocate_return), false);
+	syscall_sub_linux_arm64[48] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_faccessat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_faccessat_return), false);
+	syscall_sub_linux_arm64[49] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_chdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_chdir_return), false);
+	syscall_sub_linux_arm64[50] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchdir_return), false);
+	syscall_sub_linux_arm64[51] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_chroot_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_chroot_return), false);
+	syscall_sub_linux_arm64[52] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchmod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchmod_return), false);
+	syscall_sub_linux_arm64[53] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchmodat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchmodat_return), false);
+	syscall_sub_linux_arm64[54] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchownat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchownat_return), false);
+	syscall_sub_linux_arm64[55] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchown_return), false);
+	syscall_sub_linux_arm64[56] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_openat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_openat_return), false);
+	syscall_sub_linux_arm64[57] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_close_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_close_return), false);
+	syscall_sub_linux_arm64[58] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_vhangup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_vhangup_return), false);
+	syscall_sub_linux_arm64[59] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pipe2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pipe2_return), false);
+	syscall_sub_linux_arm64[60] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_quotactl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_quotactl_return), false);
+	syscall_sub_linux_arm64[61] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getdents64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getdents64_return), false);
+	syscall_sub_linux_arm64[62] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lseek_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lseek_return), false);
+	syscall_sub_linux_arm64[63] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_read_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_read_return), false);
+	syscall_sub_linux_arm64[64] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_write_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_write_return), false);
+	syscall_sub_linux_arm64[65] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_readv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_readv_return), false);
+	syscall_sub_linux_arm64[66] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_writev_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_writev_return), false);
+	syscall_sub_linux_arm64[67] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pread64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pread64_return), false);
+	syscall_sub_linux_arm64[68] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pwrite64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pwrite64_return), false);
+	syscall_sub_linux_arm64[69] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_preadv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_preadv_return), false);
+	syscall_sub_linux_arm64[70] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pwritev_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pwritev_return), false);
+	syscall_sub_linux_arm64[71] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendfile_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendfile_return), false);
+	syscall_sub_linux_arm64[72] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pselect6_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pselect6_return), false);
+	syscall_sub_linux_arm64[73] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ppoll_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ppoll_return), false);
+	syscall_sub_linux_arm64[74] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_signalfd4_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_signalfd4_return), false);
+	syscall_sub_linux_arm64[75] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_vmsplice_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_vmsplice_return), false);
+	syscall_sub_linux_arm64[76] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_splice_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_splice_return), false);
+	syscall_sub_linux_arm64[77] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_tee_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_tee_return), false);
+	syscall_sub_linux_arm64[78] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_readlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_readlinkat_return), false);
+	syscall_sub_linux_arm64[79] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_newfstatat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_newfstatat_return), false);
+	syscall_sub_linux_arm64[80] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fstat_return), false);
+	syscall_sub_linux_arm64[81] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sync_return), false);
+	syscall_sub_linux_arm64[82] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fsync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fsync_return), false);
+	syscall_sub_linux_arm64[83] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fdatasync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fdatasync_return), false);
+	syscall_sub_linux_arm64[84] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sync_file_range_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sync_file_range_return), false);
+	syscall_sub_linux_arm64[85] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timerfd_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timerfd_create_return), false);
+	syscall_sub_linux_arm64[86] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timerfd_settime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timerfd_settime_return), false);
+	syscall_sub_linux_arm64[87] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timerfd_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timerfd_gettime_return), false);
+	syscall_sub_linux_arm64[88] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_utimensat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_utimensat_return), false);
+	syscall_sub_linux_arm64[89] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_acct_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_acct_return), false);
+	syscall_sub_linux_arm64[90] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_capget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_capget_return), false);
+	syscall_sub_linux_arm64[91] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_capset_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_capset_return), false);
+	syscall_sub_linux_arm64[92] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_personality_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_personality_return), false);
+	syscall_sub_linux_arm64[93] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_exit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_exit_return), false);
+	syscall_sub_linux_arm64[94] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_exit_group_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_exit_group_return), false);
+	syscall_sub_linux_arm64[95] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_waitid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_waitid_return), false);
+	syscall_sub_linux_arm64[96] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_set_tid_address_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_set_tid_address_return), false);
+	syscall_sub_linux_arm64[97] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_unshare_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_unshare_return), false);
+	syscall_sub_linux_arm64[98] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_futex_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_futex_return), false);
+	syscall_sub_linux_arm64[99] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_set_robust_list_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_set_robust_list_return), false);
+	syscall_sub_linux_arm64[100] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_get_robust_list_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_get_robust_list_return), false);
+	syscall_sub_linux_arm64[101] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_nanosleep_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_nanosleep_return), false);
+	syscall_sub_linux_arm64[102] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getitimer_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getitimer_return), false);
+	syscall_sub_linux_arm64[103] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setitimer_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setitimer_return), false);
+	syscall_sub_linux_arm64[104] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_kexec_load_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_kexec_load_return), false);
+	syscall_sub_linux_arm64[105] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_init_module_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_init_module_return), false);
+	syscall_sub_linux_arm64[106] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_delete_module_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_delete_module_return), false);
+	syscall_sub_linux_arm64[107] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_create_return), false);
+	syscall_sub_linux_arm64[108] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_gettime_return), false);
+	syscall_sub_linux_arm64[109] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_getoverrun_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_getoverrun_return), false);
+	syscall_sub_linux_arm64[110] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_settime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_settime_return), false);
+	syscall_sub_linux_arm64[111] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_delete_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_delete_return), false);
+	syscall_sub_linux_arm64[112] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_settime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_settime_return), false);
+	syscall_sub_linux_arm64[113] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_gettime_return), false);
+	syscall_sub_linux_arm64[114] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_getres_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_getres_return), false);
+	syscall_sub_linux_arm64[115] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_nanosleep_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_nanosleep_return), false);
+	syscall_sub_linux_arm64[116] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_syslog_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_syslog_return), false);
+	syscall_sub_linux_arm64[117] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ptrace_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ptrace_return), false);
+	syscall_sub_linux_arm64[118] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_setparam_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_setparam_return), false);
+	syscall_sub_linux_arm64[119] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_setscheduler_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_setscheduler_return), false);
+	syscall_sub_linux_arm64[120] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_getscheduler_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_getscheduler_return), false);
+	syscall_sub_linux_arm64[121] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_getparam_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_getparam_return), false);
+	syscall_sub_linux_arm64[122] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_setaffinity_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_setaffinity_return), false);
+	syscall_sub_linux_arm64[123] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_getaffinity_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_getaffinity_return), false);
+	syscall_sub_linux_arm64[124] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_yield_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_yield_return), false);
+	syscall_sub_linux_arm64[125] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_get_priority_max_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_get_priority_max_return), false);
+	syscall_sub_linux_arm64[126] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_get_priority_min_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_get_priority_min_return), false);
+	syscall_sub_linux_arm64[127] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_rr_get_interval_return), false);
+	syscall_sub_linux_arm64[128] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_restart_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_restart_syscall_return), false);
+	syscall_sub_linux_arm64[129] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_kill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_kill_return), false);
+	syscall_sub_linux_arm64[130] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_tkill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_tkill_return), false);
+	syscall_sub_linux_arm64[131] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_tgkill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_tgkill_return), false);
+	syscall_sub_linux_arm64[132] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sigaltstack_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sigaltstack_return), false);
+	syscall_sub_linux_arm64[133] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigsuspend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigsuspend_return), false);
+	syscall_sub_linux_arm64[134] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigaction_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigaction_return), false);
+	syscall_sub_linux_arm64[135] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigprocmask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigprocmask_return), false);
+	syscall_sub_linux_arm64[136] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigpending_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigpending_return), false);
+	syscall_sub_linux_arm64[137] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigtimedwait_return), false);
+	syscall_sub_linux_arm64[138] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return), false);
+	syscall_sub_linux_arm64[139] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigreturn_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigreturn_return), false);
+	syscall_sub_linux_arm64[140] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setpriority_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setpriority_return), false);
+	syscall_sub_linux_arm64[141] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpriority_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpriority_return), false);
+	syscall_sub_linux_arm64[142] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_reboot_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_reboot_return), false);
+	syscall_sub_linux_arm64[143] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setregid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setregid_return), false);
+	syscall_sub_linux_arm64[144] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setgid_return), false);
+	syscall_sub_linux_arm64[145] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setreuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setreuid_return), false);
+	syscall_sub_linux_arm64[146] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setuid_return), false);
+	syscall_sub_linux_arm64[147] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setresuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setresuid_return), false);
+	syscall_sub_linux_arm64[148] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getresuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getresuid_return), false);
+	syscall_sub_linux_arm64[149] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setresgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setresgid_return), false);
+	syscall_sub_linux_arm64[150] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getresgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getresgid_return), false);
+	syscall_sub_linux_arm64[151] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setfsuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setfsuid_return), false);
+	syscall_sub_linux_arm64[152] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setfsgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setfsgid_return), false);
+	syscall_sub_linux_arm64[153] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_times_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_times_return), false);
+	syscall_sub_linux_arm64[154] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setpgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setpgid_return), false);
+	syscall_sub_linux_arm64[155] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpgid_return), false);
+	syscall_sub_linux_arm64[156] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getsid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getsid_return), false);
+	syscall_sub_linux_arm64[157] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setsid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setsid_return), false);
+	syscall_sub_linux_arm64[158] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getgroups_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getgroups_return), false);
+	syscall_sub_linux_arm64[159] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setgroups_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setgroups_return), false);
+	syscall_sub_linux_arm64[160] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_uname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_uname_return), false);
+	syscall_sub_linux_arm64[161] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sethostname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sethostname_return), false);
+	syscall_sub_linux_arm64[162] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setdomainname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setdomainname_return), false);
+	syscall_sub_linux_arm64[163] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getrlimit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getrlimit_return), false);
+	syscall_sub_linux_arm64[164] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setrlimit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setrlimit_return), false);
+	syscall_sub_linux_arm64[165] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getrusage_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getrusage_return), false);
+	syscall_sub_linux_arm64[166] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_umask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_umask_return), false);
+	syscall_sub_linux_arm64[167] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_prctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_prctl_return), false);
+	syscall_sub_linux_arm64[168] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getcpu_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getcpu_return), false);
+	syscall_sub_linux_arm64[169] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_gettimeofday_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_gettimeofday_return), false);
+	syscall_sub_linux_arm64[170] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_settimeofday_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_settimeofday_return), false);
+	syscall_sub_linux_arm64[171] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_adjtimex_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_adjtimex_return), false);
+	syscall_sub_linux_arm64[172] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpid_return), false);
+	syscall_sub_linux_arm64[173] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getppid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getppid_return), false);
+	syscall_sub_linux_arm64[174] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getuid_return), false);
+	syscall_sub_linux_arm64[175] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_geteuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_geteuid_return), false);
+	syscall_sub_linux_arm64[176] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getgid_return), false);
+	syscall_sub_linux_arm64[177] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getegid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getegid_return), false);
+	syscall_sub_linux_arm64[178] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_gettid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_gettid_return), false);
+	syscall_sub_linux_arm64[179] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sysinfo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sysinfo_return), false);
+	syscall_sub_linux_arm64[180] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_open_return), false);
+	syscall_sub_linux_arm64[181] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_unlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_unlink_return), false);
+	syscall_sub_linux_arm64[182] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_timedsend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_timedsend_return), false);
+	syscall_sub_linux_arm64[183] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_timedreceive_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_timedreceive_return), false);
+	syscall_sub_linux_arm64[184] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_notify_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_notify_return), false);
+	syscall_sub_linux_arm64[185] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_getsetattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_getsetattr_return), false);
+	syscall_sub_linux_arm64[186] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msgget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msgget_return), false);
+	syscall_sub_linux_arm64[187] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msgctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msgctl_return), false);
+	syscall_sub_linux_arm64[188] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msgrcv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msgrcv_return), false);
+	syscall_sub_linux_arm64[189] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msgsnd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msgsnd_return), false);
+	syscall_sub_linux_arm64[190] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_semget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_semget_return), false);
+	syscall_sub_linux_arm64[191] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_semctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_semctl_return), false);
+	syscall_sub_linux_arm64[192] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_semtimedop_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_semtimedop_return), false);
+	syscall_sub_linux_arm64[193] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_semop_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_semop_return), false);
+	syscall_sub_linux_arm64[194] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shmget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shmget_return), false);
+	syscall_sub_linux_arm64[195] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shmctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shmctl_return), false);
+	syscall_sub_linux_arm64[196] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shmat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shmat_return), false);
+	syscall_sub_linux_arm64[197] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shmdt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shmdt_return), false);
+	syscall_sub_linux_arm64[198] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_socket_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_socket_return), false);
+	syscall_sub_linux_arm64[199] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_socketpair_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_socketpair_return), false);
+	syscall_sub_linux_arm64[200] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_bind_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_bind_return), false);
+	syscall_sub_linux_arm64[201] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_listen_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_listen_return), false);
+	syscall_sub_linux_arm64[202] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_accept_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_accept_return), false);
+	syscall_sub_linux_arm64[203] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_connect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_connect_return), false);
+	syscall_sub_linux_arm64[204] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getsockname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getsockname_return), false);
+	syscall_sub_linux_arm64[205] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpeername_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpeername_return), false);
+	syscall_sub_linux_arm64[206] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendto_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendto_return), false);
+	syscall_sub_linux_arm64[207] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_recvfrom_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_recvfrom_return), false);
+	syscall_sub_linux_arm64[208] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setsockopt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setsockopt_return), false);
+	syscall_sub_linux_arm64[209] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getsockopt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getsockopt_return), false);
+	syscall_sub_linux_arm64[210] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shutdown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shutdown_return), false);
+	syscall_sub_linux_arm64[211] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendmsg_return), false);
+	syscall_sub_linux_arm64[212] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_recvmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_recvmsg_return), false);
+	syscall_sub_linux_arm64[213] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_readahead_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_readahead_return), false);
+	syscall_sub_linux_arm64[214] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_brk_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_brk_return), false);
+	syscall_sub_linux_arm64[215] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_munmap_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_munmap_return), false);
+	syscall_sub_linux_arm64[216] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mremap_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mremap_return), false);
+	syscall_sub_linux_arm64[217] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_add_key_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_add_key_return), false);
+	syscall_sub_linux_arm64[218] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_request_key_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_request_key_return), false);
+	syscall_sub_linux_arm64[219] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_keyctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_keyctl_return), false);
+	syscall_sub_linux_arm64[220] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clone_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clone_return), false);
+	syscall_sub_linux_arm64[221] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_execve_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_execve_return), false);
+	syscall_sub_linux_arm64[222] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mmap_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mmap_return), false);
+	syscall_sub_linux_arm64[223] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fadvise64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fadvise64_return), false);
+	syscall_sub_linux_arm64[224] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_swapon_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_swapon_return), false);
+	syscall_sub_linux_arm64[225] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_swapoff_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_swapoff_return), false);
+	syscall_sub_linux_arm64[226] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mprotect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mprotect_return), false);
+	syscall_sub_linux_arm64[227] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msync_return), false);
+	syscall_sub_linux_arm64[228] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mlock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mlock_return), false);
+	syscall_sub_linux_arm64[229] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_munlock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_munlock_return), false);
+	syscall_sub_linux_arm64[230] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mlockall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mlockall_return), false);
+	syscall_sub_linux_arm64[231] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_munlockall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_munlockall_return), false);
+	syscall_sub_linux_arm64[232] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mincore_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mincore_return), false);
+	syscall_sub_linux_arm64[233] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_madvise_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_madvise_return), false);
+	syscall_sub_linux_arm64[234] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_remap_file_pages_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_remap_file_pages_return), false);
+	syscall_sub_linux_arm64[235] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mbind_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mbind_return), false);
+	syscall_sub_linux_arm64[236] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_get_mempolicy_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_get_mempolicy_return), false);
+	syscall_sub_linux_arm64[237] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_set_mempolicy_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_set_mempolicy_return), false);
+	syscall_sub_linux_arm64[238] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_migrate_pages_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_migrate_pages_return), false);
+	syscall_sub_linux_arm64[239] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_move_pages_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_move_pages_return), false);
+	syscall_sub_linux_arm64[240] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return), false);
+	syscall_sub_linux_arm64[241] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_perf_event_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_perf_event_open_return), false);
+	syscall_sub_linux_arm64[242] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_accept4_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_accept4_return), false);
+	syscall_sub_linux_arm64[243] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_recvmmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_recvmmsg_return), false);
+	syscall_sub_linux_arm64[244] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_wait4_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_wait4_return), false);
+	syscall_sub_linux_arm64[245] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_prlimit64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_prlimit64_return), false);
+	syscall_sub_linux_arm64[246] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fanotify_init_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fanotify_init_return), false);
+	syscall_sub_linux_arm64[247] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fanotify_mark_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fanotify_mark_return), false);
+	syscall_sub_linux_arm64[248] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_name_to_handle_at_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_name_to_handle_at_return), false);
+	syscall_sub_linux_arm64[249] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_open_by_handle_at_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_open_by_handle_at_return), false);
+	syscall_sub_linux_arm64[250] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_adjtime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_adjtime_return), false);
+	syscall_sub_linux_arm64[251] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_syncfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_syncfs_return), false);
+	syscall_sub_linux_arm64[252] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setns_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setns_return), false);
+	syscall_sub_linux_arm64[253] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendmmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendmmsg_return), false);
+	syscall_sub_linux_arm64[254] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_process_vm_readv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_process_vm_readv_return), false);
+	syscall_sub_linux_arm64[255] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_process_vm_writev_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_process_vm_writev_return), false);
+	syscall_sub_linux_arm64[256] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_kcmp_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_kcmp_return), false);
+	syscall_sub_linux_arm64[257] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_finit_module_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_finit_module_return), false);
+	syscall_sub_linux_arm64[258] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_setattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_setattr_return), false);
+	syscall_sub_linux_arm64[259] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_getattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_getattr_return), false);
+	syscall_sub_linux_arm64[260] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_renameat2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_renameat2_return), false);
+	syscall_sub_linux_arm64[261] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_seccomp_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_seccomp_return), false);
+	syscall_sub_linux_arm64[262] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getrandom_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getrandom_return), false);
+	syscall_sub_linux_arm64[263] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_memfd_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_memfd_create_return), false);
+	syscall_sub_linux_arm64[264] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_bpf_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_bpf_return), false);
+	syscall_sub_linux_arm64[265] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_execveat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_execveat_return), false);
+	syscall_sub_linux_arm64[266] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_userfaultfd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_userfaultfd_return), false);
+	syscall_sub_linux_arm64[267] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_membarrier_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_membarrier_return), false);
+	syscall_sub_linux_arm64[268] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mlock2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mlock2_return), false);
+	syscall_sub_linux_arm64[269] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_copy_file_range_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_copy_file_range_return), false);
+	syscall_sub_linux_arm64[270] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_preadv2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_preadv2_return), false);
+	syscall_sub_linux_arm64[271] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pwritev2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pwritev2_return), false);
+	syscall_sub_linux_arm64[272] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pkey_mprotect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pkey_mprotect_return), false);
+	syscall_sub_linux_arm64[273] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pkey_alloc_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pkey_alloc_return), false);
+	syscall_sub_linux_arm64[274] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pkey_free_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pkey_free_return), false);
+	syscall_sub_linux_arm64[275] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_statx_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_statx_return), false);
+	syscall_sub_linux_arm64[276] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_kexec_file_load_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_kexec_file_load_return), false);
+	syscall_sub_linux_arm64[277] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pidfd_send_signal_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pidfd_send_signal_return), false);
+	syscall_sub_linux_arm64[278] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pidfd_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pidfd_open_return), false);
+	syscall_sub_linux_arm64[279] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clone3_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clone3_return), false);
+	syscall_sub_linux_arm64[280] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_openat2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_openat2_return), false);
+	syscall_sub_linux_arm64[281] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pidfd_getfd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pidfd_getfd_return), false);
+	syscall_sub_linux_arm64[282] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_faccessat2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_faccessat2_return), false);
+	syscall_sub_linux_arm64[283] = syscall_sub_bits(
+			all_enter || PPP_CHECK_CB(on_unknown_sys_enter), all_enter2,
+			all_return || PPP_CHECK_CB(on_unknown_sys_return), all_return2, false);
+	syscalls_subscriptions_dirty = false;
+}
+#endif
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
@@ -21,4147 +892,5289 @@ extern "C" {
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
  * system call return callbacks.
+ *
+ * System calls nobody subscribed to return right away, without reading
+ * their arguments or tracking their return.
  */
 void syscall_enter_switch_linux_arm64(CPUState *cpu, target_ptr_t pc) {
 #if defined(TARGET_ARM) && defined(TARGET_AARCH64)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {0};
 	ctx.no = env->xregs[8];
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
-	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
+	uint8_t sub;			// SYSCALL_SUB_* bits for this system call
+
+	if (unlikely(syscalls_subscriptions_dirty)) {
+		syscall_sub_update_linux_arm64();
+	}
 
 	switch (ctx.no) {
 	// 0 long sys_io_setup ['unsigned nr_reqs', 'aio_context_t __user *ctx']
 	case 0: {
+		sub = syscall_sub_linux_arm64[0];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_setup_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_setup_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_io_setup_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_io_setup_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 1 long sys_io_destroy ['aio_context_t ctx']
 	case 1: {
+		sub = syscall_sub_linux_arm64[1];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_destroy_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_destroy_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_io_destroy_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_io_destroy_enter, cpu, pc, arg0);
 	}; break;
 	// 2 long sys_io_submit ['aio_context_t', 'long', 'struct iocb __user * __user *']
 	case 2: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_submit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[2];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_submit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_io_submit_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_io_submit_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 3 long sys_io_cancel ['aio_context_t ctx_id', 'struct iocb __user *iocb', 'struct io_event __user *result']
 	case 3: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_cancel_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[3];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_cancel_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_io_cancel_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_io_cancel_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4 long sys_io_getevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct timespec __user *timeout']
 	case 4: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		int64_t arg2 = get_s64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_getevents_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_io_getevents_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[4];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			int64_t arg2 = get_s64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_getevents_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_io_getevents_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 5 long sys_setxattr ['const char __user *path', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 5: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_setxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[5];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 6 long sys_lsetxattr ['const char __user *path', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 6: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_lsetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[6];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_lsetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 7 long sys_fsetxattr ['int fd', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 7: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_fsetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[7];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_fsetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 8 long sys_getxattr ['const char __user *path', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 8: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[8];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_getxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 9 long sys_lgetxattr ['const char __user *path', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 9: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[9];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lgetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_lgetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 10 long sys_fgetxattr ['int fd', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 10: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[10];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fgetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_fgetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 11 long sys_listxattr ['const char __user *path', 'char __user *list', 'size_t size']
 	case 11: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_listxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[11];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_listxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_listxattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_listxattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 12 long sys_llistxattr ['const char __user *path', 'char __user *list', 'size_t size']
 	case 12: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_llistxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[12];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_llistxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_llistxattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_llistxattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 13 long sys_flistxattr ['int fd', 'char __user *list', 'size_t size']
 	case 13: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_flistxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[13];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_flistxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_flistxattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_flistxattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 14 long sys_removexattr ['const char __user *path', 'const char __user *name']
 	case 14: {
+		sub = syscall_sub_linux_arm64[14];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_removexattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_removexattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_removexattr_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_removexattr_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 15 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
 	case 15: {
+		sub = syscall_sub_linux_arm64[15];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_lremovexattr_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_lremovexattr_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 16 long sys_fremovexattr ['int fd', 'const char __user *name']
 	case 16: {
+		sub = syscall_sub_linux_arm64[16];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_fremovexattr_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fremovexattr_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 17 long sys_getcwd ['char __user *buf', 'unsigned long size']
 	case 17: {
+		sub = syscall_sub_linux_arm64[17];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getcwd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getcwd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getcwd_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getcwd_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 18 long sys_lookup_dcookie ['u64 cookie64', 'char __user *buf', 'size_t len']
 	case 18: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[18];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lookup_dcookie_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_lookup_dcookie_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 19 long sys_eventfd2 ['unsigned int count', 'int flags']
 	case 19: {
+		sub = syscall_sub_linux_arm64[19];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_eventfd2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_eventfd2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_eventfd2_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_eventfd2_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 20 long sys_epoll_create1 ['int flags']
 	case 20: {
+		sub = syscall_sub_linux_arm64[20];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_epoll_create1_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_epoll_create1_enter, cpu, pc, arg0);
 	}; break;
 	// 21 long sys_epoll_ctl ['int epfd', 'int op', 'int fd', 'struct epoll_event __user *event']
 	case 21: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[21];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_epoll_ctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_epoll_ctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 22 long sys_epoll_pwait ['int epfd', 'struct epoll_event __user *events', 'int maxevents', 'int timeout', 'const sigset_t __user *sigmask', 'size_t sigsetsize']
 	case 22: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_epoll_pwait_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[22];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_epoll_pwait_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 23 long sys_dup ['unsigned int fildes']
 	case 23: {
+		sub = syscall_sub_linux_arm64[23];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_dup_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_dup_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_dup_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_dup_enter, cpu, pc, arg0);
 	}; break;
 	// 24 long sys_dup3 ['unsigned int oldfd', 'unsigned int newfd', 'int flags']
 	case 24: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_dup3_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[24];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_dup3_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_dup3_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_dup3_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 25 long sys_fcntl ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 25: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fcntl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[25];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fcntl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_fcntl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fcntl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 26 long sys_inotify_init1 ['int flags']
 	case 26: {
+		sub = syscall_sub_linux_arm64[26];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_inotify_init1_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_inotify_init1_enter, cpu, pc, arg0);
 	}; break;
 	// 27 long sys_inotify_add_watch ['int fd', 'const char __user *path', 'u32 mask']
 	case 27: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[27];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_inotify_add_watch_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_inotify_add_watch_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 28 long sys_inotify_rm_watch ['int fd', '__s32 wd']
 	case 28: {
+		sub = syscall_sub_linux_arm64[28];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_inotify_rm_watch_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_inotify_rm_watch_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 29 long sys_ioctl ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 29: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ioctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[29];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ioctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_ioctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_ioctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 30 long sys_ioprio_set ['int which', 'int who', 'int ioprio']
 	case 30: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[30];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_ioprio_set_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_ioprio_set_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 31 long sys_ioprio_get ['int which', 'int who']
 	case 31: {
+		sub = syscall_sub_linux_arm64[31];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_ioprio_get_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_ioprio_get_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 32 long sys_flock ['unsigned int fd', 'unsigned int cmd']
 	case 32: {
+		sub = syscall_sub_linux_arm64[32];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_flock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_flock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_flock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_flock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 33 long sys_mknodat ['int dfd', 'const char __user *filename', 'umode_t mode', 'unsigned dev']
 	case 33: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mknodat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[33];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mknodat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mknodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_mknodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 34 long sys_mkdirat ['int dfd', 'const char __user *pathname', 'umode_t mode']
 	case 34: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mkdirat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[34];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mkdirat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mkdirat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mkdirat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 35 long sys_unlinkat ['int dfd', 'const char __user *pathname', 'int flag']
 	case 35: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_unlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[35];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_unlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_unlinkat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_unlinkat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 36 long sys_symlinkat ['const char __user *oldname', 'int newdfd', 'const char __user *newname']
 	case 36: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_symlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[36];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_symlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_symlinkat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_symlinkat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 37 long sys_linkat ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname', 'int flags']
 	case 37: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_linkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_linkat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[37];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_linkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_linkat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 38 long sys_renameat ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname']
 	case 38: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_renameat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[38];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_renameat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_renameat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_renameat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 39 long sys_umount2 ['const char* target', 'int flags']
 	case 39: {
+		sub = syscall_sub_linux_arm64[39];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_umount2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_umount2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_umount2_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_umount2_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 40 long sys_mount ['char __user *dev_name', 'char __user *dir_name', 'char __user *type', 'unsigned long flags', 'void __user *data']
 	case 40: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_mount_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[40];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mount_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 41 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
 	case 41: {
+		sub = syscall_sub_linux_arm64[41];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pivot_root_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pivot_root_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_pivot_root_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_pivot_root_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 42 long sys_nfsservctl ['int cmd', 'struct nfsctl_arg *argp', 'union nfsctl_res *resp']
 	case 42: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_nfsservctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[42];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_nfsservctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_nfsservctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_nfsservctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 43 long sys_statfs ['const char * path', 'struct statfs *buf']
 	case 43: {
+		sub = syscall_sub_linux_arm64[43];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_statfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_statfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_statfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_statfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 44 long sys_fstatfs ['unsigned int fd', 'struct statfs *buf']
 	case 44: {
+		sub = syscall_sub_linux_arm64[44];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fstatfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fstatfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_fstatfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fstatfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 45 long sys_truncate ['const char *path', 'long length']
 	case 45: {
+		sub = syscall_sub_linux_arm64[45];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_truncate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_truncate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+			}
+			PPP_RUN_CB(on_sys_truncate_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_truncate_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 46 long sys_ftruncate ['unsigned int fd', 'unsigned long length']
 	case 46: {
+		sub = syscall_sub_linux_arm64[46];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ftruncate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ftruncate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_ftruncate_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_ftruncate_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 47 long sys_fallocate ['int fd', 'int mode', 'loff_t offset', 'loff_t len']
 	case 47: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fallocate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[47];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fallocate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_fallocate_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_fallocate_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 48 long sys_faccessat ['int dfd', 'const char __user *filename', 'int mode']
 	case 48: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_faccessat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[48];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_faccessat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_faccessat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_faccessat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 49 long sys_chdir ['const char __user *filename']
 	case 49: {
+		sub = syscall_sub_linux_arm64[49];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_chdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_chdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_chdir_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_chdir_enter, cpu, pc, arg0);
 	}; break;
 	// 50 long sys_fchdir ['unsigned int fd']
 	case 50: {
+		sub = syscall_sub_linux_arm64[50];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fchdir_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_fchdir_enter, cpu, pc, arg0);
 	}; break;
 	// 51 long sys_chroot ['const char __user *filename']
 	case 51: {
+		sub = syscall_sub_linux_arm64[51];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_chroot_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_chroot_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_chroot_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_chroot_enter, cpu, pc, arg0);
 	}; break;
 	// 52 long sys_fchmod ['unsigned int fd', 'umode_t mode']
 	case 52: {
+		sub = syscall_sub_linux_arm64[52];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchmod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchmod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fchmod_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fchmod_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 53 long sys_fchmodat ['int dfd', 'const char __user *filename', 'umode_t mode']
 	case 53: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchmodat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[53];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchmodat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fchmodat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fchmodat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 54 long sys_fchownat ['int dfd', 'const char __user *filename', 'uid_t user', 'gid_t group', 'int flag']
 	case 54: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchownat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_fchownat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[54];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchownat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_fchownat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 55 long sys_fchown ['unsigned int fd', 'uid_t user', 'gid_t group']
 	case 55: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[55];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fchown_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fchown_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 56 long sys_openat ['int dfd', 'const char __user *filename', 'int flags', 'umode_t mode']
 	case 56: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_openat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[56];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_openat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_openat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_openat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 57 long sys_close ['unsigned int fd']
 	case 57: {
+		sub = syscall_sub_linux_arm64[57];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_close_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_close_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_close_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_close_enter, cpu, pc, arg0);
 	}; break;
 	// 58 long sys_vhangup ['void']
 	case 58: {
+		sub = syscall_sub_linux_arm64[58];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_vhangup_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_vhangup_enter, cpu, pc);
+		}
 	}; break;
 	// 59 long sys_pipe2 ['int *fildes', 'int flags']
 	case 59: {
+		sub = syscall_sub_linux_arm64[59];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pipe2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pipe2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_pipe2_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_pipe2_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 60 long sys_quotactl ['unsigned int cmd', 'const char __user *special', 'qid_t id', 'void __user *addr']
 	case 60: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_quotactl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[60];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_quotactl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_quotactl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_quotactl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 61 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 *dirent', 'unsigned int count']
 	case 61: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getdents64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[61];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getdents64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getdents64_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getdents64_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 62 long sys_lseek ['unsigned int fd', 'off_t offset', 'unsigned int whence']
 	case 62: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lseek_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[62];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lseek_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lseek_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_lseek_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 63 long sys_read ['unsigned int fd', 'char __user *buf', 'size_t count']
 	case 63: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_read_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[63];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_read_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_read_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_read_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 64 long sys_write ['unsigned int fd', 'const char __user *buf', 'size_t count']
 	case 64: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_write_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[64];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_write_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_write_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_write_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 65 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 	case 65: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_readv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[65];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_readv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_readv_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_readv_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 66 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 	case 66: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_writev_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[66];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_writev_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_writev_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_writev_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 67 long sys_pread64 ['unsigned int fd', 'char *buf', 'size_t count', 'loff_t pos']
 	case 67: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pread64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[67];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pread64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_pread64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_pread64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 68 long sys_pwrite64 ['unsigned int fd', 'const char *buf', 'size_t count', 'loff_t pos']
 	case 68: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pwrite64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[68];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pwrite64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_pwrite64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_pwrite64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 69 long sys_preadv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h']
 	case 69: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_preadv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_preadv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[69];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_preadv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_preadv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 70 long sys_pwritev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h']
 	case 70: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pwritev_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_pwritev_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[70];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pwritev_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_pwritev_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 71 long sys_sendfile ['int out_fd', 'int in_fd', 'off_t *offset', 'size_t count']
 	case 71: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendfile_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[71];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendfile_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sendfile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sendfile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 72 long sys_pselect6 ['int', 'fd_set *', 'fd_set *', 'fd_set *', 'struct __kernel_timespec *', 'void *']
 	case 72: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pselect6_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_pselect6_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[72];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pselect6_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_pselect6_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 73 long sys_ppoll ['struct pollfd __user *', 'unsigned int', 'struct timespec __user *', 'const sigset_t __user *', 'size_t']
 	case 73: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ppoll_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_ppoll_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[73];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ppoll_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_ppoll_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 74 long sys_signalfd4 ['int ufd', 'sigset_t *user_mask', 'size_t sizemask', 'int flags']
 	case 74: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_signalfd4_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[74];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_signalfd4_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_signalfd4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_signalfd4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 75 long sys_vmsplice ['int fd', 'const struct iovec __user *iov', 'unsigned long nr_segs', 'unsigned int flags']
 	case 75: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_vmsplice_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[75];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_vmsplice_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_vmsplice_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_vmsplice_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 76 long sys_splice ['int fd_in', 'loff_t __user *off_in', 'int fd_out', 'loff_t __user *off_out', 'size_t len', 'unsigned int flags']
 	case 76: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_splice_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_splice_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[76];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_splice_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_splice_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 77 long sys_tee ['int fdin', 'int fdout', 'size_t len', 'unsigned int flags']
 	case 77: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_tee_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[77];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_tee_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_tee_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_tee_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 78 long sys_readlinkat ['int dfd', 'const char __user *path', 'char __user *buf', 'int bufsiz']
 	case 78: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_readlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[78];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_readlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_readlinkat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_readlinkat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 79 long sys_newfstatat ['int dfd', 'const char *filename', 'struct stat *statbuf', 'int flag']
 	case 79: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_newfstatat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[79];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_newfstatat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_newfstatat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_newfstatat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 80 long sys_fstat ['unsigned int fd', 'struct __old_kernel_stat *statbuf']
 	case 80: {
+		sub = syscall_sub_linux_arm64[80];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_fstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 81 long sys_sync ['void']
 	case 81: {
+		sub = syscall_sub_linux_arm64[81];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_sync_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_sync_enter, cpu, pc);
+		}
 	}; break;
 	// 82 long sys_fsync ['unsigned int fd']
 	case 82: {
+		sub = syscall_sub_linux_arm64[82];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fsync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fsync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fsync_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_fsync_enter, cpu, pc, arg0);
 	}; break;
 	// 83 long sys_fdatasync ['unsigned int fd']
 	case 83: {
+		sub = syscall_sub_linux_arm64[83];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fdatasync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fdatasync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fdatasync_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_fdatasync_enter, cpu, pc, arg0);
 	}; break;
 	// 84 long sys_sync_file_range ['int fd', 'loff_t offset', 'loff_t nbytes', 'unsigned int flags']
 	case 84: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sync_file_range_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[84];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sync_file_range_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sync_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sync_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 85 long sys_timerfd_create ['int clockid', 'int flags']
 	case 85: {
+		sub = syscall_sub_linux_arm64[85];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_timerfd_create_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_timerfd_create_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 86 long sys_timerfd_settime ['int ufd', 'int flags', 'const struct itimerspec __user *utmr', 'struct itimerspec __user *otmr']
 	case 86: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[86];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_timerfd_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_timerfd_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 87 long sys_timerfd_gettime ['int ufd', 'struct itimerspec __user *otmr']
 	case 87: {
+		sub = syscall_sub_linux_arm64[87];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_timerfd_gettime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_timerfd_gettime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 88 long sys_utimensat ['int dfd', 'const char __user *filename', 'struct timespec __user *utimes', 'int flags']
 	case 88: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_utimensat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[88];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_utimensat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_utimensat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_utimensat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 89 long sys_acct ['const char __user *name']
 	case 89: {
+		sub = syscall_sub_linux_arm64[89];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_acct_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_acct_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_acct_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_acct_enter, cpu, pc, arg0);
 	}; break;
 	// 90 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
 	case 90: {
+		sub = syscall_sub_linux_arm64[90];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_capget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_capget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_capget_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_capget_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 91 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
 	case 91: {
+		sub = syscall_sub_linux_arm64[91];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_capset_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_capset_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_capset_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_capset_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 92 long sys_personality ['unsigned int personality']
 	case 92: {
+		sub = syscall_sub_linux_arm64[92];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_personality_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_personality_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_personality_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_personality_enter, cpu, pc, arg0);
 	}; break;
 	// 93 long sys_exit ['int error_code']
 	case 93: {
+		sub = syscall_sub_linux_arm64[93];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_exit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_exit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
 	}; break;
 	// 94 long sys_exit_group ['int error_code']
 	case 94: {
+		sub = syscall_sub_linux_arm64[94];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_exit_group_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_exit_group_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_exit_group_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_exit_group_enter, cpu, pc, arg0);
 	}; break;
 	// 95 long sys_waitid ['int which', 'pid_t pid', 'struct siginfo __user *infop', 'int options', 'struct rusage __user *ru']
 	case 95: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_waitid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_waitid_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[95];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_waitid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_waitid_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 96 long sys_set_tid_address ['int __user *tidptr']
 	case 96: {
+		sub = syscall_sub_linux_arm64[96];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_set_tid_address_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_set_tid_address_enter, cpu, pc, arg0);
 	}; break;
 	// 97 long sys_unshare ['unsigned long unshare_flags']
 	case 97: {
+		sub = syscall_sub_linux_arm64[97];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_unshare_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_unshare_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_unshare_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_unshare_enter, cpu, pc, arg0);
 	}; break;
 	// 98 long sys_futex ['u32 __user *uaddr', 'int op', 'u32 val', 'struct timespec __user *utime', 'u32 __user *uaddr2', 'u32 val3']
 	case 98: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_futex_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_futex_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[98];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_futex_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_futex_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 99 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
 	case 99: {
+		sub = syscall_sub_linux_arm64[99];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_set_robust_list_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_set_robust_list_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 100 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
 	case 100: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[100];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_get_robust_list_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_get_robust_list_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 101 long sys_nanosleep ['struct timespec __user *rqtp', 'struct timespec __user *rmtp']
 	case 101: {
+		sub = syscall_sub_linux_arm64[101];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_nanosleep_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_nanosleep_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_nanosleep_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_nanosleep_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 102 long sys_getitimer ['int which', 'struct itimerval __user *value']
 	case 102: {
+		sub = syscall_sub_linux_arm64[102];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getitimer_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getitimer_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getitimer_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getitimer_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 103 long sys_setitimer ['int which', 'struct itimerval __user *value', 'struct itimerval __user *ovalue']
 	case 103: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setitimer_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[103];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setitimer_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_setitimer_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_setitimer_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 104 long sys_kexec_load ['unsigned long entry', 'unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
 	case 104: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_kexec_load_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[104];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_kexec_load_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_kexec_load_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_kexec_load_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 105 long sys_init_module ['void __user *umod', 'unsigned long len', 'const char __user *uargs']
 	case 105: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_init_module_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[105];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_init_module_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_init_module_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_init_module_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 106 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
 	case 106: {
+		sub = syscall_sub_linux_arm64[106];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_delete_module_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_delete_module_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_delete_module_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_delete_module_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 107 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user *created_timer_id']
 	case 107: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[107];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_timer_create_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_timer_create_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 108 long sys_timer_gettime ['timer_t timer_id', 'struct itimerspec __user *setting']
 	case 108: {
+		sub = syscall_sub_linux_arm64[108];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_timer_gettime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_timer_gettime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 109 long sys_timer_getoverrun ['timer_t timer_id']
 	case 109: {
+		sub = syscall_sub_linux_arm64[109];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_getoverrun_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_timer_getoverrun_enter, cpu, pc, arg0);
 	}; break;
 	// 110 long sys_timer_settime ['timer_t timer_id', 'int flags', 'const struct itimerspec __user *new_setting', 'struct itimerspec __user *old_setting']
 	case 110: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_settime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[110];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_settime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_timer_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_timer_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 111 long sys_timer_delete ['timer_t timer_id']
 	case 111: {
+		sub = syscall_sub_linux_arm64[111];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_delete_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_delete_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_delete_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_timer_delete_enter, cpu, pc, arg0);
 	}; break;
 	// 112 long sys_clock_settime ['clockid_t which_clock', 'const struct timespec __user *tp']
 	case 112: {
+		sub = syscall_sub_linux_arm64[112];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_settime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_settime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_clock_settime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_settime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 113 long sys_clock_gettime ['clockid_t which_clock', 'struct timespec __user *tp']
 	case 113: {
+		sub = syscall_sub_linux_arm64[113];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_clock_gettime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_gettime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 114 long sys_clock_getres ['clockid_t which_clock', 'struct timespec __user *tp']
 	case 114: {
+		sub = syscall_sub_linux_arm64[114];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_getres_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_getres_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_clock_getres_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_getres_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 115 long sys_clock_nanosleep ['clockid_t which_clock', 'int flags', 'const struct timespec __user *rqtp', 'struct timespec __user *rmtp']
 	case 115: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[115];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_clock_nanosleep_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_clock_nanosleep_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 116 long sys_syslog ['int type', 'char __user *buf', 'int len']
 	case 116: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_syslog_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[116];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_syslog_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_syslog_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_syslog_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 117 long sys_ptrace ['long request', 'long pid', 'unsigned long addr', 'unsigned long data']
 	case 117: {
-		panda_noreturn = false;
-		int64_t arg0 = get_s64(cpu, 0);
-		int64_t arg1 = get_s64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ptrace_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[117];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int64_t arg0 = get_s64(cpu, 0);
+			int64_t arg1 = get_s64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ptrace_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_ptrace_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_ptrace_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 118 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
 	case 118: {
+		sub = syscall_sub_linux_arm64[118];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_sched_setparam_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sched_setparam_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 119 long sys_sched_setscheduler ['pid_t pid', 'int policy', 'struct sched_param __user *param']
 	case 119: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[119];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_sched_setscheduler_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sched_setscheduler_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 120 long sys_sched_getscheduler ['pid_t pid']
 	case 120: {
+		sub = syscall_sub_linux_arm64[120];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_getscheduler_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sched_getscheduler_enter, cpu, pc, arg0);
 	}; break;
 	// 121 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
 	case 121: {
+		sub = syscall_sub_linux_arm64[121];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_sched_getparam_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sched_getparam_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 122 long sys_sched_setaffinity ['pid_t pid', 'unsigned int len', 'unsigned long __user *user_mask_ptr']
 	case 122: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[122];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_sched_setaffinity_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sched_setaffinity_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 123 long sys_sched_getaffinity ['pid_t pid', 'unsigned int len', 'unsigned long __user *user_mask_ptr']
 	case 123: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[123];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_sched_getaffinity_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sched_getaffinity_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 124 long sys_sched_yield ['void']
 	case 124: {
+		sub = syscall_sub_linux_arm64[124];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_sched_yield_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_sched_yield_enter, cpu, pc);
+		}
 	}; break;
 	// 125 long sys_sched_get_priority_max ['int policy']
 	case 125: {
+		sub = syscall_sub_linux_arm64[125];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_get_priority_max_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sched_get_priority_max_enter, cpu, pc, arg0);
 	}; break;
 	// 126 long sys_sched_get_priority_min ['int policy']
 	case 126: {
+		sub = syscall_sub_linux_arm64[126];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_get_priority_min_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sched_get_priority_min_enter, cpu, pc, arg0);
 	}; break;
 	// 127 long sys_sched_rr_get_interval ['pid_t pid', 'struct timespec __user *interval']
 	case 127: {
+		sub = syscall_sub_linux_arm64[127];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_sched_rr_get_interval_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sched_rr_get_interval_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 128 long sys_restart_syscall ['void']
 	case 128: {
+		sub = syscall_sub_linux_arm64[128];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_restart_syscall_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_restart_syscall_enter, cpu, pc);
+		}
 	}; break;
 	// 129 long sys_kill ['pid_t pid', 'int sig']
 	case 129: {
+		sub = syscall_sub_linux_arm64[129];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_kill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_kill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_kill_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_kill_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 130 long sys_tkill ['pid_t pid', 'int sig']
 	case 130: {
+		sub = syscall_sub_linux_arm64[130];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_tkill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_tkill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_tkill_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_tkill_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 131 long sys_tgkill ['pid_t tgid', 'pid_t pid', 'int sig']
 	case 131: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_tgkill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[131];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_tgkill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_tgkill_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_tgkill_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 132 long sys_sigaltstack ['const struct sigaltstack __user *uss', 'struct sigaltstack __user *uoss']
 	case 132: {
+		sub = syscall_sub_linux_arm64[132];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_sigaltstack_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sigaltstack_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 133 long sys_rt_sigsuspend ['sigset_t __user *unewset', 'size_t sigsetsize']
 	case 133: {
+		sub = syscall_sub_linux_arm64[133];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigsuspend_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_rt_sigsuspend_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 134 long sys_rt_sigaction ['int', 'const struct sigaction __user *', 'struct sigaction __user *', 'size_t']
 	case 134: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[134];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigaction_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_sigaction_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 135 long sys_rt_sigprocmask ['int how', 'sigset_t __user *set', 'sigset_t __user *oset', 'size_t sigsetsize']
 	case 135: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[135];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigprocmask_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_sigprocmask_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 136 long sys_rt_sigpending ['sigset_t __user *set', 'size_t sigsetsize']
 	case 136: {
+		sub = syscall_sub_linux_arm64[136];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigpending_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_rt_sigpending_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 137 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct timespec __user *uts', 'size_t sigsetsize']
 	case 137: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[137];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigtimedwait_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_sigtimedwait_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 138 long sys_rt_sigqueueinfo ['pid_t pid', 'int sig', 'siginfo_t __user *uinfo']
 	case 138: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[138];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigqueueinfo_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_rt_sigqueueinfo_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 139 long sys_rt_sigreturn ['struct pt_regs *regs']
 	case 139: {
+		sub = syscall_sub_linux_arm64[139];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigreturn_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigreturn_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigreturn_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_rt_sigreturn_enter, cpu, pc, arg0);
 	}; break;
 	// 140 long sys_setpriority ['int which', 'int who', 'int niceval']
 	case 140: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setpriority_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[140];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setpriority_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setpriority_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_setpriority_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 141 long sys_getpriority ['int which', 'int who']
 	case 141: {
+		sub = syscall_sub_linux_arm64[141];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getpriority_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getpriority_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_getpriority_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getpriority_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 142 long sys_reboot ['int magic1', 'int magic2', 'unsigned int cmd', 'void __user *arg']
 	case 142: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_reboot_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[142];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_reboot_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_reboot_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_reboot_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 143 long sys_setregid ['gid_t rgid', 'gid_t egid']
 	case 143: {
+		sub = syscall_sub_linux_arm64[143];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setregid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setregid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setregid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setregid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 144 long sys_setgid ['gid_t gid']
 	case 144: {
+		sub = syscall_sub_linux_arm64[144];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setgid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_setgid_enter, cpu, pc, arg0);
 	}; break;
 	// 145 long sys_setreuid ['uid_t ruid', 'uid_t euid']
 	case 145: {
+		sub = syscall_sub_linux_arm64[145];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setreuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setreuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setreuid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setreuid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 146 long sys_setuid ['uid_t uid']
 	case 146: {
+		sub = syscall_sub_linux_arm64[146];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setuid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_setuid_enter, cpu, pc, arg0);
 	}; break;
 	// 147 long sys_setresuid ['uid_t ruid', 'uid_t euid', 'uid_t suid']
 	case 147: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setresuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[147];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setresuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setresuid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_setresuid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 148 long sys_getresuid ['uid_t __user *ruid', 'uid_t __user *euid', 'uid_t __user *suid']
 	case 148: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getresuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[148];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getresuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getresuid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getresuid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 149 long sys_setresgid ['gid_t rgid', 'gid_t egid', 'gid_t sgid']
 	case 149: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setresgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[149];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setresgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setresgid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_setresgid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 150 long sys_getresgid ['gid_t __user *rgid', 'gid_t __user *egid', 'gid_t __user *sgid']
 	case 150: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getresgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[150];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getresgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getresgid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getresgid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 151 long sys_setfsuid ['uid_t uid']
 	case 151: {
+		sub = syscall_sub_linux_arm64[151];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setfsuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setfsuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setfsuid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_setfsuid_enter, cpu, pc, arg0);
 	}; break;
 	// 152 long sys_setfsgid ['gid_t gid']
 	case 152: {
+		sub = syscall_sub_linux_arm64[152];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setfsgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setfsgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setfsgid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_setfsgid_enter, cpu, pc, arg0);
 	}; break;
 	// 153 long sys_times ['struct tms __user *tbuf']
 	case 153: {
+		sub = syscall_sub_linux_arm64[153];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_times_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_times_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_times_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_times_enter, cpu, pc, arg0);
 	}; break;
 	// 154 long sys_setpgid ['pid_t pid', 'pid_t pgid']
 	case 154: {
+		sub = syscall_sub_linux_arm64[154];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setpgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setpgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setpgid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setpgid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 155 long sys_getpgid ['pid_t pid']
 	case 155: {
+		sub = syscall_sub_linux_arm64[155];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getpgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getpgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_getpgid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_getpgid_enter, cpu, pc, arg0);
 	}; break;
 	// 156 long sys_getsid ['pid_t pid']
 	case 156: {
+		sub = syscall_sub_linux_arm64[156];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getsid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getsid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_getsid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_getsid_enter, cpu, pc, arg0);
 	}; break;
 	// 157 long sys_setsid ['void']
 	case 157: {
+		sub = syscall_sub_linux_arm64[157];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_setsid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_setsid_enter, cpu, pc);
+		}
 	}; break;
 	// 158 long sys_getgroups ['int gidsetsize', 'gid_t __user *grouplist']
 	case 158: {
+		sub = syscall_sub_linux_arm64[158];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getgroups_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getgroups_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getgroups_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getgroups_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 159 long sys_setgroups ['int gidsetsize', 'gid_t __user *grouplist']
 	case 159: {
+		sub = syscall_sub_linux_arm64[159];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setgroups_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setgroups_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_setgroups_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setgroups_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 160 long sys_uname ['struct new_utsname __user *name']
 	case 160: {
+		sub = syscall_sub_linux_arm64[160];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_uname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_uname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_uname_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_uname_enter, cpu, pc, arg0);
 	}; break;
 	// 161 long sys_sethostname ['char __user *name', 'int len']
 	case 161: {
+		sub = syscall_sub_linux_arm64[161];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sethostname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sethostname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sethostname_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sethostname_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 162 long sys_setdomainname ['char __user *name', 'int len']
 	case 162: {
+		sub = syscall_sub_linux_arm64[162];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setdomainname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setdomainname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setdomainname_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setdomainname_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 163 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 163: {
+		sub = syscall_sub_linux_arm64[163];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getrlimit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getrlimit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getrlimit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getrlimit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 164 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 164: {
+		sub = syscall_sub_linux_arm64[164];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setrlimit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setrlimit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_setrlimit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setrlimit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 165 long sys_getrusage ['int who', 'struct rusage __user *ru']
 	case 165: {
+		sub = syscall_sub_linux_arm64[165];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getrusage_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getrusage_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getrusage_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getrusage_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 166 long sys_umask ['int mask']
 	case 166: {
+		sub = syscall_sub_linux_arm64[166];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_umask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_umask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_umask_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_umask_enter, cpu, pc, arg0);
 	}; break;
 	// 167 long sys_prctl ['int option', 'unsigned long arg2', 'unsigned long arg3', 'unsigned long arg4', 'unsigned long arg5']
 	case 167: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_prctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_prctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[167];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_prctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_prctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 168 long sys_getcpu ['unsigned __user *cpu', 'unsigned __user *node', 'struct getcpu_cache __user *cache']
 	case 168: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getcpu_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[168];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getcpu_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getcpu_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getcpu_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 169 long sys_gettimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
 	case 169: {
+		sub = syscall_sub_linux_arm64[169];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_gettimeofday_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_gettimeofday_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 170 long sys_settimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
 	case 170: {
+		sub = syscall_sub_linux_arm64[170];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_settimeofday_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_settimeofday_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_settimeofday_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_settimeofday_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 171 long sys_adjtimex ['struct timex __user *txc_p']
 	case 171: {
+		sub = syscall_sub_linux_arm64[171];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_adjtimex_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_adjtimex_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_adjtimex_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_adjtimex_enter, cpu, pc, arg0);
 	}; break;
 	// 172 long sys_getpid ['void']
 	case 172: {
+		sub = syscall_sub_linux_arm64[172];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getpid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getpid_enter, cpu, pc);
+		}
 	}; break;
 	// 173 long sys_getppid ['void']
 	case 173: {
+		sub = syscall_sub_linux_arm64[173];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getppid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getppid_enter, cpu, pc);
+		}
 	}; break;
 	// 174 long sys_getuid ['void']
 	case 174: {
+		sub = syscall_sub_linux_arm64[174];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getuid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getuid_enter, cpu, pc);
+		}
 	}; break;
 	// 175 long sys_geteuid ['void']
 	case 175: {
+		sub = syscall_sub_linux_arm64[175];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_geteuid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_geteuid_enter, cpu, pc);
+		}
 	}; break;
 	// 176 long sys_getgid ['void']
 	case 176: {
+		sub = syscall_sub_linux_arm64[176];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getgid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getgid_enter, cpu, pc);
+		}
 	}; break;
 	// 177 long sys_getegid ['void']
 	case 177: {
+		sub = syscall_sub_linux_arm64[177];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getegid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getegid_enter, cpu, pc);
+		}
 	}; break;
 	// 178 long sys_gettid ['void']
 	case 178: {
+		sub = syscall_sub_linux_arm64[178];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_gettid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_gettid_enter, cpu, pc);
+		}
 	}; break;
 	// 179 long sys_sysinfo ['struct sysinfo __user *info']
 	case 179: {
+		sub = syscall_sub_linux_arm64[179];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sysinfo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sysinfo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_sysinfo_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sysinfo_enter, cpu, pc, arg0);
 	}; break;
 	// 180 long sys_mq_open ['const char __user *name', 'int oflag', 'umode_t mode', 'struct mq_attr __user *attr']
 	case 180: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[180];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mq_open_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_mq_open_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 181 long sys_mq_unlink ['const char __user *name']
 	case 181: {
+		sub = syscall_sub_linux_arm64[181];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mq_unlink_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_mq_unlink_enter, cpu, pc, arg0);
 	}; break;
 	// 182 long sys_mq_timedsend ['mqd_t mqdes', 'const char __user *msg_ptr', 'size_t msg_len', 'unsigned int msg_prio', 'const struct timespec __user *abs_timeout']
 	case 182: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_mq_timedsend_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[182];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mq_timedsend_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 183 long sys_mq_timedreceive ['mqd_t mqdes', 'char __user *msg_ptr', 'size_t msg_len', 'unsigned int __user *msg_prio', 'const struct timespec __user *abs_timeout']
 	case 183: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_mq_timedreceive_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[183];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mq_timedreceive_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 184 long sys_mq_notify ['mqd_t mqdes', 'const struct sigevent __user *notification']
 	case 184: {
+		sub = syscall_sub_linux_arm64[184];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_notify_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_notify_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mq_notify_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_mq_notify_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 185 long sys_mq_getsetattr ['mqd_t mqdes', 'const struct mq_attr __user *mqstat', 'struct mq_attr __user *omqstat']
 	case 185: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[185];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mq_getsetattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mq_getsetattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 186 long sys_msgget ['key_t key', 'int msgflg']
 	case 186: {
+		sub = syscall_sub_linux_arm64[186];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msgget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msgget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_msgget_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_msgget_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 187 long sys_msgctl ['int msqid', 'int cmd', 'struct msqid_ds __user *buf']
 	case 187: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msgctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[187];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msgctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_msgctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_msgctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 188 long sys_msgrcv ['int msqid', 'struct msgbuf __user *msgp', 'size_t msgsz', 'long msgtyp', 'int msgflg']
 	case 188: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int64_t arg3 = get_s64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msgrcv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_msgrcv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[188];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int64_t arg3 = get_s64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msgrcv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_msgrcv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 189 long sys_msgsnd ['int msqid', 'struct msgbuf __user *msgp', 'size_t msgsz', 'int msgflg']
 	case 189: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msgsnd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[189];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msgsnd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_msgsnd_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_msgsnd_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 190 long sys_semget ['key_t key', 'int nsems', 'int semflg']
 	case 190: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_semget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[190];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_semget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_semget_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_semget_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 191 long sys_semctl ['int semid', 'int semnum', 'int cmd', 'unsigned long arg']
 	case 191: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_semctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[191];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_semctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_semctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_semctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 192 long sys_semtimedop ['int semid', 'struct sembuf __user *sops', 'unsigned nsops', 'const struct timespec __user *timeout']
 	case 192: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_semtimedop_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[192];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_semtimedop_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_semtimedop_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_semtimedop_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 193 long sys_semop ['int semid', 'struct sembuf __user *sops', 'unsigned nsops']
 	case 193: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_semop_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[193];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_semop_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_semop_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_semop_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 194 long sys_shmget ['key_t key', 'size_t size', 'int flag']
 	case 194: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shmget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[194];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shmget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_shmget_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_shmget_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 195 long sys_shmctl ['int shmid', 'int cmd', 'struct shmid_ds __user *buf']
 	case 195: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shmctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[195];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shmctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_shmctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_shmctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 196 long sys_shmat ['int shmid', 'char __user *shmaddr', 'int shmflg']
 	case 196: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shmat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[196];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shmat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_shmat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_shmat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 197 long sys_shmdt ['char __user *shmaddr']
 	case 197: {
+		sub = syscall_sub_linux_arm64[197];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shmdt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shmdt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_shmdt_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_shmdt_enter, cpu, pc, arg0);
 	}; break;
 	// 198 long sys_socket ['int', 'int', 'int']
 	case 198: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_socket_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[198];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_socket_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_socket_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_socket_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 199 long sys_socketpair ['int', 'int', 'int', 'int __user *']
 	case 199: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_socketpair_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[199];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_socketpair_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_socketpair_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_socketpair_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 200 long sys_bind ['int', 'struct sockaddr __user *', 'int']
 	case 200: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_bind_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[200];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_bind_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_bind_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_bind_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 201 long sys_listen ['int', 'int']
 	case 201: {
+		sub = syscall_sub_linux_arm64[201];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_listen_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_listen_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_listen_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_listen_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 202 long sys_accept ['int', 'struct sockaddr __user *', 'int __user *']
 	case 202: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_accept_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[202];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_accept_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_accept_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_accept_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 203 long sys_connect ['int', 'struct sockaddr __user *', 'int']
 	case 203: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_connect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[203];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_connect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_connect_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_connect_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 204 long sys_getsockname ['int', 'struct sockaddr __user *', 'int __user *']
 	case 204: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getsockname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[204];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getsockname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getsockname_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getsockname_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 205 long sys_getpeername ['int', 'struct sockaddr __user *', 'int __user *']
 	case 205: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getpeername_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[205];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getpeername_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getpeername_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getpeername_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 206 long sys_sendto ['int', 'void __user *', 'size_t', 'unsigned', 'struct sockaddr __user *', 'int']
 	case 206: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendto_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_sendto_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[206];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			int32_t arg5 = get_s32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendto_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sendto_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 207 long sys_recvfrom ['int', 'void __user *', 'size_t', 'unsigned', 'struct sockaddr __user *', 'int __user *']
 	case 207: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_recvfrom_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_recvfrom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[207];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_recvfrom_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_recvfrom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 208 long sys_setsockopt ['int fd', 'int level', 'int optname', 'char __user *optval', 'int optlen']
 	case 208: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setsockopt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_setsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[208];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setsockopt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 209 long sys_getsockopt ['int fd', 'int level', 'int optname', 'char __user *optval', 'int __user *optlen']
 	case 209: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getsockopt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_getsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[209];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getsockopt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_getsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 210 long sys_shutdown ['int', 'int']
 	case 210: {
+		sub = syscall_sub_linux_arm64[210];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shutdown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shutdown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_shutdown_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_shutdown_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 211 long sys_sendmsg ['int fd', 'struct user_msghdr __user *msg', 'unsigned flags']
 	case 211: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[211];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sendmsg_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sendmsg_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 212 long sys_recvmsg ['int fd', 'struct user_msghdr __user *msg', 'unsigned flags']
 	case 212: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_recvmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[212];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_recvmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_recvmsg_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_recvmsg_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 213 long sys_readahead ['int fd', 'loff_t offset', 'size_t count']
 	case 213: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_readahead_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[213];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_readahead_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_readahead_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_readahead_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 214 long sys_brk ['unsigned long brk']
 	case 214: {
+		sub = syscall_sub_linux_arm64[214];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_brk_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_brk_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_brk_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_brk_enter, cpu, pc, arg0);
 	}; break;
 	// 215 long sys_munmap ['unsigned long addr', 'size_t len']
 	case 215: {
+		sub = syscall_sub_linux_arm64[215];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_munmap_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_munmap_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_munmap_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_munmap_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 216 long sys_mremap ['unsigned long addr', 'unsigned long old_len', 'unsigned long new_len', 'unsigned long flags', 'unsigned long new_addr']
 	case 216: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mremap_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_mremap_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[216];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mremap_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mremap_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 217 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
 	case 217: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_add_key_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_add_key_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[217];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_add_key_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_add_key_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 218 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
 	case 218: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_request_key_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[218];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_request_key_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_request_key_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_request_key_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 219 long sys_keyctl ['int cmd', 'unsigned long arg2', 'unsigned long arg3', 'unsigned long arg4', 'unsigned long arg5']
 	case 219: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_keyctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_keyctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[219];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_keyctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_keyctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 220 long sys_clone ['unsigned long', 'unsigned long', 'int __user *', 'int __user *', 'unsigned long']
 	case 220: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clone_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_clone_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[220];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clone_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_clone_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 221 long sys_execve ['const char __user *filename', 'const char __user *const __user *argv', 'const char __user *const __user *envp']
 	case 221: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_execve_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[221];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_execve_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_execve_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_execve_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 222 long sys_mmap ['void *addr', 'size_t length', 'int prot', 'int flags', 'int fd', 'off_t offset']
 	case 222: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mmap_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_mmap_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[222];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mmap_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mmap_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 223 long sys_fadvise64 ['int fd', 'loff_t offset', 'size_t len', 'int advice']
 	case 223: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fadvise64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[223];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fadvise64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_fadvise64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_fadvise64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 224 long sys_swapon ['const char __user *specialfile', 'int swap_flags']
 	case 224: {
+		sub = syscall_sub_linux_arm64[224];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_swapon_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_swapon_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_swapon_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_swapon_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 225 long sys_swapoff ['const char __user *specialfile']
 	case 225: {
+		sub = syscall_sub_linux_arm64[225];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_swapoff_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_swapoff_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_swapoff_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_swapoff_enter, cpu, pc, arg0);
 	}; break;
 	// 226 long sys_mprotect ['unsigned long start', 'size_t len', 'unsigned long prot']
 	case 226: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mprotect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[226];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mprotect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mprotect_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mprotect_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 227 long sys_msync ['unsigned long start', 'size_t len', 'int flags']
 	case 227: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[227];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_msync_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_msync_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 228 long sys_mlock ['unsigned long start', 'size_t len']
 	case 228: {
+		sub = syscall_sub_linux_arm64[228];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mlock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mlock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mlock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_mlock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 229 long sys_munlock ['unsigned long start', 'size_t len']
 	case 229: {
+		sub = syscall_sub_linux_arm64[229];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_munlock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_munlock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_munlock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_munlock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 230 long sys_mlockall ['int flags']
 	case 230: {
+		sub = syscall_sub_linux_arm64[230];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mlockall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mlockall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_mlockall_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_mlockall_enter, cpu, pc, arg0);
 	}; break;
 	// 231 long sys_munlockall ['void']
 	case 231: {
+		sub = syscall_sub_linux_arm64[231];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_munlockall_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_munlockall_enter, cpu, pc);
+		}
 	}; break;
 	// 232 long sys_mincore ['unsigned long start', 'size_t len', 'unsigned char __user *vec']
 	case 232: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mincore_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[232];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mincore_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_mincore_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mincore_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 233 long sys_madvise ['unsigned long start', 'size_t len', 'int behavior']
 	case 233: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_madvise_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[233];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_madvise_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_madvise_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_madvise_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 234 long sys_remap_file_pages ['unsigned long start', 'unsigned long size', 'unsigned long prot', 'unsigned long pgoff', 'unsigned long flags']
 	case 234: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_remap_file_pages_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[234];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_remap_file_pages_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 235 long sys_mbind ['unsigned long start', 'unsigned long len', 'unsigned long mode', 'const unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
 	case 235: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mbind_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mbind_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[235];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mbind_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mbind_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 236 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', 'unsigned long flags']
 	case 236: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_get_mempolicy_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[236];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_get_mempolicy_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 237 long sys_set_mempolicy ['int mode', 'const unsigned long __user *nmask', 'unsigned long maxnode']
 	case 237: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[237];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_set_mempolicy_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_set_mempolicy_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 238 long sys_migrate_pages ['pid_t pid', 'unsigned long maxnode', 'const unsigned long __user *from', 'const unsigned long __user *to']
 	case 238: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_migrate_pages_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[238];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_migrate_pages_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_migrate_pages_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_migrate_pages_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 239 long sys_move_pages ['pid_t pid', 'unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
 	case 239: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_move_pages_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_move_pages_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[239];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			int32_t arg5 = get_s32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_move_pages_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_move_pages_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 240 long sys_rt_tgsigqueueinfo ['pid_t tgid', 'pid_t pid', 'int sig', 'siginfo_t __user *uinfo']
 	case 240: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[240];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_rt_tgsigqueueinfo_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_tgsigqueueinfo_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 241 long sys_perf_event_open ['struct perf_event_attr __user *attr_uptr', 'pid_t pid', 'int cpu', 'int group_fd', 'unsigned long flags']
 	case 241: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_perf_event_open_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[241];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_perf_event_open_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 242 long sys_accept4 ['int', 'struct sockaddr *', 'int *', 'int']
 	case 242: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_accept4_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[242];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_accept4_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_accept4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_accept4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 243 long sys_recvmmsg ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags', 'struct timespec __user *timeout']
 	case 243: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_recvmmsg_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[243];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_recvmmsg_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 260 long sys_wait4 ['pid_t pid', 'int *stat_addr', 'int options', 'struct rusage *ru']
 	case 260: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_wait4_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[244];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_wait4_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_wait4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_wait4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 261 long sys_prlimit64 ['pid_t pid', 'unsigned int resource', 'const struct rlimit64 *new_rlim', 'struct rlimit64 *old_rlim']
 	case 261: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_prlimit64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[245];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_prlimit64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_prlimit64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_prlimit64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 262 long sys_fanotify_init ['unsigned int flags', 'unsigned int event_f_flags']
 	case 262: {
+		sub = syscall_sub_linux_arm64[246];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fanotify_init_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fanotify_init_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 263 long sys_fanotify_mark ['int fanotify_fd', 'unsigned int flags', 'u64 mask', 'int fd', 'const char __user *pathname']
 	case 263: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_fanotify_mark_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[247];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_fanotify_mark_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 264 long sys_name_to_handle_at ['int dfd', 'const char __user *name', 'struct file_handle __user *handle', 'int __user *mnt_id', 'int flag']
 	case 264: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_name_to_handle_at_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[248];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_name_to_handle_at_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 265 long sys_open_by_handle_at ['int mountdirfd', 'struct file_handle __user *handle', 'int flags']
 	case 265: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[249];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_open_by_handle_at_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_open_by_handle_at_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 266 long sys_clock_adjtime ['clockid_t which_clock', 'struct timex __user *tx']
 	case 266: {
+		sub = syscall_sub_linux_arm64[250];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_clock_adjtime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_adjtime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 267 long sys_syncfs ['int fd']
 	case 267: {
+		sub = syscall_sub_linux_arm64[251];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_syncfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_syncfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_syncfs_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_syncfs_enter, cpu, pc, arg0);
 	}; break;
 	// 268 long sys_setns ['int fd', 'int nstype']
 	case 268: {
+		sub = syscall_sub_linux_arm64[252];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setns_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setns_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setns_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setns_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 269 long sys_sendmmsg ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags']
 	case 269: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[253];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sendmmsg_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sendmmsg_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 270 long sys_process_vm_readv ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
 	case 270: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_process_vm_readv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[254];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_process_vm_readv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 271 long sys_process_vm_writev ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
 	case 271: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint64_t arg5 = get_64(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_process_vm_writev_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[255];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint64_t arg5 = get_64(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_process_vm_writev_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 272 long sys_kcmp ['pid_t pid1', 'pid_t pid2', 'int type', 'unsigned long idx1', 'unsigned long idx2']
 	case 272: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_kcmp_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_kcmp_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[256];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_kcmp_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_kcmp_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 273 long sys_finit_module ['int fd', 'const char __user *uargs', 'int flags']
 	case 273: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_finit_module_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[257];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_finit_module_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_finit_module_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_finit_module_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 274 long sys_sched_setattr ['pid_t pid', 'struct sched_attr __user *attr', 'unsigned int flags']
 	case 274: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[258];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_setattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sched_setattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 275 long sys_sched_getattr ['pid_t pid', 'struct sched_attr __user *attr', 'unsigned int size', 'unsigned int flags']
 	case 275: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[259];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_getattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sched_getattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 276 long sys_renameat2 ['int olddfd', 'const char *oldname', 'int newdfd', 'const char *newname', 'unsigned int flags']
 	case 276: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_renameat2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_renameat2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[260];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_renameat2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_renameat2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 277 long sys_seccomp ['unsigned int op', 'unsigned int flags', 'const char __user *uargs']
 	case 277: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_seccomp_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+		sub = syscall_sub_linux_arm64[261];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_seccomp_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_seccomp_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_seccomp_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 278 long sys_getrandom ['char __user *buf', 'size_t count', 'unsigned int flags']
 	case 278: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getrandom_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[262];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getrandom_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getrandom_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getrandom_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 279 long sys_memfd_create ['const char __user *uname_ptr', 'unsigned int flags']
 	case 279: {
+		sub = syscall_sub_linux_arm64[263];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_memfd_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_memfd_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_memfd_create_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_memfd_create_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 280 long sys_bpf ['int cmd', 'union bpf_attr *attr', 'unsigned int size']
 	case 280: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_bpf_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[264];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_bpf_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_bpf_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_bpf_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 281 long sys_execveat ['int dfd', 'const char __user *filename', 'const char __user *const __user *argv', 'const char __user *const __user *envp', 'int flags']
 	case 281: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_execveat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_execveat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[265];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_execveat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_execveat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 282 long sys_userfaultfd ['int flags']
 	case 282: {
+		sub = syscall_sub_linux_arm64[266];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_userfaultfd_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_userfaultfd_enter, cpu, pc, arg0);
 	}; break;
 	// 283 long sys_membarrier ['int cmd', 'int flags']
 	case 283: {
+		sub = syscall_sub_linux_arm64[267];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_membarrier_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_membarrier_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_membarrier_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_membarrier_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 284 long sys_mlock2 ['unsigned long start', 'size_t len', 'int flags']
 	case 284: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mlock2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[268];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mlock2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_mlock2_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mlock2_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 285 long sys_copy_file_range ['int fd_in', 'loff_t __user *off_in', 'int fd_out', 'loff_t __user *off_out', 'size_t len', 'unsigned int flags']
 	case 285: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_copy_file_range_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_copy_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[269];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_copy_file_range_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_copy_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 286 long sys_preadv2 ['unsigned long fd', 'const struct iovec *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h', 'rwf_t flags']
 	case 286: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_preadv2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_preadv2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[270];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_preadv2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_preadv2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 287 long sys_pwritev2 ['unsigned long fd', 'const struct iovec *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h', 'rwf_t flags']
 	case 287: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pwritev2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_pwritev2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_arm64[271];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pwritev2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pwritev2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 288 long sys_pkey_mprotect ['unsigned long start', 'size_t len', 'unsigned long prot', 'int pkey']
 	case 288: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pkey_mprotect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[272];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pkey_mprotect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_pkey_mprotect_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_pkey_mprotect_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 289 long sys_pkey_alloc ['unsigned long flags', 'unsigned long init_val']
 	case 289: {
+		sub = syscall_sub_linux_arm64[273];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pkey_alloc_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pkey_alloc_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_pkey_alloc_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_pkey_alloc_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 290 long sys_pkey_free ['int pkey']
 	case 290: {
+		sub = syscall_sub_linux_arm64[274];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pkey_free_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pkey_free_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_pkey_free_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_pkey_free_enter, cpu, pc, arg0);
 	}; break;
 	// 291 long sys_statx ['int dfd', 'const char *path', 'unsigned flags', 'unsigned mask', 'struct statx *buffer']
 	case 291: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_statx_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_statx_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[275];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_statx_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_statx_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 294 long sys_kexec_file_load ['int kernel_fd', 'int initrd_fd', 'unsigned long cmdline_len', 'const char *cmdline', 'unsigned long flags']
 	case 294: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		uint64_t arg4 = get_64(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_kexec_file_load_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
-		}
-		PPP_RUN_CB(on_sys_kexec_file_load_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_arm64[276];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			uint64_t arg4 = get_64(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_kexec_file_load_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_kexec_file_load_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 424 long sys_pidfd_send_signal ['int pidfd', 'int sig', 'siginfo_t *info', 'unsigned int flags']
 	case 424: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pidfd_send_signal_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[277];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pidfd_send_signal_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pidfd_send_signal_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_pidfd_send_signal_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 434 long sys_pidfd_open ['pid_t pid', 'unsigned int flags']
 	case 434: {
+		sub = syscall_sub_linux_arm64[278];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pidfd_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pidfd_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pidfd_open_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_pidfd_open_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 435 long sys_clone3 ['struct clone_args *cl_args', 'size_t size']
 	case 435: {
+		sub = syscall_sub_linux_arm64[279];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clone3_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clone3_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clone3_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clone3_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 437 long sys_openat2 ['int dirfd', 'const char *pathname', 'struct open_how *how', 'size_t size']
 	case 437: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_openat2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[280];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_openat2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_openat2_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_openat2_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 438 long sys_pidfd_getfd ['int pidfd', 'int targetfd', 'unsigned int flags']
 	case 438: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pidfd_getfd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_arm64[281];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pidfd_getfd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pidfd_getfd_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_pidfd_getfd_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 439 long sys_faccessat2 ['int dirfd', 'const char *pathname', 'int mode', 'int flags']
 	case 439: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_faccessat2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_arm64[282];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_faccessat2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_faccessat2_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_faccessat2_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	default:
+		sub = syscall_sub_linux_arm64[283];
+		if (!sub) return;
 		panda_noreturn = false;
 		PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, ctx.no);
 	} // switch (ctx.no)
 
+	ctx.asid = panda_current_asid(cpu);
+	ctx.retaddr = calc_retaddr(cpu, pc);
+	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (sub & SYSCALL_SUB_RETURN) {
 		struct hook h;
 		h.addr = ctx.retaddr;
 		h.asid = ctx.asid;
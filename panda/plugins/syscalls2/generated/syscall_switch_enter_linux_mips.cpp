@@ -14,6 +14,1207 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+#if defined(TARGET_MIPS)
+/**
+ * @brief SYSCALL_SUB_* bits for each system call, in switch order. The last
+ * entry is used for system calls we have no prototype for.
+ */
+static uint8_t syscall_sub_linux_mips[394];
+
+/**
+ * @brief Recomputes the subscription bits from the registered callbacks.
+ */
+static void syscall_sub_update_linux_mips(void) {
+	bool all_enter = PPP_CHECK_CB(on_all_sys_enter);
+	bool all_enter2 = PPP_CHECK_CB(on_all_sys_enter2);
+	bool all_return = PPP_CHECK_CB(on_all_sys_return);
+	bool all_return2 = PPP_CHECK_CB(on_all_sys_return2);
+	syscall_sub_linux_mips[0] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_exit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_exit_return), false);
+	syscall_sub_linux_mips[1] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fork_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fork_return), false);
+	syscall_sub_linux_mips[2] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_read_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_read_return), false);
+	syscall_sub_linux_mips[3] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_write_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_write_return), false);
+	syscall_sub_linux_mips[4] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_open_return), false);
+	syscall_sub_linux_mips[5] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_close_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_close_return), false);
+	syscall_sub_linux_mips[6] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_waitpid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_waitpid_return), false);
+	syscall_sub_linux_mips[7] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_creat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_creat_return), false);
+	syscall_sub_linux_mips[8] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_link_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_link_return), false);
+	syscall_sub_linux_mips[9] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_unlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_unlink_return), false);
+	syscall_sub_linux_mips[10] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_execve_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_execve_return), false);
+	syscall_sub_linux_mips[11] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_chdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_chdir_return), false);
+	syscall_sub_linux_mips[12] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_time32_return), false);
+	syscall_sub_linux_mips[13] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mknod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mknod_return), false);
+	syscall_sub_linux_mips[14] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_chmod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_chmod_return), false);
+	syscall_sub_linux_mips[15] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lchown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lchown_return), false);
+	syscall_sub_linux_mips[16] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_stat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_stat_return), false);
+	syscall_sub_linux_mips[17] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lseek_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lseek_return), false);
+	syscall_sub_linux_mips[18] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpid_return), false);
+	syscall_sub_linux_mips[19] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mount_return), false);
+	syscall_sub_linux_mips[20] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_oldumount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_oldumount_return), false);
+	syscall_sub_linux_mips[21] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setuid_return), false);
+	syscall_sub_linux_mips[22] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getuid_return), false);
+	syscall_sub_linux_mips[23] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_stime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_stime32_return), false);
+	syscall_sub_linux_mips[24] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ptrace_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ptrace_return), false);
+	syscall_sub_linux_mips[25] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_alarm_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_alarm_return), false);
+	syscall_sub_linux_mips[26] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fstat_return), false);
+	syscall_sub_linux_mips[27] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pause_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pause_return), false);
+	syscall_sub_linux_mips[28] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_utime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_utime32_return), false);
+	syscall_sub_linux_mips[29] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_access_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_access_return), false);
+	syscall_sub_linux_mips[30] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_nice_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_nice_return), false);
+	syscall_sub_linux_mips[31] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sync_return), false);
+	syscall_sub_linux_mips[32] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_kill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_kill_return), false);
+	syscall_sub_linux_mips[33] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rename_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rename_return), false);
+	syscall_sub_linux_mips[34] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mkdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mkdir_return), false);
+	syscall_sub_linux_mips[35] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rmdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rmdir_return), false);
+	syscall_sub_linux_mips[36] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_dup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_dup_return), false);
+	syscall_sub_linux_mips[37] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pipe_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pipe_return), false);
+	syscall_sub_linux_mips[38] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_times_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_times_return), false);
+	syscall_sub_linux_mips[39] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_brk_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_brk_return), false);
+	syscall_sub_linux_mips[40] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setgid_return), false);
+	syscall_sub_linux_mips[41] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getgid_return), false);
+	syscall_sub_linux_mips[42] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_signal_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_signal_return), false);
+	syscall_sub_linux_mips[43] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_geteuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_geteuid_return), false);
+	syscall_sub_linux_mips[44] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getegid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getegid_return), false);
+	syscall_sub_linux_mips[45] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_acct_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_acct_return), false);
+	syscall_sub_linux_mips[46] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_umount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_umount_return), false);
+	syscall_sub_linux_mips[47] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ioctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ioctl_return), false);
+	syscall_sub_linux_mips[48] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fcntl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fcntl_return), false);
+	syscall_sub_linux_mips[49] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setpgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setpgid_return), false);
+	syscall_sub_linux_mips[50] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_olduname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_olduname_return), false);
+	syscall_sub_linux_mips[51] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_umask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_umask_return), false);
+	syscall_sub_linux_mips[52] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_chroot_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_chroot_return), false);
+	syscall_sub_linux_mips[53] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ustat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ustat_return), false);
+	syscall_sub_linux_mips[54] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_dup2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_dup2_return), false);
+	syscall_sub_linux_mips[55] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getppid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getppid_return), false);
+	syscall_sub_linux_mips[56] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpgrp_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpgrp_return), false);
+	syscall_sub_linux_mips[57] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setsid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setsid_return), false);
+	syscall_sub_linux_mips[58] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sigaction_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sigaction_return), false);
+	syscall_sub_linux_mips[59] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sgetmask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sgetmask_return), false);
+	syscall_sub_linux_mips[60] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ssetmask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ssetmask_return), false);
+	syscall_sub_linux_mips[61] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setreuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setreuid_return), false);
+	syscall_sub_linux_mips[62] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setregid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setregid_return), false);
+	syscall_sub_linux_mips[63] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sigsuspend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sigsuspend_return), false);
+	syscall_sub_linux_mips[64] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sigpending_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sigpending_return), false);
+	syscall_sub_linux_mips[65] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sethostname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sethostname_return), false);
+	syscall_sub_linux_mips[66] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setrlimit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setrlimit_return), false);
+	syscall_sub_linux_mips[67] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getrlimit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getrlimit_return), false);
+	syscall_sub_linux_mips[68] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getrusage_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getrusage_return), false);
+	syscall_sub_linux_mips[69] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_gettimeofday_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_gettimeofday_return), false);
+	syscall_sub_linux_mips[70] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_settimeofday_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_settimeofday_return), false);
+	syscall_sub_linux_mips[71] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getgroups_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getgroups_return), false);
+	syscall_sub_linux_mips[72] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setgroups_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setgroups_return), false);
+	syscall_sub_linux_mips[73] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_symlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_symlink_return), false);
+	syscall_sub_linux_mips[74] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lstat_return), false);
+	syscall_sub_linux_mips[75] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_readlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_readlink_return), false);
+	syscall_sub_linux_mips[76] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_uselib_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_uselib_return), false);
+	syscall_sub_linux_mips[77] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_swapon_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_swapon_return), false);
+	syscall_sub_linux_mips[78] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_reboot_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_reboot_return), false);
+	syscall_sub_linux_mips[79] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_old_readdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_old_readdir_return), false);
+	syscall_sub_linux_mips[80] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mmap_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mmap_return), false);
+	syscall_sub_linux_mips[81] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_munmap_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_munmap_return), false);
+	syscall_sub_linux_mips[82] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_truncate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_truncate_return), false);
+	syscall_sub_linux_mips[83] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ftruncate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ftruncate_return), false);
+	syscall_sub_linux_mips[84] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchmod_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchmod_return), false);
+	syscall_sub_linux_mips[85] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchown_return), false);
+	syscall_sub_linux_mips[86] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpriority_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpriority_return), false);
+	syscall_sub_linux_mips[87] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setpriority_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setpriority_return), false);
+	syscall_sub_linux_mips[88] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_statfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_statfs_return), false);
+	syscall_sub_linux_mips[89] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fstatfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fstatfs_return), false);
+	syscall_sub_linux_mips[90] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ioperm_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ioperm_return), false);
+	syscall_sub_linux_mips[91] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_socketcall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_socketcall_return), false);
+	syscall_sub_linux_mips[92] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_syslog_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_syslog_return), false);
+	syscall_sub_linux_mips[93] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setitimer_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setitimer_return), false);
+	syscall_sub_linux_mips[94] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getitimer_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getitimer_return), false);
+	syscall_sub_linux_mips[95] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_newstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_newstat_return), false);
+	syscall_sub_linux_mips[96] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_newlstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_newlstat_return), false);
+	syscall_sub_linux_mips[97] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_newfstat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_newfstat_return), false);
+	syscall_sub_linux_mips[98] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_uname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_uname_return), false);
+	syscall_sub_linux_mips[99] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_iopl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_iopl_return), false);
+	syscall_sub_linux_mips[100] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_vhangup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_vhangup_return), false);
+	syscall_sub_linux_mips[101] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_idle_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_idle_return), false);
+	syscall_sub_linux_mips[102] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_wait4_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_wait4_return), false);
+	syscall_sub_linux_mips[103] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_swapoff_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_swapoff_return), false);
+	syscall_sub_linux_mips[104] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sysinfo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sysinfo_return), false);
+	syscall_sub_linux_mips[105] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ipc_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ipc_return), false);
+	syscall_sub_linux_mips[106] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fsync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fsync_return), false);
+	syscall_sub_linux_mips[107] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sigreturn_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sigreturn_return), false);
+	syscall_sub_linux_mips[108] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clone_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clone_return), false);
+	syscall_sub_linux_mips[109] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setdomainname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setdomainname_return), false);
+	syscall_sub_linux_mips[110] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_newuname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_newuname_return), false);
+	syscall_sub_linux_mips[111] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_modify_ldt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_modify_ldt_return), false);
+	syscall_sub_linux_mips[112] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_adjtimex_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_adjtimex_time32_return), false);
+	syscall_sub_linux_mips[113] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mprotect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mprotect_return), false);
+	syscall_sub_linux_mips[114] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sigprocmask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sigprocmask_return), false);
+	syscall_sub_linux_mips[115] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_create_module_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_create_module_return), false);
+	syscall_sub_linux_mips[116] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_init_module_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_init_module_return), false);
+	syscall_sub_linux_mips[117] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_delete_module_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_delete_module_return), false);
+	syscall_sub_linux_mips[118] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_get_kernel_syms_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_get_kernel_syms_return), false);
+	syscall_sub_linux_mips[119] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_quotactl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_quotactl_return), false);
+	syscall_sub_linux_mips[120] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpgid_return), false);
+	syscall_sub_linux_mips[121] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchdir_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchdir_return), false);
+	syscall_sub_linux_mips[122] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_bdflush_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_bdflush_return), false);
+	syscall_sub_linux_mips[123] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sysfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sysfs_return), false);
+	syscall_sub_linux_mips[124] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_personality_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_personality_return), false);
+	syscall_sub_linux_mips[125] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setfsuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setfsuid_return), false);
+	syscall_sub_linux_mips[126] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setfsgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setfsgid_return), false);
+	syscall_sub_linux_mips[127] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_llseek_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_llseek_return), false);
+	syscall_sub_linux_mips[128] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getdents_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getdents_return), false);
+	syscall_sub_linux_mips[129] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_select_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_select_return), false);
+	syscall_sub_linux_mips[130] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_flock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_flock_return), false);
+	syscall_sub_linux_mips[131] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msync_return), false);
+	syscall_sub_linux_mips[132] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_readv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_readv_return), false);
+	syscall_sub_linux_mips[133] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_writev_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_writev_return), false);
+	syscall_sub_linux_mips[134] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_cacheflush_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_cacheflush_return), false);
+	syscall_sub_linux_mips[135] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setup_return), false);
+	syscall_sub_linux_mips[136] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getsid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getsid_return), false);
+	syscall_sub_linux_mips[137] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fdatasync_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fdatasync_return), false);
+	syscall_sub_linux_mips[138] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sysctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sysctl_return), false);
+	syscall_sub_linux_mips[139] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mlock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mlock_return), false);
+	syscall_sub_linux_mips[140] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_munlock_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_munlock_return), false);
+	syscall_sub_linux_mips[141] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mlockall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mlockall_return), false);
+	syscall_sub_linux_mips[142] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_munlockall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_munlockall_return), false);
+	syscall_sub_linux_mips[143] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_setparam_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_setparam_return), false);
+	syscall_sub_linux_mips[144] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_getparam_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_getparam_return), false);
+	syscall_sub_linux_mips[145] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_setscheduler_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_setscheduler_return), false);
+	syscall_sub_linux_mips[146] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_getscheduler_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_getscheduler_return), false);
+	syscall_sub_linux_mips[147] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_yield_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_yield_return), false);
+	syscall_sub_linux_mips[148] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_get_priority_max_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_get_priority_max_return), false);
+	syscall_sub_linux_mips[149] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_get_priority_min_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_get_priority_min_return), false);
+	syscall_sub_linux_mips[150] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_rr_get_interval_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_rr_get_interval_time32_return), false);
+	syscall_sub_linux_mips[151] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_nanosleep_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_nanosleep_time32_return), false);
+	syscall_sub_linux_mips[152] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mremap_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mremap_return), false);
+	syscall_sub_linux_mips[153] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_accept_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_accept_return), false);
+	syscall_sub_linux_mips[154] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_bind_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_bind_return), false);
+	syscall_sub_linux_mips[155] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_connect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_connect_return), false);
+	syscall_sub_linux_mips[156] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getpeername_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getpeername_return), false);
+	syscall_sub_linux_mips[157] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getsockname_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getsockname_return), false);
+	syscall_sub_linux_mips[158] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getsockopt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getsockopt_return), false);
+	syscall_sub_linux_mips[159] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_listen_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_listen_return), false);
+	syscall_sub_linux_mips[160] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_recv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_recv_return), false);
+	syscall_sub_linux_mips[161] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_recvfrom_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_recvfrom_return), false);
+	syscall_sub_linux_mips[162] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_recvmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_recvmsg_return), false);
+	syscall_sub_linux_mips[163] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_send_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_send_return), false);
+	syscall_sub_linux_mips[164] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendmsg_return), false);
+	syscall_sub_linux_mips[165] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendto_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendto_return), false);
+	syscall_sub_linux_mips[166] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setsockopt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setsockopt_return), false);
+	syscall_sub_linux_mips[167] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shutdown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shutdown_return), false);
+	syscall_sub_linux_mips[168] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_socket_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_socket_return), false);
+	syscall_sub_linux_mips[169] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_socketpair_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_socketpair_return), false);
+	syscall_sub_linux_mips[170] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setresuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setresuid_return), false);
+	syscall_sub_linux_mips[171] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getresuid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getresuid_return), false);
+	syscall_sub_linux_mips[172] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_query_module_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_query_module_return), false);
+	syscall_sub_linux_mips[173] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_poll_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_poll_return), false);
+	syscall_sub_linux_mips[174] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_nfsservctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_nfsservctl_return), false);
+	syscall_sub_linux_mips[175] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setresgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setresgid_return), false);
+	syscall_sub_linux_mips[176] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getresgid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getresgid_return), false);
+	syscall_sub_linux_mips[177] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_prctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_prctl_return), false);
+	syscall_sub_linux_mips[178] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigreturn_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigreturn_return), false);
+	syscall_sub_linux_mips[179] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigaction_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigaction_return), false);
+	syscall_sub_linux_mips[180] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigprocmask_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigprocmask_return), false);
+	syscall_sub_linux_mips[181] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigpending_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigpending_return), false);
+	syscall_sub_linux_mips[182] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigtimedwait_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigtimedwait_time32_return), false);
+	syscall_sub_linux_mips[183] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return), false);
+	syscall_sub_linux_mips[184] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigsuspend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigsuspend_return), false);
+	syscall_sub_linux_mips[185] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pread64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pread64_return), false);
+	syscall_sub_linux_mips[186] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pwrite64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pwrite64_return), false);
+	syscall_sub_linux_mips[187] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_chown_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_chown_return), false);
+	syscall_sub_linux_mips[188] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getcwd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getcwd_return), false);
+	syscall_sub_linux_mips[189] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_capget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_capget_return), false);
+	syscall_sub_linux_mips[190] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_capset_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_capset_return), false);
+	syscall_sub_linux_mips[191] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sigaltstack_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sigaltstack_return), false);
+	syscall_sub_linux_mips[192] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendfile_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendfile_return), false);
+	syscall_sub_linux_mips[193] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_mmap2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_mmap2_return), false);
+	syscall_sub_linux_mips[194] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_truncate64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_truncate64_return), false);
+	syscall_sub_linux_mips[195] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ftruncate64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ftruncate64_return), false);
+	syscall_sub_linux_mips[196] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_stat64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_stat64_return), false);
+	syscall_sub_linux_mips[197] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lstat64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lstat64_return), false);
+	syscall_sub_linux_mips[198] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fstat64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fstat64_return), false);
+	syscall_sub_linux_mips[199] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pivot_root_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pivot_root_return), false);
+	syscall_sub_linux_mips[200] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mincore_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mincore_return), false);
+	syscall_sub_linux_mips[201] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_madvise_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_madvise_return), false);
+	syscall_sub_linux_mips[202] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getdents64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getdents64_return), false);
+	syscall_sub_linux_mips[203] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fcntl64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fcntl64_return), false);
+	syscall_sub_linux_mips[204] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_gettid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_gettid_return), false);
+	syscall_sub_linux_mips[205] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_readahead_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_readahead_return), false);
+	syscall_sub_linux_mips[206] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setxattr_return), false);
+	syscall_sub_linux_mips[207] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lsetxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lsetxattr_return), false);
+	syscall_sub_linux_mips[208] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fsetxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fsetxattr_return), false);
+	syscall_sub_linux_mips[209] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getxattr_return), false);
+	syscall_sub_linux_mips[210] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lgetxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lgetxattr_return), false);
+	syscall_sub_linux_mips[211] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fgetxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fgetxattr_return), false);
+	syscall_sub_linux_mips[212] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_listxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_listxattr_return), false);
+	syscall_sub_linux_mips[213] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_llistxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_llistxattr_return), false);
+	syscall_sub_linux_mips[214] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_flistxattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_flistxattr_return), false);
+	syscall_sub_linux_mips[215] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_removexattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_removexattr_return), false);
+	syscall_sub_linux_mips[216] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lremovexattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lremovexattr_return), false);
+	syscall_sub_linux_mips[217] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fremovexattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fremovexattr_return), false);
+	syscall_sub_linux_mips[218] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_tkill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_tkill_return), false);
+	syscall_sub_linux_mips[219] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendfile64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendfile64_return), false);
+	syscall_sub_linux_mips[220] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_futex_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_futex_time32_return), false);
+	syscall_sub_linux_mips[221] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_setaffinity_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_setaffinity_return), false);
+	syscall_sub_linux_mips[222] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_getaffinity_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_getaffinity_return), false);
+	syscall_sub_linux_mips[223] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_setup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_setup_return), false);
+	syscall_sub_linux_mips[224] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_destroy_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_destroy_return), false);
+	syscall_sub_linux_mips[225] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_getevents_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_getevents_time32_return), false);
+	syscall_sub_linux_mips[226] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_submit_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_submit_return), false);
+	syscall_sub_linux_mips[227] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_cancel_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_cancel_return), false);
+	syscall_sub_linux_mips[228] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_exit_group_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_exit_group_return), false);
+	syscall_sub_linux_mips[229] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_lookup_dcookie_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_lookup_dcookie_return), false);
+	syscall_sub_linux_mips[230] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_epoll_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_epoll_create_return), false);
+	syscall_sub_linux_mips[231] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_epoll_ctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_epoll_ctl_return), false);
+	syscall_sub_linux_mips[232] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_epoll_wait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_epoll_wait_return), false);
+	syscall_sub_linux_mips[233] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_remap_file_pages_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_remap_file_pages_return), false);
+	syscall_sub_linux_mips[234] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_set_tid_address_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_set_tid_address_return), false);
+	syscall_sub_linux_mips[235] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_restart_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_restart_syscall_return), false);
+	syscall_sub_linux_mips[236] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fadvise64_64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fadvise64_64_return), false);
+	syscall_sub_linux_mips[237] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_statfs64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_statfs64_return), false);
+	syscall_sub_linux_mips[238] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fstatfs64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fstatfs64_return), false);
+	syscall_sub_linux_mips[239] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_create_return), false);
+	syscall_sub_linux_mips[240] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_settime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_settime32_return), false);
+	syscall_sub_linux_mips[241] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_gettime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_gettime32_return), false);
+	syscall_sub_linux_mips[242] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_getoverrun_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_getoverrun_return), false);
+	syscall_sub_linux_mips[243] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_delete_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_delete_return), false);
+	syscall_sub_linux_mips[244] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_settime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_settime32_return), false);
+	syscall_sub_linux_mips[245] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_gettime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_gettime32_return), false);
+	syscall_sub_linux_mips[246] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_getres_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_getres_time32_return), false);
+	syscall_sub_linux_mips[247] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_nanosleep_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_nanosleep_time32_return), false);
+	syscall_sub_linux_mips[248] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_tgkill_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_tgkill_return), false);
+	syscall_sub_linux_mips[249] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_utimes_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_utimes_time32_return), false);
+	syscall_sub_linux_mips[250] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mbind_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mbind_return), false);
+	syscall_sub_linux_mips[251] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_get_mempolicy_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_get_mempolicy_return), false);
+	syscall_sub_linux_mips[252] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_set_mempolicy_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_set_mempolicy_return), false);
+	syscall_sub_linux_mips[253] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_open_return), false);
+	syscall_sub_linux_mips[254] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_unlink_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_unlink_return), false);
+	syscall_sub_linux_mips[255] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_timedsend_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_timedsend_time32_return), false);
+	syscall_sub_linux_mips[256] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_timedreceive_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_timedreceive_time32_return), false);
+	syscall_sub_linux_mips[257] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_notify_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_notify_return), false);
+	syscall_sub_linux_mips[258] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_getsetattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_getsetattr_return), false);
+	syscall_sub_linux_mips[259] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_waitid_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_waitid_return), false);
+	syscall_sub_linux_mips[260] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_add_key_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_add_key_return), false);
+	syscall_sub_linux_mips[261] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_request_key_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_request_key_return), false);
+	syscall_sub_linux_mips[262] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_keyctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_keyctl_return), false);
+	syscall_sub_linux_mips[263] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_set_thread_area_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_set_thread_area_return), false);
+	syscall_sub_linux_mips[264] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_inotify_init_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_inotify_init_return), false);
+	syscall_sub_linux_mips[265] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_inotify_add_watch_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_inotify_add_watch_return), false);
+	syscall_sub_linux_mips[266] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_inotify_rm_watch_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_inotify_rm_watch_return), false);
+	syscall_sub_linux_mips[267] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_migrate_pages_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_migrate_pages_return), false);
+	syscall_sub_linux_mips[268] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_openat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_openat_return), false);
+	syscall_sub_linux_mips[269] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mkdirat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mkdirat_return), false);
+	syscall_sub_linux_mips[270] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mknodat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mknodat_return), false);
+	syscall_sub_linux_mips[271] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchownat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchownat_return), false);
+	syscall_sub_linux_mips[272] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_futimesat_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_futimesat_time32_return), false);
+	syscall_sub_linux_mips[273] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fstatat64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fstatat64_return), false);
+	syscall_sub_linux_mips[274] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_unlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_unlinkat_return), false);
+	syscall_sub_linux_mips[275] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_renameat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_renameat_return), false);
+	syscall_sub_linux_mips[276] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_linkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_linkat_return), false);
+	syscall_sub_linux_mips[277] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_symlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_symlinkat_return), false);
+	syscall_sub_linux_mips[278] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_readlinkat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_readlinkat_return), false);
+	syscall_sub_linux_mips[279] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fchmodat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fchmodat_return), false);
+	syscall_sub_linux_mips[280] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_faccessat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_faccessat_return), false);
+	syscall_sub_linux_mips[281] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pselect6_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pselect6_time32_return), false);
+	syscall_sub_linux_mips[282] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ppoll_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ppoll_time32_return), false);
+	syscall_sub_linux_mips[283] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_unshare_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_unshare_return), false);
+	syscall_sub_linux_mips[284] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_splice_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_splice_return), false);
+	syscall_sub_linux_mips[285] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sync_file_range_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sync_file_range_return), false);
+	syscall_sub_linux_mips[286] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_tee_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_tee_return), false);
+	syscall_sub_linux_mips[287] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_vmsplice_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_vmsplice_return), false);
+	syscall_sub_linux_mips[288] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_move_pages_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_move_pages_return), false);
+	syscall_sub_linux_mips[289] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_set_robust_list_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_set_robust_list_return), false);
+	syscall_sub_linux_mips[290] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_get_robust_list_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_get_robust_list_return), false);
+	syscall_sub_linux_mips[291] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_kexec_load_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_kexec_load_return), false);
+	syscall_sub_linux_mips[292] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getcpu_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getcpu_return), false);
+	syscall_sub_linux_mips[293] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_epoll_pwait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_epoll_pwait_return), false);
+	syscall_sub_linux_mips[294] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ioprio_set_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ioprio_set_return), false);
+	syscall_sub_linux_mips[295] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ioprio_get_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ioprio_get_return), false);
+	syscall_sub_linux_mips[296] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_utimensat_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_utimensat_time32_return), false);
+	syscall_sub_linux_mips[297] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_signalfd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_signalfd_return), false);
+	syscall_sub_linux_mips[298] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ni_syscall_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ni_syscall_return), false);
+	syscall_sub_linux_mips[299] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_eventfd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_eventfd_return), false);
+	syscall_sub_linux_mips[300] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fallocate_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fallocate_return), false);
+	syscall_sub_linux_mips[301] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timerfd_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timerfd_create_return), false);
+	syscall_sub_linux_mips[302] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timerfd_gettime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timerfd_gettime32_return), false);
+	syscall_sub_linux_mips[303] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timerfd_settime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timerfd_settime32_return), false);
+	syscall_sub_linux_mips[304] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_signalfd4_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_signalfd4_return), false);
+	syscall_sub_linux_mips[305] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_eventfd2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_eventfd2_return), false);
+	syscall_sub_linux_mips[306] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_epoll_create1_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_epoll_create1_return), false);
+	syscall_sub_linux_mips[307] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_dup3_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_dup3_return), false);
+	syscall_sub_linux_mips[308] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pipe2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pipe2_return), false);
+	syscall_sub_linux_mips[309] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_inotify_init1_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_inotify_init1_return), false);
+	syscall_sub_linux_mips[310] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_preadv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_preadv_return), false);
+	syscall_sub_linux_mips[311] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pwritev_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pwritev_return), false);
+	syscall_sub_linux_mips[312] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return), false);
+	syscall_sub_linux_mips[313] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_perf_event_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_perf_event_open_return), false);
+	syscall_sub_linux_mips[314] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_accept4_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_accept4_return), false);
+	syscall_sub_linux_mips[315] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_recvmmsg_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_recvmmsg_time32_return), false);
+	syscall_sub_linux_mips[316] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fanotify_init_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fanotify_init_return), false);
+	syscall_sub_linux_mips[317] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fanotify_mark_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fanotify_mark_return), false);
+	syscall_sub_linux_mips[318] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_prlimit64_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_prlimit64_return), false);
+	syscall_sub_linux_mips[319] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_name_to_handle_at_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_name_to_handle_at_return), false);
+	syscall_sub_linux_mips[320] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_open_by_handle_at_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_open_by_handle_at_return), false);
+	syscall_sub_linux_mips[321] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_adjtime32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_adjtime32_return), false);
+	syscall_sub_linux_mips[322] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_syncfs_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_syncfs_return), false);
+	syscall_sub_linux_mips[323] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sendmmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sendmmsg_return), false);
+	syscall_sub_linux_mips[324] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_setns_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_setns_return), false);
+	syscall_sub_linux_mips[325] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_process_vm_readv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_process_vm_readv_return), false);
+	syscall_sub_linux_mips[326] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_process_vm_writev_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_process_vm_writev_return), false);
+	syscall_sub_linux_mips[327] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_kcmp_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_kcmp_return), false);
+	syscall_sub_linux_mips[328] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_finit_module_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_finit_module_return), false);
+	syscall_sub_linux_mips[329] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_setattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_setattr_return), false);
+	syscall_sub_linux_mips[330] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_getattr_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_getattr_return), false);
+	syscall_sub_linux_mips[331] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_renameat2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_renameat2_return), false);
+	syscall_sub_linux_mips[332] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_seccomp_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_seccomp_return), false);
+	syscall_sub_linux_mips[333] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_getrandom_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_getrandom_return), false);
+	syscall_sub_linux_mips[334] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_memfd_create_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_memfd_create_return), false);
+	syscall_sub_linux_mips[335] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_bpf_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_bpf_return), false);
+	syscall_sub_linux_mips[336] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_execveat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_execveat_return), false);
+	syscall_sub_linux_mips[337] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_userfaultfd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_userfaultfd_return), false);
+	syscall_sub_linux_mips[338] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_membarrier_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_membarrier_return), false);
+	syscall_sub_linux_mips[339] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mlock2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mlock2_return), false);
+	syscall_sub_linux_mips[340] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_copy_file_range_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_copy_file_range_return), false);
+	syscall_sub_linux_mips[341] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_preadv2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_preadv2_return), false);
+	syscall_sub_linux_mips[342] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pwritev2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pwritev2_return), false);
+	syscall_sub_linux_mips[343] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pkey_mprotect_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pkey_mprotect_return), false);
+	syscall_sub_linux_mips[344] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pkey_alloc_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pkey_alloc_return), false);
+	syscall_sub_linux_mips[345] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pkey_free_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pkey_free_return), false);
+	syscall_sub_linux_mips[346] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_statx_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_statx_return), false);
+	syscall_sub_linux_mips[347] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rseq_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rseq_return), false);
+	syscall_sub_linux_mips[348] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_pgetevents_time32_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_pgetevents_time32_return), false);
+	syscall_sub_linux_mips[349] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_semget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_semget_return), false);
+	syscall_sub_linux_mips[350] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_semctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_semctl_return), false);
+	syscall_sub_linux_mips[351] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shmget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shmget_return), false);
+	syscall_sub_linux_mips[352] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shmctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shmctl_return), false);
+	syscall_sub_linux_mips[353] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shmat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shmat_return), false);
+	syscall_sub_linux_mips[354] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_shmdt_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_shmdt_return), false);
+	syscall_sub_linux_mips[355] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msgget_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msgget_return), false);
+	syscall_sub_linux_mips[356] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msgsnd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msgsnd_return), false);
+	syscall_sub_linux_mips[357] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msgrcv_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msgrcv_return), false);
+	syscall_sub_linux_mips[358] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_msgctl_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_msgctl_return), false);
+	syscall_sub_linux_mips[359] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_gettime_return), false);
+	syscall_sub_linux_mips[360] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_settime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_settime_return), false);
+	syscall_sub_linux_mips[361] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_adjtime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_adjtime_return), false);
+	syscall_sub_linux_mips[362] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_getres_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_getres_return), false);
+	syscall_sub_linux_mips[363] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_clock_nanosleep_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_clock_nanosleep_return), false);
+	syscall_sub_linux_mips[364] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_gettime_return), false);
+	syscall_sub_linux_mips[365] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timer_settime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timer_settime_return), false);
+	syscall_sub_linux_mips[366] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timerfd_gettime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timerfd_gettime_return), false);
+	syscall_sub_linux_mips[367] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_timerfd_settime_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_timerfd_settime_return), false);
+	syscall_sub_linux_mips[368] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_utimensat_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_utimensat_return), false);
+	syscall_sub_linux_mips[369] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pselect6_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pselect6_return), false);
+	syscall_sub_linux_mips[370] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_ppoll_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_ppoll_return), false);
+	syscall_sub_linux_mips[371] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_pgetevents_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_pgetevents_return), false);
+	syscall_sub_linux_mips[372] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_recvmmsg_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_recvmmsg_return), false);
+	syscall_sub_linux_mips[373] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_timedsend_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_timedsend_return), false);
+	syscall_sub_linux_mips[374] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_mq_timedreceive_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_mq_timedreceive_return), false);
+	syscall_sub_linux_mips[375] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_semtimedop_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_semtimedop_return), false);
+	syscall_sub_linux_mips[376] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_rt_sigtimedwait_return), false);
+	syscall_sub_linux_mips[377] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_futex_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_futex_return), false);
+	syscall_sub_linux_mips[378] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_sched_rr_get_interval_return), false);
+	syscall_sub_linux_mips[379] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pidfd_send_signal_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pidfd_send_signal_return), false);
+	syscall_sub_linux_mips[380] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_uring_setup_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_uring_setup_return), false);
+	syscall_sub_linux_mips[381] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_uring_enter_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_uring_enter_return), false);
+	syscall_sub_linux_mips[382] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_io_uring_register_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_io_uring_register_return), false);
+	syscall_sub_linux_mips[383] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_open_tree_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_open_tree_return), false);
+	syscall_sub_linux_mips[384] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_move_mount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_move_mount_return), false);
+	syscall_sub_linux_mips[385] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fsopen_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fsopen_return), false);
+	syscall_sub_linux_mips[386] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fsconfig_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fsconfig_return), false);
+	syscall_sub_linux_mips[387] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fsmount_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fsmount_return), false);
+	syscall_sub_linux_mips[388] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_fspick_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_fspick_return), false);
+	syscall_sub_linux_mips[389] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pidfd_open_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pidfd_open_return), false);
+	syscall_sub_linux_mips[390] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_openat2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_openat2_return), false);
+	syscall_sub_linux_mips[391] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_pidfd_getfd_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_pidfd_getfd_return), false);
+	syscall_sub_linux_mips[392] = syscall_sub_bits(all_enter,
+			all_enter2 || PPP_CHECK_CB(on_sys_faccessat2_enter), all_return,
+			all_return2 || PPP_CHECK_CB(on_sys_faccessat2_return), false);
+	syscall_sub_linux_mips[393] = syscall_sub_bits(
+			all_enter || PPP_CHECK_CB(on_unknown_sys_enter), all_enter2,
+			all_return || PPP_CHECK_CB(on_unknown_sys_return), all_return2, false);
+	syscalls_subscriptions_dirty = false;
+}
+#endif
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
@@ -21,5655 +1222,7237 @@ extern "C" {
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
  * system call return callbacks.
+ *
+ * System calls nobody subscribed to return right away, without reading
+ * their arguments or tracking their return.
  */
 void syscall_enter_switch_linux_mips(CPUState *cpu, target_ptr_t pc) {
 #if defined(TARGET_MIPS)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {0};
 	ctx.no = env->active_tc.gpr[2];
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
-	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
+	uint8_t sub;			// SYSCALL_SUB_* bits for this system call
+
+	if (unlikely(syscalls_subscriptions_dirty)) {
+		syscall_sub_update_linux_mips();
+	}
 
 	switch (ctx.no) {
 	// 4001 long sys_exit ['int error_code']
 	case 4001: {
+		sub = syscall_sub_linux_mips[0];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_exit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_exit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
 	}; break;
 	// 4002 pid_t sys_fork ['void']
 	case 4002: {
+		sub = syscall_sub_linux_mips[1];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_fork_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_fork_enter, cpu, pc);
+		}
 	}; break;
 	// 4003 long sys_read ['unsigned int fd', 'char __user *buf', 'size_t count']
 	case 4003: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_read_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[2];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_read_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_read_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_read_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4004 long sys_write ['unsigned int fd', 'const char __user *buf', 'size_t count']
 	case 4004: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_write_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[3];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_write_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_write_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_write_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4005 long sys_open ['const char __user *filename', 'int flags', 'umode_t mode']
 	case 4005: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[4];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_open_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_open_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4006 long sys_close ['unsigned int fd']
 	case 4006: {
+		sub = syscall_sub_linux_mips[5];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_close_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_close_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_close_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_close_enter, cpu, pc, arg0);
 	}; break;
 	// 4007 long sys_waitpid ['pid_t pid', 'int __user *stat_addr', 'int options']
 	case 4007: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_waitpid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[6];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_waitpid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_waitpid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_waitpid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4008 long sys_creat ['const char __user *pathname', 'umode_t mode']
 	case 4008: {
+		sub = syscall_sub_linux_mips[7];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_creat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_creat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_creat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_creat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4009 long sys_link ['const char __user *oldname', 'const char __user *newname']
 	case 4009: {
+		sub = syscall_sub_linux_mips[8];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_link_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_link_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_link_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_link_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4010 long sys_unlink ['const char __user *pathname']
 	case 4010: {
+		sub = syscall_sub_linux_mips[9];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_unlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_unlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_unlink_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_unlink_enter, cpu, pc, arg0);
 	}; break;
 	// 4011 long sys_execve ['const char __user *filename', 'const char __user *const __user *argv', 'const char __user *const __user *envp']
 	case 4011: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_execve_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[10];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_execve_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_execve_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_execve_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4012 long sys_chdir ['const char __user *filename']
 	case 4012: {
+		sub = syscall_sub_linux_mips[11];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_chdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_chdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_chdir_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_chdir_enter, cpu, pc, arg0);
 	}; break;
 	// 4013 long sys_time32 ['old_time32_t __user *tloc']
 	case 4013: {
+		sub = syscall_sub_linux_mips[12];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_time32_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_time32_enter, cpu, pc, arg0);
 	}; break;
 	// 4014 long sys_mknod ['const char __user *filename', 'umode_t mode', 'unsigned dev']
 	case 4014: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mknod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[13];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mknod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mknod_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mknod_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4015 long sys_chmod ['const char __user *filename', 'umode_t mode']
 	case 4015: {
+		sub = syscall_sub_linux_mips[14];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_chmod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_chmod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_chmod_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_chmod_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4016 long sys_lchown ['const char __user *filename', 'uid_t user', 'gid_t group']
 	case 4016: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lchown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[15];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lchown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lchown_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_lchown_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4018 long sys_stat ['const char __user *filename', 'struct __old_kernel_stat __user *statbuf']
 	case 4018: {
+		sub = syscall_sub_linux_mips[16];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_stat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_stat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_stat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_stat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4019 long sys_lseek ['unsigned int fd', 'off_t offset', 'unsigned int whence']
 	case 4019: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lseek_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[17];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lseek_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lseek_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_lseek_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4020 long sys_getpid ['void']
 	case 4020: {
+		sub = syscall_sub_linux_mips[18];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getpid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getpid_enter, cpu, pc);
+		}
 	}; break;
 	// 4021 long sys_mount ['char __user *dev_name', 'char __user *dir_name', 'char __user *type', 'unsigned long flags', 'void __user *data']
 	case 4021: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mount_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[19];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mount_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4022 long sys_oldumount ['char __user *name']
 	case 4022: {
+		sub = syscall_sub_linux_mips[20];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_oldumount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_oldumount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_oldumount_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_oldumount_enter, cpu, pc, arg0);
 	}; break;
 	// 4023 long sys_setuid ['uid_t uid']
 	case 4023: {
+		sub = syscall_sub_linux_mips[21];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setuid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_setuid_enter, cpu, pc, arg0);
 	}; break;
 	// 4024 long sys_getuid ['void']
 	case 4024: {
+		sub = syscall_sub_linux_mips[22];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getuid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getuid_enter, cpu, pc);
+		}
 	}; break;
 	// 4025 long sys_stime32 ['old_time32_t __user *tptr']
 	case 4025: {
+		sub = syscall_sub_linux_mips[23];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_stime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_stime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_stime32_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_stime32_enter, cpu, pc, arg0);
 	}; break;
 	// 4026 long sys_ptrace ['long request', 'long pid', 'unsigned long addr', 'unsigned long data']
 	case 4026: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ptrace_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[24];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ptrace_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_ptrace_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_ptrace_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4027 long sys_alarm ['unsigned int seconds']
 	case 4027: {
+		sub = syscall_sub_linux_mips[25];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_alarm_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_alarm_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_alarm_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_alarm_enter, cpu, pc, arg0);
 	}; break;
 	// 4028 long sys_fstat ['unsigned int fd', 'struct __old_kernel_stat __user *statbuf']
 	case 4028: {
+		sub = syscall_sub_linux_mips[26];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4029 long sys_pause ['void']
 	case 4029: {
+		sub = syscall_sub_linux_mips[27];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_pause_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_pause_enter, cpu, pc);
+		}
 	}; break;
 	// 4030 long sys_utime32 ['const char __user *filename', 'struct old_utimbuf32 __user *t']
 	case 4030: {
+		sub = syscall_sub_linux_mips[28];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_utime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_utime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_utime32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_utime32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4033 long sys_access ['const char __user *filename', 'int mode']
 	case 4033: {
+		sub = syscall_sub_linux_mips[29];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_access_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_access_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_access_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_access_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4034 long sys_nice ['int increment']
 	case 4034: {
+		sub = syscall_sub_linux_mips[30];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_nice_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_nice_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_nice_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_nice_enter, cpu, pc, arg0);
 	}; break;
 	// 4036 long sys_sync ['void']
 	case 4036: {
+		sub = syscall_sub_linux_mips[31];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_sync_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_sync_enter, cpu, pc);
+		}
 	}; break;
 	// 4037 long sys_kill ['pid_t pid', 'int sig']
 	case 4037: {
+		sub = syscall_sub_linux_mips[32];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_kill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_kill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_kill_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_kill_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4038 long sys_rename ['const char __user *oldname', 'const char __user *newname']
 	case 4038: {
+		sub = syscall_sub_linux_mips[33];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rename_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rename_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rename_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_rename_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4039 long sys_mkdir ['const char __user *pathname', 'umode_t mode']
 	case 4039: {
+		sub = syscall_sub_linux_mips[34];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mkdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mkdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mkdir_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_mkdir_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4040 long sys_rmdir ['const char __user *pathname']
 	case 4040: {
+		sub = syscall_sub_linux_mips[35];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rmdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rmdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rmdir_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_rmdir_enter, cpu, pc, arg0);
 	}; break;
 	// 4041 long sys_dup ['unsigned int fildes']
 	case 4041: {
+		sub = syscall_sub_linux_mips[36];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_dup_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_dup_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_dup_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_dup_enter, cpu, pc, arg0);
 	}; break;
 	// 4042 long sys_pipe ['int __user *fildes']
 	case 4042: {
+		sub = syscall_sub_linux_mips[37];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pipe_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pipe_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pipe_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_pipe_enter, cpu, pc, arg0);
 	}; break;
 	// 4043 long sys_times ['struct tms __user *tbuf']
 	case 4043: {
+		sub = syscall_sub_linux_mips[38];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_times_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_times_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_times_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_times_enter, cpu, pc, arg0);
 	}; break;
 	// 4045 long sys_brk ['unsigned long brk']
 	case 4045: {
+		sub = syscall_sub_linux_mips[39];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_brk_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_brk_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_brk_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_brk_enter, cpu, pc, arg0);
 	}; break;
 	// 4046 long sys_setgid ['gid_t gid']
 	case 4046: {
+		sub = syscall_sub_linux_mips[40];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setgid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_setgid_enter, cpu, pc, arg0);
 	}; break;
 	// 4047 long sys_getgid ['void']
 	case 4047: {
+		sub = syscall_sub_linux_mips[41];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getgid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getgid_enter, cpu, pc);
+		}
 	}; break;
 	// 4048 long sys_signal ['int sig', '__sighandler_t handler']
 	case 4048: {
+		sub = syscall_sub_linux_mips[42];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_signal_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_signal_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_signal_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_signal_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4049 long sys_geteuid ['void']
 	case 4049: {
+		sub = syscall_sub_linux_mips[43];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_geteuid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_geteuid_enter, cpu, pc);
+		}
 	}; break;
 	// 4050 long sys_getegid ['void']
 	case 4050: {
+		sub = syscall_sub_linux_mips[44];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getegid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getegid_enter, cpu, pc);
+		}
 	}; break;
 	// 4051 long sys_acct ['const char __user *name']
 	case 4051: {
+		sub = syscall_sub_linux_mips[45];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_acct_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_acct_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_acct_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_acct_enter, cpu, pc, arg0);
 	}; break;
 	// 4052 long sys_umount ['char __user *name', 'int flags']
 	case 4052: {
+		sub = syscall_sub_linux_mips[46];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_umount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_umount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_umount_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_umount_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4054 long sys_ioctl ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 4054: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ioctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[47];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ioctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_ioctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_ioctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4055 long sys_fcntl ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 4055: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fcntl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[48];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fcntl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fcntl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fcntl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4057 long sys_setpgid ['pid_t pid', 'pid_t pgid']
 	case 4057: {
+		sub = syscall_sub_linux_mips[49];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setpgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setpgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setpgid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setpgid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4059 long sys_olduname ['struct oldold_utsname __user *']
 	case 4059: {
+		sub = syscall_sub_linux_mips[50];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_olduname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_olduname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_olduname_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_olduname_enter, cpu, pc, arg0);
 	}; break;
 	// 4060 long sys_umask ['int mask']
 	case 4060: {
+		sub = syscall_sub_linux_mips[51];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_umask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_umask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_umask_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_umask_enter, cpu, pc, arg0);
 	}; break;
 	// 4061 long sys_chroot ['const char __user *filename']
 	case 4061: {
+		sub = syscall_sub_linux_mips[52];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_chroot_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_chroot_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_chroot_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_chroot_enter, cpu, pc, arg0);
 	}; break;
 	// 4062 long sys_ustat ['unsigned dev', 'struct ustat __user *ubuf']
 	case 4062: {
+		sub = syscall_sub_linux_mips[53];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ustat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ustat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_ustat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_ustat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4063 long sys_dup2 ['unsigned int oldfd', 'unsigned int newfd']
 	case 4063: {
+		sub = syscall_sub_linux_mips[54];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_dup2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_dup2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_dup2_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_dup2_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4064 long sys_getppid ['void']
 	case 4064: {
+		sub = syscall_sub_linux_mips[55];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getppid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getppid_enter, cpu, pc);
+		}
 	}; break;
 	// 4065 long sys_getpgrp ['void']
 	case 4065: {
+		sub = syscall_sub_linux_mips[56];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_getpgrp_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_getpgrp_enter, cpu, pc);
+		}
 	}; break;
 	// 4066 long sys_setsid ['void']
 	case 4066: {
+		sub = syscall_sub_linux_mips[57];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_setsid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_setsid_enter, cpu, pc);
+		}
 	}; break;
 	// 4067 long sys_sigaction ['int', 'const struct old_sigaction __user *', 'struct old_sigaction __user *']
 	case 4067: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sigaction_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[58];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sigaction_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sigaction_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sigaction_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4068 long sys_sgetmask ['void']
 	case 4068: {
+		sub = syscall_sub_linux_mips[59];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_sgetmask_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_sgetmask_enter, cpu, pc);
+		}
 	}; break;
 	// 4069 long sys_ssetmask ['int newmask']
 	case 4069: {
+		sub = syscall_sub_linux_mips[60];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ssetmask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ssetmask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_ssetmask_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_ssetmask_enter, cpu, pc, arg0);
 	}; break;
 	// 4070 long sys_setreuid ['uid_t ruid', 'uid_t euid']
 	case 4070: {
+		sub = syscall_sub_linux_mips[61];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setreuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setreuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setreuid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setreuid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4071 long sys_setregid ['gid_t rgid', 'gid_t egid']
 	case 4071: {
+		sub = syscall_sub_linux_mips[62];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setregid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setregid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setregid_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setregid_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4072 long sys_sigsuspend ['int unused1', 'int unused2', 'old_sigset_t mask']
 	case 4072: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sigsuspend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[63];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sigsuspend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sigsuspend_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sigsuspend_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4073 long sys_sigpending ['old_sigset_t __user *uset']
 	case 4073: {
+		sub = syscall_sub_linux_mips[64];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sigpending_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sigpending_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sigpending_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sigpending_enter, cpu, pc, arg0);
 	}; break;
 	// 4074 long sys_sethostname ['char __user *name', 'int len']
 	case 4074: {
+		sub = syscall_sub_linux_mips[65];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sethostname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sethostname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sethostname_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sethostname_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4075 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 4075: {
+		sub = syscall_sub_linux_mips[66];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setrlimit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setrlimit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setrlimit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setrlimit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4076 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 4076: {
+		sub = syscall_sub_linux_mips[67];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getrlimit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getrlimit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getrlimit_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getrlimit_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4077 long sys_getrusage ['int who', 'struct rusage __user *ru']
 	case 4077: {
+		sub = syscall_sub_linux_mips[68];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getrusage_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getrusage_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getrusage_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getrusage_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4078 long sys_gettimeofday ['struct __kernel_old_timeval __user *tv', 'struct timezone __user *tz']
 	case 4078: {
+		sub = syscall_sub_linux_mips[69];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_gettimeofday_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_gettimeofday_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4079 long sys_settimeofday ['struct __kernel_old_timeval __user *tv', 'struct timezone __user *tz']
 	case 4079: {
+		sub = syscall_sub_linux_mips[70];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_settimeofday_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_settimeofday_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_settimeofday_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_settimeofday_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4080 long sys_getgroups ['int gidsetsize', 'gid_t __user *grouplist']
 	case 4080: {
+		sub = syscall_sub_linux_mips[71];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getgroups_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getgroups_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getgroups_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getgroups_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4081 long sys_setgroups ['int gidsetsize', 'gid_t __user *grouplist']
 	case 4081: {
+		sub = syscall_sub_linux_mips[72];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setgroups_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setgroups_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setgroups_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setgroups_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4083 long sys_symlink ['const char __user *old', 'const char __user *new']
 	case 4083: {
+		sub = syscall_sub_linux_mips[73];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_symlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_symlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_symlink_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_symlink_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4084 long sys_lstat ['const char __user *filename', 'struct __old_kernel_stat __user *statbuf']
 	case 4084: {
+		sub = syscall_sub_linux_mips[74];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_lstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4085 long sys_readlink ['const char __user *path', 'char __user *buf', 'int bufsiz']
 	case 4085: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_readlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[75];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_readlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_readlink_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_readlink_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4086 long sys_uselib ['const char __user *library']
 	case 4086: {
+		sub = syscall_sub_linux_mips[76];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_uselib_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_uselib_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_uselib_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_uselib_enter, cpu, pc, arg0);
 	}; break;
 	// 4087 long sys_swapon ['const char __user *specialfile', 'int swap_flags']
 	case 4087: {
+		sub = syscall_sub_linux_mips[77];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_swapon_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_swapon_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_swapon_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_swapon_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4088 long sys_reboot ['int magic1', 'int magic2', 'unsigned int cmd', 'void __user *arg']
 	case 4088: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_reboot_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[78];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_reboot_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_reboot_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_reboot_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4089 long sys_old_readdir ['unsigned int', 'struct old_linux_dirent __user *', 'unsigned int']
 	case 4089: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_old_readdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[79];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_old_readdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_old_readdir_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_old_readdir_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4090 long sys_mmap ['unsigned long addr', 'unsigned long len', 'unsigned long prot', 'unsigned long flags', 'unsigned long fd', 'unsigned long pgoff']
 	case 4090: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mmap_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mmap_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[80];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mmap_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mmap_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4091 long sys_munmap ['unsigned long addr', 'size_t len']
 	case 4091: {
+		sub = syscall_sub_linux_mips[81];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_munmap_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_munmap_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_munmap_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_munmap_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4092 long sys_truncate ['const char __user *path', 'long length']
 	case 4092: {
+		sub = syscall_sub_linux_mips[82];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_truncate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_truncate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_truncate_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_truncate_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4093 long sys_ftruncate ['unsigned int fd', 'unsigned long length']
 	case 4093: {
+		sub = syscall_sub_linux_mips[83];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ftruncate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ftruncate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_ftruncate_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_ftruncate_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4094 long sys_fchmod ['unsigned int fd', 'umode_t mode']
 	case 4094: {
+		sub = syscall_sub_linux_mips[84];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchmod_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchmod_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fchmod_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fchmod_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4095 long sys_fchown ['unsigned int fd', 'uid_t user', 'gid_t group']
 	case 4095: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[85];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fchown_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fchown_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4096 long sys_getpriority ['int which', 'int who']
 	case 4096: {
+		sub = syscall_sub_linux_mips[86];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getpriority_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getpriority_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_getpriority_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getpriority_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4097 long sys_setpriority ['int which', 'int who', 'int niceval']
 	case 4097: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setpriority_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[87];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setpriority_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setpriority_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_setpriority_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4099 long sys_statfs ['const char __user *path', 'struct statfs __user *buf']
 	case 4099: {
+		sub = syscall_sub_linux_mips[88];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_statfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_statfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_statfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_statfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4100 long sys_fstatfs ['unsigned int fd', 'struct statfs __user *buf']
 	case 4100: {
+		sub = syscall_sub_linux_mips[89];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fstatfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fstatfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fstatfs_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fstatfs_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4101 long sys_ioperm ['unsigned long from', 'unsigned long num', 'int on']
 	case 4101: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ioperm_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[90];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ioperm_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_ioperm_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_ioperm_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4102 long sys_socketcall ['int call', 'unsigned long __user *args']
 	case 4102: {
+		sub = syscall_sub_linux_mips[91];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_socketcall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_socketcall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_socketcall_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_socketcall_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4103 long sys_syslog ['int type', 'char __user *buf', 'int len']
 	case 4103: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_syslog_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[92];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_syslog_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_syslog_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_syslog_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4104 long sys_setitimer ['int which', 'struct __kernel_old_itimerval __user *value', 'struct __kernel_old_itimerval __user *ovalue']
 	case 4104: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setitimer_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[93];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setitimer_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setitimer_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_setitimer_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4105 long sys_getitimer ['int which', 'struct __kernel_old_itimerval __user *value']
 	case 4105: {
+		sub = syscall_sub_linux_mips[94];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getitimer_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getitimer_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getitimer_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getitimer_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4106 long sys_newstat ['const char __user *filename', 'struct stat __user *statbuf']
 	case 4106: {
+		sub = syscall_sub_linux_mips[95];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_newstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_newstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_newstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_newstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4107 long sys_newlstat ['const char __user *filename', 'struct stat __user *statbuf']
 	case 4107: {
+		sub = syscall_sub_linux_mips[96];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_newlstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_newlstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_newlstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_newlstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4108 long sys_newfstat ['unsigned int fd', 'struct stat __user *statbuf']
 	case 4108: {
+		sub = syscall_sub_linux_mips[97];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_newfstat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_newfstat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_newfstat_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_newfstat_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4109 long sys_uname ['struct old_utsname __user *']
 	case 4109: {
+		sub = syscall_sub_linux_mips[98];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_uname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_uname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_uname_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_uname_enter, cpu, pc, arg0);
 	}; break;
 	// 4110 long sys_iopl ['int level']
 	case 4110: {
+		sub = syscall_sub_linux_mips[99];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_iopl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_iopl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_iopl_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_iopl_enter, cpu, pc, arg0);
 	}; break;
 	// 4111 long sys_vhangup ['void']
 	case 4111: {
+		sub = syscall_sub_linux_mips[100];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_vhangup_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_vhangup_enter, cpu, pc);
+		}
 	}; break;
 	// 4112 long sys_idle ['void']
 	case 4112: {
+		sub = syscall_sub_linux_mips[101];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_idle_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_idle_enter, cpu, pc);
+		}
 	}; break;
 	// 4114 long sys_wait4 ['pid_t pid', 'int __user *stat_addr', 'int options', 'struct rusage __user *ru']
 	case 4114: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_wait4_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[102];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_wait4_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_wait4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_wait4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4115 long sys_swapoff ['const char __user *specialfile']
 	case 4115: {
+		sub = syscall_sub_linux_mips[103];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_swapoff_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_swapoff_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_swapoff_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_swapoff_enter, cpu, pc, arg0);
 	}; break;
 	// 4116 long sys_sysinfo ['struct sysinfo __user *info']
 	case 4116: {
+		sub = syscall_sub_linux_mips[104];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sysinfo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sysinfo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sysinfo_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sysinfo_enter, cpu, pc, arg0);
 	}; break;
 	// 4117 long sys_ipc ['unsigned int call', 'int first', 'unsigned long second', 'unsigned long third', 'void __user *ptr', 'long fifth']
 	case 4117: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ipc_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_ipc_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[105];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			int32_t arg5 = get_s32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ipc_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_ipc_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4118 long sys_fsync ['unsigned int fd']
 	case 4118: {
+		sub = syscall_sub_linux_mips[106];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fsync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fsync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fsync_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_fsync_enter, cpu, pc, arg0);
 	}; break;
 	// 4119 void sys_sigreturn ['void']
 	case 4119: {
+		sub = syscall_sub_linux_mips[107];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_sigreturn_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_sigreturn_enter, cpu, pc);
+		}
 	}; break;
 	// 4120 long sys_clone ['unsigned long', 'unsigned long', 'int __user *', 'unsigned long', 'int __user *']
 	case 4120: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clone_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_clone_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[108];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clone_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clone_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4121 long sys_setdomainname ['char __user *name', 'int len']
 	case 4121: {
+		sub = syscall_sub_linux_mips[109];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setdomainname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setdomainname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setdomainname_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setdomainname_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4122 long sys_newuname ['struct new_utsname __user *name']
 	case 4122: {
+		sub = syscall_sub_linux_mips[110];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_newuname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_newuname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_newuname_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_newuname_enter, cpu, pc, arg0);
 	}; break;
 	// 4123 long modify_ldt ['int func', 'void *ptr', 'unsigned long bytecount']
 	case 4123: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_modify_ldt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[111];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_modify_ldt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_modify_ldt_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_modify_ldt_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4124 long sys_adjtimex_time32 ['struct old_timex32 __user *txc_p']
 	case 4124: {
+		sub = syscall_sub_linux_mips[112];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_adjtimex_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_adjtimex_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_adjtimex_time32_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_adjtimex_time32_enter, cpu, pc, arg0);
 	}; break;
 	// 4125 long sys_mprotect ['unsigned long start', 'size_t len', 'unsigned long prot']
 	case 4125: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mprotect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[113];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mprotect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mprotect_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mprotect_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4126 long sys_sigprocmask ['int how', 'old_sigset_t __user *set', 'old_sigset_t __user *oset']
 	case 4126: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sigprocmask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[114];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sigprocmask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sigprocmask_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sigprocmask_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4127 caddr_t create_module ['const char *name', 'size_t size']
 	case 4127: {
+		sub = syscall_sub_linux_mips[115];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_create_module_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_create_module_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_create_module_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_create_module_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4128 long sys_init_module ['void __user *umod', 'unsigned long len', 'const char __user *uargs']
 	case 4128: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_init_module_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[116];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_init_module_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_init_module_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_init_module_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4129 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
 	case 4129: {
+		sub = syscall_sub_linux_mips[117];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_delete_module_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_delete_module_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_delete_module_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_delete_module_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4130 long get_kernel_syms ['struct kernel_sym *table']
 	case 4130: {
+		sub = syscall_sub_linux_mips[118];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_get_kernel_syms_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_get_kernel_syms_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_get_kernel_syms_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_get_kernel_syms_enter, cpu, pc, arg0);
 	}; break;
 	// 4131 long sys_quotactl ['unsigned int cmd', 'const char __user *special', 'qid_t id', 'void __user *addr']
 	case 4131: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_quotactl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[119];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_quotactl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_quotactl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_quotactl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4132 long sys_getpgid ['pid_t pid']
 	case 4132: {
+		sub = syscall_sub_linux_mips[120];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getpgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getpgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_getpgid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_getpgid_enter, cpu, pc, arg0);
 	}; break;
 	// 4133 long sys_fchdir ['unsigned int fd']
 	case 4133: {
+		sub = syscall_sub_linux_mips[121];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchdir_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchdir_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fchdir_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_fchdir_enter, cpu, pc, arg0);
 	}; break;
 	// 4134 long sys_bdflush ['int func', 'long data']
 	case 4134: {
+		sub = syscall_sub_linux_mips[122];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_bdflush_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_bdflush_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_bdflush_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_bdflush_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4135 long sys_sysfs ['int option', 'unsigned long arg1', 'unsigned long arg2']
 	case 4135: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sysfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[123];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sysfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sysfs_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sysfs_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4136 long sys_personality ['unsigned int personality']
 	case 4136: {
+		sub = syscall_sub_linux_mips[124];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_personality_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_personality_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_personality_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_personality_enter, cpu, pc, arg0);
 	}; break;
 	// 4138 long sys_setfsuid ['uid_t uid']
 	case 4138: {
+		sub = syscall_sub_linux_mips[125];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setfsuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setfsuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setfsuid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_setfsuid_enter, cpu, pc, arg0);
 	}; break;
 	// 4139 long sys_setfsgid ['gid_t gid']
 	case 4139: {
+		sub = syscall_sub_linux_mips[126];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setfsgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setfsgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setfsgid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_setfsgid_enter, cpu, pc, arg0);
 	}; break;
 	// 4140 long sys_llseek ['unsigned int fd', 'unsigned long offset_high', 'unsigned long offset_low', 'loff_t __user *result', 'unsigned int whence']
 	case 4140: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_llseek_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_llseek_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[127];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_llseek_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_llseek_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4141 long sys_getdents ['unsigned int fd', 'struct linux_dirent __user *dirent', 'unsigned int count']
 	case 4141: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getdents_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[128];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getdents_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getdents_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getdents_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4142 long sys_select ['int n', 'fd_set __user *inp', 'fd_set __user *outp', 'fd_set __user *exp', 'struct __kernel_old_timeval __user *tvp']
 	case 4142: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_select_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_select_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[129];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_select_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_select_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4143 long sys_flock ['unsigned int fd', 'unsigned int cmd']
 	case 4143: {
+		sub = syscall_sub_linux_mips[130];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_flock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_flock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_flock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_flock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4144 long sys_msync ['unsigned long start', 'size_t len', 'int flags']
 	case 4144: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[131];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_msync_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_msync_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4145 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 	case 4145: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_readv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[132];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_readv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_readv_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_readv_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4146 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 	case 4146: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_writev_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[133];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_writev_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_writev_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_writev_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4147 long sys_cacheflush ['char *addr', 'int nbytes', 'int cache']
 	case 4147: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_cacheflush_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[134];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_cacheflush_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_cacheflush_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_cacheflush_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4150 long sys_setup ['void']
 	case 4150: {
+		sub = syscall_sub_linux_mips[135];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_setup_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_setup_enter, cpu, pc);
+		}
 	}; break;
 	// 4151 long sys_getsid ['pid_t pid']
 	case 4151: {
+		sub = syscall_sub_linux_mips[136];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getsid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getsid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_getsid_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_getsid_enter, cpu, pc, arg0);
 	}; break;
 	// 4152 long sys_fdatasync ['unsigned int fd']
 	case 4152: {
+		sub = syscall_sub_linux_mips[137];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fdatasync_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fdatasync_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fdatasync_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_fdatasync_enter, cpu, pc, arg0);
 	}; break;
 	// 4153 long sys_sysctl ['struct __sysctl_args __user *args']
 	case 4153: {
+		sub = syscall_sub_linux_mips[138];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sysctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sysctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sysctl_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sysctl_enter, cpu, pc, arg0);
 	}; break;
 	// 4154 long sys_mlock ['unsigned long start', 'size_t len']
 	case 4154: {
+		sub = syscall_sub_linux_mips[139];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mlock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mlock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mlock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_mlock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4155 long sys_munlock ['unsigned long start', 'size_t len']
 	case 4155: {
+		sub = syscall_sub_linux_mips[140];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_munlock_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_munlock_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_munlock_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_munlock_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4156 long sys_mlockall ['int flags']
 	case 4156: {
+		sub = syscall_sub_linux_mips[141];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mlockall_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mlockall_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_mlockall_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_mlockall_enter, cpu, pc, arg0);
 	}; break;
 	// 4157 long sys_munlockall ['void']
 	case 4157: {
+		sub = syscall_sub_linux_mips[142];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_munlockall_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_munlockall_enter, cpu, pc);
+		}
 	}; break;
 	// 4158 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
 	case 4158: {
+		sub = syscall_sub_linux_mips[143];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_setparam_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sched_setparam_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4159 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
 	case 4159: {
+		sub = syscall_sub_linux_mips[144];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_getparam_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sched_getparam_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4160 long sys_sched_setscheduler ['pid_t pid', 'int policy', 'struct sched_param __user *param']
 	case 4160: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[145];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_setscheduler_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sched_setscheduler_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4161 long sys_sched_getscheduler ['pid_t pid']
 	case 4161: {
+		sub = syscall_sub_linux_mips[146];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_getscheduler_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sched_getscheduler_enter, cpu, pc, arg0);
 	}; break;
 	// 4162 long sys_sched_yield ['void']
 	case 4162: {
+		sub = syscall_sub_linux_mips[147];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_sched_yield_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_sched_yield_enter, cpu, pc);
+		}
 	}; break;
 	// 4163 long sys_sched_get_priority_max ['int policy']
 	case 4163: {
+		sub = syscall_sub_linux_mips[148];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_get_priority_max_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sched_get_priority_max_enter, cpu, pc, arg0);
 	}; break;
 	// 4164 long sys_sched_get_priority_min ['int policy']
 	case 4164: {
+		sub = syscall_sub_linux_mips[149];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_get_priority_min_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_sched_get_priority_min_enter, cpu, pc, arg0);
 	}; break;
 	// 4165 long sys_sched_rr_get_interval_time32 ['pid_t pid', 'struct old_timespec32 __user *interval']
 	case 4165: {
+		sub = syscall_sub_linux_mips[150];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_rr_get_interval_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_rr_get_interval_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_rr_get_interval_time32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sched_rr_get_interval_time32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4166 long sys_nanosleep_time32 ['struct old_timespec32 __user *rqtp', 'struct old_timespec32 __user *rmtp']
 	case 4166: {
+		sub = syscall_sub_linux_mips[151];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_nanosleep_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_nanosleep_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_nanosleep_time32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_nanosleep_time32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4167 long sys_mremap ['unsigned long addr', 'unsigned long old_len', 'unsigned long new_len', 'unsigned long flags', 'unsigned long new_addr']
 	case 4167: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mremap_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mremap_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[152];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mremap_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mremap_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4168 long sys_accept ['int', 'struct sockaddr __user *', 'int __user *']
 	case 4168: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_accept_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[153];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_accept_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_accept_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_accept_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4169 long sys_bind ['int', 'struct sockaddr __user *', 'int']
 	case 4169: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_bind_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[154];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_bind_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_bind_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_bind_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4170 long sys_connect ['int', 'struct sockaddr __user *', 'int']
 	case 4170: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_connect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[155];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_connect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_connect_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_connect_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4171 long sys_getpeername ['int', 'struct sockaddr __user *', 'int __user *']
 	case 4171: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getpeername_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[156];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getpeername_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getpeername_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getpeername_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4172 long sys_getsockname ['int', 'struct sockaddr __user *', 'int __user *']
 	case 4172: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getsockname_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[157];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getsockname_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getsockname_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getsockname_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4173 long sys_getsockopt ['int fd', 'int level', 'int optname', 'char __user *optval', 'int __user *optlen']
 	case 4173: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getsockopt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_getsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[158];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getsockopt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4174 long sys_listen ['int', 'int']
 	case 4174: {
+		sub = syscall_sub_linux_mips[159];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_listen_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_listen_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_listen_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_listen_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4175 long sys_recv ['int', 'void __user *', 'size_t', 'unsigned']
 	case 4175: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_recv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[160];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_recv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_recv_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_recv_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4176 long sys_recvfrom ['int', 'void __user *', 'size_t', 'unsigned', 'struct sockaddr __user *', 'int __user *']
 	case 4176: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_recvfrom_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_recvfrom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[161];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_recvfrom_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_recvfrom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4177 long sys_recvmsg ['int fd', 'struct user_msghdr __user *msg', 'unsigned flags']
 	case 4177: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_recvmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[162];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_recvmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_recvmsg_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_recvmsg_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4178 long sys_send ['int', 'void __user *', 'size_t', 'unsigned']
 	case 4178: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_send_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[163];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_send_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_send_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_send_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4179 long sys_sendmsg ['int fd', 'struct user_msghdr __user *msg', 'unsigned flags']
 	case 4179: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[164];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sendmsg_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sendmsg_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4180 long sys_sendto ['int', 'void __user *', 'size_t', 'unsigned', 'struct sockaddr __user *', 'int']
 	case 4180: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendto_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_sendto_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[165];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			int32_t arg5 = get_s32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendto_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_sendto_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4181 long sys_setsockopt ['int fd', 'int level', 'int optname', 'char __user *optval', 'int optlen']
 	case 4181: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setsockopt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_setsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[166];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setsockopt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setsockopt_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4182 long sys_shutdown ['int', 'int']
 	case 4182: {
+		sub = syscall_sub_linux_mips[167];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shutdown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shutdown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_shutdown_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_shutdown_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4183 long sys_socket ['int', 'int', 'int']
 	case 4183: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_socket_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[168];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_socket_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_socket_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_socket_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4184 long sys_socketpair ['int', 'int', 'int', 'int __user *']
 	case 4184: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_socketpair_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[169];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_socketpair_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_socketpair_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_socketpair_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4185 long sys_setresuid ['uid_t ruid', 'uid_t euid', 'uid_t suid']
 	case 4185: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setresuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[170];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setresuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setresuid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_setresuid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4186 long sys_getresuid ['uid_t __user *ruid', 'uid_t __user *euid', 'uid_t __user *suid']
 	case 4186: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getresuid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[171];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getresuid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getresuid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getresuid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4187 long sys_query_module ['const char *name', 'int which', 'void *buf', 'size_t bufsize', 'size_t *ret']
 	case 4187: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_query_module_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_query_module_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[172];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_query_module_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_query_module_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4188 long sys_poll ['struct pollfd __user *ufds', 'unsigned int nfds', 'int timeout']
 	case 4188: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_poll_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[173];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_poll_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_poll_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_poll_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4189 long sys_nfsservctl ['int cmd', 'struct nfsctl_arg *argp', 'union nfsctl_res *resp']
 	case 4189: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_nfsservctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[174];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_nfsservctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_nfsservctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_nfsservctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4190 long sys_setresgid ['gid_t rgid', 'gid_t egid', 'gid_t sgid']
 	case 4190: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setresgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[175];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setresgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_setresgid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_setresgid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4191 long sys_getresgid ['gid_t __user *rgid', 'gid_t __user *egid', 'gid_t __user *sgid']
 	case 4191: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getresgid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[176];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getresgid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getresgid_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getresgid_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4192 long sys_prctl ['int option', 'unsigned long arg2', 'unsigned long arg3', 'unsigned long arg4', 'unsigned long arg5']
 	case 4192: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_prctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_prctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[177];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_prctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_prctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4193 void sys_rt_sigreturn ['void']
 	case 4193: {
+		sub = syscall_sub_linux_mips[178];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_rt_sigreturn_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_rt_sigreturn_enter, cpu, pc);
+		}
 	}; break;
 	// 4194 long sys_rt_sigaction ['int', 'const struct sigaction __user *', 'struct sigaction __user *', 'size_t']
 	case 4194: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[179];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigaction_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_sigaction_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4195 long sys_rt_sigprocmask ['int how', 'sigset_t __user *set', 'sigset_t __user *oset', 'size_t sigsetsize']
 	case 4195: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[180];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigprocmask_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_sigprocmask_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4196 long sys_rt_sigpending ['sigset_t __user *set', 'size_t sigsetsize']
 	case 4196: {
+		sub = syscall_sub_linux_mips[181];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigpending_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_rt_sigpending_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4197 long sys_rt_sigtimedwait_time32 ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct old_timespec32 __user *uts', 'size_t sigsetsize']
 	case 4197: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigtimedwait_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[182];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigtimedwait_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigtimedwait_time32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_sigtimedwait_time32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4198 long sys_rt_sigqueueinfo ['pid_t pid', 'int sig', 'siginfo_t __user *uinfo']
 	case 4198: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[183];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigqueueinfo_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_rt_sigqueueinfo_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4199 long sys_rt_sigsuspend ['sigset_t __user *unewset', 'size_t sigsetsize']
 	case 4199: {
+		sub = syscall_sub_linux_mips[184];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigsuspend_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_rt_sigsuspend_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4200 long sys_pread64 ['unsigned int fd', 'char __user *buf', 'size_t count', 'loff_t pos']
 	case 4200: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pread64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_mips[185];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pread64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_pread64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_pread64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4201 long sys_pwrite64 ['unsigned int fd', 'const char __user *buf', 'size_t count', 'loff_t pos']
 	case 4201: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pwrite64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_mips[186];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pwrite64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_pwrite64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_pwrite64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4202 long sys_chown ['const char __user *filename', 'uid_t user', 'gid_t group']
 	case 4202: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_chown_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[187];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_chown_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_chown_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_chown_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4203 long sys_getcwd ['char __user *buf', 'unsigned long size']
 	case 4203: {
+		sub = syscall_sub_linux_mips[188];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getcwd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getcwd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getcwd_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_getcwd_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4204 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
 	case 4204: {
+		sub = syscall_sub_linux_mips[189];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_capget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_capget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_capget_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_capget_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4205 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
 	case 4205: {
+		sub = syscall_sub_linux_mips[190];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_capset_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_capset_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_capset_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_capset_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4206 long sys_sigaltstack ['const struct sigaltstack __user *uss', 'struct sigaltstack __user *uoss']
 	case 4206: {
+		sub = syscall_sub_linux_mips[191];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sigaltstack_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sigaltstack_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4207 long sys_sendfile ['int out_fd', 'int in_fd', 'off_t __user *offset', 'size_t count']
 	case 4207: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendfile_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[192];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendfile_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sendfile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sendfile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4210 void* mmap2 ['void *addr', 'size_t length', 'int prot', 'int flags', 'int fd', 'off_t pgoffset']
 	case 4210: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_mmap2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_mmap2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[193];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_mmap2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_mmap2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4211 long sys_truncate64 ['const char __user *path', 'loff_t length']
 	case 4211: {
+		sub = syscall_sub_linux_mips[194];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_truncate64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_truncate64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_truncate64_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_truncate64_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4212 long sys_ftruncate64 ['unsigned int fd', 'loff_t length']
 	case 4212: {
+		sub = syscall_sub_linux_mips[195];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ftruncate64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ftruncate64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_ftruncate64_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_ftruncate64_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4213 long sys_stat64 ['const char __user *filename', 'struct stat64 __user *statbuf']
 	case 4213: {
+		sub = syscall_sub_linux_mips[196];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_stat64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_stat64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_stat64_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_stat64_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4214 long sys_lstat64 ['const char __user *filename', 'struct stat64 __user *statbuf']
 	case 4214: {
+		sub = syscall_sub_linux_mips[197];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lstat64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lstat64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lstat64_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_lstat64_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4215 long sys_fstat64 ['unsigned long fd', 'struct stat64 __user *statbuf']
 	case 4215: {
+		sub = syscall_sub_linux_mips[198];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fstat64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fstat64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fstat64_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fstat64_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4216 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
 	case 4216: {
+		sub = syscall_sub_linux_mips[199];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pivot_root_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pivot_root_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pivot_root_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_pivot_root_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4217 long sys_mincore ['unsigned long start', 'size_t len', 'unsigned char __user *vec']
 	case 4217: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mincore_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[200];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mincore_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mincore_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mincore_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4218 long sys_madvise ['unsigned long start', 'size_t len', 'int behavior']
 	case 4218: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_madvise_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[201];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_madvise_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_madvise_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_madvise_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4219 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 __user *dirent', 'unsigned int count']
 	case 4219: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getdents64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[202];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getdents64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getdents64_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getdents64_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4220 long sys_fcntl64 ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 4220: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fcntl64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[203];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fcntl64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fcntl64_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fcntl64_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4222 long sys_gettid ['void']
 	case 4222: {
+		sub = syscall_sub_linux_mips[204];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_gettid_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_gettid_enter, cpu, pc);
+		}
 	}; break;
 	// 4223 long sys_readahead ['int fd', 'loff_t offset', 'size_t count']
 	case 4223: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_readahead_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[205];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_readahead_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_readahead_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_readahead_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4224 long sys_setxattr ['const char __user *path', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 4224: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_setxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[206];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4225 long sys_lsetxattr ['const char __user *path', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 4225: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_lsetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[207];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_lsetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4226 long sys_fsetxattr ['int fd', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 4226: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_fsetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[208];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_fsetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4227 long sys_getxattr ['const char __user *path', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 4227: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[209];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_getxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4228 long sys_lgetxattr ['const char __user *path', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 4228: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[210];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lgetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_lgetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4229 long sys_fgetxattr ['int fd', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 4229: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[211];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fgetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_fgetxattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4230 long sys_listxattr ['const char __user *path', 'char __user *list', 'size_t size']
 	case 4230: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_listxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[212];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_listxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_listxattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_listxattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4231 long sys_llistxattr ['const char __user *path', 'char __user *list', 'size_t size']
 	case 4231: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_llistxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[213];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_llistxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_llistxattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_llistxattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4232 long sys_flistxattr ['int fd', 'char __user *list', 'size_t size']
 	case 4232: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_flistxattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[214];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_flistxattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_flistxattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_flistxattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4233 long sys_removexattr ['const char __user *path', 'const char __user *name']
 	case 4233: {
+		sub = syscall_sub_linux_mips[215];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_removexattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_removexattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_removexattr_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_removexattr_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4234 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
 	case 4234: {
+		sub = syscall_sub_linux_mips[216];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lremovexattr_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_lremovexattr_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4235 long sys_fremovexattr ['int fd', 'const char __user *name']
 	case 4235: {
+		sub = syscall_sub_linux_mips[217];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fremovexattr_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fremovexattr_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4236 long sys_tkill ['pid_t pid', 'int sig']
 	case 4236: {
+		sub = syscall_sub_linux_mips[218];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_tkill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_tkill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_tkill_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_tkill_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4237 long sys_sendfile64 ['int out_fd', 'int in_fd', 'loff_t __user *offset', 'size_t count']
 	case 4237: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendfile64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[219];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendfile64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sendfile64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sendfile64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4238 long sys_futex_time32 ['u32 __user *uaddr', 'int op', 'u32 val', 'struct old_timespec32 __user *utime', 'u32 __user *uaddr2', 'u32 val3']
 	case 4238: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_futex_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_futex_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[220];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_futex_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_futex_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4239 long sys_sched_setaffinity ['pid_t pid', 'unsigned int len', 'unsigned long __user *user_mask_ptr']
 	case 4239: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[221];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_setaffinity_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sched_setaffinity_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4240 long sys_sched_getaffinity ['pid_t pid', 'unsigned int len', 'unsigned long __user *user_mask_ptr']
 	case 4240: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[222];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_getaffinity_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sched_getaffinity_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4241 long sys_io_setup ['unsigned nr_reqs', 'aio_context_t __user *ctx']
 	case 4241: {
+		sub = syscall_sub_linux_mips[223];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_setup_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_setup_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_setup_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_io_setup_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4242 long sys_io_destroy ['aio_context_t ctx']
 	case 4242: {
+		sub = syscall_sub_linux_mips[224];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_destroy_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_destroy_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_destroy_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_io_destroy_enter, cpu, pc, arg0);
 	}; break;
 	// 4243 long sys_io_getevents_time32 ['__u32 ctx_id', '__s32 min_nr', '__s32 nr', 'struct io_event __user *events', 'struct old_timespec32 __user *timeout']
 	case 4243: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_getevents_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_io_getevents_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[225];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_getevents_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_getevents_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4244 long sys_io_submit ['aio_context_t', 'long', 'struct iocb __user * __user *']
 	case 4244: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_submit_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[226];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_submit_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_submit_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_io_submit_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4245 long sys_io_cancel ['aio_context_t ctx_id', 'struct iocb __user *iocb', 'struct io_event __user *result']
 	case 4245: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_cancel_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[227];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_cancel_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_cancel_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_io_cancel_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4246 long sys_exit_group ['int error_code']
 	case 4246: {
+		sub = syscall_sub_linux_mips[228];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_exit_group_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_exit_group_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_exit_group_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_exit_group_enter, cpu, pc, arg0);
 	}; break;
 	// 4247 long sys_lookup_dcookie ['u64 cookie64', 'char __user *buf', 'size_t len']
 	case 4247: {
-		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[229];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint64_t arg0 = get_64(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_lookup_dcookie_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_lookup_dcookie_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4248 long sys_epoll_create ['int size']
 	case 4248: {
+		sub = syscall_sub_linux_mips[230];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_epoll_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_epoll_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_epoll_create_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_epoll_create_enter, cpu, pc, arg0);
 	}; break;
 	// 4249 long sys_epoll_ctl ['int epfd', 'int op', 'int fd', 'struct epoll_event __user *event']
 	case 4249: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[231];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_epoll_ctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_epoll_ctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4250 long sys_epoll_wait ['int epfd', 'struct epoll_event __user *events', 'int maxevents', 'int timeout']
 	case 4250: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_epoll_wait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[232];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_epoll_wait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_epoll_wait_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_epoll_wait_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4251 long sys_remap_file_pages ['unsigned long start', 'unsigned long size', 'unsigned long prot', 'unsigned long pgoff', 'unsigned long flags']
 	case 4251: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_remap_file_pages_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[233];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_remap_file_pages_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4252 long sys_set_tid_address ['int __user *tidptr']
 	case 4252: {
+		sub = syscall_sub_linux_mips[234];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_set_tid_address_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_set_tid_address_enter, cpu, pc, arg0);
 	}; break;
 	// 4253 long sys_restart_syscall ['void']
 	case 4253: {
+		sub = syscall_sub_linux_mips[235];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_restart_syscall_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_restart_syscall_enter, cpu, pc);
+		}
 	}; break;
 	// 4254 long sys_fadvise64_64 ['int fd', 'loff_t offset', 'loff_t len', 'int advice']
 	case 4254: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fadvise64_64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[236];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fadvise64_64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_fadvise64_64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_fadvise64_64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4255 long sys_statfs64 ['const char __user *path', 'size_t sz', 'struct statfs64 __user *buf']
 	case 4255: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_statfs64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[237];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_statfs64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_statfs64_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_statfs64_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4256 long sys_fstatfs64 ['unsigned int fd', 'size_t sz', 'struct statfs64 __user *buf']
 	case 4256: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fstatfs64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[238];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fstatfs64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fstatfs64_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fstatfs64_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4257 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user *created_timer_id']
 	case 4257: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[239];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_create_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_timer_create_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4258 long sys_timer_settime32 ['timer_t timer_id', 'int flags', 'struct old_itimerspec32 __user *new', 'struct old_itimerspec32 __user *old']
 	case 4258: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_settime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[240];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_settime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_settime32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_timer_settime32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4259 long sys_timer_gettime32 ['timer_t timer_id', 'struct old_itimerspec32 __user *setting']
 	case 4259: {
+		sub = syscall_sub_linux_mips[241];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_gettime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_gettime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_gettime32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_timer_gettime32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4260 long sys_timer_getoverrun ['timer_t timer_id']
 	case 4260: {
+		sub = syscall_sub_linux_mips[242];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_getoverrun_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_timer_getoverrun_enter, cpu, pc, arg0);
 	}; break;
 	// 4261 long sys_timer_delete ['timer_t timer_id']
 	case 4261: {
+		sub = syscall_sub_linux_mips[243];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_delete_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_delete_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_delete_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_timer_delete_enter, cpu, pc, arg0);
 	}; break;
 	// 4262 long sys_clock_settime32 ['clockid_t which_clock', 'struct old_timespec32 __user *tp']
 	case 4262: {
+		sub = syscall_sub_linux_mips[244];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_settime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_settime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_settime32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_settime32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4263 long sys_clock_gettime32 ['clockid_t which_clock', 'struct old_timespec32 __user *tp']
 	case 4263: {
+		sub = syscall_sub_linux_mips[245];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_gettime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_gettime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_gettime32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_gettime32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4264 long sys_clock_getres_time32 ['clockid_t which_clock', 'struct old_timespec32 __user *tp']
 	case 4264: {
+		sub = syscall_sub_linux_mips[246];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_getres_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_getres_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_getres_time32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_getres_time32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4265 long sys_clock_nanosleep_time32 ['clockid_t which_clock', 'int flags', 'struct old_timespec32 __user *rqtp', 'struct old_timespec32 __user *rmtp']
 	case 4265: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_nanosleep_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[247];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_nanosleep_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_nanosleep_time32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_clock_nanosleep_time32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4266 long sys_tgkill ['pid_t tgid', 'pid_t pid', 'int sig']
 	case 4266: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_tgkill_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[248];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_tgkill_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_tgkill_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_tgkill_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4267 long sys_utimes_time32 ['const char __user *filename', 'struct old_timeval32 __user *t']
 	case 4267: {
+		sub = syscall_sub_linux_mips[249];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_utimes_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_utimes_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_utimes_time32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_utimes_time32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4268 long sys_mbind ['unsigned long start', 'unsigned long len', 'unsigned long mode', 'const unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
 	case 4268: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mbind_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mbind_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[250];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mbind_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mbind_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4269 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', 'unsigned long flags']
 	case 4269: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_get_mempolicy_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[251];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_get_mempolicy_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4270 long sys_set_mempolicy ['int mode', 'const unsigned long __user *nmask', 'unsigned long maxnode']
 	case 4270: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[252];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_set_mempolicy_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_set_mempolicy_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4271 long sys_mq_open ['const char __user *name', 'int oflag', 'umode_t mode', 'struct mq_attr __user *attr']
 	case 4271: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[253];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mq_open_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_mq_open_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4272 long sys_mq_unlink ['const char __user *name']
 	case 4272: {
+		sub = syscall_sub_linux_mips[254];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mq_unlink_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_mq_unlink_enter, cpu, pc, arg0);
 	}; break;
 	// 4273 long sys_mq_timedsend_time32 ['mqd_t mqdes', 'const char __user *u_msg_ptr', 'unsigned int msg_len', 'unsigned int msg_prio', 'const struct old_timespec32 __user *u_abs_timeout']
 	case 4273: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_timedsend_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mq_timedsend_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[255];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_timedsend_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mq_timedsend_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4274 long sys_mq_timedreceive_time32 ['mqd_t mqdes', 'char __user *u_msg_ptr', 'unsigned int msg_len', 'unsigned int __user *u_msg_prio', 'const struct old_timespec32 __user *u_abs_timeout']
 	case 4274: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_timedreceive_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mq_timedreceive_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[256];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_timedreceive_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mq_timedreceive_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4275 long sys_mq_notify ['mqd_t mqdes', 'const struct sigevent __user *notification']
 	case 4275: {
+		sub = syscall_sub_linux_mips[257];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_notify_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_notify_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mq_notify_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_mq_notify_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4276 long sys_mq_getsetattr ['mqd_t mqdes', 'const struct mq_attr __user *mqstat', 'struct mq_attr __user *omqstat']
 	case 4276: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[258];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mq_getsetattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mq_getsetattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4278 long sys_waitid ['int which', 'pid_t pid', 'struct siginfo __user *infop', 'int options', 'struct rusage __user *ru']
 	case 4278: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_waitid_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_waitid_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[259];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_waitid_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_waitid_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4280 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
 	case 4280: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_add_key_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_add_key_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[260];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_add_key_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_add_key_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4281 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
 	case 4281: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_request_key_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[261];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_request_key_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_request_key_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_request_key_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4282 long sys_keyctl ['int cmd', 'unsigned long arg2', 'unsigned long arg3', 'unsigned long arg4', 'unsigned long arg5']
 	case 4282: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_keyctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_keyctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[262];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_keyctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_keyctl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4283 long set_thread_area ['unsigned long tp']
 	case 4283: {
+		sub = syscall_sub_linux_mips[263];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_set_thread_area_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_set_thread_area_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_set_thread_area_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_set_thread_area_enter, cpu, pc, arg0);
 	}; break;
 	// 4284 long sys_inotify_init ['void']
 	case 4284: {
+		sub = syscall_sub_linux_mips[264];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_inotify_init_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_inotify_init_enter, cpu, pc);
+		}
 	}; break;
 	// 4285 long sys_inotify_add_watch ['int fd', 'const char __user *path', 'u32 mask']
 	case 4285: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[265];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_inotify_add_watch_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_inotify_add_watch_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4286 long sys_inotify_rm_watch ['int fd', '__s32 wd']
 	case 4286: {
+		sub = syscall_sub_linux_mips[266];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_inotify_rm_watch_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_inotify_rm_watch_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4287 long sys_migrate_pages ['pid_t pid', 'unsigned long maxnode', 'const unsigned long __user *from', 'const unsigned long __user *to']
 	case 4287: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_migrate_pages_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[267];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_migrate_pages_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_migrate_pages_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_migrate_pages_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4288 long sys_openat ['int dfd', 'const char __user *filename', 'int flags', 'umode_t mode']
 	case 4288: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_openat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[268];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_openat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_openat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_openat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4289 long sys_mkdirat ['int dfd', 'const char __user *pathname', 'umode_t mode']
 	case 4289: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mkdirat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[269];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mkdirat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mkdirat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mkdirat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4290 long sys_mknodat ['int dfd', 'const char __user *filename', 'umode_t mode', 'unsigned dev']
 	case 4290: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mknodat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[270];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mknodat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mknodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_mknodat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4291 long sys_fchownat ['int dfd', 'const char __user *filename', 'uid_t user', 'gid_t group', 'int flag']
 	case 4291: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchownat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_fchownat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[271];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchownat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_fchownat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4292 long sys_futimesat_time32 ['unsigned int dfd', 'const char __user *filename', 'struct old_timeval32 __user *t']
 	case 4292: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_futimesat_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[272];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_futimesat_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_futimesat_time32_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_futimesat_time32_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4293 long sys_fstatat64 ['int dfd', 'const char __user *filename', 'struct stat64 __user *statbuf', 'int flag']
 	case 4293: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fstatat64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[273];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fstatat64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_fstatat64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_fstatat64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4294 long sys_unlinkat ['int dfd', 'const char __user *pathname', 'int flag']
 	case 4294: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_unlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[274];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_unlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_unlinkat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_unlinkat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4295 long sys_renameat ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname']
 	case 4295: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_renameat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[275];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_renameat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_renameat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_renameat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4296 long sys_linkat ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname', 'int flags']
 	case 4296: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_linkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_linkat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[276];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_linkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_linkat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4297 long sys_symlinkat ['const char __user *oldname', 'int newdfd', 'const char __user *newname']
 	case 4297: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_symlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[277];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_symlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_symlinkat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_symlinkat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4298 long sys_readlinkat ['int dfd', 'const char __user *path', 'char __user *buf', 'int bufsiz']
 	case 4298: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_readlinkat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[278];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_readlinkat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_readlinkat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_readlinkat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4299 long sys_fchmodat ['int dfd', 'const char __user *filename', 'umode_t mode']
 	case 4299: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fchmodat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[279];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fchmodat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fchmodat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fchmodat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4300 long sys_faccessat ['int dfd', 'const char __user *filename', 'int mode']
 	case 4300: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_faccessat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[280];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_faccessat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_faccessat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_faccessat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4301 long sys_pselect6_time32 ['int', 'fd_set __user *', 'fd_set __user *', 'fd_set __user *', 'struct old_timespec32 __user *', 'void __user *']
 	case 4301: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pselect6_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_pselect6_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[281];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pselect6_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pselect6_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4302 long sys_ppoll_time32 ['struct pollfd __user *', 'unsigned int', 'struct old_timespec32 __user *', 'const sigset_t __user *', 'size_t']
 	case 4302: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ppoll_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_ppoll_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[282];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ppoll_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_ppoll_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4303 long sys_unshare ['unsigned long unshare_flags']
 	case 4303: {
+		sub = syscall_sub_linux_mips[283];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_unshare_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_unshare_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_unshare_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_unshare_enter, cpu, pc, arg0);
 	}; break;
 	// 4304 long sys_splice ['int fd_in', 'loff_t __user *off_in', 'int fd_out', 'loff_t __user *off_out', 'size_t len', 'unsigned int flags']
 	case 4304: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_splice_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_splice_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[284];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_splice_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_splice_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4305 long sys_sync_file_range ['int fd', 'loff_t offset', 'loff_t nbytes', 'unsigned int flags']
 	case 4305: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sync_file_range_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[285];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint64_t arg1 = get_64(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sync_file_range_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sync_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sync_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4306 long sys_tee ['int fdin', 'int fdout', 'size_t len', 'unsigned int flags']
 	case 4306: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_tee_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[286];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_tee_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_tee_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_tee_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4307 long sys_vmsplice ['int fd', 'const struct iovec __user *iov', 'unsigned long nr_segs', 'unsigned int flags']
 	case 4307: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_vmsplice_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[287];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_vmsplice_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_vmsplice_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_vmsplice_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4308 long sys_move_pages ['pid_t pid', 'unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
 	case 4308: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_move_pages_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_move_pages_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[288];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			int32_t arg5 = get_s32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_move_pages_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_move_pages_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4309 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
 	case 4309: {
+		sub = syscall_sub_linux_mips[289];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_set_robust_list_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_set_robust_list_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4310 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
 	case 4310: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[290];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_get_robust_list_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_get_robust_list_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4311 long sys_kexec_load ['unsigned long entry', 'unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
 	case 4311: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_kexec_load_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[291];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_kexec_load_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_kexec_load_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_kexec_load_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4312 long sys_getcpu ['unsigned __user *cpu', 'unsigned __user *node', 'struct getcpu_cache __user *cache']
 	case 4312: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getcpu_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[292];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getcpu_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getcpu_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getcpu_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4313 long sys_epoll_pwait ['int epfd', 'struct epoll_event __user *events', 'int maxevents', 'int timeout', 'const sigset_t __user *sigmask', 'size_t sigsetsize']
 	case 4313: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_epoll_pwait_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[293];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_epoll_pwait_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4314 long sys_ioprio_set ['int which', 'int who', 'int ioprio']
 	case 4314: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[294];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_ioprio_set_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_ioprio_set_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4315 long sys_ioprio_get ['int which', 'int who']
 	case 4315: {
+		sub = syscall_sub_linux_mips[295];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_ioprio_get_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_ioprio_get_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4316 long sys_utimensat_time32 ['unsigned int dfd', 'const char __user *filename', 'struct old_timespec32 __user *t', 'int flags']
 	case 4316: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_utimensat_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[296];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_utimensat_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_utimensat_time32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_utimensat_time32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4317 long sys_signalfd ['int ufd', 'sigset_t __user *user_mask', 'size_t sizemask']
 	case 4317: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_signalfd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[297];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_signalfd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_signalfd_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_signalfd_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4318 long sys_ni_syscall ['void']
 	case 4318: {
+		sub = syscall_sub_linux_mips[298];
+		if (!sub) return;
 		panda_noreturn = false;
-		PPP_RUN_CB(on_sys_ni_syscall_enter, cpu, pc);
+		if (sub & SYSCALL_SUB_ARGS) {
+			PPP_RUN_CB(on_sys_ni_syscall_enter, cpu, pc);
+		}
 	}; break;
 	// 4319 long sys_eventfd ['unsigned int count']
 	case 4319: {
+		sub = syscall_sub_linux_mips[299];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_eventfd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_eventfd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_eventfd_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_eventfd_enter, cpu, pc, arg0);
 	}; break;
 	// 4320 long sys_fallocate ['int fd', 'int mode', 'loff_t offset', 'loff_t len']
 	case 4320: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fallocate_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+		sub = syscall_sub_linux_mips[300];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			uint64_t arg3 = get_64(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fallocate_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint64_t));
+			}
+			PPP_RUN_CB(on_sys_fallocate_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_fallocate_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4321 long sys_timerfd_create ['int clockid', 'int flags']
 	case 4321: {
+		sub = syscall_sub_linux_mips[301];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_timerfd_create_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_timerfd_create_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4322 long sys_timerfd_gettime32 ['int ufd', 'struct old_itimerspec32 __user *otmr']
 	case 4322: {
+		sub = syscall_sub_linux_mips[302];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timerfd_gettime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timerfd_gettime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timerfd_gettime32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_timerfd_gettime32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4323 long sys_timerfd_settime32 ['int ufd', 'int flags', 'const struct old_itimerspec32 __user *utmr', 'struct old_itimerspec32 __user *otmr']
 	case 4323: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timerfd_settime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[303];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timerfd_settime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timerfd_settime32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_timerfd_settime32_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4324 long sys_signalfd4 ['int ufd', 'sigset_t __user *user_mask', 'size_t sizemask', 'int flags']
 	case 4324: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_signalfd4_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[304];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_signalfd4_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_signalfd4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_signalfd4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4325 long sys_eventfd2 ['unsigned int count', 'int flags']
 	case 4325: {
+		sub = syscall_sub_linux_mips[305];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_eventfd2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_eventfd2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_eventfd2_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_eventfd2_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4326 long sys_epoll_create1 ['int flags']
 	case 4326: {
+		sub = syscall_sub_linux_mips[306];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_epoll_create1_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_epoll_create1_enter, cpu, pc, arg0);
 	}; break;
 	// 4327 long sys_dup3 ['unsigned int oldfd', 'unsigned int newfd', 'int flags']
 	case 4327: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_dup3_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[307];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_dup3_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_dup3_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_dup3_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4328 long sys_pipe2 ['int __user *fildes', 'int flags']
 	case 4328: {
+		sub = syscall_sub_linux_mips[308];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pipe2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pipe2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_pipe2_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_pipe2_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4329 long sys_inotify_init1 ['int flags']
 	case 4329: {
+		sub = syscall_sub_linux_mips[309];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_inotify_init1_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_inotify_init1_enter, cpu, pc, arg0);
 	}; break;
 	// 4330 long sys_preadv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h']
 	case 4330: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_preadv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_preadv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[310];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_preadv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_preadv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4331 long sys_pwritev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h']
 	case 4331: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pwritev_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_pwritev_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[311];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pwritev_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pwritev_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4332 long sys_rt_tgsigqueueinfo ['pid_t tgid', 'pid_t pid', 'int sig', 'siginfo_t __user *uinfo']
 	case 4332: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[312];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_tgsigqueueinfo_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_tgsigqueueinfo_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4333 long sys_perf_event_open ['struct perf_event_attr __user *attr_uptr', 'pid_t pid', 'int cpu', 'int group_fd', 'unsigned long flags']
 	case 4333: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_perf_event_open_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[313];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_perf_event_open_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4334 long sys_accept4 ['int', 'struct sockaddr __user *', 'int __user *', 'int']
 	case 4334: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_accept4_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[314];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_accept4_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_accept4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_accept4_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4335 long sys_recvmmsg_time32 ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags', 'struct old_timespec32 __user *timeout']
 	case 4335: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_recvmmsg_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_recvmmsg_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[315];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_recvmmsg_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_recvmmsg_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4336 long sys_fanotify_init ['unsigned int flags', 'unsigned int event_f_flags']
 	case 4336: {
+		sub = syscall_sub_linux_mips[316];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fanotify_init_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fanotify_init_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4337 long sys_fanotify_mark ['int fanotify_fd', 'unsigned int flags', 'u64 mask', 'int fd', 'const char __user *pathname']
 	case 4337: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_fanotify_mark_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[317];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint64_t arg2 = get_64(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fanotify_mark_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4338 long sys_prlimit64 ['pid_t pid', 'unsigned int resource', 'const struct rlimit64 __user *new_rlim', 'struct rlimit64 __user *old_rlim']
 	case 4338: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_prlimit64_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[318];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_prlimit64_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_prlimit64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_prlimit64_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4339 long sys_name_to_handle_at ['int dfd', 'const char __user *name', 'struct file_handle __user *handle', 'int __user *mnt_id', 'int flag']
 	case 4339: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_name_to_handle_at_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[319];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_name_to_handle_at_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4340 long sys_open_by_handle_at ['int mountdirfd', 'struct file_handle __user *handle', 'int flags']
 	case 4340: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[320];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_open_by_handle_at_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_open_by_handle_at_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4341 long sys_clock_adjtime32 ['clockid_t which_clock', 'struct old_timex32 __user *tx']
 	case 4341: {
+		sub = syscall_sub_linux_mips[321];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_adjtime32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_adjtime32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_adjtime32_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_adjtime32_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4342 long sys_syncfs ['int fd']
 	case 4342: {
+		sub = syscall_sub_linux_mips[322];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_syncfs_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_syncfs_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_syncfs_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_syncfs_enter, cpu, pc, arg0);
 	}; break;
 	// 4343 long sys_sendmmsg ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags']
 	case 4343: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[323];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sendmmsg_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sendmmsg_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4344 long sys_setns ['int fd', 'int nstype']
 	case 4344: {
+		sub = syscall_sub_linux_mips[324];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_setns_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_setns_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_setns_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_setns_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4345 long sys_process_vm_readv ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
 	case 4345: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_process_vm_readv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[325];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_process_vm_readv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4346 long sys_process_vm_writev ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
 	case 4346: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_process_vm_writev_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[326];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_process_vm_writev_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4347 long sys_kcmp ['pid_t pid1', 'pid_t pid2', 'int type', 'unsigned long idx1', 'unsigned long idx2']
 	case 4347: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_kcmp_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_kcmp_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[327];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_kcmp_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_kcmp_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4348 long sys_finit_module ['int fd', 'const char __user *uargs', 'int flags']
 	case 4348: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_finit_module_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[328];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_finit_module_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_finit_module_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_finit_module_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4349 long sys_sched_setattr ['pid_t pid', 'struct sched_attr __user *attr', 'unsigned int flags']
 	case 4349: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[329];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_setattr_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_sched_setattr_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4350 long sys_sched_getattr ['pid_t pid', 'struct sched_attr __user *attr', 'unsigned int size', 'unsigned int flags']
 	case 4350: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[330];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_getattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_sched_getattr_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4351 long sys_renameat2 ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname', 'unsigned int flags']
 	case 4351: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_renameat2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_renameat2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[331];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_renameat2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_renameat2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4352 long sys_seccomp ['unsigned int op', 'unsigned int flags', 'void __user *uargs']
 	case 4352: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_seccomp_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[332];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_seccomp_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_seccomp_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_seccomp_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4353 long sys_getrandom ['char __user *buf', 'size_t count', 'unsigned int flags']
 	case 4353: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_getrandom_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[333];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_getrandom_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_getrandom_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_getrandom_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4354 long sys_memfd_create ['const char __user *uname_ptr', 'unsigned int flags']
 	case 4354: {
+		sub = syscall_sub_linux_mips[334];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_memfd_create_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_memfd_create_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_memfd_create_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_memfd_create_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4355 long sys_bpf ['int cmd', 'union bpf_attr *attr', 'unsigned int size']
 	case 4355: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_bpf_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[335];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_bpf_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_bpf_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_bpf_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4356 long sys_execveat ['int dfd', 'const char __user *filename', 'const char __user *const __user *argv', 'const char __user *const __user *envp', 'int flags']
 	case 4356: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_execveat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_execveat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[336];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_execveat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_execveat_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4357 long sys_userfaultfd ['int flags']
 	case 4357: {
+		sub = syscall_sub_linux_mips[337];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_userfaultfd_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_userfaultfd_enter, cpu, pc, arg0);
 	}; break;
 	// 4358 long sys_membarrier ['int cmd', 'int flags']
 	case 4358: {
+		sub = syscall_sub_linux_mips[338];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_membarrier_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_membarrier_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_membarrier_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_membarrier_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4359 long sys_mlock2 ['unsigned long start', 'size_t len', 'int flags']
 	case 4359: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mlock2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[339];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mlock2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_mlock2_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_mlock2_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4360 long sys_copy_file_range ['int fd_in', 'loff_t __user *off_in', 'int fd_out', 'loff_t __user *off_out', 'size_t len', 'unsigned int flags']
 	case 4360: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_copy_file_range_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_copy_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[340];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_copy_file_range_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_copy_file_range_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4361 long sys_preadv2 ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h', 'rwf_t flags']
 	case 4361: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_preadv2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_preadv2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[341];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_preadv2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_preadv2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4362 long sys_pwritev2 ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h', 'rwf_t flags']
 	case 4362: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pwritev2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_pwritev2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[342];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pwritev2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pwritev2_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4363 long sys_pkey_mprotect ['unsigned long start', 'size_t len', 'unsigned long prot', 'int pkey']
 	case 4363: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pkey_mprotect_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[343];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pkey_mprotect_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_pkey_mprotect_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_pkey_mprotect_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4364 long sys_pkey_alloc ['unsigned long flags', 'unsigned long init_val']
 	case 4364: {
+		sub = syscall_sub_linux_mips[344];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pkey_alloc_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pkey_alloc_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pkey_alloc_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_pkey_alloc_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4365 long sys_pkey_free ['int pkey']
 	case 4365: {
+		sub = syscall_sub_linux_mips[345];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pkey_free_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pkey_free_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_pkey_free_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_pkey_free_enter, cpu, pc, arg0);
 	}; break;
 	// 4366 long sys_statx ['int dfd', 'const char __user *path', 'unsigned flags', 'unsigned mask', 'struct statx __user *buffer']
 	case 4366: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_statx_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_statx_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[346];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_statx_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_statx_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4367 long sys_rseq ['struct rseq __user *rseq', 'uint32_t rseq_len', 'int flags', 'uint32_t sig']
 	case 4367: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rseq_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[347];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rseq_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_rseq_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rseq_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4368 long sys_io_pgetevents_time32 ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct old_timespec32 __user *timeout', 'const struct __aio_sigset *sig']
 	case 4368: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_pgetevents_time32_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_io_pgetevents_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[348];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_pgetevents_time32_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_pgetevents_time32_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4393 long sys_semget ['key_t key', 'int nsems', 'int semflg']
 	case 4393: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_semget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[349];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_semget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_semget_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_semget_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4394 long sys_semctl ['int semid', 'int semnum', 'int cmd', 'unsigned long arg']
 	case 4394: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_semctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[350];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_semctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_semctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_semctl_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4395 long sys_shmget ['key_t key', 'size_t size', 'int flag']
 	case 4395: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shmget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[351];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shmget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_shmget_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_shmget_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4396 long sys_shmctl ['int shmid', 'int cmd', 'struct shmid_ds __user *buf']
 	case 4396: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shmctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[352];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shmctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_shmctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_shmctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4397 long sys_shmat ['int shmid', 'char __user *shmaddr', 'int shmflg']
 	case 4397: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shmat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[353];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shmat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_shmat_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_shmat_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4398 long sys_shmdt ['char __user *shmaddr']
 	case 4398: {
+		sub = syscall_sub_linux_mips[354];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_shmdt_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_shmdt_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_shmdt_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_sys_shmdt_enter, cpu, pc, arg0);
 	}; break;
 	// 4399 long sys_msgget ['key_t key', 'int msgflg']
 	case 4399: {
+		sub = syscall_sub_linux_mips[355];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msgget_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msgget_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_msgget_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_msgget_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4400 long sys_msgsnd ['int msqid', 'struct msgbuf __user *msgp', 'size_t msgsz', 'int msgflg']
 	case 4400: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msgsnd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[356];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msgsnd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_msgsnd_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_msgsnd_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4401 long sys_msgrcv ['int msqid', 'struct msgbuf __user *msgp', 'size_t msgsz', 'long msgtyp', 'int msgflg']
 	case 4401: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msgrcv_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_msgrcv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[357];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msgrcv_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_msgrcv_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4402 long sys_msgctl ['int msqid', 'int cmd', 'struct msqid_ds __user *buf']
 	case 4402: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_msgctl_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[358];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_msgctl_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_msgctl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_msgctl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4403 long sys_clock_gettime ['clockid_t which_clock', 'struct __kernel_timespec __user *tp']
 	case 4403: {
+		sub = syscall_sub_linux_mips[359];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_gettime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_gettime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4404 long sys_clock_settime ['clockid_t which_clock', 'const struct __kernel_timespec __user *tp']
 	case 4404: {
+		sub = syscall_sub_linux_mips[360];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_settime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_settime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_settime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_settime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4405 long sys_clock_adjtime ['clockid_t which_clock', 'struct __kernel_timex __user *tx']
 	case 4405: {
+		sub = syscall_sub_linux_mips[361];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_adjtime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_adjtime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4406 long sys_clock_getres ['clockid_t which_clock', 'struct __kernel_timespec __user *tp']
 	case 4406: {
+		sub = syscall_sub_linux_mips[362];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_getres_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_getres_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_getres_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_clock_getres_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4407 long sys_clock_nanosleep ['clockid_t which_clock', 'int flags', 'const struct __kernel_timespec __user *rqtp', 'struct __kernel_timespec __user *rmtp']
 	case 4407: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[363];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_clock_nanosleep_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_clock_nanosleep_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4408 long sys_timer_gettime ['timer_t timer_id', 'struct __kernel_itimerspec __user *setting']
 	case 4408: {
+		sub = syscall_sub_linux_mips[364];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_gettime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_timer_gettime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4409 long sys_timer_settime ['timer_t timer_id', 'int flags', 'const struct __kernel_itimerspec __user *new_setting', 'struct __kernel_itimerspec __user *old_setting']
 	case 4409: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timer_settime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[365];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timer_settime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timer_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_timer_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4410 long sys_timerfd_gettime ['int ufd', 'struct __kernel_itimerspec __user *otmr']
 	case 4410: {
+		sub = syscall_sub_linux_mips[366];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timerfd_gettime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_timerfd_gettime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4411 long sys_timerfd_settime ['int ufd', 'int flags', 'const struct __kernel_itimerspec __user *utmr', 'struct __kernel_itimerspec __user *otmr']
 	case 4411: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[367];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_timerfd_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_timerfd_settime_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4412 long sys_utimensat ['int dfd', 'const char __user *filename', 'struct __kernel_timespec __user *utimes', 'int flags']
 	case 4412: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_utimensat_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[368];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_utimensat_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_utimensat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_utimensat_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4413 long sys_pselect6 ['int', 'fd_set __user *', 'fd_set __user *', 'fd_set __user *', 'struct __kernel_timespec __user *', 'void __user *']
 	case 4413: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pselect6_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_pselect6_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[369];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pselect6_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pselect6_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4414 long sys_ppoll ['struct pollfd __user *', 'unsigned int', 'struct __kernel_timespec __user *', 'const sigset_t __user *', 'size_t']
 	case 4414: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_ppoll_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_ppoll_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[370];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_ppoll_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_ppoll_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4416 long sys_io_pgetevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct __kernel_timespec __user *timeout', 'const struct __aio_sigset *sig']
 	case 4416: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_pgetevents_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_io_pgetevents_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[371];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_pgetevents_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_pgetevents_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4417 long sys_recvmmsg ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags', 'struct __kernel_timespec __user *timeout']
 	case 4417: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_recvmmsg_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[372];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_recvmmsg_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4418 long sys_mq_timedsend ['mqd_t mqdes', 'const char __user *msg_ptr', 'size_t msg_len', 'unsigned int msg_prio', 'const struct __kernel_timespec __user *abs_timeout']
 	case 4418: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mq_timedsend_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[373];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mq_timedsend_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4419 long sys_mq_timedreceive ['mqd_t mqdes', 'char __user *msg_ptr', 'size_t msg_len', 'unsigned int __user *msg_prio', 'const struct __kernel_timespec __user *abs_timeout']
 	case 4419: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_mq_timedreceive_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[374];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_mq_timedreceive_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4420 long sys_semtimedop ['int semid', 'struct sembuf __user *sops', 'unsigned nsops', 'const struct __kernel_timespec __user *timeout']
 	case 4420: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_semtimedop_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[375];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_semtimedop_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_semtimedop_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_semtimedop_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4421 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct __kernel_timespec __user *uts', 'size_t sigsetsize']
 	case 4421: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[376];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_rt_sigtimedwait_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_rt_sigtimedwait_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4422 long sys_futex ['u32 __user *uaddr', 'int op', 'u32 val', 'struct __kernel_timespec __user *utime', 'u32 __user *uaddr2', 'u32 val3']
 	case 4422: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_futex_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_futex_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[377];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_futex_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_futex_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4423 long sys_sched_rr_get_interval ['pid_t pid', 'struct __kernel_timespec __user *interval']
 	case 4423: {
+		sub = syscall_sub_linux_mips[378];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_sched_rr_get_interval_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_sched_rr_get_interval_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4424 long sys_pidfd_send_signal ['int pidfd', 'int sig', 'siginfo_t __user *info', 'unsigned int flags']
 	case 4424: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pidfd_send_signal_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[379];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pidfd_send_signal_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pidfd_send_signal_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_pidfd_send_signal_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4425 long sys_io_uring_setup ['u32 entries', 'struct io_uring_params __user *p']
 	case 4425: {
+		sub = syscall_sub_linux_mips[380];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_uring_setup_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_uring_setup_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_uring_setup_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_io_uring_setup_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4426 long sys_io_uring_enter ['unsigned int fd', 'u32 to_submit', 'u32 min_complete', 'u32 flags', 'const sigset_t __user *sig', 'size_t sigsz']
 	case 4426: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_uring_enter_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_io_uring_enter_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		sub = syscall_sub_linux_mips[381];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_uring_enter_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+				memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_uring_enter_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
+		}
 	}; break;
 	// 4427 long sys_io_uring_register ['unsigned int fd', 'unsigned int op', 'void __user *arg', 'unsigned int nr_args']
 	case 4427: {
-		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_io_uring_register_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[382];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_io_uring_register_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_io_uring_register_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_io_uring_register_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4428 long sys_open_tree ['int dfd', 'const char __user *path', 'unsigned flags']
 	case 4428: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_open_tree_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[383];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_open_tree_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_open_tree_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_open_tree_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4429 long sys_move_mount ['int from_dfd', 'const char __user *from_path', 'int to_dfd', 'const char __user *to_path', 'unsigned int ms_flags']
 	case 4429: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_move_mount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
-		}
-		PPP_RUN_CB(on_sys_move_mount_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[384];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_move_mount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_move_mount_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4430 long sys_fsopen ['const char __user *fs_name', 'unsigned int flags']
 	case 4430: {
+		sub = syscall_sub_linux_mips[385];
+		if (!sub) return;
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fsopen_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fsopen_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fsopen_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_fsopen_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4431 long sys_fsconfig ['int fs_fd', 'unsigned int cmd', 'const char __user *key', 'const void __user *value', 'int aux']
 	case 4431: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fsconfig_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
-			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
-		}
-		PPP_RUN_CB(on_sys_fsconfig_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		sub = syscall_sub_linux_mips[386];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fsconfig_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+				memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_fsconfig_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
+		}
 	}; break;
 	// 4432 long sys_fsmount ['int fs_fd', 'unsigned int flags', 'unsigned int ms_flags']
 	case 4432: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fsmount_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[387];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fsmount_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fsmount_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fsmount_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4433 long sys_fspick ['int dfd', 'const char __user *path', 'unsigned int flags']
 	case 4433: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_fspick_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[388];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_fspick_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_fspick_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_fspick_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4434 long sys_pidfd_open ['pid_t pid', 'unsigned int flags']
 	case 4434: {
+		sub = syscall_sub_linux_mips[389];
+		if (!sub) return;
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pidfd_open_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pidfd_open_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pidfd_open_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_sys_pidfd_open_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 4437 long sys_openat2 ['int dfd', 'const char __user *filename', 'struct open_how *how', 'size_t size']
 	case 4437: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_openat2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[390];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_openat2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_openat2_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_openat2_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 4438 long sys_pidfd_getfd ['int pidfd', 'int fd', 'unsigned int flags']
 	case 4438: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_pidfd_getfd_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+		sub = syscall_sub_linux_mips[391];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_pidfd_getfd_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(int32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			}
+			PPP_RUN_CB(on_sys_pidfd_getfd_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_sys_pidfd_getfd_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 4439 long sys_faccessat2 ['int dfd', 'const char __user *filename', 'int mode', 'int flags']
 	case 4439: {
-		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_sys_faccessat2_return)))) {
-			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
-			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
-			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
-			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+		sub = syscall_sub_linux_mips[392];
+		if (!sub) return;
+		panda_noreturn = false;
+		if (sub & SYSCALL_SUB_ARGS) {
+			int32_t arg0 = get_s32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			int32_t arg2 = get_s32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			if (PPP_CHECK_CB(on_all_sys_enter2) ||
+				(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
+						PPP_CHECK_CB(on_sys_faccessat2_return)))) {
+				memcpy(ctx.args[0], &arg0, sizeof(int32_t));
+				memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+				memcpy(ctx.args[2], &arg2, sizeof(int32_t));
+				memcpy(ctx.args[3], &arg3, sizeof(int32_t));
+			}
+			PPP_RUN_CB(on_sys_faccessat2_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_sys_faccessat2_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	default:
+		sub = syscall_sub_linux_mips[393];
+		if (!sub) return;
 		panda_noreturn = false;
 		PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, ctx.no);
 	} // switch (ctx.no)
 
+	ctx.asid = panda_current_asid(cpu);
+	ctx.retaddr = calc_retaddr(cpu, pc);
+	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (sub & SYSCALL_SUB_RETURN) {
 		struct hook h;
 		h.addr = ctx.retaddr;
 		h.asid = ctx.asid;
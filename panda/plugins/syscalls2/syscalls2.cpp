@@ -762,6 +762,12 @@ extern const syscall_meta_t *syscall_meta;
  */
 context_map_t running_syscalls;
 
+/**
+ * @brief Whether the subscription bits of the generated enter switch are
+ * stale. Set by the PPP registration functions.
+ */
+bool syscalls_subscriptions_dirty = true;
+
 #if defined(SYSCALL_RETURN_DEBUG)
 /**
  * @brief Returns a string representation of a context_map_t container.
@@ -8,6 +8,26 @@ extern context_map_t running_syscalls;
 extern void (*hooks_add_hook)(struct hook*);
 void hook_syscall_return(CPUState *cpu, TranslationBlock* tb, struct hook* h);
 
+// Set whenever a syscall callback is registered or removed. The generated
+// enter switches then recompute which system calls anybody subscribed to.
+extern bool syscalls_subscriptions_dirty;
+
+enum {
+    SYSCALL_SUB_ENTER = 1,   // some callback runs on entry
+    SYSCALL_SUB_ARGS = 2,    // the arguments need to be read
+    SYSCALL_SUB_RETURN = 4,  // the return needs to be tracked
+};
+
+static inline uint8_t syscall_sub_bits(bool enter, bool enter_args,
+                                       bool ret, bool ret_args, bool noreturn) {
+    uint8_t sub = 0;
+    if (enter) sub |= SYSCALL_SUB_ENTER;
+    if (enter_args) sub |= SYSCALL_SUB_ENTER | SYSCALL_SUB_ARGS;
+    if (!noreturn && ret) sub |= SYSCALL_SUB_RETURN;
+    if (!noreturn && ret_args) sub |= SYSCALL_SUB_RETURN | SYSCALL_SUB_ARGS;
+    return sub;
+}
+
 // In generated, run the following to get this list
 // grep -hE '^.*syscall_(enter|return)_switch_[^(]*\(' *.cpp | sed 's/ {$/;/'
 void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc);
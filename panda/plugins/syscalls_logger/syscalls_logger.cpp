@@ -15,6 +15,7 @@ PANDAENDCOMMENT */
 #include <fstream>
 
 #include "panda/plugin.h"
+#include "panda/plog-cc.hpp"
 
 #include "syscalls2/syscalls_ext_typedefs.h"
 #include "syscalls2/syscalls2_info.h"
@@ -38,28 +39,15 @@ extern "C" {
 #define MAX_STRLEN 256
 #define STRUCT_RECURSION_LIMIT 256
 
-std::vector<void*> tmp_single_ptrs;
-std::vector<void*> tmp_double_ptrs;
 bool did_call_warning;
 
 // Read a string from guest memory
 int get_string(CPUState *cpu, target_ulong addr, uint8_t *buf) {
-    // determine strlen (upto max)
-    int len = 0;
-    uint8_t c;
-    while (len < MAX_STRLEN) {
-        int rv = panda_virtual_memory_read(cpu, addr + len, (uint8_t*) (&c), 1);
-        if (rv == -1) break;
-        if (c == 0) break;
-        len++;
-    }
-    if (len > 0) {
-        int rv = panda_virtual_memory_read(cpu, addr, (uint8_t*) buf, len);
-        buf[len] = 0;
-        for (int i = 0; i < len; i++)
-            if (!isprint(buf[i])) buf[i] = '.';
-        assert(rv != -1);
-    }
+    // buf holds MAX_STRLEN bytes, terminator included
+    int len = panda_virtual_memory_read_str(cpu, addr, (char*) buf, MAX_STRLEN);
+    if (len < 0) return 0;
+    for (int i = 0; i < len; i++)
+        if (!isprint(buf[i])) buf[i] = '.';
     return len;
 }
 
@@ -91,35 +79,22 @@ target_ulong get_ptr(CPUState *cpu, target_ulong addr) {
 }
 
 // Parse out primitive array buffers
-Panda__StructData* array_logger(ReadableDataType& rdt, PrimitiveVariant& data) {
+// Returns false if the array can't be logged, leaving sdata partly filled in
+bool array_logger(ReadableDataType& rdt, PrimitiveVariant& data, panda::StructData *sdata) {
 
     uint8_t* buf = std::get<uint8_t*>(data);
     int arr_size = rdt.get_arr_size();
 
     if (arr_size <= 0) {
-        return 0;
+        return false;
     }
 
-    Panda__StructData *sdata = (Panda__StructData*)malloc(sizeof(Panda__StructData));
-    assert(sdata != NULL);
-    tmp_single_ptrs.push_back(sdata);
-    *sdata = PANDA__STRUCT_DATA__INIT;
-
-    Panda__NamedData** members = (Panda__NamedData **)malloc(sizeof(Panda__NamedData *) * arr_size);
-    assert(members != NULL);
-    tmp_double_ptrs.push_back(members);
-    sdata->members = members;
-
     for (int i = 0; i < arr_size; i++) {
 
         uint8_t* data_ptr = buf + (i * rdt.arr_member_size_bytes);
 
-        Panda__NamedData *m = (Panda__NamedData *)malloc(sizeof(Panda__NamedData));
-        assert(m != NULL);
-        tmp_single_ptrs.push_back(m);
-
-        sdata->members[i] = m;
-        *m = PANDA__NAMED_DATA__INIT;
+        panda::NamedData *m = sdata->add_members();
+        m->set_arg_name("");
 
         switch (rdt.arr_member_type) {
             case DataType::BOOL:
@@ -127,37 +102,31 @@ Panda__StructData* array_logger(ReadableDataType& rdt, PrimitiveVariant& data) {
                 if (rdt.is_signed) {
                     switch (rdt.size_bytes) {
                         case sizeof(short int):
-                            m->i16 = *(short int*)data_ptr;
-                            m->has_i16 = true;
+                            m->set_i16(*(short int*)data_ptr);
                             break;
                         case sizeof(int):
-                            m->i32 = *(int*)data_ptr;
-                            m->has_i32 = true;
+                            m->set_i32(*(int*)data_ptr);
                             break;
                         case sizeof(long int):
-                            m->i64 = *(long int*)data_ptr;
-                            m->has_i64 = true;
+                            m->set_i64(*(long int*)data_ptr);
                             break;
                         default:
-                            return 0;
+                            return false;
                             break;
                     }
                 } else {
                     switch (rdt.size_bytes) {
                         case sizeof(short unsigned):
-                            m->u16 = *(short unsigned*)data_ptr;
-                            m->has_u16 = true;
+                            m->set_u16(*(short unsigned*)data_ptr);
                             break;
                         case sizeof(unsigned):
-                            m->u32 = *(unsigned*)data_ptr;
-                            m->has_u32 = true;
+                            m->set_u32(*(unsigned*)data_ptr);
                             break;
                         case sizeof(long unsigned):
-                            m->u64 = *(long unsigned*)data_ptr;
-                            m->has_u64 = true;
+                            m->set_u64(*(long unsigned*)data_ptr);
                             break;
                         default:
-                            return 0;
+                            return false;
                             break;
                     }
                 }
@@ -166,103 +135,88 @@ Panda__StructData* array_logger(ReadableDataType& rdt, PrimitiveVariant& data) {
             case DataType::FLOAT:
                 switch (rdt.size_bytes) {
                     case sizeof(float):
-                        m->float_val = *(float*)data_ptr;
-                        m->has_float_val = true;
+                        m->set_float_val(*(float*)data_ptr);
                         break;
                     case sizeof(double):
-                        m->double_val = *(float*)data_ptr;
-                        m->has_double_val = true;
+                        m->set_double_val(*(float*)data_ptr);
                         break;
                     default:
-                        return 0;
+                        return false;
                         break;
                 }
             default:
-                return 0;
+                return false;
                 break;
         }
     }
 
-    sdata->n_members = arr_size;
-    return sdata;
+    return true;
 }
 
 // Helper for struct_logger
-void set_data(Panda__NamedData* nd, ReadableDataType& rdt, PrimitiveVariant& data) {
+void set_data(panda::NamedData* nd, ReadableDataType& rdt, PrimitiveVariant& data) {
     switch (data.index()) {
         case VariantType::VT_BOOL:
-            nd->bool_val = std::get<bool>(data);
-            nd->has_bool_val = true;
+            nd->set_bool_val(std::get<bool>(data));
             break;
         case VariantType::VT_CHAR:
             {
                 static_assert(sizeof(char) == 1);
                 std::string char_str(1, std::get<char>(data));
-                nd->str = strdup(char_str.c_str());
+                nd->set_str(char_str.c_str());
             }
             break;
         case VariantType::VT_SHORT_INT:
             static_assert(sizeof(short int) == 2);
-            nd->i16 = std::get<short int>(data);
-            nd->has_i16 = true;
+            nd->set_i16(std::get<short int>(data));
             break;
         case VariantType::VT_INT:
             static_assert(sizeof(int) == 4);
-            nd->i32 = std::get<int>(data);
-            nd->has_i32 = true;
+            nd->set_i32(std::get<int>(data));
             break;
         case VariantType::VT_LONG_INT:
             static_assert(sizeof(long int) == 8);
-            nd->i64 = std::get<long int>(data);
-            nd->has_i64 = true;
+            nd->set_i64(std::get<long int>(data));
             break;
         case VariantType::VT_SHORT_UNSIGNED:
             static_assert(sizeof(short unsigned) == 2);
-            nd->u16 = std::get<short unsigned>(data);
-            nd->has_u16 = true;
+            nd->set_u16(std::get<short unsigned>(data));
             break;
         case VariantType::VT_UNSIGNED:
             static_assert(sizeof(unsigned) == 4);
-            nd->u32 = std::get<unsigned>(data);
-            nd->has_u32 = true;
+            nd->set_u32(std::get<unsigned>(data));
             break;
         case VariantType::VT_LONG_UNSIGNED:
             static_assert(sizeof(long unsigned) == 8);
-            nd->u64 = std::get<long unsigned>(data);
-            nd->has_u64 = true;
+            nd->set_u64(std::get<long unsigned>(data));
             break;
         case VariantType::VT_FLOAT:
-            nd->float_val = std::get<float>(data);
-            nd->has_float_val = true;
+            nd->set_float_val(std::get<float>(data));
             break;
         case VariantType::VT_DOUBLE:
-            nd->double_val = std::get<double>(data);
-            nd->has_double_val = true;
+            nd->set_double_val(std::get<double>(data));
             break;
         case VariantType::VT_LONG_DOUBLE:
-            nd->double_val = (double)std::get<long double>(data);
-            nd->has_double_val = true;
+            nd->set_double_val((double)std::get<long double>(data));
             std::cerr << "[WARNING] syscalls_logger: casting long double to double (only latter supported by protobuf)" << std::endl;
             break;
         case VariantType::VT_UINT8_T_PTR:
         {
             char* str_ptr = (char *)std::get<uint8_t*>(data);
             if ((rdt.type == DataType::ARRAY) && (rdt.arr_member_type == DataType::CHAR) && check_str(str_ptr)) {
-                nd->str = strdup(str_ptr);
+                nd->set_str(str_ptr);
                 return;
             } else if ((rdt.type == DataType::ARRAY) && (rdt.arr_member_type != DataType::CHAR)) {
-                auto sdata = array_logger(rdt, data);
-                if (sdata) {
-                    nd->struct_type = strdup("ArrayOfPrimitive");
-                    nd->struct_data = sdata;
+                if (array_logger(rdt, data, nd->mutable_struct_data())) {
+                    nd->set_struct_type("ArrayOfPrimitive");
                     return;
                 }
+                nd->clear_struct_data();
             }
 
             assert(rdt.type != DataType::STRUCT);
             // TODO: how to convert to protobuf bytes? This is a host pointer, not helpful
-            nd->ptr = (uint64_t)std::get<uint8_t*>(data);
-            nd->has_ptr = true;
+            nd->set_ptr((uint64_t)std::get<uint8_t*>(data));
             break;
         }
         default:
@@ -273,32 +227,17 @@ void set_data(Panda__NamedData* nd, ReadableDataType& rdt, PrimitiveVariant& dat
 
 // TODO: reduce code repetition in recursive cases
 // Recursively read struct information for PANDALOG, using DWARF layout information
-Panda__StructData* struct_logger(CPUState *cpu, target_ulong saddr, StructDef& sdef, int recursion_limit) {
+void struct_logger(CPUState *cpu, target_ulong saddr, StructDef& sdef, int recursion_limit, panda::StructData *sdata) {
 
     int mcount = sdef.members.size();
     bool null_ptr_err = (saddr == 0);
 
-    Panda__StructData *sdata = (Panda__StructData*)malloc(sizeof(Panda__StructData));
-    assert(sdata != NULL);
-    tmp_single_ptrs.push_back(sdata);
-    *sdata = PANDA__STRUCT_DATA__INIT;
-
-    Panda__NamedData** members = (Panda__NamedData **)malloc(sizeof(Panda__NamedData *) * mcount);
-    assert(members != NULL);
-    tmp_double_ptrs.push_back(members);
-    sdata->members = members;
-
     for (int i = 0; i < mcount; i++) {
 
         ReadableDataType mdef = sdef.members[i];
         target_ulong maddr = saddr + mdef.offset_bytes;
-        Panda__NamedData *m = (Panda__NamedData *)malloc(sizeof(Panda__NamedData));
-        assert(m != NULL);
-        tmp_single_ptrs.push_back(m);
-
-        sdata->members[i] = m;
-        *m = PANDA__NAMED_DATA__INIT;
-        m->arg_name = strdup(mdef.name.c_str());
+        panda::NamedData *m = sdata->add_members();
+        m->set_arg_name(mdef.name.c_str());
 
         if (log_verbose) {
             std::cout << "[INFO] syscalls_logger: loading struct " << sdef.name
@@ -312,13 +251,13 @@ Panda__StructData* struct_logger(CPUState *cpu, target_ulong saddr, StructDef& s
             auto it = struct_hashtable.find(mdef.struct_name);
 
             if ((recursion_limit > 0) && it != struct_hashtable.end() && (sdef.name.compare(mdef.struct_name) != 0)) {
-                m->struct_type = strdup(mdef.struct_name.c_str());
-                m->struct_data = struct_logger(cpu, maddr, it->second, (recursion_limit - 1));
+                m->set_struct_type(mdef.struct_name.c_str());
+                struct_logger(cpu, maddr, it->second, (recursion_limit - 1), m->mutable_struct_data());
             } else {
                 if (null_ptr_err) {
-                    m->str = strdup("{read failed, SC2 returned a NULL pointer (bug)}");
+                    m->set_str("{read failed, SC2 returned a NULL pointer (bug)}");
                 } else {
-                    m->str = strdup("{read failed, unknown embedded struct}");
+                    m->set_str("{read failed, unknown embedded struct}");
                 }
             }
 
@@ -329,13 +268,13 @@ Panda__StructData* struct_logger(CPUState *cpu, target_ulong saddr, StructDef& s
             target_ulong addr = get_ptr(cpu, maddr);
 
             if ((recursion_limit > 0) && (it != struct_hashtable.end()) && (addr != 0) && (sdef.name.compare(mdef.struct_name) != 0)) {
-                m->struct_type = strdup(mdef.struct_name.c_str());
-                m->struct_data = struct_logger(cpu, addr, it->second, (recursion_limit - 1));
+                m->set_struct_type(mdef.struct_name.c_str());
+                struct_logger(cpu, addr, it->second, (recursion_limit - 1), m->mutable_struct_data());
             } else {
                 if (null_ptr_err) {
-                    m->str = strdup("{read failed, SC2 returned a NULL pointer (bug)}");
+                    m->set_str("{read failed, SC2 returned a NULL pointer (bug)}");
                 } else {
-                    m->str = strdup("{read failed, unknown struct ptr}");
+                    m->set_str("{read failed, unknown struct ptr}");
                 }
             }
 
@@ -351,13 +290,13 @@ Panda__StructData* struct_logger(CPUState *cpu, target_ulong saddr, StructDef& s
             }
 
             if ((recursion_limit > 0) && (it != struct_hashtable.end()) && (addr_2 != 0) && (sdef.name.compare(mdef.struct_name) != 0)) {
-                m->struct_type = strdup(mdef.struct_name.c_str());
-                m->struct_data = struct_logger(cpu, addr_2, it->second, (recursion_limit - 1));
+                m->set_struct_type(mdef.struct_name.c_str());
+                struct_logger(cpu, addr_2, it->second, (recursion_limit - 1), m->mutable_struct_data());
             } else {
                 if (null_ptr_err) {
-                    m->str = strdup("{read failed, SC2 returned a NULL pointer (bug)}");
+                    m->set_str("{read failed, SC2 returned a NULL pointer (bug)}");
                 } else {
-                    m->str = strdup("{read failed, unknown struct double ptr}");
+                    m->set_str("{read failed, unknown struct double ptr}");
                 }
             }
 
@@ -371,16 +310,14 @@ Panda__StructData* struct_logger(CPUState *cpu, target_ulong saddr, StructDef& s
                 set_data(m, mdef, data);
             } else {
                 if (null_ptr_err) {
-                    m->str = strdup("{read failed, SC2 returned a NULL pointer (bug)}");
+                    m->set_str("{read failed, SC2 returned a NULL pointer (bug)}");
                 } else {
-                    m->str = strdup("{read failed, unknown data}");
+                    m->set_str("{read failed, unknown data}");
                 }
             }
         }
     }
 
-    sdata->n_members = mcount;
-    return sdata;
 }
 
 // Log arguments for every system call
@@ -410,24 +347,20 @@ void sys_return(CPUState *cpu, target_ulong pc, const syscall_info_t *call, cons
 
     if (pandalog) {
 
-        Panda__Syscall psyscall;
-        psyscall = PANDA__SYSCALL__INIT;
-        psyscall.pid = current->pid;
-        psyscall.ppid = current->ppid;
-        psyscall.tid = othread->tid;
-        psyscall.retcode = get_syscall_retval(cpu);
-        psyscall.create_time = current->create_time;
-        psyscall.call_name = strdup(call->name);
-        psyscall.args = (Panda__NamedData **)malloc(sizeof(Panda__NamedData *) * call->nargs);
-        assert(psyscall.args != NULL);
+        // allocated from the pandalog's arena, along with everything in it
+        panda::LogEntry *ple = globalLog.new_entry();
+        panda::Syscall *psyscall = ple->mutable_syscall();
+        psyscall->set_pid(current->pid);
+        psyscall->set_ppid(current->ppid);
+        psyscall->set_tid(othread->tid);
+        psyscall->set_retcode(get_syscall_retval(cpu));
+        psyscall->set_create_time(current->create_time);
+        psyscall->set_call_name(call->name);
 
         for (int i = 0; i < call->nargs; i++) {
 
-            Panda__NamedData *sa = (Panda__NamedData *)malloc(sizeof(Panda__NamedData));
-            assert(sa != NULL);
-            psyscall.args[i] = sa;
-            *sa = PANDA__NAMED_DATA__INIT;
-            sa->arg_name = strdup(call->argn[i]);
+            panda::NamedData *sa = psyscall->add_args();
+            sa->set_arg_name(call->argn[i]);
             switch (call->argt[i]) {
 
                 case SYSCALL_ARG_STR_PTR:
@@ -435,10 +368,10 @@ void sys_return(CPUState *cpu, target_ulong pc, const syscall_info_t *call, cons
                     target_ulong addr = *((target_ulong *)rp->args[i]);
                     int len = get_string(cpu, addr, buf);
                     if (len > 0) {
-                        sa->str = strdup((const char *) buf);
+                        sa->set_str((const char *) buf);
                     }
                     else {
-                        sa->str = strdup("n/a");
+                        sa->set_str("n/a");
                     }
                     //sa->has_str = true;
                     break;
@@ -461,8 +394,8 @@ void sys_return(CPUState *cpu, target_ulong pc, const syscall_info_t *call, cons
                                 << std::endl;
                         }
 
-                        sa->struct_type = strdup(call->argtn[i]);
-                        sa->struct_data = struct_logger(cpu, ptr_val, sdef, STRUCT_RECURSION_LIMIT);
+                        sa->set_struct_type(call->argtn[i]);
+                        struct_logger(cpu, ptr_val, sdef, STRUCT_RECURSION_LIMIT, sa->mutable_struct_data());
                     } else {
 
                         if (log_verbose) {
@@ -471,46 +404,38 @@ void sys_return(CPUState *cpu, target_ulong pc, const syscall_info_t *call, cons
                                 << std::endl;
                         }
 
-                        sa->ptr = (uint64_t)ptr_val;
-                        sa->has_ptr = true;
+                        sa->set_ptr((uint64_t)ptr_val);
                     }
 
                     break;
                 }
 
                 case SYSCALL_ARG_BUF_PTR:
-                    sa->ptr = (uint64_t) *((target_ulong *) rp->args[i]);
-                    sa->has_ptr = true;
+                    sa->set_ptr((uint64_t) *((target_ulong *) rp->args[i]));
                     break;
 
                 case SYSCALL_ARG_U64:
-                    sa->u64 = (uint64_t) *((target_ulong *) rp->args[i]);
-                    sa->has_u64 = true;
+                    sa->set_u64((uint64_t) *((target_ulong *) rp->args[i]));
                     break;
 
                 case SYSCALL_ARG_U32:
-                    sa->u32 = *((uint32_t *) rp->args[i]);
-                    sa->has_u32 = true;
+                    sa->set_u32(*((uint32_t *) rp->args[i]));
                     break;
 
                 case SYSCALL_ARG_U16:
-                    sa->u16 = (uint32_t) *((uint16_t *) rp->args[i]);
-                    sa->has_u16 = true;
+                    sa->set_u16((uint32_t) *((uint16_t *) rp->args[i]));
                     break;
 
                 case SYSCALL_ARG_S64:
-                    sa->i64 = *((int64_t *) rp->args[i]);
-                    sa->has_i64 = true;
+                    sa->set_i64(*((int64_t *) rp->args[i]));
                     break;
 
                 case SYSCALL_ARG_S32:
-                    sa->i32 = *((int32_t *) rp->args[i]);
-                    sa->has_i32 = true;
+                    sa->set_i32(*((int32_t *) rp->args[i]));
                     break;
 
                 case SYSCALL_ARG_S16:
-                    sa->i16 = (int32_t) *((int16_t *) rp->args[i]);
-                    sa->has_i16 = true;
+                    sa->set_i16((int32_t) *((int16_t *) rp->args[i]));
                     break;
 
                 default:
@@ -519,27 +444,8 @@ void sys_return(CPUState *cpu, target_ulong pc, const syscall_info_t *call, cons
             }
         }
 
-        psyscall.n_args = call->nargs;
-        Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
-        ple.syscall = &psyscall;
-        ple.has_asid = true;
-        ple.asid = current->asid;
-        pandalog_write_entry(&ple);
-
-        for (auto ptr : tmp_single_ptrs) {
-            free(ptr);
-        }
-        tmp_single_ptrs.clear();
-
-        for (auto ptr : tmp_double_ptrs) {
-            free(ptr);
-        }
-        tmp_double_ptrs.clear();
-
-        for (int i = 0; i < call->nargs; i++) {
-            free(psyscall.args[i]);
-        }
-        free(psyscall.args);
+        ple->set_asid(current->asid);
+        globalLog.write_entry(ple);
 
     } else {
 
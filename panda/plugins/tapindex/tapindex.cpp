@@ -39,6 +39,7 @@ extern "C" {
 
 #include "callstack_instr/prog_point.h"           // use the prog_point.h from callstack_instr, any way the plugin is dependent on callstack_instr
 #include "callstack_instr/callstack_instr_ext.h" // for init api, any way the plugin is dependent on callstack_instr
+#include "callstack_instr/prog_point_table.h"
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -64,8 +65,8 @@ struct prog_point
     }
 };*/
 
-std::map<prog_point, target_ulong> read_tracker;
-std::map<prog_point, target_ulong> write_tracker;
+ProgPointTable<target_ulong> read_tracker;
+ProgPointTable<target_ulong> write_tracker;
 FILE *read_index;
 FILE *write_index;
 
@@ -148,11 +149,10 @@ void uninit_plugin(void *self)
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, read_index);
 
     // Save reads
-    std::map<prog_point, target_ulong>::iterator it;
-    for (it = read_tracker.begin(); it != read_tracker.end(); it++)
+    for (auto &it : read_tracker.sorted())
     {
-        fwrite(&it->first, sizeof(prog_point), 1, read_index);
-        fwrite(&it->second, sizeof(target_ulong), 1, read_index);
+        fwrite(it.first, sizeof(prog_point), 1, read_index);
+        fwrite(it.second, sizeof(target_ulong), 1, read_index);
     }
     fclose(read_index);
 
@@ -160,10 +160,10 @@ void uninit_plugin(void *self)
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, write_index);
 
     // Save writes
-    for (it = write_tracker.begin(); it != write_tracker.end(); it++)
+    for (auto &it : write_tracker.sorted())
     {
-        fwrite(&it->first, sizeof(prog_point), 1, write_index);
-        fwrite(&it->second, sizeof(target_ulong), 1, write_index);
+        fwrite(it.first, sizeof(prog_point), 1, write_index);
+        fwrite(it.second, sizeof(target_ulong), 1, write_index);
     }
     fclose(write_index);
 }
\ No newline at end of file
@@ -25,6 +25,7 @@ PANDAENDCOMMENT */
 
 #include "../callstack_instr/callstack_instr.h"
 #include "../callstack_instr/callstack_instr_ext.h"
+#include "../callstack_instr/prog_point_table.h"
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -39,12 +40,12 @@ struct text_counter {
     std::map<uint8_t,unsigned int> hist;
 };
 
-std::map<prog_point,text_counter> read_tracker;
-std::map<prog_point,text_counter> write_tracker;
+ProgPointTable<text_counter> read_tracker;
+ProgPointTable<text_counter> write_tracker;
 
 static void mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                          size_t size, uint8_t *buf,
-                         std::map<prog_point, text_counter> &tracker) {
+                         ProgPointTable<text_counter> &tracker) {
     prog_point p = {};
 
     get_prog_point(env, &p);
@@ -91,27 +92,26 @@ bool init_plugin(void *self) {
     return true;
 }
 
-void write_report(FILE *report, std::map<prog_point,text_counter> &tracker) {
+void write_report(FILE *report, ProgPointTable<text_counter> &tracker) {
     // Cross platform support: need to know how big a target_ulong is
     uint32_t target_ulong_size = sizeof(target_ulong);
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, report);
     uint32_t stack_type_size = sizeof(stack_type);
     fwrite(&stack_type_size, sizeof(uint32_t), 1, report);
 
-    std::map<prog_point,text_counter>::iterator it;
-    for(it = tracker.begin(); it != tracker.end(); it++) {
+    for (auto &it : tracker.sorted()) {
         // prog_point parts
-        fwrite(&it->first.stackKind, stack_type_size, 1, report);
-        fwrite(&it->first.caller, target_ulong_size, 1, report);
-        fwrite(&it->first.pc, target_ulong_size, 1, report);
-        fwrite(&it->first.sidFirst, target_ulong_size, 1, report);
-        fwrite(&it->first.sidSecond, target_ulong_size, 1, report);
-        fwrite(&it->first.isKernelMode, sizeof(bool), 1, report);
+        fwrite(&it.first->stackKind, stack_type_size, 1, report);
+        fwrite(&it.first->caller, target_ulong_size, 1, report);
+        fwrite(&it.first->pc, target_ulong_size, 1, report);
+        fwrite(&it.first->sidFirst, target_ulong_size, 1, report);
+        fwrite(&it.first->sidSecond, target_ulong_size, 1, report);
+        fwrite(&it.first->isKernelMode, sizeof(bool), 1, report);
 
         unsigned int hist[256] = {};
         for(int i = 0; i < 256; i++) {
-            if (it->second.hist.find(i) != it->second.hist.end())
-                hist[i] = it->second.hist[i];
+            if (it.second->hist.find(i) != it.second->hist.end())
+                hist[i] = it.second->hist[i];
         }
         fwrite(hist, sizeof(hist), 1, report);
     }
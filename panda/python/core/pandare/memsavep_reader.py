@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+'''
+Reads the incremental memory dumps of the memsavep plugin (its `instrcounts`
+and `every` arguments).
+
+Such a dump is made of three files:
+
+    <file>          raw image of physical memory at the first point
+    <file>.delta    pages written between points, back to back
+    <file>.idx      index of the points and of the data in <file>.delta
+
+The index starts with a 24-byte header:
+
+    char[8] "PANDAMSI", u32 version, u32 page size, u64 memory size
+
+followed by one record per point: u64 instruction count, u64 number of
+ranges, and that many (u64 physical address, u64 length, u64 offset in
+<file>.delta) ranges, sorted by address. The first record is the base image
+and has no ranges. All integers are little-endian.
+
+The memory at point k is the base image overlaid with the ranges of points
+1 to k, in order. This module reads it lazily, through mmaps of the files:
+
+    with MemsavepReader('memsavep.raw') as msr:
+        print(msr.points)
+        data = msr.read(3, 0x1000, 4096)
+        msr.write_image(3, 'point3.raw')
+
+Run `python -m pandare.memsavep_reader memsavep.raw point out.raw` to
+reconstruct the full image of a point.
+'''
+
+import bisect
+import mmap
+import os
+import struct
+
+_MAGIC = b'PANDAMSI'
+_HEADER = struct.Struct('<8sIIQ')
+_POINT = struct.Struct('<QQ')
+_RANGE = struct.Struct('<QQQ')
+
+def _mmap(path):
+    with open(path, 'rb') as f:
+        if os.fstat(f.fileno()).st_size == 0:
+            return b''
+        return mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+class MemsavepReader:
+    '''
+    Incremental memsavep dump whose base image is `fn`. `points` is the list
+    of instruction counts at which memory was saved.
+    '''
+    def __init__(self, fn):
+        with open(fn + '.idx', 'rb') as f:
+            idx = f.read()
+        magic, self.version, self.page_size, self.size = _HEADER.unpack_from(idx, 0)
+        if magic != _MAGIC:
+            raise ValueError('%s.idx is not a memsavep index' % fn)
+
+        self.points = []
+        self._starts = []   # per point, sorted start addresses of its ranges
+        self._ranges = []   # per point, (addr, len, offset) tuples
+        pos = _HEADER.size
+        # a point being written when the replay stopped may be truncated
+        while pos + _POINT.size <= len(idx):
+            instr, n = _POINT.unpack_from(idx, pos)
+            pos += _POINT.size
+            if pos + n * _RANGE.size > len(idx):
+                break
+            ranges = [_RANGE.unpack_from(idx, pos + i * _RANGE.size) for i in range(n)]
+            pos += n * _RANGE.size
+            self.points.append(instr)
+            self._starts.append([r[0] for r in ranges])
+            self._ranges.append(ranges)
+
+        self.base = _mmap(fn)
+        self.delta = _mmap(fn + '.delta')
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.close()
+
+    def close(self):
+        for m in (self.base, self.delta):
+            if isinstance(m, mmap.mmap):
+                m.close()
+        self.base = self.delta = None
+
+    def _lookup(self, point, addr):
+        # Returns (buffer, offset, length) of the newest copy of addr as of
+        # point; length is how far that copy extends.
+        for k in range(point, 0, -1):
+            i = bisect.bisect_right(self._starts[k], addr) - 1
+            if i >= 0:
+                start, length, offset = self._ranges[k][i]
+                if addr < start + length:
+                    return self.delta, offset + addr - start, start + length - addr
+        return self.base, addr, self.page_size - addr % self.page_size
+
+    def read(self, point, addr, size):
+        '''
+        Returns size bytes of physical memory at addr, as they were at the
+        point with index point.
+        '''
+        if addr + size > self.size:
+            raise ValueError('read past the end of memory')
+        out = bytearray()
+        while size > 0:
+            buf, off, avail = self._lookup(point, addr)
+            # a later point may have a copy of the next page
+            n = min(size, avail, self.page_size - addr % self.page_size)
+            out += buf[off:off + n]
+            addr += n
+            size -= n
+        return bytes(out)
+
+    def write_image(self, point, out_fn):
+        '''
+        Writes the full raw image of memory at the point with index point
+        to out_fn.
+        '''
+        with open(out_fn, 'wb') as out:
+            out.write(self.base)
+            for k in range(1, point + 1):
+                for addr, length, offset in self._ranges[k]:
+                    out.seek(addr)
+                    out.write(self.delta[offset:offset + length])
+
+if __name__ == "__main__":
+    import sys
+    with MemsavepReader(sys.argv[1]) as msr:
+        if len(sys.argv) < 4:
+            for i, instr in enumerate(msr.points):
+                print('%d: instr %d, %d ranges' % (i, instr, len(msr._ranges[i])))
+        else:
+            msr.write_image(int(sys.argv[2]), sys.argv[3])
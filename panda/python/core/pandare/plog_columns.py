@@ -0,0 +1,360 @@
+#!/usr/bin/env python3
+'''
+Columnar export of PANDAlog (plog) files.
+
+Aggregating over a plog means parsing every protobuf `LogEntry` in it. This
+module converts a plog, once, into one table per kind of entry (the `LogEntry`
+field a plugin sets, e.g. `syscall` or `tainted_branch`), stored column by
+column, so that later jobs only read the columns they use.
+
+Run `python -m pandare.plog_columns input.plog output_dir` to convert a log.
+
+Layout of the output directory:
+
+    index.json              {"tables": {name: row count, ...}}
+    <table>/schema.json     column names, types and files
+    <table>/<column>.bin    column data
+
+Every table has `instr` and `pc` columns, and rows are sorted by `instr`.
+Fields of nested messages are flattened into columns with dotted names
+(`a.b.c`). Repeated fields are stored as JSON text. Column types are:
+
+* `i32`, `i64`, `u32`, `u64`, `f32`, `f64`, `bool`: little-endian arrays,
+  one value per row, readable with e.g. `numpy.fromfile`.
+* `str`, `bytes`, `json`: the concatenated values in `<column>.bin`, and
+  `rows + 1` u64 offsets into it in `<column>.off`.
+
+A column that isn't set in every row also has a `<column>.valid` file with
+one byte per row, 0 where the value is missing. Missing values are stored as
+0 or empty.
+
+Entries written outside of the replay have instr == 2**64 - 1 and are at the
+end of each table.
+'''
+
+import array
+import base64
+import bisect
+import json
+import os
+import pickle
+import sys
+import tempfile
+
+from google.protobuf.descriptor import FieldDescriptor
+from google.protobuf.json_format import MessageToDict
+
+from pandare.plog_reader import PLogReader, NO_INSTR
+
+# array typecodes for fixed-width column types
+_TYPECODES = {'i32': 'i', 'i64': 'q', 'u32': 'I', 'u64': 'Q',
+              'f32': 'f', 'f64': 'd', 'bool': 'B'}
+_VARWIDTH = ('str', 'bytes', 'json')
+
+_FD = FieldDescriptor
+_DTYPES = {
+    _FD.TYPE_INT32: 'i32', _FD.TYPE_SINT32: 'i32', _FD.TYPE_SFIXED32: 'i32',
+    _FD.TYPE_ENUM: 'i32',
+    _FD.TYPE_INT64: 'i64', _FD.TYPE_SINT64: 'i64', _FD.TYPE_SFIXED64: 'i64',
+    _FD.TYPE_UINT32: 'u32', _FD.TYPE_FIXED32: 'u32',
+    _FD.TYPE_UINT64: 'u64', _FD.TYPE_FIXED64: 'u64',
+    _FD.TYPE_FLOAT: 'f32', _FD.TYPE_DOUBLE: 'f64', _FD.TYPE_BOOL: 'bool',
+    _FD.TYPE_STRING: 'str', _FD.TYPE_BYTES: 'bytes',
+}
+
+# flush column buffers to disk past this many bytes
+_FLUSH_SIZE = 1 << 20
+
+def _is_repeated(fd):
+    # newer protobuf releases replace label with is_repeated
+    if hasattr(fd, 'is_repeated'):
+        return fd.is_repeated
+    return fd.label == _FD.LABEL_REPEATED
+
+def _repeated_json(fd, values):
+    if fd.type == _FD.TYPE_MESSAGE:
+        return [MessageToDict(v, preserving_proto_field_name=True) for v in values]
+    if fd.type == _FD.TYPE_BYTES:
+        return [base64.b64encode(v).decode() for v in values]
+    return list(values)
+
+def _flatten(msg, prefix, row):
+    for fd, val in msg.ListFields():
+        name = prefix + fd.name
+        if _is_repeated(fd):
+            row[name] = ('json', json.dumps(_repeated_json(fd, val)))
+        elif fd.type == _FD.TYPE_MESSAGE:
+            _flatten(val, name + '.', row)
+        else:
+            row[name] = (_DTYPES[fd.type], val)
+
+def entry_rows(entry):
+    '''
+    Yields (table name, {column: (type, value)}) for each field set in a
+    LogEntry, other than instr and pc.
+    '''
+    for fd, val in entry.ListFields():
+        if fd.name in ('instr', 'pc'):
+            continue
+        row = {}
+        if _is_repeated(fd):
+            row['value'] = ('json', json.dumps(_repeated_json(fd, val)))
+        elif fd.type == _FD.TYPE_MESSAGE:
+            _flatten(val, '', row)
+        else:
+            row['value'] = (_DTYPES[fd.type], val)
+        # don't clash with the key columns
+        for key in ('instr', 'pc'):
+            if key in row:
+                row[fd.name + '.' + key] = row.pop(key)
+        yield fd.name, row
+
+def _write_zeros(f, size):
+    zeros = bytes(min(size, _FLUSH_SIZE))
+    while size > 0:
+        f.write(zeros[:size])
+        size -= len(zeros)
+
+class _ColumnWriter:
+    # A column first seen at row nrows starts with nrows missing values,
+    # which are written out right away. The validity bytes are written along
+    # with the data, and the file is dropped if no value is missing.
+    def __init__(self, table_dir, name, dtype, nrows):
+        self.name = name
+        self.dtype = dtype
+        self.data = open(os.path.join(table_dir, name + '.bin'), 'wb')
+        self.valid_path = os.path.join(table_dir, name + '.valid')
+        self.valid_file = open(self.valid_path, 'wb')
+        _write_zeros(self.valid_file, nrows)
+        self.valid = bytearray()
+        self.missing = nrows
+        if dtype in _VARWIDTH:
+            self.buf = bytearray()
+            self.offsets = array.array('Q')
+            self.off_file = open(os.path.join(table_dir, name + '.off'), 'wb')
+            _write_zeros(self.off_file, (nrows + 1) * self.offsets.itemsize)
+        else:
+            self.buf = array.array(_TYPECODES[dtype])
+            self.offsets = None
+            _write_zeros(self.data, nrows * self.buf.itemsize)
+        self.end = 0
+
+    def append(self, value):
+        self.valid.append(1)
+        if self.offsets is not None:
+            if self.dtype != 'bytes':
+                value = value.encode()
+            self.buf += value
+            self.end += len(value)
+            self.offsets.append(self.end)
+        else:
+            self.buf.append(value)
+        self._maybe_flush()
+
+    def append_null(self):
+        self.valid.append(0)
+        self.missing += 1
+        if self.offsets is not None:
+            self.offsets.append(self.end)
+        else:
+            self.buf.append(0)
+        self._maybe_flush()
+
+    def _maybe_flush(self):
+        # count everything buffered, so that columns of empty strings flush too
+        size = len(self.valid)
+        if self.offsets is not None:
+            size += len(self.buf) + len(self.offsets) * self.offsets.itemsize
+        else:
+            size += len(self.buf) * self.buf.itemsize
+        if size >= _FLUSH_SIZE:
+            self.flush()
+
+    def flush(self):
+        self.valid_file.write(self.valid)
+        self.valid = bytearray()
+        if self.offsets is not None:
+            self.data.write(self.buf)
+            self.buf = bytearray()
+            _write_array(self.off_file, self.offsets)
+            self.offsets = array.array('Q')
+        else:
+            _write_array(self.data, self.buf)
+            self.buf = array.array(self.buf.typecode)
+
+    def close(self, table_dir):
+        self.flush()
+        self.data.close()
+        desc = {'name': self.name, 'type': self.dtype, 'data': self.name + '.bin'}
+        if self.dtype in _VARWIDTH:
+            self.off_file.close()
+            desc['offsets'] = self.name + '.off'
+        self.valid_file.close()
+        if self.missing:
+            desc['valid'] = self.name + '.valid'
+        else:
+            os.unlink(self.valid_path)
+        return desc
+
+def _write_array(f, a):
+    if sys.byteorder != 'little':
+        a = array.array(a.typecode, a)
+        a.byteswap()
+    a.tofile(f)
+
+class _TableWriter:
+    def __init__(self, out_dir, name):
+        self.name = name
+        self.dir = os.path.join(out_dir, name)
+        os.makedirs(self.dir, exist_ok=True)
+        self.rows = 0
+        self.columns = {key: _ColumnWriter(self.dir, key, 'u64', 0)
+                        for key in ('instr', 'pc')}
+
+    def add_row(self, instr, pc, row):
+        row['instr'] = ('u64', instr)
+        row['pc'] = ('u64', pc)
+        for name, (dtype, value) in row.items():
+            if name not in self.columns:
+                self.columns[name] = _ColumnWriter(self.dir, name, dtype, self.rows)
+        for name, col in self.columns.items():
+            if name in row:
+                col.append(row[name][1])
+            else:
+                col.append_null()
+        self.rows += 1
+
+    def close(self):
+        schema = {'name': self.name, 'rows': self.rows, 'sorted_by': 'instr',
+                  'columns': [c.close(self.dir) for c in self.columns.values()]}
+        with open(os.path.join(self.dir, 'schema.json'), 'w') as f:
+            json.dump(schema, f, indent=1)
+
+def export(plog, out_dir, tables=None, threads=0):
+    '''
+    Converts plog into one columnar table per kind of entry in out_dir. If
+    tables is given, only the entries for those LogEntry fields are exported.
+    Returns a dict of table name to row count.
+    '''
+    os.makedirs(out_dir, exist_ok=True)
+    writers = {}
+
+    def add(name, instr, pc, row):
+        if name not in writers:
+            writers[name] = _TableWriter(out_dir, name)
+        writers[name].add_row(instr, pc, row)
+
+    # Entries without an instruction count go at the end of the tables, to
+    # keep them sorted by instr; they are set aside in a file meanwhile.
+    with PLogReader(plog) as plr, tempfile.TemporaryFile(dir=out_dir) as late:
+        for msgs in plr.chunk_iter(threads=threads):
+            late_rows = []
+            for entry in msgs:
+                for name, row in entry_rows(entry):
+                    if tables is not None and name not in tables:
+                        continue
+                    if entry.instr == NO_INSTR:
+                        late_rows.append((name, entry.instr, entry.pc, row))
+                    else:
+                        add(name, entry.instr, entry.pc, row)
+            if late_rows:
+                pickle.dump(late_rows, late)
+        late.seek(0)
+        while True:
+            try:
+                late_rows = pickle.load(late)
+            except EOFError:
+                break
+            for name, instr, pc, row in late_rows:
+                add(name, instr, pc, row)
+
+    counts = {}
+    for name, w in writers.items():
+        w.close()
+        counts[name] = w.rows
+    with open(os.path.join(out_dir, 'index.json'), 'w') as f:
+        json.dump({'tables': counts}, f, indent=1)
+    return counts
+
+def _read_array(path, dtype, lo, hi):
+    a = array.array(_TYPECODES[dtype])
+    with open(path, 'rb') as f:
+        f.seek(lo * a.itemsize)
+        a.frombytes(f.read((hi - lo) * a.itemsize))
+    if sys.byteorder != 'little':
+        a.byteswap()
+    return a
+
+def load_table(out_dir, name, columns=None, start=None, end=None):
+    '''
+    Reads columns (default: all) of table name, for the rows with
+    start <= instr < end. Returns a dict of column name to values: an
+    array.array for fixed-width columns, or a list, with None for missing
+    values.
+    '''
+    table_dir = os.path.join(out_dir, name)
+    with open(os.path.join(table_dir, 'schema.json')) as f:
+        schema = json.load(f)
+
+    lo, hi = 0, schema['rows']
+    if start is not None or end is not None:
+        instrs = _read_array(os.path.join(table_dir, 'instr.bin'), 'u64', 0, hi)
+        if start is not None:
+            lo = bisect.bisect_left(instrs, start)
+        if end is not None:
+            hi = bisect.bisect_left(instrs, end)
+        hi = max(lo, hi)
+
+    out = {}
+    for col in schema['columns']:
+        if columns is not None and col['name'] not in columns:
+            continue
+        dtype = col['type']
+        data_path = os.path.join(table_dir, col['data'])
+        if dtype in _VARWIDTH:
+            offs = _read_array(os.path.join(table_dir, col['offsets']), 'u64', lo, hi + 1)
+            with open(data_path, 'rb') as f:
+                f.seek(offs[0])
+                blob = f.read(offs[-1] - offs[0])
+            base = offs[0]
+            values = [blob[offs[i] - base:offs[i+1] - base] for i in range(hi - lo)]
+            if dtype != 'bytes':
+                values = [v.decode() for v in values]
+            if dtype == 'json':
+                values = [json.loads(v) if v else None for v in values]
+        else:
+            values = _read_array(data_path, dtype, lo, hi)
+        if 'valid' in col:
+            with open(os.path.join(table_dir, col['valid']), 'rb') as f:
+                f.seek(lo)
+                valid = f.read(hi - lo)
+            values = [v if ok else None for v, ok in zip(values, valid)]
+        out[col['name']] = values
+    return out
+
+def to_arrow(out_dir, name, columns=None):
+    '''
+    Returns table name as a pyarrow.Table, e.g. to write it as Parquet with
+    pyarrow.parquet.write_table. Requires pyarrow.
+    '''
+    import pyarrow as pa
+    cols = load_table(out_dir, name, columns)
+    return pa.table({k: (v.tolist() if isinstance(v, array.array) else v) for k, v in cols.items()})
+
+if __name__ == "__main__":
+    import argparse
+    parser = argparse.ArgumentParser(description='Convert a plog to columnar tables')
+    parser.add_argument('plog')
+    parser.add_argument('out_dir')
+    parser.add_argument('--tables', help='comma-separated LogEntry fields to export (default: all)')
+    parser.add_argument('--threads', type=int, default=0, help='threads decoding chunks')
+    parser.add_argument('--parquet', action='store_true', help='also write <table>.parquet files (requires pyarrow)')
+    args = parser.parse_args()
+
+    counts = export(args.plog, args.out_dir,
+                    args.tables.split(',') if args.tables else None, args.threads)
+    for name, rows in sorted(counts.items()):
+        print('%s: %d rows' % (name, rows))
+        if args.parquet:
+            import pyarrow.parquet as pq
+            pq.write_table(to_arrow(args.out_dir, name), os.path.join(args.out_dir, name + '.parquet'))
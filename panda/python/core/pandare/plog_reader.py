@@ -3,16 +3,33 @@
 Module for reading and writing PANDAlog (plog) files from Python.
 '''
 
+import bisect
+import os
 import zlib
 import struct
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor, ProcessPoolExecutor
 import pandare.plog_pb2
 from google.protobuf.message import Message
 
+# instr of entries written outside of a replay
+NO_INSTR = 2**64 - 1
+
+# reader used by the worker processes of PLogReader.map_chunks
+_worker_reader = None
+
+def _init_map_worker(fn):
+    global _worker_reader
+    _worker_reader = PLogReader(fn)
+
+def _map_chunk(func, chunk_idx):
+    return func(_worker_reader.read_chunk(chunk_idx))
+
 class PLogReader:
     '''
     A class for reading PANDAlog (plog) files. Run directly with `python -m  pandare.plog_reader [input.plog]` to translate input.plog file to json.
 
-    Or the class can be imported and used in a Python script, where it can be iterated over to get 
+    Or the class can be imported and used in a Python script, where it can be iterated over to get
     [google.protobuf.message.Message](https://googleapis.dev/python/protobuf/latest/google/protobuf/message.html#google.protobuf.message.Message) objects.
 
 	with PLogReader('input.plog') as plr:
@@ -22,8 +39,21 @@ class PLogReader:
 		if msg.HasField("OtherField"):
 		  print(msg.otherField)
 
+    The directory at the end of a plog records the first instruction of each
+    chunk, so a range of instructions can be read without decoding the rest
+    of the log, and chunks can be decoded in parallel:
+
+	with PLogReader('input.plog') as plr:
+	  for msg in plr.window(1000000, 2000000, threads=4):
+		...
+	  plr.seek(5000000)
+	  msg = next(plr)
+
+    Entries written outside of the replay (e.g. when a plugin is unloaded)
+    have instr == NO_INSTR; they are skipped by `seek` and `window`.
     '''
     def __init__(self, fn):
+        self.fn = fn
         self.f = open(fn, 'rb')
         self.version, _, self.dir_pos, _, self.chunk_gsize = struct.unpack('<IIQII', self.f.read(24))
 
@@ -35,6 +65,11 @@ class PLogReader:
         self.chunk_data = None                              # data of current chunk
         self.chunk_data_idx = 0
 
+        # first instr and file position of each chunk, plus end of last chunk
+        dir_entries = [struct.unpack_from('<QQQ', self.chunks, 24*i) for i in range(self.nchunks)]
+        self.chunk_instrs = [e[0] for e in dir_entries]
+        self.chunk_pos = [e[1] for e in dir_entries] + [self.dir_pos]
+
     def __iter__(self):
         return self
 
@@ -45,27 +80,129 @@ class PLogReader:
         self.f.close()
         self.f = self.chunk_data = None
 
+    def _decompress_chunk(self, chunk_idx):
+        # pread doesn't move the file position, so this is safe from any thread
+        start, end = self.chunk_pos[chunk_idx], self.chunk_pos[chunk_idx+1]
+        zdata = os.pread(self.f.fileno(), end - start, start)
+        return zlib.decompress(zdata, 15, self.chunk_gsize)
+
+    @staticmethod
+    def _parse_chunk(data):
+        msgs = []
+        idx = 0
+        while idx < len(data):
+            msg_size, = struct.unpack_from('<I', data, idx)
+            msg = pandare.plog_pb2.LogEntry()
+            msg.MergeFromString(data[idx+4:idx+4+msg_size])
+            msgs.append(msg)
+            idx += 4 + msg_size
+        return msgs
+
+    def read_chunk(self, chunk_idx):
+        '''
+        Returns a list of all the messages in chunk chunk_idx.
+        '''
+        return self._parse_chunk(self._decompress_chunk(chunk_idx))
+
+    def find_chunk(self, instr):
+        '''
+        Returns the index of the chunk holding the first entries for instr,
+        by binary search over the directory.
+        '''
+        i = max(bisect.bisect_right(self.chunk_instrs, instr) - 1, 0)
+        while i > 0 and self.chunk_instrs[i-1] == self.chunk_instrs[i]:
+            i -= 1
+        return i
+
+    def seek(self, instr):
+        '''
+        Positions the reader so that the next message returned by iteration
+        is the first one with instruction count >= instr.
+        '''
+        self.chunk_idx = self.find_chunk(instr)
+        self.chunk_data = None
+        self.chunk_data_idx = 0
+        while self.chunk_idx < self.nchunks:
+            if self.chunk_data is None:
+                self._load_chunk()
+            while self.chunk_data_idx < self.chunk_size:
+                msg_size, = struct.unpack_from('<I', self.chunk_data, self.chunk_data_idx)
+                msg = pandare.plog_pb2.LogEntry()
+                msg_start = self.chunk_data_idx + 4
+                msg.MergeFromString(self.chunk_data[msg_start:msg_start+msg_size])
+                if instr <= msg.instr < NO_INSTR:
+                    return
+                self.chunk_data_idx = msg_start + msg_size
+            self._next_chunk()
+
+    def chunk_iter(self, first=0, last=None, threads=0):
+        '''
+        Yields, in order, the lists of messages in chunks first..last
+        (inclusive). With threads > 0, chunks are decompressed and parsed
+        ahead of the consumer on that many threads.
+        '''
+        if last is None:
+            last = self.nchunks - 1
+        if threads <= 0:
+            for i in range(first, last + 1):
+                yield self.read_chunk(i)
+            return
+        with ThreadPoolExecutor(max_workers=threads) as pool:
+            pending = deque()
+            nxt = first
+            for _ in range(first, last + 1):
+                while nxt <= last and len(pending) < 2*threads:
+                    pending.append(pool.submit(self.read_chunk, nxt))
+                    nxt += 1
+                yield pending.popleft().result()
+
+    def window(self, start, end, threads=0):
+        '''
+        Yields, in order, every message with start <= instr < end.
+        '''
+        if self.nchunks == 0 or start >= end:
+            return
+        first = self.find_chunk(start)
+        # chunks starting at or after end only hold later entries
+        last = bisect.bisect_left(self.chunk_instrs, end) - 1
+        if last < first:
+            return
+        for msgs in self.chunk_iter(first, last, threads):
+            for msg in msgs:
+                if start <= msg.instr < end:
+                    yield msg
+
+    def map_chunks(self, func, processes=None):
+        '''
+        Calls func on the list of messages of every chunk, in a pool of
+        worker processes, and returns the results in chunk order. func must
+        be picklable, e.g. a module-level function. This is the fastest way
+        to aggregate over a whole log, since parsing isn't limited by the GIL.
+        '''
+        with ProcessPoolExecutor(max_workers=processes, initializer=_init_map_worker,
+                                 initargs=(self.fn,)) as pool:
+            futures = [pool.submit(_map_chunk, func, i) for i in range(self.nchunks)]
+            return [f.result() for f in futures]
+
+    def _load_chunk(self):
+        self.chunk_data = self._decompress_chunk(self.chunk_idx)
+        self.chunk_size = len(self.chunk_data)
+        self.chunk_data_idx = 0
+
+    def _next_chunk(self):
+        self.chunk_idx += 1
+        self.chunk_size = 0
+        self.chunk_data = None
+        self.chunk_data_idx = 0
+
     def __next__(self):
         # ran out of chunks
         if not self.chunk_idx < self.nchunks:
             raise StopIteration
 
         if self.chunk_data is None:
-            # unpack ins, pos, nentries for this and the next chunk
-            cur = struct.unpack_from('<QQQ', self.chunks, 24*self.chunk_idx)
-            if self.chunk_idx + 1 < self.nchunks:
-                nxt = struct.unpack_from('<QQQ', self.chunks, 24*(self.chunk_idx+1))
-                zchunk_size = nxt[1] - cur[1]
-            else:
-                # setting the compressed chunk size to -1 will
-                # result in reading the remaining of the file
-                zchunk_size = -1
-
             # read and decompress chunk data
-            self.f.seek(cur[1])
-            self.chunk_data = zlib.decompress(self.f.read(zchunk_size), 15, self.chunk_gsize)
-            self.chunk_size = len(self.chunk_data)
-            self.chunk_data_idx = 0
+            self._load_chunk()
 
         # parse message - we're using a fresh message
         # using MergeFromString() is slightly faster than using ParseFromString()
@@ -79,10 +216,7 @@ class PLogReader:
         self.chunk_data_idx = msg_end
 
         if not self.chunk_data_idx < self.chunk_size:
-            self.chunk_idx += 1
-            self.chunk_size = 0
-            self.chunk_data = None
-            self.chunk_data_idx = 0
+            self._next_chunk()
 
         return msg
 
@@ -104,13 +104,21 @@ if __name__ == '__main__':
         f.write(textwrap.dedent("""
             syntax = "proto2";
             package panda;
+            option cc_enable_arenas = true;
         """).lstrip())
         for message in messages:
             f.write(message + "\n")
+        # messages written by PANDA itself use field numbers from 1000 up
         f.write(textwrap.dedent("""
+            message PandalogDropped {
+            required string type = 1;
+            required uint64 kept = 2;
+            required uint64 dropped = 3;
+            }
             message LogEntry {
             required uint64 pc = 1;
             required uint64 instr = 2;
+            optional PandalogDropped pandalog_dropped = 1000;
         """).lstrip())
         for line in rests:
             f.write(line + "\n")
@@ -34,13 +34,27 @@ except EnvironmentError:
     print("Failed to open", base + '-rr-nondet.log. Aborting.', file=sys.stderr)
     sys.exit(1)
 
+# A RAM image written at record time (-record-ram-image) holds the guest RAM
+# the snapshot lacks; a cache written by a replay doesn't need to be packed.
+# Its header is "PANDARAM", u32 version, u32 number of blocks, u64 snapshot
+# size, u64 snapshot mtime and a 16-byte ID, which is zero for caches.
+files = [base + '-rr-snp', base + '-rr-nondet.log']
+try:
+    with open(base + '-rr-ram', 'rb') as f:
+        magic, _, _, _, _, image_id = struct.unpack("<8sIIQQ16s", f.read(48))
+        if magic == b'PANDARAM' and image_id != b'\0' * 16:
+            files.append(base + '-rr-ram')
+except (EnvironmentError, struct.error):
+    pass
+
 print("Packing RR log %s with %d instructions..." % (base, num_guest_insns))
 outf = open(outfname, 'wb')
 outf.write(RRPACK_MAGIC)
 outf.write(struct.pack("<Q", num_guest_insns))
 outf.write("\0" * 16) # Placeholder for checksum
 outf.flush()
-subprocess.check_call(['tar', 'cJf', '-', base + '-rr-snp', base + '-rr-nondet.log'], stdout=outf)
+# the RAM image is sparse where guest RAM is zero
+subprocess.check_call(['tar', '--sparse', '-cJf', '-'] + files, stdout=outf)
 outf.close()
 
 print("Calculating checksum...", end=' ')
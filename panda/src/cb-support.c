@@ -258,6 +258,59 @@ int32_t PCB(before_handle_interrupt)(CPUState *cpu, int32_t interrupt_request) {
 }
 
 
+// Per-vCPU buffer of accesses pending delivery to PANDA_CB_MEM_ACCESS_BATCH.
+// Allocated lazily on the first recorded access and hung off the CPUState.
+#define PANDA_MEM_BATCH_SIZE 4096
+
+typedef struct panda_mem_batch {
+    size_t count;
+    panda_mem_access accesses[PANDA_MEM_BATCH_SIZE];
+} panda_mem_batch;
+
+void PCB(mem_batch_flush)(CPUState *env) {
+    panda_mem_batch *batch = env->panda_mem_batch;
+    panda_cb_list *plist;
+    if (!batch || batch->count == 0) return;
+    for (plist = panda_cbs[PANDA_CB_MEM_ACCESS_BATCH]; plist != NULL;
+         plist = panda_cb_list_next(plist)) {
+        if (plist->enabled) plist->entry.mem_access_batch(env, batch->accesses,
+                                                          batch->count);
+    }
+    batch->count = 0;
+}
+
+// Append a record for the batch consumers. Unlike get_paddr, we never fall
+// back to a page table walk here: the physical address is only filled in if
+// the softmmu TLB gave us a host pointer into guest RAM.
+static inline void mem_batch_append(CPUState *env, target_ptr_t addr,
+                                    size_t data_size, uint64_t val,
+                                    void *ram_ptr, uint32_t flags) {
+    panda_mem_batch *batch = env->panda_mem_batch;
+    if (unlikely(!batch)) {
+        batch = env->panda_mem_batch = g_new0(panda_mem_batch, 1);
+    }
+
+    panda_mem_access *rec = &batch->accesses[batch->count++];
+    rec->pc = env->panda_guest_pc;
+    rec->vaddr = addr;
+    rec->paddr = -1;
+    rec->value = val;
+    rec->size = data_size;
+    rec->flags = flags;
+    if (ram_ptr) {
+        ram_addr_t offset = 0;
+        RAMBlock *block = qemu_ram_block_from_host(ram_ptr, false, &offset);
+        if (block && block->mr) {
+            rec->paddr = block->mr->addr + offset;
+            rec->flags |= PANDA_MEM_ACCESS_PADDR_VALID;
+        }
+    }
+
+    if (batch->count == PANDA_MEM_BATCH_SIZE) {
+        PCB(mem_batch_flush)(env);
+    }
+}
+
 // These are used in softmmu_template.h. They are distinct from MAKE_CALLBACK's standard form.
 // ram_ptr is a possible pointer into host memory from the TLB code. Can be NULL.
 void PCB(mem_before_read)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
@@ -283,6 +336,10 @@ void PCB(mem_before_read)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
 void PCB(mem_after_read)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
                          size_t data_size, uint64_t result, void *ram_ptr) {
     panda_cb_list *plist;
+    if (panda_cbs[PANDA_CB_MEM_ACCESS_BATCH]) {
+        mem_batch_append(env, addr, data_size, result, ram_ptr,
+                         PANDA_MEM_ACCESS_READ);
+    }
     for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_READ]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         /* mstamat: Passing &result as the last cb arg doesn't make much sense. */
@@ -327,6 +384,12 @@ void PCB(mem_before_write)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
 void PCB(mem_after_write)(CPUState *env, target_ptr_t pc, target_ptr_t addr,
                           size_t data_size, uint64_t val, void *ram_ptr) {
     panda_cb_list *plist;
+    // the instruction count hasn't moved, but memory has
+    panda_mem_cache_invalidate();
+    if (panda_cbs[PANDA_CB_MEM_ACCESS_BATCH]) {
+        mem_batch_append(env, addr, data_size, val, ram_ptr,
+                         PANDA_MEM_ACCESS_WRITE);
+    }
     for (plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_WRITE]; plist != NULL;
          plist = panda_cb_list_next(plist)) {
         /* mstamat: Passing &val as the last cb arg doesn't make much sense. */
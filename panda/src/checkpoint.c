@@ -193,6 +193,13 @@ void panda_restore(void *opaque) {
 
     migration_incoming_state_destroy();
 
+    // guest memory and page tables were replaced
+    CPUState *cpu;
+    CPU_FOREACH(cpu) {
+        panda_vtlb_flush(cpu);
+    }
+    panda_ram_dirty_mark_all();
+
     first_cpu->rr_guest_instr_count = checkpoint->guest_instr_count;
     first_cpu->panda_guest_pc = panda_current_pc(first_cpu);
     rr_nondet_log->bytes_read = checkpoint->nondet_log_position;
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <glib.h>
 
 #include "panda/debug.h"
@@ -8,6 +9,8 @@
 #include "panda/common.h"
 #include "panda/plog.h"
 #include "panda/plog-cc-bridge.h"
+#include "exec/ram_addr.h"
+#include "qemu/thread.h"
 
 #if defined(TARGET_ARM)
 /* Return the exception level which controls this address translation regime */
@@ -354,4 +357,376 @@ bool enter_priv(CPUState* cpu) {return false;};
 void exit_priv(CPUState* cpu)  {};
 #endif
 
+PandaVtlb *panda_vtlb_new(CPUState *cpu) {
+    PandaVtlb *vtlb = g_new(PandaVtlb, 1);
+    memset(vtlb->entries, -1, sizeof(vtlb->entries));
+    vtlb->empty = true;
+    cpu->panda_vtlb = vtlb;
+    return vtlb;
+}
+
+// Called from QEMU's TLB flushes, on the vCPU thread
+void panda_vtlb_flush(CPUState *cpu) {
+    PandaVtlb *vtlb = (PandaVtlb *)cpu->panda_vtlb;
+    // cached reads are by virtual address
+    panda_mem_cache_invalidate();
+    if (vtlb == NULL || vtlb->empty) return;
+    memset(vtlb->entries, -1, sizeof(vtlb->entries));
+    vtlb->empty = true;
+}
+
+/* Appends len bytes at host pointer p to the view in iov, merging it with
+ * the last entry if they are contiguous. Returns false if iov is full. */
+static bool view_append(struct iovec *iov, int *n, int max_iov, uint8_t *p,
+                        size_t len) {
+    if (*n > 0 &&
+        (uint8_t *)iov[*n - 1].iov_base + iov[*n - 1].iov_len == p) {
+        iov[*n - 1].iov_len += len;
+        return true;
+    }
+    if (*n == max_iov) return false;
+    iov[*n].iov_base = p;
+    iov[*n].iov_len = len;
+    (*n)++;
+    return true;
+}
+
+/* Adds the len bytes at guest physical address addr, which don't cross a
+ * page, to the view in iov */
+static bool view_add_phys(hwaddr addr, size_t len, struct iovec *iov, int *n,
+                          int max_iov) {
+    hwaddr l = len;
+    hwaddr addr1;
+    uint8_t *p = NULL;
+    // as in address_space_rw; the RAM block stays put after, as long as
+    // the guest doesn't run
+    rcu_read_lock();
+    MemoryRegion *mr = address_space_translate(&address_space_memory, addr,
+                                               &addr1, &l, false);
+    if (memory_access_is_direct(mr, false) && l >= len) {
+        p = (uint8_t *)qemu_map_ram_ptr(mr->ram_block, addr1);
+    }
+    rcu_read_unlock();
+    return p != NULL && view_append(iov, n, max_iov, p, len);
+}
+
+int panda_physical_memory_view(hwaddr addr, size_t len, struct iovec *iov,
+                               int max_iov) {
+    int n = 0;
+    while (len > 0) {
+        size_t l = TARGET_PAGE_SIZE - (addr & ~TARGET_PAGE_MASK);
+        if (l > len) l = len;
+        if (!view_add_phys(addr, l, iov, &n, max_iov)) return -1;
+        addr += l;
+        len -= l;
+    }
+    return n;
+}
+
+int panda_virtual_memory_view(CPUState *env, target_ulong addr, size_t len,
+                              struct iovec *iov, int max_iov) {
+    target_ulong asid = panda_vtlb_asid(env);
+    bool changed_priv = false;
+    int n = 0;
+    while (len > 0) {
+        target_ulong page = addr & TARGET_PAGE_MASK;
+        size_t l = (page + TARGET_PAGE_SIZE) - addr;
+        if (l > len) l = len;
+        hwaddr phys = panda_vtlb_translate(env, asid, page, &changed_priv);
+        if (phys == -1 ||
+            !view_add_phys(phys + (addr & ~TARGET_PAGE_MASK), l, iov, &n,
+                           max_iov)) {
+            n = -1;
+            break;
+        }
+        addr += l;
+        len -= l;
+    }
+    if (changed_priv) exit_priv(env);
+    return n;
+}
+
+typedef struct RamScanRange {
+    hwaddr addr;
+    uint8_t *host;
+    size_t len;
+} RamScanRange;
+
+typedef struct RamScanJob {
+    GArray *ranges;
+    int next;
+    panda_ram_scan_cb cb;
+    void *opaque;
+} RamScanJob;
+
+static uint64_t ram_dirty_since = 0;
+static bool ram_dirty_tracking = false;
+
+// Appends a range, merged with the previous one if it continues it (in both
+// guest and host memory) within the same chunk.
+static void ram_scan_add(GArray *ranges, hwaddr addr, uint8_t *host,
+                         size_t len) {
+    while (len > 0) {
+        size_t l = PANDA_RAM_SCAN_CHUNK - (addr & (PANDA_RAM_SCAN_CHUNK - 1));
+        if (l > len) l = len;
+        RamScanRange *last = ranges->len == 0 ? NULL :
+            &g_array_index(ranges, RamScanRange, ranges->len - 1);
+        if (last != NULL && (addr & (PANDA_RAM_SCAN_CHUNK - 1)) != 0 &&
+            last->addr + last->len == addr && last->host + last->len == host) {
+            last->len += l;
+        } else {
+            RamScanRange r = { addr, host, l };
+            g_array_append_val(ranges, r);
+        }
+        addr += l;
+        host += l;
+        len -= l;
+    }
+}
+
+static void ram_scan_add_dirty(GArray *ranges, DirtyMemoryBlocks *dirty,
+                               ram_addr_t ram, hwaddr addr, uint8_t *host,
+                               size_t len) {
+    size_t off = 0;
+    while (off < len) {
+        size_t l = TARGET_PAGE_SIZE - ((ram + off) & ~TARGET_PAGE_MASK);
+        if (l > len - off) l = len - off;
+        unsigned long page = (ram + off) >> TARGET_PAGE_BITS;
+        if (test_bit(page % DIRTY_MEMORY_BLOCK_SIZE,
+                     dirty->blocks[page / DIRTY_MEMORY_BLOCK_SIZE])) {
+            ram_scan_add(ranges, addr + off, host + off, l);
+        }
+        off += l;
+    }
+}
+
+typedef struct RamScanCollect {
+    GArray *ranges;
+    DirtyMemoryBlocks *dirty;
+    int flags;
+} RamScanCollect;
+
+static void ram_scan_collect_section(MemoryRegionSection *section,
+                                     void *opaque) {
+    RamScanCollect *c = (RamScanCollect *)opaque;
+    hwaddr addr = section->offset_within_address_space;
+    hwaddr xlat = section->offset_within_region;
+    size_t len = int128_get64(section->size);
+    uint8_t *host = (uint8_t *)qemu_map_ram_ptr(section->mr->ram_block, xlat);
+    if (c->flags & PANDA_RAM_SCAN_DIRTY) {
+        ram_scan_add_dirty(c->ranges, c->dirty,
+                           memory_region_get_ram_addr(section->mr) + xlat,
+                           addr, host, len);
+    } else {
+        ram_scan_add(c->ranges, addr, host, len);
+    }
+}
+
+// Called within RCU critical section. Sections come from the flat view of
+// the address space, so they are clamped to what each region maps, and
+// holes and MMIO in between are skipped.
+static void ram_scan_collect(GArray *ranges, int flags) {
+    RamScanCollect c = {
+        ranges, atomic_rcu_read(&ram_list.dirty_memory[DIRTY_MEMORY_PANDA]),
+        flags
+    };
+    address_space_foreach_direct_section(&address_space_memory,
+                                         ram_scan_collect_section, &c);
+}
+
+static void *ram_scan_worker(void *opaque) {
+    RamScanJob *job = (RamScanJob *)opaque;
+    int i;
+    while ((i = atomic_fetch_inc(&job->next)) < (int)job->ranges->len) {
+        RamScanRange *r = &g_array_index(job->ranges, RamScanRange, i);
+        job->cb(r->addr, r->host, r->len, job->opaque);
+    }
+    return NULL;
+}
+
+uint64_t panda_ram_scan(panda_ram_scan_cb cb, void *opaque, int threads,
+                        int flags) {
+    GArray *ranges = g_array_new(false, false, sizeof(RamScanRange));
+    uint64_t total = 0;
+
+    rcu_read_lock();
+    ram_scan_collect(ranges, flags);
+    for (guint i = 0; i < ranges->len; i++) {
+        total += g_array_index(ranges, RamScanRange, i).len;
+    }
+
+    if (threads <= 0) threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads > (int)ranges->len) threads = ranges->len;
+
+    RamScanJob job = { ranges, 0, cb, opaque };
+    if (threads <= 1) {
+        ram_scan_worker(&job);
+    } else {
+        // This thread takes ranges too, so start one less worker.
+        QemuThread *workers = g_new(QemuThread, threads - 1);
+        for (int i = 0; i < threads - 1; i++) {
+            qemu_thread_create(&workers[i], "panda-ram-scan", ram_scan_worker,
+                               &job, QEMU_THREAD_JOINABLE);
+        }
+        ram_scan_worker(&job);
+        for (int i = 0; i < threads - 1; i++) {
+            qemu_thread_join(&workers[i]);
+        }
+        g_free(workers);
+    }
+    rcu_read_unlock();
+
+    g_array_free(ranges, true);
+    return total;
+}
+
+static int ram_dirty_clear(const char *name, void *host, ram_addr_t offset,
+                           ram_addr_t length, void *opaque) {
+    // Also sets TLB_NOTDIRTY on the pages, so that the next write to each
+    // of them sets its bit again.
+    cpu_physical_memory_test_and_clear_dirty(offset, length,
+                                             DIRTY_MEMORY_PANDA);
+    return 0;
+}
+
+static int ram_dirty_set(const char *name, void *host, ram_addr_t offset,
+                         ram_addr_t length, void *opaque) {
+    cpu_physical_memory_set_dirty_range(offset, length,
+                                        1 << DIRTY_MEMORY_PANDA);
+    return 0;
+}
+
+void panda_ram_dirty_reset(void) {
+    if (!ram_dirty_tracking) {
+        // Have DMA writes logged too; the CPU's always are.
+        memory_global_panda_dirty_log_start();
+        ram_dirty_tracking = true;
+    }
+    qemu_ram_foreach_block(ram_dirty_clear, NULL);
+    ram_dirty_since = rr_get_guest_instr_count();
+}
+
+uint64_t panda_ram_dirty_since(void) {
+    return ram_dirty_since;
+}
+
+void panda_ram_dirty_mark_all(void) {
+    qemu_ram_foreach_block(ram_dirty_set, NULL);
+}
+
+int panda_virtual_memory_read_str(CPUState *env, target_ulong addr, char *buf,
+                                  int size) {
+    target_ulong asid = panda_vtlb_asid(env);
+    bool changed_priv = false;
+    bool read_any = false;
+    int len = 0;
+    if (size <= 0) return -1;
+    while (len < size - 1) {
+        int l = TARGET_PAGE_SIZE - ((addr + len) & ~TARGET_PAGE_MASK);
+        if (l > size - 1 - len) l = size - 1 - len;
+        if (panda_virtual_memory_rw_priv(env, asid, addr + len,
+                                         (uint8_t *)buf + len, l, false,
+                                         &changed_priv) != 0) {
+            break;
+        }
+        read_any = true;
+        char *nul = (char *)memchr(buf + len, 0, l);
+        if (nul != NULL) {
+            len = nul - buf;
+            break;
+        }
+        len += l;
+    }
+    buf[len] = '\0';
+    if (changed_priv) exit_priv(env);
+    return read_any ? len : -1;
+}
+
+/*
+ * Cache of panda_virtual_memory_read_cached(): direct-mapped lines, which
+ * never cross a page. A line is valid for the epoch and instruction count
+ * it was read at; the epoch is bumped whenever guest memory or the
+ * translations may have changed without the instruction count moving:
+ * on stores seen by mem_after_write (only with memory callbacks on), and
+ * regardless of those after each instruction with after_insn_exec, at the
+ * end of each block and after interrupt and exception delivery.
+ */
+#define MEM_CACHE_LINE_BITS 6
+#define MEM_CACHE_LINE_SIZE (1 << MEM_CACHE_LINE_BITS)
+#define MEM_CACHE_LINES 512
+
+typedef struct MemCacheLine {
+    uint64_t epoch;
+    uint64_t instr;
+    target_ulong asid;
+    target_ulong addr;
+    uint8_t data[MEM_CACHE_LINE_SIZE];
+} MemCacheLine;
+
+static MemCacheLine mem_cache[MEM_CACHE_LINES];
+// lines start out with epoch 0, i.e. invalid
+static uint64_t mem_cache_epoch = 1;
+
+void panda_mem_cache_invalidate(void) {
+    mem_cache_epoch++;
+}
+
+int panda_virtual_memory_read_cached(CPUState *env, target_ulong addr,
+                                     uint8_t *buf, int len) {
+    if (!rr_in_replay()) {
+        return panda_virtual_memory_read(env, addr, buf, len);
+    }
+
+    target_ulong asid = panda_vtlb_asid(env);
+    uint64_t instr = env->rr_guest_instr_count;
+    bool changed_priv = false;
+    int ret = 0;
+    while (len > 0) {
+        target_ulong line = addr & ~(target_ulong)(MEM_CACHE_LINE_SIZE - 1);
+        int off = addr - line;
+        int l = MIN(MEM_CACHE_LINE_SIZE - off, len);
+        MemCacheLine *c =
+            &mem_cache[(line >> MEM_CACHE_LINE_BITS) & (MEM_CACHE_LINES - 1)];
+        if (c->epoch != mem_cache_epoch || c->instr != instr ||
+            c->asid != asid || c->addr != line) {
+            c->epoch = 0;
+            if (panda_virtual_memory_rw_priv(env, asid, line, c->data,
+                                             MEM_CACHE_LINE_SIZE, false,
+                                             &changed_priv) != 0) {
+                // the rest of the line may not be RAM, read just what was
+                // asked for
+                ret = panda_virtual_memory_rw_priv(env, asid, addr, buf, l,
+                                                   false, &changed_priv);
+                if (ret != 0) break;
+                goto next;
+            }
+            c->epoch = mem_cache_epoch;
+            c->instr = instr;
+            c->asid = asid;
+            c->addr = line;
+        }
+        memcpy(buf, c->data + off, l);
+next:
+        addr += l;
+        buf += l;
+        len -= l;
+    }
+    if (changed_priv) exit_priv(env);
+    return ret;
+}
+
+int panda_virtual_memory_read_many(CPUState *env, PandaMemRead *reads, int n) {
+    target_ulong asid = panda_vtlb_asid(env);
+    bool changed_priv = false;
+    int failed = 0;
+    for (int i = 0; i < n; i++) {
+        reads[i].ret = panda_virtual_memory_rw_priv(env, asid, reads[i].addr,
+                                                    reads[i].buf, reads[i].len,
+                                                    false, &changed_priv);
+        if (reads[i].ret != 0) failed++;
+    }
+    if (changed_priv) exit_priv(env);
+    return failed;
+}
+
 /* vim:set shiftwidth=4 ts=4 sts=4 et: */
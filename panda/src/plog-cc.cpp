@@ -1,9 +1,14 @@
 
+#include <algorithm>
 #include <cinttypes>
 #include <iostream>
 #include <math.h>
 #include <fstream>
 #include <memory>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include "panda/plog-cc.hpp"
 #include "panda/plog-cc-bridge.h"
 
@@ -11,6 +16,187 @@ using namespace std;
 
 extern int panda_in_main_loop;
 
+// instr of the last entry written
+uint64_t last_instr_entry = -1;
+
+//---------------------------------------------------------------------
+// Chunk compression and writing
+
+void PandalogCcWriter::start(std::fstream *file, int level, unsigned num_threads){
+    this->file = file;
+    this->level = level;
+    this->num_threads = num_threads;
+    this->next_write = 0;
+    this->in_flight = 0;
+    this->stopping = false;
+    this->written_pos.clear();
+
+    for (unsigned i = 0; i < num_threads; i++) {
+        this->threads.emplace_back(&PandalogCcWriter::compress_loop, this);
+    }
+    if (num_threads > 0) {
+        this->threads.emplace_back(&PandalogCcWriter::write_loop, this);
+    }
+}
+
+void PandalogCcWriter::compress_job(PandalogCcJob *job){
+    unsigned long ccs = compressBound(job->size);
+    job->zbuf.resize(ccs);
+    int ret = compress2(job->zbuf.data(), &ccs, job->buf, job->size, this->level);
+    assert(ret == Z_OK);
+    job->zbuf.resize(ccs);
+}
+
+void PandalogCcWriter::write_job(PandalogCcJob *job){
+    unsigned long ccs = job->zbuf.size();
+    printf("writing chunk %u of pandalog, %lu / %lu = %.2f compression, %u entries\n",
+            job->chunk_num, job->size, ccs, ((float)job->size) / ccs,
+            job->num_entries);
+    if (job->num_entries == 0) {
+        printf("WARNING: Empty chunk written to pandalog. Did you forget?\n");
+    }
+    this->written_pos.push_back(this->file->tellp());
+    this->file->write((char*)job->zbuf.data(), ccs);
+}
+
+// a free chunk buffer, or a new one, of at least *buf_size bytes
+// must be called with lock held
+unsigned char *PandalogCcWriter::get_buf(uint32_t *buf_size){
+    while (!this->free_bufs.empty()) {
+        std::pair<unsigned char *, uint32_t> b = this->free_bufs.back();
+        this->free_bufs.pop_back();
+        if (b.second >= *buf_size) {
+            *buf_size = b.second;
+            return b.first;
+        }
+        free(b.first);
+    }
+    unsigned char *buf = (unsigned char *) malloc(*buf_size);
+    assert(buf != NULL);
+    return buf;
+}
+
+unsigned char *PandalogCcWriter::submit(uint32_t chunk_num, unsigned char *buf,
+                                        uint32_t *buf_size, unsigned long size,
+                                        uint32_t num_entries){
+    PandalogCcJob *job = new PandalogCcJob();
+    job->chunk_num = chunk_num;
+    job->buf = buf;
+    job->buf_size = *buf_size;
+    job->size = size;
+    job->num_entries = num_entries;
+    job->done = false;
+
+    if (this->num_threads == 0) {
+        compress_job(job);
+        write_job(job);
+        this->next_write++;
+        delete job;
+        // just keep using the same buffer
+        return buf;
+    }
+
+    std::unique_lock<std::mutex> l(this->lock);
+    // back-pressure: don't let chunks pile up in memory
+    this->done_cv.wait(l, [this]{ return this->in_flight <= this->num_threads; });
+    this->in_flight++;
+    this->jobs[chunk_num] = job;
+    this->queue.push_back(job);
+    this->work_cv.notify_one();
+    return get_buf(buf_size);
+}
+
+void PandalogCcWriter::compress_loop(){
+    std::unique_lock<std::mutex> l(this->lock);
+    while (true) {
+        this->work_cv.wait(l, [this]{ return this->stopping || !this->queue.empty(); });
+        if (this->queue.empty()) return;
+        PandalogCcJob *job = this->queue.front();
+        this->queue.erase(this->queue.begin());
+
+        l.unlock();
+        compress_job(job);
+        l.lock();
+
+        job->done = true;
+        this->free_bufs.push_back(std::make_pair(job->buf, job->buf_size));
+        job->buf = NULL;
+        if (job->chunk_num == this->next_write) {
+            this->done_cv.notify_all();
+        }
+    }
+}
+
+void PandalogCcWriter::write_loop(){
+    std::unique_lock<std::mutex> l(this->lock);
+    while (true) {
+        auto next_done = [this]{
+            auto it = this->jobs.find(this->next_write);
+            return it != this->jobs.end() && it->second->done;
+        };
+        this->done_cv.wait(l, [&]{ return next_done() || (this->stopping && this->jobs.empty()); });
+        if (!next_done()) return;
+        PandalogCcJob *job = this->jobs[this->next_write];
+
+        // only this thread touches the file and written_pos until finish()
+        l.unlock();
+        write_job(job);
+        l.lock();
+
+        this->jobs.erase(this->next_write);
+        this->next_write++;
+        this->in_flight--;
+        delete job;
+        this->done_cv.notify_all();
+    }
+}
+
+void PandalogCcWriter::stop(){
+    {
+        std::lock_guard<std::mutex> l(this->lock);
+        this->stopping = true;
+    }
+    this->work_cv.notify_all();
+    this->done_cv.notify_all();
+    for (auto &t : this->threads) {
+        t.join();
+    }
+    this->threads.clear();
+    for (auto &b : this->free_bufs) {
+        free(b.first);
+    }
+    this->free_bufs.clear();
+}
+
+void PandalogCcWriter::finish(std::vector<uint64_t> &pos){
+    // compression threads drain the queue and the writer drains the
+    // submitted jobs before exiting
+    stop();
+    assert(this->jobs.empty());
+    for (uint32_t i = 0; i < this->written_pos.size(); i++) {
+        if (i < pos.size()) {
+            pos[i] = this->written_pos[i];
+        } else {
+            pos.push_back(this->written_pos[i]);
+        }
+    }
+}
+
+// reads a non-negative integer setting from the environment
+static int plog_env_setting(const char *name, int dflt){
+    const char *val = getenv(name);
+    if (val == NULL || *val == '\0') return dflt;
+    char *end;
+    long l = strtol(val, &end, 10);
+    if (*end != '\0' || l < 0) {
+        fprintf(stderr, "WARNING: ignoring bad value for %s: %s\n", name, val);
+        return dflt;
+    }
+    return (int) l;
+}
+
+//---------------------------------------------------------------------
+
 void PandaLog::create(uint32_t chunk_size) {
     this->chunk.size = chunk_size;
     this->chunk.zsize = chunk_size;
@@ -18,6 +204,7 @@ void PandaLog::create(uint32_t chunk_size) {
     // the invariant that all log entries for an instruction reside in same
     // chunk.  this should be big enough but don't worry, we'll be monitoring it.
     this->chunk.buf = (unsigned char *) malloc(this->chunk.size);
+    this->chunk.buf_size = this->chunk.size;
     this->chunk.buf_p = this->chunk.buf;
     this->chunk.zbuf = (unsigned char *) malloc(this->chunk.zsize);
     this->chunk.start_pos = PL_HEADER_SIZE;
@@ -34,6 +221,7 @@ void PandaLog::read_dir(){
     this->chunk.zsize = plh->chunk_size;
     
     this->chunk.buf = (unsigned char *) realloc(this->chunk.buf, this->chunk.size);
+    this->chunk.buf_size = this->chunk.size;
     this->chunk.buf_p = this->chunk.buf;
 
     this->chunk.zbuf = (unsigned char *) realloc(this->chunk.zbuf, this->chunk.size);
@@ -62,7 +250,7 @@ void PandaLog::read_dir(){
     }
 
     // a little hack so unmarshall_chunk will work
-    this->dir.pos[num_chunks] = plh->dir_pos;
+    this->dir.pos.push_back(plh->dir_pos);
 }
 
 PlHeader* PandaLog::read_header(){
@@ -123,7 +311,20 @@ void PandaLog::open_write(const char* filepath, uint32_t chunk_size){
     // skip over header to be ready to write first chunk
     // NB: we will write the header later, when we write the directory.
     
-    this->file->seekg(this->chunk.start_pos);
+    this->file->seekp(this->chunk.start_pos);
+
+    // compression threads: one less than the host cores, since the vCPU
+    // thread keeps one busy, up to PL_MAX_THREADS
+    unsigned cores = std::thread::hardware_concurrency();
+    int dflt_threads = (cores > 1) ? std::min(cores - 1, (unsigned) PL_MAX_THREADS) : 0;
+    int num_threads = plog_env_setting("PANDALOG_THREADS", dflt_threads);
+    int level = plog_env_setting("PANDALOG_ZLEVEL", PL_Z_LEVEL);
+    const char *limits = getenv("PANDALOG_LIMITS");
+    if (limits != NULL && !add_limits(limits)) {
+        exit(1);
+    }
+    if (level > Z_BEST_COMPRESSION) level = Z_BEST_COMPRESSION;
+    this->writer.start(this->file, level, num_threads);
 
     this->chunk_num = 0;
     // write bogus initial chunk
@@ -242,8 +443,20 @@ void PandaLog::add_dir_entry(){
 int PandaLog::close(){
 
     if (this->mode == PL_MODE_WRITE){
+        if (this->limits_dropped) {
+            write_limit_summaries(last_instr_entry, -1);
+        }
+        for (auto &l : this->limits) {
+            if (l.total_dropped > 0) {
+                printf("pandalog: dropped %" PRIu64 " %s entries due to limits\n",
+                        l.total_dropped, l.type.c_str());
+            }
+        }
         write_current_chunk();
         add_dir_entry();
+        // chunk positions are only known once they've been written
+        this->writer.finish(this->dir.pos);
+        this->file->seekp(0, ios::end);
         write_dir();
     }
 
@@ -251,14 +464,12 @@ int PandaLog::close(){
     return 0;
 }
 
-// compress current chunk and write it to file,
+// hand current chunk off to be compressed and written to file,
 // also update directory map
 void PandaLog::write_current_chunk(){
 #ifndef PLOG_READER 
     //uncompressed chunk size
     unsigned long chunk_sz = this->chunk.buf_p - this->chunk.buf;
-    unsigned long ccs = this->chunk.zsize;
-    int ret;
 
     if (this->filename == NULL) {
       fprintf(stderr,"ERROR: Attempted to write to pandalog  but there isn't one! Did " \
@@ -268,33 +479,13 @@ void PandaLog::write_current_chunk(){
       return;
     }
 
-    // loop allows compress2 to fail and resize output buffer as needed
-    uint32_t i;
-    for (i=0; i<10; i++) {
-        ret = compress2(this->chunk.zbuf, &ccs, this->chunk.buf, chunk_sz, Z_BEST_COMPRESSION);
-        
-        if (ret == Z_OK) break;
-        // bigger output buffer needed to perform compression?
-        this->chunk.zsize *= 2;
-        this->chunk.zbuf = (unsigned char *) realloc(this->chunk.zbuf, this->chunk.zsize);
-        assert (this->chunk.zbuf != NULL);
-    }
-
-    // ccs is final compressed chunk size
-    assert(ret == Z_OK);
-    printf("writing chunk %u of pandalog, %lu / %lu = %.2f compression, %u entries\n",
-            this->chunk_num, chunk_sz, ccs, ((float)chunk_sz) / ccs,
-            this->chunk.ind_entry);
-    if (this->chunk.ind_entry == 0) {
-        printf("WARNING: Empty chunk written to pandalog. Did you forget?\n");
-    }
-
-    this->file->write((char*)this->chunk.zbuf, ccs);
-    //assert(this->)
+    // file position is filled in by the writer, see close()
     add_dir_entry();
-    // reset start instr / pos
+    this->chunk.buf = this->writer.submit(this->chunk_num, this->chunk.buf,
+                                          &this->chunk.buf_size, chunk_sz,
+                                          this->chunk.ind_entry);
+    // reset start instr
     this->chunk.start_instr = rr_get_guest_instr_count();
-    this->chunk.start_pos = this->file->tellg();
     // rewind chunk buf and inc chunk #
     this->chunk.buf_p = this->chunk.buf;
     this->chunk_num ++;
@@ -302,10 +493,37 @@ void PandaLog::write_current_chunk(){
 #endif
 }
 
-uint64_t last_instr_entry = -1;
-
 void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
+    write_entry(entry.get());
+}
+
+panda::LogEntry *PandaLog::new_entry(void){
+    this->arena_live++;
+    return google::protobuf::Arena::CreateMessage<panda::LogEntry>(&this->arena);
+}
+
+void PandaLog::discard_entry(panda::LogEntry *entry){
+    if (entry->GetArena() == &this->arena) {
+        assert(this->arena_live > 0);
+        this->arena_live--;
+        maybe_reset_arena(false);
+    }
+}
+
+void PandaLog::maybe_reset_arena(bool chunk_done){
+    // entries for the chunk are serialized by now, so the arena is only
+    // holding on to memory for reuse. NB: serialized size is a cheap
+    // stand-in for arena usage, Arena::SpaceAllocated walks its blocks.
+    if (this->arena_live == 0
+        && (chunk_done || this->arena_bytes > PL_ARENA_MAX)) {
+        this->arena.Reset();
+        this->arena_bytes = 0;
+    }
+}
+
+void PandaLog::write_entry(panda::LogEntry *entry){
 #ifndef PLOG_READER 
+    uint32_t start_chunk = this->chunk_num;
     if (panda_in_main_loop) {
         entry->set_pc(panda_current_pc(first_cpu));
         entry->set_instr(rr_get_guest_instr_count());
@@ -317,6 +535,21 @@ void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
 
     size_t n = entry->ByteSize();
 
+    if (this->limits.empty() || keep_entry(entry, n)) {
+        append_entry(entry, n);
+    }
+
+    if (entry->GetArena() == &this->arena) {
+        assert(this->arena_live > 0);
+        this->arena_live--;
+        this->arena_bytes += n;
+        maybe_reset_arena(this->chunk_num != start_chunk);
+    }
+#endif
+}
+
+void PandaLog::append_entry(panda::LogEntry *entry, size_t n){
+#ifndef PLOG_READER 
     // invariant: all log entries for an instruction belong in a single chunk
     if(last_instr_entry != -1 
         && (last_instr_entry != entry->instr())
@@ -324,17 +557,23 @@ void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
         // if entry won't fit in current chunk
         // and new entry is a different instr from last entry written
             write_current_chunk();
+            // start the new chunk with what was dropped in the last one
+            if (this->limits_dropped) {
+                write_limit_summaries(entry->instr(), entry->pc());
+            }
     }
 
-    // create another chunk
+    // grow chunk buffer
     if (this->chunk.buf_p + sizeof(uint32_t) + n
-        >= this->chunk.buf + ((int)(floor(this->chunk.size)))) {
+        >= this->chunk.buf + this->chunk.buf_size) {
 
         uint32_t offset = this->chunk.buf_p - this->chunk.buf;
-        uint32_t new_size = offset * 2;
+        uint32_t new_size = std::max((uint32_t) (offset * 2),
+                                     (uint32_t) (offset + sizeof(uint32_t) + n + 1));
         this->chunk.buf = (unsigned char *) realloc(this->chunk.buf, new_size);
-        this->chunk.buf_p = this->chunk.buf + offset;
         assert (this->chunk.buf != NULL);
+        this->chunk.buf_size = new_size;
+        this->chunk.buf_p = this->chunk.buf + offset;
     }
 
     // now write the entry itself to the buffer.  size then entry itself
@@ -349,6 +588,181 @@ void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
 #endif
 }
 
+//---------------------------------------------------------------------
+// Sampling and rate limits
+
+// parses a count with an optional K/M/G suffix, in powers of unit
+static bool parse_count(const std::string &str, double unit, double *out){
+    char *end;
+    double v = strtod(str.c_str(), &end);
+    if (end == str.c_str() || v < 0) return false;
+    switch (*end) {
+        case 'k': case 'K': v *= unit; end++; break;
+        case 'm': case 'M': v *= unit * unit; end++; break;
+        case 'g': case 'G': v *= unit * unit * unit; end++; break;
+        default: break;
+    }
+    if (*end != '\0') return false;
+    *out = v;
+    return true;
+}
+
+static std::vector<std::string> split(const std::string &str, char sep){
+    std::vector<std::string> parts;
+    size_t start = 0;
+    while (true) {
+        size_t end = str.find(sep, start);
+        parts.push_back(str.substr(start, end - start));
+        if (end == std::string::npos) break;
+        start = end + 1;
+    }
+    return parts;
+}
+
+bool PandaLog::add_limits(const char *spec){
+    std::vector<PandalogCcLimit> added;
+    const google::protobuf::Descriptor *desc = panda::LogEntry::descriptor();
+
+    for (auto &rule : split(spec, ';')) {
+        if (rule.empty()) continue;
+        size_t colon = rule.find(':');
+        if (colon == std::string::npos) {
+            fprintf(stderr, "pandalog limits: expected type:policy in \"%s\"\n", rule.c_str());
+            return false;
+        }
+        PandalogCcLimit l = {};
+        l.type = rule.substr(0, colon);
+        l.sample = 1.0;
+        if (l.type != "*") {
+            l.field = desc->FindFieldByName(l.type);
+            if (l.field == NULL) {
+                fprintf(stderr, "pandalog limits: no LogEntry field %s\n", l.type.c_str());
+                return false;
+            }
+        }
+        for (auto &policy : split(rule.substr(colon + 1), ',')) {
+            size_t eq = policy.find('=');
+            std::string name = policy.substr(0, eq);
+            std::string val = (eq == std::string::npos) ? "" : policy.substr(eq + 1);
+            double v, instrs = 1e6;
+            bool ok;
+            if (name == "every") {
+                ok = parse_count(val, 1000, &v) && v >= 1;
+                l.every = v;
+            } else if (name == "sample") {
+                ok = parse_count(val, 1000, &v) && v <= 1;
+                l.sample = v;
+            } else if (name == "rate") {
+                // entries[/instructions]
+                size_t slash = val.find('/');
+                ok = parse_count(val.substr(0, slash), 1000, &v) && v >= 1;
+                if (ok && slash != std::string::npos) {
+                    ok = parse_count(val.substr(slash + 1), 1000, &instrs) && instrs >= 1;
+                }
+                l.rate = v;
+                l.rate_instrs = instrs;
+                l.tokens = v;
+            } else if (name == "budget") {
+                ok = parse_count(val, 1024, &v);
+                l.budget = v;
+            } else {
+                ok = false;
+            }
+            if (!ok) {
+                fprintf(stderr, "pandalog limits: bad policy \"%s\" for %s\n",
+                        policy.c_str(), l.type.c_str());
+                return false;
+            }
+        }
+        added.push_back(l);
+    }
+
+    this->limits.insert(this->limits.end(), added.begin(), added.end());
+    return true;
+}
+
+bool PandaLog::limit_allows(PandalogCcLimit &l, uint64_t instr, size_t n){
+    l.seen++;
+    if (l.every > 1 && (l.seen - 1) % l.every != 0) {
+        return false;
+    }
+    if (l.sample < 1.0) {
+        // xorshift64*, seeded the same way every run so that replays
+        // produce the same log
+        this->rng_state ^= this->rng_state >> 12;
+        this->rng_state ^= this->rng_state << 25;
+        this->rng_state ^= this->rng_state >> 27;
+        uint64_t r = this->rng_state * 0x2545F4914F6CDD1Dull;
+        if ((r >> 11) * (1.0 / (1ull << 53)) >= l.sample) {
+            return false;
+        }
+    }
+    if (l.rate > 0) {
+        // entries written outside of replay (instr -1) don't refill
+        if (instr != (uint64_t) -1 && instr > l.last_instr) {
+            l.tokens += (double) (instr - l.last_instr) * l.rate / l.rate_instrs;
+            if (l.tokens > l.rate) l.tokens = l.rate;
+            l.last_instr = instr;
+        }
+        if (l.tokens < 1) {
+            return false;
+        }
+        l.tokens -= 1;
+    }
+    if (l.budget > 0 && l.bytes + n > l.budget) {
+        return false;
+    }
+    return true;
+}
+
+bool PandaLog::keep_entry(const panda::LogEntry *entry, size_t n){
+    const google::protobuf::Reflection *refl = entry->GetReflection();
+    bool keep = true;
+    for (auto &l : this->limits) {
+        if (l.field == NULL) {
+            l.matched = true;
+        } else if (l.field->is_repeated()) {
+            l.matched = refl->FieldSize(*entry, l.field) > 0;
+        } else {
+            l.matched = refl->HasField(*entry, l.field);
+        }
+        // once a limit drops the entry, the others keep their every, sample
+        // and rate state for the next one
+        if (l.matched && keep && !limit_allows(l, entry->instr(), n)) {
+            keep = false;
+        }
+    }
+    for (auto &l : this->limits) {
+        if (!l.matched) continue;
+        if (keep) {
+            l.kept++;
+            l.bytes += n;
+        } else {
+            l.dropped++;
+            l.total_dropped++;
+        }
+    }
+    if (!keep) this->limits_dropped = true;
+    return keep;
+}
+
+void PandaLog::write_limit_summaries(uint64_t instr, uint64_t pc){
+    for (auto &l : this->limits) {
+        if (l.dropped == 0) continue;
+        panda::LogEntry ple;
+        ple.set_pc(pc);
+        ple.set_instr(instr);
+        panda::PandalogDropped *d = ple.mutable_pandalog_dropped();
+        d->set_type(l.type);
+        d->set_kept(l.kept);
+        d->set_dropped(l.dropped);
+        append_entry(&ple, ple.ByteSize());
+        l.kept = 0;
+        l.dropped = 0;
+    }
+    this->limits_dropped = false;
+}
+
 void PandaLog::unmarshall_chunk(uint32_t chunk_num){  
     printf ("unmarshalling chunk %d\n", chunk_num);
     PandalogCcChunk *chunk = &(this->chunk);
@@ -481,6 +895,195 @@ void PandaLog::seek(uint64_t instr){
 }
 
 
+//---------------------------------------------------------------------
+// Random access reader
+
+bool PandaLogReader::open(const char *path){
+    close();
+    this->fd = ::open(path, O_RDONLY);
+    if (this->fd < 0) return false;
+
+    PlHeader plh;
+    if (pread(this->fd, &plh, sizeof(plh), 0) != sizeof(plh)
+        || plh.version != PL_CURRENT_VERSION) {
+        close();
+        return false;
+    }
+    this->chunk_size = plh.chunk_size;
+    this->dir_pos = plh.dir_pos;
+
+    uint32_t num_chunks;
+    if (pread(this->fd, &num_chunks, sizeof(num_chunks), plh.dir_pos) != sizeof(num_chunks)) {
+        close();
+        return false;
+    }
+    std::vector<uint64_t> raw(3 * (size_t) num_chunks);
+    ssize_t raw_size = raw.size() * sizeof(uint64_t);
+    if (pread(this->fd, raw.data(), raw_size, plh.dir_pos + sizeof(num_chunks)) != raw_size) {
+        close();
+        return false;
+    }
+    this->dir.num_chunks = num_chunks;
+    for (uint32_t i = 0; i < num_chunks; i++) {
+        this->dir.instr.push_back(raw[3*i]);
+        this->dir.pos.push_back(raw[3*i + 1]);
+        this->dir.num_entries.push_back(raw[3*i + 2]);
+    }
+    // end of last chunk
+    this->dir.pos.push_back(plh.dir_pos);
+    return true;
+}
+
+void PandaLogReader::close(void){
+    if (this->fd >= 0) {
+        ::close(this->fd);
+    }
+    this->fd = -1;
+    this->dir.num_chunks = 0;
+    this->dir.instr.clear();
+    this->dir.pos.clear();
+    this->dir.num_entries.clear();
+}
+
+uint32_t PandaLogReader::find_chunk(uint64_t instr) const {
+    // dir.instr is sorted. the last chunk starting at or before instr is
+    // the first that can hold it, unless earlier chunks start at the same
+    // instr (chunks holding only entries written outside of replay).
+    auto it = std::upper_bound(this->dir.instr.begin(), this->dir.instr.end(), instr);
+    uint32_t i = (it == this->dir.instr.begin()) ? 0 : (it - this->dir.instr.begin()) - 1;
+    while (i > 0 && this->dir.instr[i-1] == this->dir.instr[i]) i--;
+    return i;
+}
+
+std::vector<std::unique_ptr<panda::LogEntry>> PandaLogReader::read_chunk(uint32_t i) const {
+    assert(i < this->dir.num_chunks);
+    std::vector<std::unique_ptr<panda::LogEntry>> entries;
+
+    size_t zsize = this->dir.pos[i+1] - this->dir.pos[i];
+    std::vector<unsigned char> zbuf(zsize);
+    ssize_t n = pread(this->fd, zbuf.data(), zsize, this->dir.pos[i]);
+    assert(n == (ssize_t) zsize);
+
+    // chunks can be bigger than the nominal chunk size, since all entries
+    // for an instr go in the same chunk
+    std::vector<unsigned char> buf(std::max(this->chunk_size, (uint32_t) 1));
+    unsigned long size;
+    int ret;
+    while (true) {
+        size = buf.size();
+        ret = uncompress(buf.data(), &size, zbuf.data(), zsize);
+        if (ret != Z_BUF_ERROR) break;
+        assert(buf.size() < UINT32_MAX/2);
+        buf.resize(buf.size() * 2);
+    }
+    assert(ret == Z_OK && "Decompression failed");
+
+    entries.reserve(this->dir.num_entries[i]);
+    unsigned char *p = buf.data();
+    unsigned char *end = p + size;
+    while (p + sizeof(uint32_t) <= end) {
+        uint32_t entry_size;
+        memcpy(&entry_size, p, sizeof(entry_size));
+        p += sizeof(uint32_t);
+        assert(p + entry_size <= end);
+        std::unique_ptr<panda::LogEntry> ple (new panda::LogEntry());
+        ple->ParseFromArray(p, entry_size);
+        p += entry_size;
+        entries.push_back(std::move(ple));
+    }
+    return entries;
+}
+
+void PandaLogReader::read_window(uint64_t start, uint64_t end, const EntryFn &fn,
+                                 unsigned num_threads) const {
+    if (this->dir.num_chunks == 0 || start >= end) return;
+    uint32_t first = find_chunk(start);
+    // chunks starting at or after end only hold later entries
+    auto it = std::lower_bound(this->dir.instr.begin(), this->dir.instr.end(), end);
+    if (it == this->dir.instr.begin()) return;
+    uint32_t last = (it - this->dir.instr.begin()) - 1;
+    if (last < first) return;
+    read_chunks(first, last, false, start, end, fn, num_threads);
+}
+
+void PandaLogReader::read_all(const EntryFn &fn, unsigned num_threads) const {
+    if (this->dir.num_chunks == 0) return;
+    read_chunks(0, this->dir.num_chunks - 1, true, 0, 0, fn, num_threads);
+}
+
+void PandaLogReader::read_chunks(uint32_t first, uint32_t last, bool all,
+                                 uint64_t start, uint64_t end,
+                                 const EntryFn &fn, unsigned num_threads) const {
+    typedef std::vector<std::unique_ptr<panda::LogEntry>> Entries;
+
+    // returns false if fn asked to stop
+    auto visit = [&](const Entries &entries) {
+        for (auto &ple : entries) {
+            if (!all && (ple->instr() < start || ple->instr() >= end)) continue;
+            if (!fn(*ple)) return false;
+        }
+        return true;
+    };
+
+    if (num_threads == 0) {
+        for (uint32_t i = first; i <= last; i++) {
+            if (!visit(read_chunk(i))) return;
+        }
+        return;
+    }
+
+    // workers decode chunks in order of index, at most 2 per thread ahead
+    // of the chunk being visited, and fn is called from this thread
+    std::mutex lock;
+    std::condition_variable cv;
+    std::map<uint32_t, Entries> decoded;
+    uint32_t next = first;
+    uint32_t visiting = first;
+    bool stopping = false;
+    uint32_t lookahead = 2 * num_threads;
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> l(lock);
+        while (true) {
+            cv.wait(l, [&]{ return stopping || next > last || next - visiting < lookahead; });
+            if (stopping || next > last) return;
+            uint32_t i = next++;
+            l.unlock();
+            Entries entries = read_chunk(i);
+            l.lock();
+            decoded[i] = std::move(entries);
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < num_threads; t++) {
+        threads.emplace_back(worker);
+    }
+
+    for (uint32_t i = first; i <= last; i++) {
+        Entries entries;
+        {
+            std::unique_lock<std::mutex> l(lock);
+            cv.wait(l, [&]{ return decoded.count(i) > 0; });
+            entries = std::move(decoded[i]);
+            decoded.erase(i);
+            visiting = i + 1;
+            cv.notify_all();
+        }
+        if (!visit(entries)) break;
+    }
+
+    {
+        std::lock_guard<std::mutex> l(lock);
+        stopping = true;
+    }
+    cv.notify_all();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
 //---------------------------------------------------------------------
 // These functions are accessible to C plugins/files
 // And declared in plog-cc-bridge.h
@@ -512,10 +1115,10 @@ void pandalog_cc_close(){
 // and write it to the log
 void pandalog_write_packed(size_t entry_size, unsigned char* buf){
     
-    std::unique_ptr<panda::LogEntry> ple (new panda::LogEntry());
+    panda::LogEntry *ple = globalLog.new_entry();
     ple->ParseFromArray(buf, entry_size);
     
-    globalLog.write_entry(std::move(ple));
+    globalLog.write_entry(ple);
 }
 
 // Pack an entry into binary protobuf data
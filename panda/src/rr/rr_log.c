@@ -35,6 +35,7 @@
 #include <sys/resource.h>
 #include <sys/time.h>
 #include <unistd.h>
+#include <sys/wait.h>
 
 #include <libgen.h>
 
@@ -1088,6 +1089,8 @@ void rr_replay_skipped_calls_internal(RR_callsite_id call_site)
         } else {
 
             RR_skipped_call_args args = current_item->variant.call_args;
+            // DMA and the like change memory between two instructions
+            panda_mem_cache_invalidate();
             switch (args.kind) {
             case RR_CALL_CPU_MEM_RW: {
                 cpu_physical_memory_rw(args.variant.cpu_mem_rw_args.addr,
@@ -1322,6 +1325,14 @@ static inline void rr_get_snapshot_file_name(char* rr_name, char* rr_path,
              rr_name);
 }
 
+static inline void rr_get_ram_image_file_name(char* rr_name, char* rr_path,
+                                              char* file_name,
+                                              size_t file_name_len)
+{
+    rr_assert(rr_name != NULL && rr_path != NULL);
+    snprintf(file_name, file_name_len, "%s/%s-rr-ram", rr_path, rr_name);
+}
+
 static inline void rr_get_nondet_log_file_name(char* rr_name, char* rr_path,
                                                char* file_name,
                                                size_t file_name_len)
@@ -1417,6 +1428,120 @@ void hmp_end_replay(Monitor* mon, const QDict* qdict)
 
 static time_t rr_start_time;
 
+int rr_record_bg_snapshot = 0;
+int rr_record_ram_image = 0;
+int rr_replay_ram_image = 0;
+
+#ifdef CONFIG_SOFTMMU
+static pid_t rr_snapshot_pid = -1;
+
+// With no_pages_id, RAM is left out of the snapshot, which records that
+// ID in its place.
+static int rr_write_snapshot_file(const char *name,
+                                  const QemuUUID *no_pages_id)
+{
+    Error* err = NULL;
+    QIOChannelFile* ioc =
+        qio_channel_file_new_path(name, O_WRONLY | O_CREAT | O_TRUNC, 0660,
+                                  NULL);
+    QEMUFile* snp = qemu_fopen_channel_output(QIO_CHANNEL(ioc));
+    ram_save_skip_pages = no_pages_id != NULL;
+    if (no_pages_id != NULL) {
+        ram_no_pages_id = *no_pages_id;
+    }
+    int ret = qemu_savevm_state(snp, &err);
+    ram_save_skip_pages = false;
+    qemu_fclose(snp);
+    return ret;
+}
+
+static int rr_write_snapshot(const char *name, const char *ram_image)
+{
+    QemuUUID id;
+    int ret;
+
+    if (ram_image == NULL || !rr_ram_image_supported()) {
+        return rr_write_snapshot_file(name, NULL);
+    }
+    // RAM goes into the image, which replays map lazily, and the snapshot
+    // only has the list of RAM blocks, and the ID of the image.
+    qemu_uuid_generate(&id);
+    ret = rr_write_snapshot_file(name, &id);
+    if (ret >= 0 && rr_ram_image_write(ram_image, name, &id) != 0) {
+        printf("Failed to write RAM image %s, saving RAM in the snapshot\n",
+               ram_image);
+        ret = rr_write_snapshot_file(name, NULL);
+    }
+    return ret;
+}
+
+#ifdef MADV_DOFORK
+static int rr_ram_is_shared(const char *block_name, void *host_addr,
+                            ram_addr_t offset, ram_addr_t length, void *opaque)
+{
+    ram_addr_t block_offset;
+    RAMBlock *rb = qemu_ram_block_from_host(host_addr, false, &block_offset);
+    return rb != NULL && qemu_ram_is_shared(rb);
+}
+
+static int rr_ram_madvise(const char *block_name, void *host_addr,
+                          ram_addr_t offset, ram_addr_t length, void *opaque)
+{
+    qemu_madvise(host_addr, length, *(int *)opaque);
+    return 0;
+}
+
+static bool rr_save_snapshot_in_child(const char *name, const char *ram_image)
+{
+    int advice = MADV_DOFORK;
+    pid_t pid;
+
+    // Shared RAM isn't copied on write, so the child would see the guest's
+    // later writes to it.
+    if (qemu_ram_foreach_block(rr_ram_is_shared, NULL)) {
+        return false;
+    }
+    // Guest RAM is normally left out of child processes (see ram_block_add).
+    qemu_ram_foreach_block(rr_ram_madvise, &advice);
+    pid = fork();
+    if (pid == 0) {
+        _exit(rr_write_snapshot(name, ram_image) < 0 ? 1 : 0);
+    }
+    advice = MADV_DONTFORK;
+    qemu_ram_foreach_block(rr_ram_madvise, &advice);
+    if (pid < 0) {
+        return false;
+    }
+    rr_snapshot_pid = pid;
+    return true;
+}
+#endif
+
+int rr_save_snapshot(const char *name, const char *ram_image, bool background)
+{
+    rr_snapshot_wait();
+#ifdef MADV_DOFORK
+    if (background && rr_save_snapshot_in_child(name, ram_image)) {
+        return 0;
+    }
+#endif
+    return rr_write_snapshot(name, ram_image);
+}
+
+int rr_snapshot_wait(void)
+{
+    int status = 0;
+
+    if (rr_snapshot_pid < 0) {
+        return 0;
+    }
+    while (waitpid(rr_snapshot_pid, &status, 0) < 0 && errno == EINTR) {
+    }
+    rr_snapshot_pid = -1;
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : -1;
+}
+#endif // CONFIG_SOFTMMU
+
 // mz file_name_full should be full path to desired record/replay log file
 int rr_do_begin_record(const char* file_name_full, CPUState* cpu_state)
 {
@@ -1426,7 +1551,6 @@ int rr_do_begin_record(const char* file_name_full, CPUState* cpu_state)
 #endif
 
 #ifdef CONFIG_SOFTMMU
-    Error* err = NULL;
     char name_buf[1024];
 
     // decompose file_name_base into path & file.
@@ -1449,12 +1573,16 @@ int rr_do_begin_record(const char* file_name_full, CPUState* cpu_state)
     // write PANDA memory snapshot
     global_state_store_running(); // force running state
     rr_get_snapshot_file_name(rr_name, rr_path, name_buf, sizeof(name_buf));
-    printf("writing snapshot:\t%s\n", name_buf);
-    QIOChannelFile* ioc =
-        qio_channel_file_new_path(name_buf, O_WRONLY | O_CREAT, 0660, NULL);
-    QEMUFile* snp = qemu_fopen_channel_output(QIO_CHANNEL(ioc));
-    snapshot_ret = qemu_savevm_state(snp, &err);
-    qemu_fclose(snp);
+    char image_buf[1024];
+    rr_get_ram_image_file_name(rr_name, rr_path, image_buf, sizeof(image_buf));
+    printf("writing snapshot:\t%s%s\n", name_buf,
+           rr_record_bg_snapshot ? " (in the background)" : "");
+    if (rr_record_ram_image) {
+        printf("writing RAM image:\t%s\n", image_buf);
+    }
+    snapshot_ret = rr_save_snapshot(name_buf,
+                                    rr_record_ram_image ? image_buf : NULL,
+                                    rr_record_bg_snapshot);
     // log_all_cpu_states();
 
     // save the time so we can report how long record takes
@@ -1502,6 +1630,11 @@ void rr_do_end_record(void)
 
     rr_destroy_log();
 
+    // the recording can't be replayed before its snapshot is complete
+    if (rr_snapshot_wait() != 0) {
+        printf("Error writing the snapshot of the recording.\n");
+    }
+
     g_free(rr_path_base);
     g_free(rr_name_base);
 
@@ -1562,10 +1695,32 @@ int rr_do_begin_replay(const char* file_name_full, CPUState* cpu_state)
     }
     QEMUFile* snp = qemu_fopen_channel_input(QIO_CHANNEL(ioc));
 
+    // If there's a RAM image, guest RAM is mapped from it instead of being
+    // copied out of the snapshot. That is either a cache of the snapshot's
+    // RAM, or, if the snapshot has none, the image recorded with it.
+    char image_buf[1024];
+    rr_get_ram_image_file_name(rr_name, rr_path, image_buf, sizeof(image_buf));
+    RRRamImageKind image = rr_ram_image_probe(image_buf, name_buf);
+    bool use_image = false;
+
     qemu_system_reset(VMRESET_SILENT);
+    // Map it before loading the snapshot, whose device load hooks read guest
+    // RAM (virtio_load reads the rings, for one).
+    if (image != RR_RAM_IMAGE_NONE) {
+        printf("mapping RAM image:\t%s\n", image_buf);
+        use_image = rr_ram_image_map(image_buf, name_buf) == 0;
+        if (!use_image) {
+            printf("... it doesn't match the guest\n");
+        }
+    }
     MigrationIncomingState* mis = migration_incoming_get_current();
     mis->from_src_file = snp;
+    // Should the snapshot have RAM after all, a recorded image is stale and
+    // its pages are overwritten.
+    ram_load_discard_pages = use_image && image == RR_RAM_IMAGE_CACHE;
+    ram_load_no_pages = false;
     snapshot_ret = qemu_loadvm_state(snp);
+    ram_load_discard_pages = false;
     qemu_fclose(snp);
     migration_incoming_state_destroy();
 
@@ -1573,7 +1728,36 @@ int rr_do_begin_replay(const char* file_name_full, CPUState* cpu_state)
         fprintf(stderr, "Failed to load vmstate\n");
         return snapshot_ret;
     }
+    if (ram_load_no_pages) {
+        // The image holds the only copy of guest RAM of the recording.
+        if (!use_image || image != RR_RAM_IMAGE_RECORDED ||
+            !rr_ram_image_matches_ram(image_buf, name_buf, &ram_no_pages_id)) {
+            fprintf(stderr, "The snapshot has no RAM, and the RAM image %s "
+                    "recorded with it is missing, isn't that image or "
+                    "doesn't match the guest\n", image_buf);
+            return -1;
+        }
+    } else if (use_image && image == RR_RAM_IMAGE_CACHE) {
+        if (!rr_ram_image_matches_ram(image_buf, name_buf, NULL)) {
+            fprintf(stderr, "RAM image %s doesn't match the guest, delete it "
+                    "and replay again\n", image_buf);
+            return -1;
+        }
+    } else if (rr_replay_ram_image) {
+        // Share the RAM we just loaded with later replays (and free ours).
+        printf("writing RAM image:\t%s\n", image_buf);
+        if (rr_ram_image_write(image_buf, name_buf, NULL) != 0 ||
+            rr_ram_image_map(image_buf, name_buf) != 0) {
+            printf("... failed, not sharing RAM\n");
+        }
+    }
     printf("... done.\n");
+
+    // guest memory and page tables were replaced
+    CPUState *cpu;
+    CPU_FOREACH(cpu) {
+        panda_vtlb_flush(cpu);
+    }
     // log_all_cpu_states();
 
     // save the time so we can report how long replay takes
@@ -0,0 +1,306 @@
+/*
+ * Guest RAM images for replay
+ *
+ * A RAM image is a raw copy of every RAM block of the guest as of the
+ * snapshot of a recording, stored next to it as <name>-rr-ram. Instead of
+ * copying RAM out of the snapshot, a replay maps the image over guest RAM,
+ * privately (copy-on-write). Pages are then only read from disk when the
+ * guest first touches them, and concurrent replays of the same recording
+ * share them in the page cache until they write to them.
+ *
+ * Images are either caches written by a replay from a full snapshot, tied
+ * to that snapshot file by its size and mtime, or written at record time
+ * in place of RAM in the snapshot (-record-ram-image). The latter are the
+ * only copy of guest RAM of the recording, so they are tied to the snapshot
+ * by a random ID saved in both, which survives copying the files around.
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include "qemu/osdep.h"
+#include "qemu/cutils.h"
+#include "qemu/error-report.h"
+#include "cpu.h"
+#include "exec/ram_addr.h"
+#include "qemu/uuid.h"
+
+#include "panda/rr/rr_log.h"
+
+#define RR_RAM_IMAGE_MAGIC "PANDARAM"
+#define RR_RAM_IMAGE_VERSION 2
+// Block data is aligned to this, which must be a multiple of the host page
+// size for it to be mapped.
+#define RR_RAM_IMAGE_ALIGN (64 * 1024)
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_blocks;
+    // identify the snapshot a cache goes with
+    uint64_t snapshot_size;
+    uint64_t snapshot_mtime_ns;
+    // recorded images only, zero otherwise
+    QemuUUID id;
+} RRRamImageHeader;
+
+typedef struct {
+    char idstr[256];
+    uint64_t length;
+    uint64_t offset;
+} RRRamImageBlock;
+
+static bool rr_ram_image_snapshot_id(const char *snapshot, uint64_t *size,
+                                     uint64_t *mtime_ns)
+{
+    struct stat st;
+
+    if (stat(snapshot, &st) != 0) {
+        return false;
+    }
+    *size = st.st_size;
+    *mtime_ns = st.st_mtim.tv_sec * 1000000000ULL + st.st_mtim.tv_nsec;
+    return true;
+}
+
+// Reads the header and block table of image fd. Returns the number of
+// blocks, or -1 if it is neither a recorded image nor a cache of snapshot.
+// Whether a recorded image goes with snapshot is only known once that is
+// loaded.
+static int rr_ram_image_read_header(int fd, const char *snapshot,
+                                    RRRamImageHeader *hdr,
+                                    RRRamImageBlock **blocks)
+{
+    uint64_t size, mtime_ns;
+    size_t len;
+
+    if (pread(fd, hdr, sizeof(*hdr), 0) != sizeof(*hdr) ||
+        memcmp(hdr->magic, RR_RAM_IMAGE_MAGIC, sizeof(hdr->magic)) != 0 ||
+        hdr->version != RR_RAM_IMAGE_VERSION) {
+        return -1;
+    }
+    if (qemu_uuid_is_null(&hdr->id) &&
+        (!rr_ram_image_snapshot_id(snapshot, &size, &mtime_ns) ||
+         hdr->snapshot_size != size || hdr->snapshot_mtime_ns != mtime_ns)) {
+        return -1;
+    }
+    len = hdr->num_blocks * sizeof(RRRamImageBlock);
+    *blocks = g_malloc(len);
+    if (pread(fd, *blocks, len, sizeof(*hdr)) != len) {
+        g_free(*blocks);
+        return -1;
+    }
+    return hdr->num_blocks;
+}
+
+RRRamImageKind rr_ram_image_probe(const char *path, const char *snapshot)
+{
+    RRRamImageHeader hdr;
+    RRRamImageBlock *blocks;
+    int fd;
+    int n;
+
+    if (!rr_ram_image_supported()) {
+        return RR_RAM_IMAGE_NONE;
+    }
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return RR_RAM_IMAGE_NONE;
+    }
+    n = rr_ram_image_read_header(fd, snapshot, &hdr, &blocks);
+    close(fd);
+    if (n < 0) {
+        return RR_RAM_IMAGE_NONE;
+    }
+    g_free(blocks);
+    return qemu_uuid_is_null(&hdr.id) ? RR_RAM_IMAGE_CACHE
+                                      : RR_RAM_IMAGE_RECORDED;
+}
+
+// Shared RAM can't be replaced by a private mapping.
+bool rr_ram_image_supported(void)
+{
+    RAMBlock *block;
+    bool ok = true;
+
+    rcu_read_lock();
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+        if (block->host == NULL || qemu_ram_is_shared(block)) {
+            ok = false;
+        }
+    }
+    rcu_read_unlock();
+    return ok;
+}
+
+int rr_ram_image_write(const char *path, const char *snapshot,
+                       const QemuUUID *id)
+{
+    RRRamImageHeader hdr = { RR_RAM_IMAGE_MAGIC, RR_RAM_IMAGE_VERSION };
+    GArray *blocks = g_array_new(false, true, sizeof(RRRamImageBlock));
+    char *tmp = g_strdup_printf("%s.%d.tmp", path, getpid());
+    uint64_t offset;
+    RAMBlock *block;
+    int ret = -1;
+    int fd;
+
+    if (!rr_ram_image_supported()) {
+        goto out;
+    }
+    if (id != NULL) {
+        hdr.id = *id;
+    } else if (!rr_ram_image_snapshot_id(snapshot, &hdr.snapshot_size,
+                                         &hdr.snapshot_mtime_ns)) {
+        goto out;
+    }
+    fd = open(tmp, O_WRONLY | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        goto out;
+    }
+
+    rcu_read_lock();
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+        RRRamImageBlock b = { .length = block->used_length };
+        pstrcpy(b.idstr, sizeof(b.idstr), block->idstr);
+        g_array_append_val(blocks, b);
+    }
+    hdr.num_blocks = blocks->len;
+    offset = ROUND_UP(sizeof(hdr) + blocks->len * sizeof(RRRamImageBlock),
+                      RR_RAM_IMAGE_ALIGN);
+    for (guint i = 0; i < blocks->len; i++) {
+        RRRamImageBlock *b = &g_array_index(blocks, RRRamImageBlock, i);
+        b->offset = offset;
+        offset = ROUND_UP(offset + b->length, RR_RAM_IMAGE_ALIGN);
+    }
+
+    if (ftruncate(fd, offset) != 0 ||
+        pwrite(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr) ||
+        pwrite(fd, blocks->data, blocks->len * sizeof(RRRamImageBlock),
+               sizeof(hdr)) != blocks->len * sizeof(RRRamImageBlock)) {
+        goto write_error;
+    }
+    // Zeroed parts of RAM are left as holes.
+    for (guint i = 0; i < blocks->len; i++) {
+        RRRamImageBlock *b = &g_array_index(blocks, RRRamImageBlock, i);
+        uint8_t *host = qemu_ram_block_by_name(b->idstr)->host;
+        for (uint64_t off = 0; off < b->length; off += RR_RAM_IMAGE_ALIGN) {
+            size_t l = MIN(RR_RAM_IMAGE_ALIGN, b->length - off);
+            if (!buffer_is_zero(host + off, l) &&
+                pwrite(fd, host + off, l, b->offset + off) != l) {
+                goto write_error;
+            }
+        }
+    }
+    ret = 0;
+
+write_error:
+    rcu_read_unlock();
+    close(fd);
+    // Another replay may have written it first; either copy is fine.
+    if (ret == 0 && rename(tmp, path) != 0) {
+        ret = -1;
+    }
+    if (ret != 0) {
+        unlink(tmp);
+    }
+out:
+    g_array_free(blocks, true);
+    g_free(tmp);
+    return ret;
+}
+
+// Checks that blocks cover all of RAM. The snapshot may yet resize
+// resizeable blocks, so unless exact, blocks only have to fit in them.
+static bool rr_ram_image_check_blocks(RRRamImageBlock *blocks, int n,
+                                      bool exact)
+{
+    RAMBlock *block;
+    int num_ram_blocks = 0;
+
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+        num_ram_blocks++;
+    }
+    for (int i = 0; i < n; i++) {
+        blocks[i].idstr[sizeof(blocks[i].idstr) - 1] = 0;
+        block = qemu_ram_block_by_name(blocks[i].idstr);
+        if (block == NULL || blocks[i].offset % RR_RAM_IMAGE_ALIGN != 0 ||
+            (exact ? block->used_length != blocks[i].length
+                   : block->max_length < blocks[i].length)) {
+            return false;
+        }
+    }
+    return n == num_ram_blocks;
+}
+
+bool rr_ram_image_matches_ram(const char *path, const char *snapshot,
+                              const QemuUUID *id)
+{
+    RRRamImageHeader hdr;
+    RRRamImageBlock *blocks;
+    bool ok;
+    int fd, n;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    n = rr_ram_image_read_header(fd, snapshot, &hdr, &blocks);
+    close(fd);
+    if (n < 0) {
+        return false;
+    }
+    if (id != NULL && memcmp(&hdr.id, id, sizeof(*id)) != 0) {
+        g_free(blocks);
+        return false;
+    }
+    rcu_read_lock();
+    ok = rr_ram_image_check_blocks(blocks, n, true);
+    rcu_read_unlock();
+    g_free(blocks);
+    return ok;
+}
+
+int rr_ram_image_map(const char *path, const char *snapshot)
+{
+    RRRamImageHeader hdr;
+    RRRamImageBlock *blocks = NULL;
+    RAMBlock *block;
+    int ret = -1;
+    int fd, n;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    n = rr_ram_image_read_header(fd, snapshot, &hdr, &blocks);
+    if (n < 0 || !rr_ram_image_supported()) {
+        goto out;
+    }
+
+    // Check that the image covers all of RAM before replacing any of it.
+    rcu_read_lock();
+    if (!rr_ram_image_check_blocks(blocks, n, false)) {
+        rcu_read_unlock();
+        goto out;
+    }
+
+    for (int i = 0; i < n; i++) {
+        block = qemu_ram_block_by_name(blocks[i].idstr);
+        if (mmap(block->host, blocks[i].length, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_FIXED, fd, blocks[i].offset) == MAP_FAILED) {
+            // part of RAM may already have been replaced
+            error_report("Failed to map RAM block %s from %s: %s",
+                         blocks[i].idstr, path, strerror(errno));
+            abort();
+        }
+        // as in ram_block_add
+        qemu_madvise(block->host, blocks[i].length, QEMU_MADV_DONTFORK);
+    }
+    rcu_read_unlock();
+    ret = 0;
+
+out:
+    g_free(blocks);
+    close(fd);
+    return ret;
+}
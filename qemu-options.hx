@@ -4157,16 +4157,34 @@ DEF("llvm", 0, QEMU_OPTION_execute_llvm,
     "-llvm           execute code using LLVM JIT\n", QEMU_ARCH_ALL)
 DEF("generate-llvm", 0, QEMU_OPTION_generate_llvm,
     "-generate-llvm  translate code into LLVM but don't execute it\n", QEMU_ARCH_ALL)
+DEF("llvm-tiered", 0, QEMU_OPTION_llvm_tiered,
+    "-llvm-tiered    when executing LLVM code, JIT it quickly first and\n"
+    "                optimize hot blocks in the background\n", QEMU_ARCH_ALL)
 #endif
 
 DEF("record-from", HAS_ARG, QEMU_OPTION_record_from,
     "-record-from <snapshot>:<record-name>\n"
     "                load snapshot <snapshot> and begin recording\n", QEMU_ARCH_ALL)
 
+DEF("record-bg-snapshot", 0, QEMU_OPTION_record_bg_snapshot,
+    "-record-bg-snapshot\n"
+    "                write the snapshot at the start of a recording from a\n"
+    "                copy-on-write copy of the VM, without pausing the guest\n", QEMU_ARCH_ALL)
+
+DEF("record-ram-image", 0, QEMU_OPTION_record_ram_image,
+    "-record-ram-image\n"
+    "                write guest RAM to a separate image at the start of a\n"
+    "                recording, which replays map on demand\n", QEMU_ARCH_ALL)
+
 DEF("replay", HAS_ARG, QEMU_OPTION_replay,
     "-replay </path/to/snapshot-prefix>\n"
     "                replay the recording that starts at <snapshot>\n", QEMU_ARCH_ALL)
 
+DEF("replay-ram-image", 0, QEMU_OPTION_replay_ram_image,
+    "-replay-ram-image\n"
+    "                map guest RAM copy-on-write from an image of the snapshot,\n"
+    "                shared by all replays of the recording, creating it if needed\n", QEMU_ARCH_ALL)
+
 DEF("pandalog", HAS_ARG, QEMU_OPTION_pandalog,
     "-pandalog <filename>\n"
     "                enable panda logging to file\n", QEMU_ARCH_ALL)
@@ -879,6 +879,7 @@ static TranslationBlock *tb_alloc(target_ulong pc)
     tb->pc = pc;
     tb->cflags = 0;
     tb->invalid = false;
+    tb->panda_end_type = 0;
 #ifdef CONFIG_LLVM
     tcg_llvm_tb_alloc(tb);
 #endif
@@ -1778,6 +1779,11 @@ static TranslationBlock *tb_find_pc(uintptr_t tc_ptr)
             if (tb->llvm_asm_ptr
                     && tc_ptr >= (uintptr_t)tb->llvm_asm_ptr
                     && tc_ptr <  (uintptr_t)tb->llvm_tc_end) {
+                /* the code of a trace runs several blocks, the one running
+                 * is the last one entered */
+                if (tb->llvm_trace_len > 1 && tcg_llvm_runtime.last_tb) {
+                    return tcg_llvm_runtime.last_tb;
+                }
                 return tb;
             }
         }
@@ -176,6 +176,7 @@ struct TCGLLVMTranslator;
 extern struct TCGLLVMTranslator* tcg_llvm_translator;
 extern int generate_llvm;
 extern int execute_llvm;
+extern int llvm_tiered;
 extern const int has_llvm_engine;
 
 void tcg_llvm_initialize(void);
@@ -4234,11 +4235,17 @@ int main_aux(int argc, char **argv, char **envp, PandaMainMode pmm)
                 }
                 generate_llvm = 1;
                 break;
+            case QEMU_OPTION_llvm_tiered:
+                llvm_tiered = 1;
+                break;
 #endif
             case QEMU_OPTION_replay:
                 display_type = DT_NONE;
                 replay_name = optarg;
                 break;
+            case QEMU_OPTION_replay_ram_image:
+                rr_replay_ram_image = 1;
+                break;
             case QEMU_OPTION_pandalog:
                 pandalog = 1;
                 pandalog_cc_init_write(optarg);
@@ -4247,6 +4254,12 @@ int main_aux(int argc, char **argv, char **envp, PandaMainMode pmm)
             case QEMU_OPTION_record_from:
                 record_name = optarg;
                 break;
+            case QEMU_OPTION_record_bg_snapshot:
+                rr_record_bg_snapshot = 1;
+                break;
+            case QEMU_OPTION_record_ram_image:
+                rr_record_ram_image = 1;
+                break;
             case QEMU_OPTION_panda_arg:
                 // panda_add_arg() currently always return true
                 assert(panda_add_arg(NULL, optarg));